@@ -226,9 +226,11 @@ namespace BoSSS.Foundation.Grid.Classic {
 
 
         /// <summary>
-        /// Clears all internal references for this object, to make sure that any attempt to use it leads to an exception.
+        /// Clears all internal references for this object, to make sure that any attempt to use it leads to an exception;
+        /// this is a collective call (on all MPI processes), since it frees the communicator of the <see cref="Transceiver"/>s on this grid.
         /// </summary
         public void Invalidate() {
+            Transceiver.ReleaseNeighborhoodComm(this.m_Parallel);
             this.m_Cells = null;
             this.m_Edges = null;
             this.m_GlobalNodes = null;
@@ -16,7 +16,8 @@ limitations under the License.
 
 using System;
 using System.Collections.Generic;
-using System.Runtime.InteropServices;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
 using System.Linq;
 
 using MPI.Wrappers;
@@ -30,6 +31,13 @@ namespace BoSSS.Foundation.Comm {
     /// and receives field coordinates from other processes and putts the received values
     /// into the corresponding memory for external cells.
     /// </summary>
+    /// <remarks>
+    /// All fields are packed into one contiguous buffer, and each exchange is a single
+    /// neighborhood collective (see <see cref="NeighborhoodComm.IAlltoallv"/>) on a graph communicator,
+    /// which is created once per grid.
+    /// The number of items per cell may change between exchanges (e.g. for XDG fields), therefore
+    /// the counts are determined for each exchange.
+    /// </remarks>
     public class Transceiver {
 
         /// <summary>
@@ -49,7 +57,7 @@ namespace BoSSS.Foundation.Comm {
 
 
         /// <summary>
-        /// constructor
+        /// constructor; this is a collective call (on all MPI processes), see <see cref="Transceiver(ICollection{DGField})"/>
         /// </summary>
         /// <param name="TRXfields">
         /// fields which should be exchanged
@@ -59,7 +67,9 @@ namespace BoSSS.Foundation.Comm {
 
 
         /// <summary>
-        /// constructor
+        /// constructor; this is a collective call (on all MPI processes):
+        /// the first transceiver on a grid creates the graph communicator for its neighbour processes
+        /// (see <see cref="ReleaseNeighborhoodComm"/>).
         /// </summary>
         /// <param name="TRXfields">
         /// fields which should be exchanged
@@ -85,11 +95,11 @@ namespace BoSSS.Foundation.Comm {
             // alloc some arrays
             // =================
 
-            m_ReceiveBuffers = new double[m_Size][];
-            m_SendBuffers = new double[m_Size][];
-            m_ReceiveBufferPin = new GCHandle[m_parallel.ProcessesToReceiveFrom.Length];
-            m_SendBufferPin = new GCHandle[m_parallel.ProcessesToSendTo.Length];
-            m_Requests = new MPI_Request[m_parallel.ProcessesToSendTo.Length + m_parallel.ProcessesToReceiveFrom.Length];
+            m_SendBuffer = new double[0];
+            m_ReceiveBuffer = new double[0];
+            m_SendCounts = new int[m_parallel.ProcessesToSendTo.Length];
+            m_ReceiveCounts = new int[m_parallel.ProcessesToReceiveFrom.Length];
+            m_NbComm = GetNeighborhoodComm(m_parallel);
 
             // collect fields
             // ==============
@@ -126,49 +136,112 @@ namespace BoSSS.Foundation.Comm {
 
 
 
-        int FillSendBuffer(int p) {
-            int i0 = 0;
+        /// <summary>
+        /// graph communicators for the neighbours of a grid (<see cref="IParallelization.ProcessesToReceiveFrom"/>,
+        /// <see cref="IParallelization.ProcessesToSendTo"/>), shared by all transceivers on the same grid;
+        /// (since the creation of the communicator is collective, it is created in the constructor of the first transceiver
+        /// on the respective grid, which is called on all processes.)
+        /// </summary>
+        static ConditionalWeakTable<IParallelization, NeighborhoodComm> m_NeighborhoodComms = new ConditionalWeakTable<IParallelization, NeighborhoodComm>();
+
+        /// <summary>
+        /// all entries of <see cref="m_NeighborhoodComms"/>, in order of creation (which is the same on all processes);
+        /// the grid is only weakly referenced, so that communicators of grids which have been dropped can still be freed.
+        /// </summary>
+        static List<Tuple<WeakReference, NeighborhoodComm>> m_AllNeighborhoodComms = new List<Tuple<WeakReference, NeighborhoodComm>>();
+
+        static NeighborhoodComm GetNeighborhoodComm(IParallelization para) {
+            NeighborhoodComm nbComm;
+            if (m_NeighborhoodComms.TryGetValue(para, out nbComm))
+                return nbComm;
+
+            // a new grid: a good point to free the communicators of grids which were dropped without 'GridData.Invalidate'
+            FreeOrphanedNeighborhoodComms();
 
+            nbComm = new NeighborhoodComm(csMPI.Raw._COMM.WORLD, para.ProcessesToReceiveFrom, para.ProcessesToSendTo);
+            m_NeighborhoodComms.Add(para, nbComm);
+            m_AllNeighborhoodComms.Add(Tuple.Create(new WeakReference(para), nbComm));
+            return nbComm;
+        }
+
+        /// <summary>
+        /// Frees the communicators whose grid has been garbage-collected on all processes; collective.
+        /// (Freeing is collective, but the garbage collector runs independently on each process,
+        /// so the processes first agree on the entries to free.)
+        /// </summary>
+        static void FreeOrphanedNeighborhoodComms() {
+            int N = m_AllNeighborhoodComms.Count;
+            if (N <= 0)
+                return;
+
+            int[] alive = new int[N];
+            for (int i = 0; i < N; i++)
+                alive[i] = m_AllNeighborhoodComms[i].Item1.IsAlive ? 1 : 0;
+            alive = alive.MPIMax();
+
+            for (int i = N - 1; i >= 0; i--) {
+                if (alive[i] == 0) {
+                    m_AllNeighborhoodComms[i].Item2.Dispose();
+                    m_AllNeighborhoodComms.RemoveAt(i);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Frees the graph communicator of the grid with parallelization <paramref name="para"/>, if one was created;
+        /// this is a collective call (on all MPI processes).
+        /// Transceivers on that grid must not be used afterwards; it is called by <see cref="BoSSS.Foundation.Grid.Classic.GridData.Invalidate"/>.
+        /// Communicators of grids which are dropped without this call are freed when the next grid creates its communicator.
+        /// </summary>
+        public static void ReleaseNeighborhoodComm(IParallelization para) {
+            NeighborhoodComm nbComm;
+            if (para != null && m_NeighborhoodComms.TryGetValue(para, out nbComm)) {
+                m_NeighborhoodComms.Remove(para);
+                m_AllNeighborhoodComms.RemoveAll(t => object.ReferenceEquals(t.Item2, nbComm));
+                nbComm.Dispose();
+            }
+        }
+
+
+        /// <summary>
+        /// packs the data of all fields for process <paramref name="p"/> into <see cref="m_SendBuffer"/>, starting at <paramref name="i0"/>
+        /// </summary>
+        int FillSendBuffer(int p, int i0) {
             int TotLen = 0;
-            foreach(DGField fld in m_TRXFields) TotLen += fld.GetMPISendBufferSize(p);
-            if (m_SendBuffers[p] == null)
-                m_SendBuffers[p] = new double[TotLen];
-            if (m_SendBuffers[p].Length < TotLen)
-                m_SendBuffers[p] = new double[TotLen];
-            
             for (int f = 0; f < m_TRXFields.Count; f++) {
                 DGField fld = m_TRXFields[f];
                 int Len = fld.GetMPISendBufferSize(p);
-                fld.FillMPISendBuffer(p, m_SendBuffers[p], i0);
-                i0 += Len;
+                fld.FillMPISendBuffer(p, m_SendBuffer, i0 + TotLen);
+                TotLen += Len;
             }
 
             return TotLen;
         }
 
+        int GetSendBufferLen(int p) {
+            int TotLen = 0;
+            foreach (DGField fld in m_TRXFields) TotLen += fld.GetMPISendBufferSize(p);
+            return TotLen;
+        }
 
         int GetReceiveBufferLen(int p) {
             int TotLen = 0;
             foreach (DGField fld in m_TRXFields) TotLen += fld.GetMPIRecvBufferSize(p);
-            
-            if (m_ReceiveBuffers[p] == null)
-                m_ReceiveBuffers[p] = new double[TotLen];
-            if (m_ReceiveBuffers[p].Length < TotLen)
-                m_ReceiveBuffers[p] = new double[TotLen];
-
             return TotLen;
         }
 
-        int WriteReceivedData(int p) {
-
-            int i0 = 0;
+        /// <summary>
+        /// unpacks the data of all fields from process <paramref name="p"/>, starting at <paramref name="i0"/> in <see cref="m_ReceiveBuffer"/>
+        /// </summary>
+        int WriteReceivedData(int p, int i0) {
+            int TotLen = 0;
             for (int f = 0; f < m_TRXFields.Count; f++) {
                 DGField fld = m_TRXFields[f];
-                int Len = fld.CopyFromMPIrecvBuffer(p, m_ReceiveBuffers[p],i0);
-                i0 += Len;
+                int Len = fld.CopyFromMPIrecvBuffer(p, m_ReceiveBuffer, i0 + TotLen);
+                TotLen += Len;
             }
 
-            return i0;
+            return TotLen;
         }
 
 
@@ -179,15 +252,29 @@ namespace BoSSS.Foundation.Comm {
         List<DGField> m_TRXFields = new List<DGField>();
 
 
-        double[][] m_SendBuffers;
+        /// <summary>
+        /// send data for all processes in <see cref="IParallelization.ProcessesToSendTo"/>, one after another
+        /// </summary>
+        double[] m_SendBuffer;
+
+        /// <summary>
+        /// received data from all processes in <see cref="IParallelization.ProcessesToReceiveFrom"/>, one after another
+        /// </summary>
+        double[] m_ReceiveBuffer;
+
+        /// <summary>
+        /// index correlates with <see cref="IParallelization.ProcessesToSendTo"/>
+        /// </summary>
+        int[] m_SendCounts;
 
-        double[][] m_ReceiveBuffers;
+        /// <summary>
+        /// index correlates with <see cref="IParallelization.ProcessesToReceiveFrom"/>
+        /// </summary>
+        int[] m_ReceiveCounts;
 
-        GCHandle[] m_SendBufferPin;
-        
-        GCHandle[] m_ReceiveBufferPin;
+        NeighborhoodComm m_NbComm;
 
-        MPI_Request[] m_Requests;
+        MPIPendingRequest m_Pending;
 
         bool started = false;
 
@@ -203,44 +290,44 @@ namespace BoSSS.Foundation.Comm {
 
             if (m_Size == 1) return; // nothing to communicate
 
-            // start sending
-            // =============
-            int[] sndProc;
+            // fill send buffer
+            // ================
             {
-                sndProc = m_parallel.ProcessesToSendTo;
+                int[] sndProc = m_parallel.ProcessesToSendTo;
 
+                int TotLen = 0;
                 for (int i = 0; i < sndProc.Length; i++) {
-                    int proc = sndProc[i];
-
-                    int BufLen = FillSendBuffer(proc);
+                    m_SendCounts[i] = GetSendBufferLen(sndProc[i]);
+                    TotLen += m_SendCounts[i];
+                }
+                if (m_SendBuffer.Length < TotLen)
+                    m_SendBuffer = new double[TotLen];
 
-                    m_SendBufferPin[i] = GCHandle.Alloc(m_SendBuffers[proc],GCHandleType.Pinned);
-                    csMPI.Raw.Issend(Marshal.UnsafeAddrOfPinnedArrayElement(m_SendBuffers[proc], 0),
-                        BufLen, csMPI.Raw._DATATYPE.DOUBLE, proc,
-                        42 + m_MyRank,
-                        csMPI.Raw._COMM.WORLD,
-                        out m_Requests[i]);
+                int i0 = 0;
+                for (int i = 0; i < sndProc.Length; i++) {
+                    int BufLen = FillSendBuffer(sndProc[i], i0);
+                    Debug.Assert(BufLen == m_SendCounts[i]);
+                    i0 += BufLen;
                 }
             }
 
-            // init receiving
+            // receive buffer
             // ==============
             {
                 int[] rcvProc = m_parallel.ProcessesToReceiveFrom;
 
+                int TotLen = 0;
                 for (int i = 0; i < rcvProc.Length; i++) {
-                    int proc = rcvProc[i];
-
-                    int BufLen = GetReceiveBufferLen(proc);
-
-                    m_ReceiveBufferPin[i] = GCHandle.Alloc(m_ReceiveBuffers[proc], GCHandleType.Pinned);
-                    csMPI.Raw.Irecv(Marshal.UnsafeAddrOfPinnedArrayElement(m_ReceiveBuffers[proc], 0),
-                        BufLen, csMPI.Raw._DATATYPE.DOUBLE, proc,
-                        42 + proc,
-                        csMPI.Raw._COMM.WORLD,
-                        out m_Requests[i + sndProc.Length]);
+                    m_ReceiveCounts[i] = GetReceiveBufferLen(rcvProc[i]);
+                    TotLen += m_ReceiveCounts[i];
                 }
+                if (m_ReceiveBuffer.Length < TotLen)
+                    m_ReceiveBuffer = new double[TotLen];
             }
+
+            // start exchange
+            // ==============
+            m_Pending = m_NbComm.IAlltoallv(m_SendBuffer, m_SendCounts, m_ReceiveBuffer, m_ReceiveCounts);
         }
 
         /// <summary>
@@ -255,20 +342,15 @@ namespace BoSSS.Foundation.Comm {
            
             if (m_Size == 1) return; // nothing to communicate
 
-            int[] sndPrc = m_parallel.ProcessesToSendTo;
-            int[] rcvPrc = m_parallel.ProcessesToReceiveFrom;
+            m_Pending.Wait();
+            m_Pending = null;
 
-            int index;
-            MPI_Status status;
-            for (int i = 0; i < (sndPrc.Length + rcvPrc.Length); i++) {
-                csMPI.Raw.Waitany(m_Requests.Length, m_Requests, out index, out status);
-                if (index < sndPrc.Length) {
-                    m_SendBufferPin[index].Free();
-                } else {
-                    index -= sndPrc.Length;
-                    m_ReceiveBufferPin[index].Free();
-                    WriteReceivedData(rcvPrc[index]);
-                }
+            int[] rcvPrc = m_parallel.ProcessesToReceiveFrom;
+            int i0 = 0;
+            for (int i = 0; i < rcvPrc.Length; i++) {
+                int Len = WriteReceivedData(rcvPrc[i], i0);
+                Debug.Assert(Len == m_ReceiveCounts[i]);
+                i0 += m_ReceiveCounts[i];
             }
         }
     }
@@ -39,7 +39,7 @@ namespace BoSSS.Solution.Multigrid {
     /// For each aggregation grid level, this mapping defines a bijection between variable index,
     /// DG mode and aggregation cell index and a unique index.
     /// </summary>
-    public class MultigridMapping : IBlockPartitioning {
+    public class MultigridMapping : IBlockPartitioning, IDisposable {
 
         /// <summary>
         /// Base grid on which the problem is defined.
@@ -910,5 +910,93 @@ namespace BoSSS.Solution.Multigrid {
         public int GetLocalLength(int proc) {
             return this.m_Partitioning.GetLocalLength(proc);
         }
+
+        HaloExchangePlan m_ExchangePlan;
+
+        int m_NoOfExternalEntries = -1;
+
+        /// <summary>
+        /// Persistent plan for the exchange of entries in external cells, used by <see cref="MPIexchange{T}"/> and <see cref="MPIexchangeInverse{T}"/>;
+        /// - send indices: local indices of the entries in the cells in <see cref="IParallelization.SendCommLists"/>
+        /// - receive indices: indices of the entries in external cells, minus <see cref="LocalLength"/>.
+        /// 
+        /// Created on first use, which must be collective (on all MPI processes);
+        /// released by <see cref="Dispose"/>.
+        /// </summary>
+        internal HaloExchangePlan ExchangePlan {
+            get {
+                if (m_ExchangePlan == null) {
+                    var Para = this.AggGrid.iParallel;
+                    int[] sndProc = Para.ProcessesToSendTo;
+                    int[] rcvProc = Para.ProcessesToReceiveFrom;
+                    int LocLen = this.LocalLength;
+
+                    int[][] SendIndices = new int[sndProc.Length][];
+                    for (int i = 0; i < sndProc.Length; i++) {
+                        var Idx = new List<int>();
+                        foreach (int jCell in Para.SendCommLists[sndProc[i]]) {
+                            AddIndices(Idx, jCell, 0);
+                        }
+                        SendIndices[i] = Idx.ToArray();
+                    }
+
+                    int[][] RecvIndices = new int[rcvProc.Length][];
+                    for (int i = 0; i < rcvProc.Length; i++) {
+                        var Idx = new List<int>();
+                        int J0 = Para.RcvCommListsInsertIndex[rcvProc[i]];
+                        int JE = Para.RcvCommListsNoOfItems[rcvProc[i]] + J0;
+                        for (int jCell = J0; jCell < JE; jCell++) {
+                            Debug.Assert(jCell >= this.LocalNoOfBlocks);
+                            AddIndices(Idx, jCell, -LocLen);
+                        }
+                        RecvIndices[i] = Idx.ToArray();
+                    }
+
+                    m_ExchangePlan = new HaloExchangePlan(csMPI.Raw._COMM.WORLD, sndProc, SendIndices, rcvProc, RecvIndices);
+                }
+                return m_ExchangePlan;
+            }
+        }
+
+        /// <summary>
+        /// Number of entries in external cells, i.e. length of <see cref="MPIexchange{T}.Vector_Ext"/>.
+        /// </summary>
+        internal int NoOfExternalEntries {
+            get {
+                if (m_NoOfExternalEntries < 0) {
+                    var Para = this.AggGrid.iParallel;
+                    int L = 0;
+                    foreach (int p in Para.ProcessesToReceiveFrom) {
+                        int J0 = Para.RcvCommListsInsertIndex[p];
+                        int JE = Para.RcvCommListsNoOfItems[p] + J0;
+                        for (int jCell = J0; jCell < JE; jCell++)
+                            L += this.GetLength(jCell);
+                    }
+                    m_NoOfExternalEntries = L;
+                }
+                return m_NoOfExternalEntries;
+            }
+        }
+
+        /// <summary>
+        /// Releases the MPI resources of the <see cref="ExchangePlan"/> (communicators, shared memory window);
+        /// this is a collective call (on all MPI processes).
+        /// The mapping remains usable, the plan is created again on its next use.
+        /// </summary>
+        public void Dispose() {
+            if (m_ExchangePlan != null) {
+                m_ExchangePlan.Dispose();
+                m_ExchangePlan = null;
+            }
+        }
+
+        void AddIndices(List<int> Idx, int jCell, int Offset) {
+            int N = this.GetLength(jCell);
+            if (N <= 0)
+                return;
+            int i0 = this.LocalUniqueIndex(0, jCell, 0) + Offset;
+            for (int n = 0; n < N; n++)
+                Idx.Add(i0 + n);
+        }
     }
 }
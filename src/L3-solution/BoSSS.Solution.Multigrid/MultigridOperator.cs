@@ -30,7 +30,7 @@ using ilPSP.Tracing;
 namespace BoSSS.Solution.Multigrid {
 
 
-    public partial class MultigridOperator {
+    public partial class MultigridOperator : IDisposable {
 
         /// <summary>
         /// DG coordinate mapping on the original grid/mesh.
@@ -513,6 +513,16 @@ namespace BoSSS.Solution.Multigrid {
             private set;
         }
 
+        /// <summary>
+        /// Releases the MPI resources of the mappings on this and all coarser levels (see <see cref="MultigridMapping.Dispose"/>);
+        /// this is a collective call (on all MPI processes).
+        /// </summary>
+        public void Dispose() {
+            if (this.CoarserLevel != null)
+                this.CoarserLevel.Dispose();
+            this.Mapping.Dispose();
+        }
+
         BlockMsrMatrix m_LeftChangeOfBasis;
 
         public BlockMsrMatrix LeftChangeOfBasis {
@@ -213,6 +213,8 @@ namespace BoSSS.Solution.Multigrid {
             double[] OpAffineRaw;
             this.m_AssembleMatrix(out OpMtxRaw, out OpAffineRaw, out MassMtxRaw, CurrentState.ToArray());
 
+            if(CurrentLin != null)
+                CurrentLin.Dispose();
             CurrentLin = new MultigridOperator(this.m_AggBasisSeq, this.ProblemMapping,
                 OpMtxRaw.CloneAs(), MassMtxRaw,
                 this.m_MultigridOperatorConfig);
@@ -1380,6 +1380,7 @@ namespace BoSSS.Solution.XdgTimestepping {
                             mgOperator.UseSolver(linearSolver, m_Stack_u[0], RHS);
                         }
                     }
+                    mgOperator.Dispose();
 
                     // 'revert' agglomeration
                     Debug.Assert(object.ReferenceEquals(m_CurrentAgglomeration.Tracker, m_LsTrk));
@@ -567,6 +567,7 @@ namespace BoSSS.Solution.XdgTimestepping {
 
                 // try to solve the saddle-point system.
                 mgOperator.UseSolver(linearSolver, m_CurrentState, RHS);
+                mgOperator.Dispose();
 
                 // 'revert' agglomeration
                 m_CurrentAgglomeration.Extrapolate(CurrentStateMapping);
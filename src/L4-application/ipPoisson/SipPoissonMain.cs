@@ -613,6 +613,7 @@ namespace BoSSS.Application.SipPoisson {
                         MultigridOp.UseSolver(solver, T2, RHSvec);
                         T.CoordinateVector.SetV(T2);
                     }
+                    MultigridOp.Dispose();
                     solverIteration.Stop();
                     Console.WriteLine("done. (" + solverIteration.Elapsed.TotalSeconds + " sec)");
 
@@ -0,0 +1,216 @@
+
+#include <stdio.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <mpi.h>
+
+#include <mono/jit/jit.h>
+#include <mono/metadata/assembly.h>
+#include <mono/metadata/debug-helpers.h>
+
+#define DECLARE_MONKEY
+#define DEFINE_MONKEY_INTERNALS
+#include "monkey.h"
+
+// Micro-benchmark for the call overhead of the C-binding:
+// compares the reflective 'mono_runtime_invoke' - path (which was used
+// by the binding before) against the cached unmanaged thunks which are
+// now resolved in 'InitBinding()'.
+// In addition, the copying 'ISparseSolver_Solve' is compared against the
+// zero-copy 'ISparseSolver_SolveInPlace' (wall time and managed memory
+// allocated per solve).
+
+// number of calls to measure
+#define NCALLS 1000000
+
+// number of solver calls to measure
+#define NSOLVES 100
+
+// local problem size for the solver benchmark
+#define NSOLVE 100000
+
+static double wtime() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + 1.0e-9*((double)ts.tv_nsec);
+}
+
+static MonoMethod* lookup(char* klassName, char* methDesc) {
+        MonoClass *klass;
+        MonoMethodDesc* desc_X;
+        MonoMethod* meth;
+
+        klass = mono_class_from_name (img, "ilPSP.ExternalBinding", klassName);
+        assert(klass);
+        desc_X = mono_method_desc_new (methDesc, 1);
+        assert(desc_X);
+        meth = mono_method_desc_search_in_class (desc_X, klass);
+        assert(meth);
+        mono_method_desc_free (desc_X);
+        return meth;
+}
+
+static void report(char* name, double tInvoke, double tThunk) {
+        printf("%-28s  invoke: %8.1f ns/call    thunk: %8.1f ns/call    speedup: %6.1f\n",
+               name, 1.0e9*tInvoke/NCALLS, 1.0e9*tThunk/NCALLS, tInvoke/tThunk);
+}
+
+static double allocatedBytes() {
+        double bytes;
+        int ierr;
+        Common_GetAllocatedBytes(&bytes,&ierr);
+        assert(ierr == 0);
+        return bytes;
+}
+
+static void reportSolve(char* name, double t, double bytes) {
+        printf("%-28s  %10.3f ms/solve    %14.0f bytes allocated/solve\n",
+               name, 1.0e3*t/NSOLVES, bytes/NSOLVES);
+}
+
+int main(int argc, char** argv) {
+        int k, ierr, i0, L, N, n, iRow;
+        int MtxRef, partRef, RefSolver, i, nnz;
+        int MPIrank;
+        double d, t0, tInvoke, tThunk, b0;
+        int *rowptr, *cols;
+        double *vals, *X, *rhs;
+        void* args[5];
+        MonoMethod* meth;
+
+        ilPSPinit();
+
+        MPI_Comm_rank(MPI_COMM_WORLD,&MPIrank);
+
+        L = 100; N = 100; n = 1;
+        MsrMatrix_New(&MtxRef,&L,&N,&n,&n,&ierr); assert(ierr == 0);
+        ISparseMatrix_GetRowPart(&MtxRef,&partRef,&ierr); assert(ierr == 0);
+
+        // Partition_GetI0: the smallest possible call
+        // -------------------------------------------
+        meth = lookup("Partition_", "ilPSP.ExternalBinding.Partition_:GetI0(int&,int&,int&)");
+        args[0] = &partRef; args[1] = &i0; args[2] = &ierr;
+        t0 = wtime();
+        for(k = 0; k < NCALLS; k++)
+                mono_runtime_invoke (meth, NULL, args, NULL);
+        tInvoke = wtime() - t0;
+
+        t0 = wtime();
+        for(k = 0; k < NCALLS; k++)
+                Partition_GetI0(&partRef,&i0,&ierr);
+        tThunk = wtime() - t0;
+        assert(ierr == 0);
+
+        if(MPIrank == 0)
+                report("Partition_GetI0", tInvoke, tThunk);
+
+        // IMutableMatrix_SetEntry: typical small call during assembly
+        // -----------------------------------------------------------
+        meth = lookup("IMutableMatrix_", "ilPSP.ExternalBinding.IMutableMatrix_:SetEntry(int&,int&,int&,double&,int&)");
+        d = 1.0;
+        args[0] = &MtxRef; args[1] = &iRow; args[2] = &iRow; args[3] = &d; args[4] = &ierr;
+        t0 = wtime();
+        for(k = 0; k < NCALLS; k++) {
+                iRow = i0 + (k % L);
+                mono_runtime_invoke (meth, NULL, args, NULL);
+        }
+        tInvoke = wtime() - t0;
+
+        t0 = wtime();
+        for(k = 0; k < NCALLS; k++) {
+                iRow = i0 + (k % L);
+                IMutableMatrix_SetEntry(&MtxRef,&iRow,&iRow,&d,&ierr);
+        }
+        tThunk = wtime() - t0;
+        assert(ierr == 0);
+
+        if(MPIrank == 0)
+                report("IMutableMatrix_SetEntry", tInvoke, tThunk);
+
+        Common_ReleaseObject(&partRef,&ierr);
+        Common_ReleaseObject(&MtxRef,&ierr);
+
+        // ISparseSolver_Solve vs. ISparseSolver_SolveInPlace
+        // --------------------------------------------------
+        // a (process-local) tridiagonal, diagonal dominant system,
+        // assembled in one call.
+        char solver[] = "<sparsesolver name=\"bench-solver\"> \
+                             <type>PCG</type> \
+                             <library>monkey</library> \
+                             <specific> \
+                                  <MaxIterations>5</MaxIterations> \
+                                  <ConvergenceType>Relative</ConvergenceType> \
+                                  <Tolerance>1.0e-30</Tolerance> \
+                                  <DevType>CPU</DevType> \
+                                  <MatrixType>CSR</MatrixType> \
+                             </specific> \
+                        </sparsesolver>";
+
+        L = NSOLVE;
+        MPI_Allreduce(&L,&N,1,MPI_INT,MPI_SUM,MPI_COMM_WORLD);
+        MsrMatrix_New(&MtxRef,&L,&N,&n,&n,&ierr); assert(ierr == 0);
+        ISparseMatrix_GetRowPart(&MtxRef,&partRef,&ierr); assert(ierr == 0);
+        Partition_GetI0(&partRef,&i0,&ierr); assert(ierr == 0);
+        Common_ReleaseObject(&partRef,&ierr);
+
+        rowptr = malloc(sizeof(int)*(L+1));
+        cols = malloc(sizeof(int)*3*L);
+        vals = malloc(sizeof(double)*3*L);
+        nnz = 0;
+        for(i = 0; i < L; i++) {
+                rowptr[i] = nnz;
+                if(i > 0) { cols[nnz] = i0 + i - 1; vals[nnz] = -1.0; nnz++; }
+                cols[nnz] = i0 + i; vals[nnz] = 4.0; nnz++;
+                if(i < L - 1) { cols[nnz] = i0 + i + 1; vals[nnz] = -1.0; nnz++; }
+        }
+        rowptr[L] = nnz;
+        IMutableMatrix_SetRowsCSR(&MtxRef,&i0,&L,rowptr,cols,vals,&ierr); assert(ierr == 0);
+        free(rowptr); free(cols); free(vals);
+
+        ISparseSolver_FromXML(&RefSolver,solver,&ierr); assert(ierr == 0);
+        ISparseSolver_DefineMatrix(&RefSolver,&MtxRef,&ierr); assert(ierr == 0);
+        Common_ReleaseObject(&MtxRef,&ierr);
+
+        X = malloc(sizeof(double)*L);
+        rhs = malloc(sizeof(double)*L);
+        for(i = 0; i < L; i++) {
+                rhs[i] = 1.0;
+                X[i] = 0.0;
+        }
+
+        // warm-up (JIT, solver-internal setup)
+        ISparseSolver_Solve(&RefSolver,&L,X,rhs,&ierr); assert(ierr == 0);
+        ISparseSolver_SolveInPlace(&RefSolver,&L,X,rhs,&ierr); assert(ierr == 0);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        b0 = allocatedBytes();
+        t0 = wtime();
+        for(k = 0; k < NSOLVES; k++) {
+                X[0] = 0.0;
+                ISparseSolver_Solve(&RefSolver,&L,X,rhs,&ierr);
+        }
+        t0 = wtime() - t0;
+        assert(ierr == 0);
+        if(MPIrank == 0)
+                reportSolve("ISparseSolver_Solve", t0, allocatedBytes() - b0);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        b0 = allocatedBytes();
+        t0 = wtime();
+        for(k = 0; k < NSOLVES; k++) {
+                X[0] = 0.0;
+                ISparseSolver_SolveInPlace(&RefSolver,&L,X,rhs,&ierr);
+        }
+        t0 = wtime() - t0;
+        assert(ierr == 0);
+        if(MPIrank == 0)
+                reportSolve("ISparseSolver_SolveInPlace", t0, allocatedBytes() - b0);
+
+        Common_ReleaseObject(&RefSolver,&ierr);
+        free(X); free(rhs);
+
+        ilPSPshutdown();
+        return 0;
+}
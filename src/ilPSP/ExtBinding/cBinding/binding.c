@@ -6,16 +6,12 @@
 #define DEFINE_MONKEY_INTERNALS
 #define DECLARE_BINDING
 #include "monkey.h"
-MonoMethod *pMsrMatrix_New;
+typedef void (*tMsrMatrix_New)(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr,MonoObject** exc);
+tMsrMatrix_New pMsrMatrix_New;
 void MsrMatrix_New(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){
-void* args[6];
-args [0] = _ref;
-args [1] = LocalNumberOfRows;
-args [2] = NoOfColumns;
-args [3] = _RowsPerBlock;
-args [4] = _ColPerBlock;
-args [5] = ierr;
-mono_runtime_invoke (pMsrMatrix_New, NULL, args, NULL);
+MonoObject* exc = NULL;
+pMsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr,&exc);
+assert(exc == NULL);
 }
 void msrmatrix_new(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){MsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr);}
 void MSRMATRIX_NEW(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){MsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr);}
@@ -25,15 +21,12 @@ void _msrmatrix_new(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _Rows
 void _MSRMATRIX_NEW(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){MsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr);}
 void _MsrMatrix_New(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){MsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr);}
 void MsrMatrix_New_(int* _ref,int* LocalNumberOfRows,int* NoOfColumns,int* _RowsPerBlock,int* _ColPerBlock,int* ierr){MsrMatrix_New(_ref,LocalNumberOfRows,NoOfColumns,_RowsPerBlock,_ColPerBlock,ierr);}
-MonoMethod *pIMutableMatrix_SetEntry;
+typedef void (*tIMutableMatrix_SetEntry)(int* _ref,int* i,int* j,double* val,int* ierr,MonoObject** exc);
+tIMutableMatrix_SetEntry pIMutableMatrix_SetEntry;
 void IMutableMatrix_SetEntry(int* _ref,int* i,int* j,double* val,int* ierr){
-void* args[5];
-args [0] = _ref;
-args [1] = i;
-args [2] = j;
-args [3] = val;
-args [4] = ierr;
-mono_runtime_invoke (pIMutableMatrix_SetEntry, NULL, args, NULL);
+MonoObject* exc = NULL;
+pIMutableMatrix_SetEntry(_ref,i,j,val,ierr,&exc);
+assert(exc == NULL);
 }
 void imutablematrix_setentry(int* _ref,int* i,int* j,double* val,int* ierr){IMutableMatrix_SetEntry(_ref,i,j,val,ierr);}
 void IMUTABLEMATRIX_SETENTRY(int* _ref,int* i,int* j,double* val,int* ierr){IMutableMatrix_SetEntry(_ref,i,j,val,ierr);}
@@ -43,12 +36,42 @@ void _imutablematrix_setentry(int* _ref,int* i,int* j,double* val,int* ierr){IMu
 void _IMUTABLEMATRIX_SETENTRY(int* _ref,int* i,int* j,double* val,int* ierr){IMutableMatrix_SetEntry(_ref,i,j,val,ierr);}
 void _IMutableMatrix_SetEntry(int* _ref,int* i,int* j,double* val,int* ierr){IMutableMatrix_SetEntry(_ref,i,j,val,ierr);}
 void IMutableMatrix_SetEntry_(int* _ref,int* i,int* j,double* val,int* ierr){IMutableMatrix_SetEntry(_ref,i,j,val,ierr);}
-MonoMethod *pCommon_ReleaseObject;
+typedef void (*tIMutableMatrix_SetRowsCSR)(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr,MonoObject** exc);
+tIMutableMatrix_SetRowsCSR pIMutableMatrix_SetRowsCSR;
+void IMutableMatrix_SetRowsCSR(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){
+MonoObject* exc = NULL;
+pIMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr,&exc);
+assert(exc == NULL);
+}
+void imutablematrix_setrowscsr(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void IMUTABLEMATRIX_SETROWSCSR(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void imutablematrix_setrowscsr_(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void IMUTABLEMATRIX_SETROWSCSR_(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void _imutablematrix_setrowscsr(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void _IMUTABLEMATRIX_SETROWSCSR(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void _IMutableMatrix_SetRowsCSR(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+void IMutableMatrix_SetRowsCSR_(int* _ref,int* i0,int* nrows,int* rowptr,int* cols,double* vals,int* ierr){IMutableMatrix_SetRowsCSR(_ref,i0,nrows,rowptr,cols,vals,ierr);}
+typedef void (*tIMutableMatrix_SetBlockRowsCSR)(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr,MonoObject** exc);
+tIMutableMatrix_SetBlockRowsCSR pIMutableMatrix_SetBlockRowsCSR;
+void IMutableMatrix_SetBlockRowsCSR(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){
+MonoObject* exc = NULL;
+pIMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr,&exc);
+assert(exc == NULL);
+}
+void imutablematrix_setblockrowscsr(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void IMUTABLEMATRIX_SETBLOCKROWSCSR(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void imutablematrix_setblockrowscsr_(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void IMUTABLEMATRIX_SETBLOCKROWSCSR_(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void _imutablematrix_setblockrowscsr(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void _IMUTABLEMATRIX_SETBLOCKROWSCSR(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void _IMutableMatrix_SetBlockRowsCSR(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+void IMutableMatrix_SetBlockRowsCSR_(int* _ref,int* i0,int* nblkrows,int* RowsPerBlock,int* ColPerBlock,int* blkrowptr,int* blkcols,double* vals,int* ierr){IMutableMatrix_SetBlockRowsCSR(_ref,i0,nblkrows,RowsPerBlock,ColPerBlock,blkrowptr,blkcols,vals,ierr);}
+typedef void (*tCommon_ReleaseObject)(int* _ref,int* ierr,MonoObject** exc);
+tCommon_ReleaseObject pCommon_ReleaseObject;
 void Common_ReleaseObject(int* _ref,int* ierr){
-void* args[2];
-args [0] = _ref;
-args [1] = ierr;
-mono_runtime_invoke (pCommon_ReleaseObject, NULL, args, NULL);
+MonoObject* exc = NULL;
+pCommon_ReleaseObject(_ref,ierr,&exc);
+assert(exc == NULL);
 }
 void common_releaseobject(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);}
 void COMMON_RELEASEOBJECT(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);}
@@ -58,12 +81,12 @@ void _common_releaseobject(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);
 void _COMMON_RELEASEOBJECT(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);}
 void _Common_ReleaseObject(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);}
 void Common_ReleaseObject_(int* _ref,int* ierr){Common_ReleaseObject(_ref,ierr);}
-MonoMethod *pCommon_Test;
+typedef void (*tCommon_Test)(int* dummy,int* ierr,MonoObject** exc);
+tCommon_Test pCommon_Test;
 void Common_Test(int* dummy,int* ierr){
-void* args[2];
-args [0] = dummy;
-args [1] = ierr;
-mono_runtime_invoke (pCommon_Test, NULL, args, NULL);
+MonoObject* exc = NULL;
+pCommon_Test(dummy,ierr,&exc);
+assert(exc == NULL);
 }
 void common_test(int* dummy,int* ierr){Common_Test(dummy,ierr);}
 void COMMON_TEST(int* dummy,int* ierr){Common_Test(dummy,ierr);}
@@ -73,10 +96,27 @@ void _common_test(int* dummy,int* ierr){Common_Test(dummy,ierr);}
 void _COMMON_TEST(int* dummy,int* ierr){Common_Test(dummy,ierr);}
 void _Common_Test(int* dummy,int* ierr){Common_Test(dummy,ierr);}
 void Common_Test_(int* dummy,int* ierr){Common_Test(dummy,ierr);}
-MonoMethod *pCommon_ilPSPInitialize;
+typedef void (*tCommon_GetAllocatedBytes)(double* bytes,int* ierr,MonoObject** exc);
+tCommon_GetAllocatedBytes pCommon_GetAllocatedBytes;
+void Common_GetAllocatedBytes(double* bytes,int* ierr){
+MonoObject* exc = NULL;
+pCommon_GetAllocatedBytes(bytes,ierr,&exc);
+assert(exc == NULL);
+}
+void common_getallocatedbytes(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void COMMON_GETALLOCATEDBYTES(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void common_getallocatedbytes_(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void COMMON_GETALLOCATEDBYTES_(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void _common_getallocatedbytes(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void _COMMON_GETALLOCATEDBYTES(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void _Common_GetAllocatedBytes(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+void Common_GetAllocatedBytes_(double* bytes,int* ierr){Common_GetAllocatedBytes(bytes,ierr);}
+typedef void (*tCommon_ilPSPInitialize)(MonoObject** exc);
+tCommon_ilPSPInitialize pCommon_ilPSPInitialize;
 void Common_ilPSPInitialize(){
-void* args[0];
-mono_runtime_invoke (pCommon_ilPSPInitialize, NULL, args, NULL);
+MonoObject* exc = NULL;
+pCommon_ilPSPInitialize(&exc);
+assert(exc == NULL);
 }
 void common_ilpspinitialize(){Common_ilPSPInitialize();}
 void COMMON_ILPSPINITIALIZE(){Common_ilPSPInitialize();}
@@ -86,10 +126,12 @@ void _common_ilpspinitialize(){Common_ilPSPInitialize();}
 void _COMMON_ILPSPINITIALIZE(){Common_ilPSPInitialize();}
 void _Common_ilPSPInitialize(){Common_ilPSPInitialize();}
 void Common_ilPSPInitialize_(){Common_ilPSPInitialize();}
-MonoMethod *pCommon_ilPSPFinalize;
+typedef void (*tCommon_ilPSPFinalize)(MonoObject** exc);
+tCommon_ilPSPFinalize pCommon_ilPSPFinalize;
 void Common_ilPSPFinalize(){
-void* args[0];
-mono_runtime_invoke (pCommon_ilPSPFinalize, NULL, args, NULL);
+MonoObject* exc = NULL;
+pCommon_ilPSPFinalize(&exc);
+assert(exc == NULL);
 }
 void common_ilpspfinalize(){Common_ilPSPFinalize();}
 void COMMON_ILPSPFINALIZE(){Common_ilPSPFinalize();}
@@ -99,13 +141,12 @@ void _common_ilpspfinalize(){Common_ilPSPFinalize();}
 void _COMMON_ILPSPFINALIZE(){Common_ilPSPFinalize();}
 void _Common_ilPSPFinalize(){Common_ilPSPFinalize();}
 void Common_ilPSPFinalize_(){Common_ilPSPFinalize();}
-MonoMethod *pIMutableMatrixEx_SaveToTextFileSparse;
+typedef void (*tIMutableMatrixEx_SaveToTextFileSparse)(int* _ref,char* path,int* ierr,MonoObject** exc);
+tIMutableMatrixEx_SaveToTextFileSparse pIMutableMatrixEx_SaveToTextFileSparse;
 void IMutableMatrixEx_SaveToTextFileSparse(int* _ref,char* path,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = path;
-args [2] = ierr;
-mono_runtime_invoke (pIMutableMatrixEx_SaveToTextFileSparse, NULL, args, NULL);
+MonoObject* exc = NULL;
+pIMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr,&exc);
+assert(exc == NULL);
 }
 void imutablematrixex_savetotextfilesparse(int* _ref,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr);}
 void IMUTABLEMATRIXEX_SAVETOTEXTFILESPARSE(int* _ref,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr);}
@@ -115,14 +156,12 @@ void _imutablematrixex_savetotextfilesparse(int* _ref,char* path,int* ierr){IMut
 void _IMUTABLEMATRIXEX_SAVETOTEXTFILESPARSE(int* _ref,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr);}
 void _IMutableMatrixEx_SaveToTextFileSparse(int* _ref,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr);}
 void IMutableMatrixEx_SaveToTextFileSparse_(int* _ref,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparse(_ref,path,ierr);}
-MonoMethod *pIMutableMatrixEx_SaveToTextFileSparseF;
+typedef void (*tIMutableMatrixEx_SaveToTextFileSparseF)(int* _ref,char* termchar,char* path,int* ierr,MonoObject** exc);
+tIMutableMatrixEx_SaveToTextFileSparseF pIMutableMatrixEx_SaveToTextFileSparseF;
 void IMutableMatrixEx_SaveToTextFileSparseF(int* _ref,char* termchar,char* path,int* ierr){
-void* args[4];
-args [0] = _ref;
-args [1] = termchar;
-args [2] = path;
-args [3] = ierr;
-mono_runtime_invoke (pIMutableMatrixEx_SaveToTextFileSparseF, NULL, args, NULL);
+MonoObject* exc = NULL;
+pIMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr,&exc);
+assert(exc == NULL);
 }
 void imutablematrixex_savetotextfilesparsef(int* _ref,char* termchar,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr);}
 void IMUTABLEMATRIXEX_SAVETOTEXTFILESPARSEF(int* _ref,char* termchar,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr);}
@@ -132,13 +171,12 @@ void _imutablematrixex_savetotextfilesparsef(int* _ref,char* termchar,char* path
 void _IMUTABLEMATRIXEX_SAVETOTEXTFILESPARSEF(int* _ref,char* termchar,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr);}
 void _IMutableMatrixEx_SaveToTextFileSparseF(int* _ref,char* termchar,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr);}
 void IMutableMatrixEx_SaveToTextFileSparseF_(int* _ref,char* termchar,char* path,int* ierr){IMutableMatrixEx_SaveToTextFileSparseF(_ref,termchar,path,ierr);}
-MonoMethod *pISparseMatrix_GetI0;
+typedef void (*tISparseMatrix_GetI0)(int* _ref,int* i0,int* ierr,MonoObject** exc);
+tISparseMatrix_GetI0 pISparseMatrix_GetI0;
 void ISparseMatrix_GetI0(int* _ref,int* i0,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = i0;
-args [2] = ierr;
-mono_runtime_invoke (pISparseMatrix_GetI0, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseMatrix_GetI0(_ref,i0,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsematrix_geti0(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,i0,ierr);}
 void ISPARSEMATRIX_GETI0(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,i0,ierr);}
@@ -148,13 +186,12 @@ void _isparsematrix_geti0(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,
 void _ISPARSEMATRIX_GETI0(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,i0,ierr);}
 void _ISparseMatrix_GetI0(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,i0,ierr);}
 void ISparseMatrix_GetI0_(int* _ref,int* i0,int* ierr){ISparseMatrix_GetI0(_ref,i0,ierr);}
-MonoMethod *pISparseMatrix_GetLocLen;
+typedef void (*tISparseMatrix_GetLocLen)(int* _ref,int* LocLen,int* ierr,MonoObject** exc);
+tISparseMatrix_GetLocLen pISparseMatrix_GetLocLen;
 void ISparseMatrix_GetLocLen(int* _ref,int* LocLen,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = LocLen;
-args [2] = ierr;
-mono_runtime_invoke (pISparseMatrix_GetLocLen, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseMatrix_GetLocLen(_ref,LocLen,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsematrix_getloclen(int* _ref,int* LocLen,int* ierr){ISparseMatrix_GetLocLen(_ref,LocLen,ierr);}
 void ISPARSEMATRIX_GETLOCLEN(int* _ref,int* LocLen,int* ierr){ISparseMatrix_GetLocLen(_ref,LocLen,ierr);}
@@ -164,13 +201,12 @@ void _isparsematrix_getloclen(int* _ref,int* LocLen,int* ierr){ISparseMatrix_Get
 void _ISPARSEMATRIX_GETLOCLEN(int* _ref,int* LocLen,int* ierr){ISparseMatrix_GetLocLen(_ref,LocLen,ierr);}
 void _ISparseMatrix_GetLocLen(int* _ref,int* LocLen,int* ierr){ISparseMatrix_GetLocLen(_ref,LocLen,ierr);}
 void ISparseMatrix_GetLocLen_(int* _ref,int* LocLen,int* ierr){ISparseMatrix_GetLocLen(_ref,LocLen,ierr);}
-MonoMethod *pISparseMatrix_GetRowPart;
+typedef void (*tISparseMatrix_GetRowPart)(int* MtxRef,int* PartRef,int* ierr,MonoObject** exc);
+tISparseMatrix_GetRowPart pISparseMatrix_GetRowPart;
 void ISparseMatrix_GetRowPart(int* MtxRef,int* PartRef,int* ierr){
-void* args[3];
-args [0] = MtxRef;
-args [1] = PartRef;
-args [2] = ierr;
-mono_runtime_invoke (pISparseMatrix_GetRowPart, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseMatrix_GetRowPart(MtxRef,PartRef,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsematrix_getrowpart(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix_GetRowPart(MtxRef,PartRef,ierr);}
 void ISPARSEMATRIX_GETROWPART(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix_GetRowPart(MtxRef,PartRef,ierr);}
@@ -180,13 +216,12 @@ void _isparsematrix_getrowpart(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix
 void _ISPARSEMATRIX_GETROWPART(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix_GetRowPart(MtxRef,PartRef,ierr);}
 void _ISparseMatrix_GetRowPart(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix_GetRowPart(MtxRef,PartRef,ierr);}
 void ISparseMatrix_GetRowPart_(int* MtxRef,int* PartRef,int* ierr){ISparseMatrix_GetRowPart(MtxRef,PartRef,ierr);}
-MonoMethod *pISparseSolver_FromXML;
+typedef void (*tISparseSolver_FromXML)(int* ref_,char* xmlcode,int* ierr,MonoObject** exc);
+tISparseSolver_FromXML pISparseSolver_FromXML;
 void ISparseSolver_FromXML(int* ref_,char* xmlcode,int* ierr){
-void* args[3];
-args [0] = ref_;
-args [1] = xmlcode;
-args [2] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXML, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXML(ref_,xmlcode,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxml(int* ref_,char* xmlcode,int* ierr){ISparseSolver_FromXML(ref_,xmlcode,ierr);}
 void ISPARSESOLVER_FROMXML(int* ref_,char* xmlcode,int* ierr){ISparseSolver_FromXML(ref_,xmlcode,ierr);}
@@ -196,12 +231,12 @@ void _isparsesolver_fromxml(int* ref_,char* xmlcode,int* ierr){ISparseSolver_Fro
 void _ISPARSESOLVER_FROMXML(int* ref_,char* xmlcode,int* ierr){ISparseSolver_FromXML(ref_,xmlcode,ierr);}
 void _ISparseSolver_FromXML(int* ref_,char* xmlcode,int* ierr){ISparseSolver_FromXML(ref_,xmlcode,ierr);}
 void ISparseSolver_FromXML_(int* ref_,char* xmlcode,int* ierr){ISparseSolver_FromXML(ref_,xmlcode,ierr);}
-MonoMethod *pISparseSolver_FromXMLBegin;
+typedef void (*tISparseSolver_FromXMLBegin)(char* lineTerm,int* ierr,MonoObject** exc);
+tISparseSolver_FromXMLBegin pISparseSolver_FromXMLBegin;
 void ISparseSolver_FromXMLBegin(char* lineTerm,int* ierr){
-void* args[2];
-args [0] = lineTerm;
-args [1] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXMLBegin, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXMLBegin(lineTerm,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxmlbegin(char* lineTerm,int* ierr){ISparseSolver_FromXMLBegin(lineTerm,ierr);}
 void ISPARSESOLVER_FROMXMLBEGIN(char* lineTerm,int* ierr){ISparseSolver_FromXMLBegin(lineTerm,ierr);}
@@ -211,12 +246,12 @@ void _isparsesolver_fromxmlbegin(char* lineTerm,int* ierr){ISparseSolver_FromXML
 void _ISPARSESOLVER_FROMXMLBEGIN(char* lineTerm,int* ierr){ISparseSolver_FromXMLBegin(lineTerm,ierr);}
 void _ISparseSolver_FromXMLBegin(char* lineTerm,int* ierr){ISparseSolver_FromXMLBegin(lineTerm,ierr);}
 void ISparseSolver_FromXMLBegin_(char* lineTerm,int* ierr){ISparseSolver_FromXMLBegin(lineTerm,ierr);}
-MonoMethod *pISparseSolver_FromXMLSubmit;
+typedef void (*tISparseSolver_FromXMLSubmit)(char* line,int* ierr,MonoObject** exc);
+tISparseSolver_FromXMLSubmit pISparseSolver_FromXMLSubmit;
 void ISparseSolver_FromXMLSubmit(char* line,int* ierr){
-void* args[2];
-args [0] = line;
-args [1] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXMLSubmit, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXMLSubmit(line,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxmlsubmit(char* line,int* ierr){ISparseSolver_FromXMLSubmit(line,ierr);}
 void ISPARSESOLVER_FROMXMLSUBMIT(char* line,int* ierr){ISparseSolver_FromXMLSubmit(line,ierr);}
@@ -226,12 +261,12 @@ void _isparsesolver_fromxmlsubmit(char* line,int* ierr){ISparseSolver_FromXMLSub
 void _ISPARSESOLVER_FROMXMLSUBMIT(char* line,int* ierr){ISparseSolver_FromXMLSubmit(line,ierr);}
 void _ISparseSolver_FromXMLSubmit(char* line,int* ierr){ISparseSolver_FromXMLSubmit(line,ierr);}
 void ISparseSolver_FromXMLSubmit_(char* line,int* ierr){ISparseSolver_FromXMLSubmit(line,ierr);}
-MonoMethod *pISparseSolver_FromXMLEnd;
+typedef void (*tISparseSolver_FromXMLEnd)(int* SolverRef,int* ierr,MonoObject** exc);
+tISparseSolver_FromXMLEnd pISparseSolver_FromXMLEnd;
 void ISparseSolver_FromXMLEnd(int* SolverRef,int* ierr){
-void* args[2];
-args [0] = SolverRef;
-args [1] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXMLEnd, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXMLEnd(SolverRef,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxmlend(int* SolverRef,int* ierr){ISparseSolver_FromXMLEnd(SolverRef,ierr);}
 void ISPARSESOLVER_FROMXMLEND(int* SolverRef,int* ierr){ISparseSolver_FromXMLEnd(SolverRef,ierr);}
@@ -241,15 +276,12 @@ void _isparsesolver_fromxmlend(int* SolverRef,int* ierr){ISparseSolver_FromXMLEn
 void _ISPARSESOLVER_FROMXMLEND(int* SolverRef,int* ierr){ISparseSolver_FromXMLEnd(SolverRef,ierr);}
 void _ISparseSolver_FromXMLEnd(int* SolverRef,int* ierr){ISparseSolver_FromXMLEnd(SolverRef,ierr);}
 void ISparseSolver_FromXMLEnd_(int* SolverRef,int* ierr){ISparseSolver_FromXMLEnd(SolverRef,ierr);}
-MonoMethod *pISparseSolver_FromXMLFileF;
+typedef void (*tISparseSolver_FromXMLFileF)(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr,MonoObject** exc);
+tISparseSolver_FromXMLFileF pISparseSolver_FromXMLFileF;
 void ISparseSolver_FromXMLFileF(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){
-void* args[5];
-args [0] = SolverRef;
-args [1] = termChar;
-args [2] = File;
-args [3] = solvername;
-args [4] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXMLFileF, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxmlfilef(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr);}
 void ISPARSESOLVER_FROMXMLFILEF(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr);}
@@ -259,14 +291,12 @@ void _isparsesolver_fromxmlfilef(int* SolverRef,char* termChar,char* File,char*
 void _ISPARSESOLVER_FROMXMLFILEF(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr);}
 void _ISparseSolver_FromXMLFileF(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr);}
 void ISparseSolver_FromXMLFileF_(int* SolverRef,char* termChar,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFileF(SolverRef,termChar,File,solvername,ierr);}
-MonoMethod *pISparseSolver_FromXMLFile;
+typedef void (*tISparseSolver_FromXMLFile)(int* SolverRef,char* File,char* solvername,int* ierr,MonoObject** exc);
+tISparseSolver_FromXMLFile pISparseSolver_FromXMLFile;
 void ISparseSolver_FromXMLFile(int* SolverRef,char* File,char* solvername,int* ierr){
-void* args[4];
-args [0] = SolverRef;
-args [1] = File;
-args [2] = solvername;
-args [3] = ierr;
-mono_runtime_invoke (pISparseSolver_FromXMLFile, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_fromxmlfile(int* SolverRef,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr);}
 void ISPARSESOLVER_FROMXMLFILE(int* SolverRef,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr);}
@@ -276,13 +306,12 @@ void _isparsesolver_fromxmlfile(int* SolverRef,char* File,char* solvername,int*
 void _ISPARSESOLVER_FROMXMLFILE(int* SolverRef,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr);}
 void _ISparseSolver_FromXMLFile(int* SolverRef,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr);}
 void ISparseSolver_FromXMLFile_(int* SolverRef,char* File,char* solvername,int* ierr){ISparseSolver_FromXMLFile(SolverRef,File,solvername,ierr);}
-MonoMethod *pISparseSolver_DefineMatrix;
+typedef void (*tISparseSolver_DefineMatrix)(int* SolverRef,int* MatrixRef,int* ierr,MonoObject** exc);
+tISparseSolver_DefineMatrix pISparseSolver_DefineMatrix;
 void ISparseSolver_DefineMatrix(int* SolverRef,int* MatrixRef,int* ierr){
-void* args[3];
-args [0] = SolverRef;
-args [1] = MatrixRef;
-args [2] = ierr;
-mono_runtime_invoke (pISparseSolver_DefineMatrix, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_definematrix(int* SolverRef,int* MatrixRef,int* ierr){ISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr);}
 void ISPARSESOLVER_DEFINEMATRIX(int* SolverRef,int* MatrixRef,int* ierr){ISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr);}
@@ -292,15 +321,12 @@ void _isparsesolver_definematrix(int* SolverRef,int* MatrixRef,int* ierr){ISpars
 void _ISPARSESOLVER_DEFINEMATRIX(int* SolverRef,int* MatrixRef,int* ierr){ISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr);}
 void _ISparseSolver_DefineMatrix(int* SolverRef,int* MatrixRef,int* ierr){ISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr);}
 void ISparseSolver_DefineMatrix_(int* SolverRef,int* MatrixRef,int* ierr){ISparseSolver_DefineMatrix(SolverRef,MatrixRef,ierr);}
-MonoMethod *pISparseSolver_Solve;
+typedef void (*tISparseSolver_Solve)(int* SolverRef,int* N,double* x,double* rhs,int* ierr,MonoObject** exc);
+tISparseSolver_Solve pISparseSolver_Solve;
 void ISparseSolver_Solve(int* SolverRef,int* N,double* x,double* rhs,int* ierr){
-void* args[5];
-args [0] = SolverRef;
-args [1] = N;
-args [2] = x;
-args [3] = rhs;
-args [4] = ierr;
-mono_runtime_invoke (pISparseSolver_Solve, NULL, args, NULL);
+MonoObject* exc = NULL;
+pISparseSolver_Solve(SolverRef,N,x,rhs,ierr,&exc);
+assert(exc == NULL);
 }
 void isparsesolver_solve(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_Solve(SolverRef,N,x,rhs,ierr);}
 void ISPARSESOLVER_SOLVE(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_Solve(SolverRef,N,x,rhs,ierr);}
@@ -310,13 +336,27 @@ void _isparsesolver_solve(int* SolverRef,int* N,double* x,double* rhs,int* ierr)
 void _ISPARSESOLVER_SOLVE(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_Solve(SolverRef,N,x,rhs,ierr);}
 void _ISparseSolver_Solve(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_Solve(SolverRef,N,x,rhs,ierr);}
 void ISparseSolver_Solve_(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_Solve(SolverRef,N,x,rhs,ierr);}
-MonoMethod *pPartition_GetI0;
+typedef void (*tISparseSolver_SolveInPlace)(int* SolverRef,int* N,double* x,double* rhs,int* ierr,MonoObject** exc);
+tISparseSolver_SolveInPlace pISparseSolver_SolveInPlace;
+void ISparseSolver_SolveInPlace(int* SolverRef,int* N,double* x,double* rhs,int* ierr){
+MonoObject* exc = NULL;
+pISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr,&exc);
+assert(exc == NULL);
+}
+void isparsesolver_solveinplace(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void ISPARSESOLVER_SOLVEINPLACE(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void isparsesolver_solveinplace_(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void ISPARSESOLVER_SOLVEINPLACE_(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void _isparsesolver_solveinplace(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void _ISPARSESOLVER_SOLVEINPLACE(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void _ISparseSolver_SolveInPlace(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+void ISparseSolver_SolveInPlace_(int* SolverRef,int* N,double* x,double* rhs,int* ierr){ISparseSolver_SolveInPlace(SolverRef,N,x,rhs,ierr);}
+typedef void (*tPartition_GetI0)(int* _ref,int* i0,int* ierr,MonoObject** exc);
+tPartition_GetI0 pPartition_GetI0;
 void Partition_GetI0(int* _ref,int* i0,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = i0;
-args [2] = ierr;
-mono_runtime_invoke (pPartition_GetI0, NULL, args, NULL);
+MonoObject* exc = NULL;
+pPartition_GetI0(_ref,i0,ierr,&exc);
+assert(exc == NULL);
 }
 void partition_geti0(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr);}
 void PARTITION_GETI0(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr);}
@@ -326,13 +366,12 @@ void _partition_geti0(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr)
 void _PARTITION_GETI0(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr);}
 void _Partition_GetI0(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr);}
 void Partition_GetI0_(int* _ref,int* i0,int* ierr){Partition_GetI0(_ref,i0,ierr);}
-MonoMethod *pPartition_GetLocLen;
+typedef void (*tPartition_GetLocLen)(int* _ref,int* LocLen,int* ierr,MonoObject** exc);
+tPartition_GetLocLen pPartition_GetLocLen;
 void Partition_GetLocLen(int* _ref,int* LocLen,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = LocLen;
-args [2] = ierr;
-mono_runtime_invoke (pPartition_GetLocLen, NULL, args, NULL);
+MonoObject* exc = NULL;
+pPartition_GetLocLen(_ref,LocLen,ierr,&exc);
+assert(exc == NULL);
 }
 void partition_getloclen(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_ref,LocLen,ierr);}
 void PARTITION_GETLOCLEN(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_ref,LocLen,ierr);}
@@ -342,13 +381,12 @@ void _partition_getloclen(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_
 void _PARTITION_GETLOCLEN(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_ref,LocLen,ierr);}
 void _Partition_GetLocLen(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_ref,LocLen,ierr);}
 void Partition_GetLocLen_(int* _ref,int* LocLen,int* ierr){Partition_GetLocLen(_ref,LocLen,ierr);}
-MonoMethod *pPartition_GetMPIrank;
+typedef void (*tPartition_GetMPIrank)(int* _ref,int* MPIrank,int* ierr,MonoObject** exc);
+tPartition_GetMPIrank pPartition_GetMPIrank;
 void Partition_GetMPIrank(int* _ref,int* MPIrank,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = MPIrank;
-args [2] = ierr;
-mono_runtime_invoke (pPartition_GetMPIrank, NULL, args, NULL);
+MonoObject* exc = NULL;
+pPartition_GetMPIrank(_ref,MPIrank,ierr,&exc);
+assert(exc == NULL);
 }
 void partition_getmpirank(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIrank(_ref,MPIrank,ierr);}
 void PARTITION_GETMPIRANK(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIrank(_ref,MPIrank,ierr);}
@@ -358,13 +396,12 @@ void _partition_getmpirank(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIran
 void _PARTITION_GETMPIRANK(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIrank(_ref,MPIrank,ierr);}
 void _Partition_GetMPIrank(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIrank(_ref,MPIrank,ierr);}
 void Partition_GetMPIrank_(int* _ref,int* MPIrank,int* ierr){Partition_GetMPIrank(_ref,MPIrank,ierr);}
-MonoMethod *pPartition_GetMPIsize;
+typedef void (*tPartition_GetMPIsize)(int* _ref,int* MPIsize,int* ierr,MonoObject** exc);
+tPartition_GetMPIsize pPartition_GetMPIsize;
 void Partition_GetMPIsize(int* _ref,int* MPIsize,int* ierr){
-void* args[3];
-args [0] = _ref;
-args [1] = MPIsize;
-args [2] = ierr;
-mono_runtime_invoke (pPartition_GetMPIsize, NULL, args, NULL);
+MonoObject* exc = NULL;
+pPartition_GetMPIsize(_ref,MPIsize,ierr,&exc);
+assert(exc == NULL);
 }
 void partition_getmpisize(int* _ref,int* MPIsize,int* ierr){Partition_GetMPIsize(_ref,MPIsize,ierr);}
 void PARTITION_GETMPISIZE(int* _ref,int* MPIsize,int* ierr){Partition_GetMPIsize(_ref,MPIsize,ierr);}
@@ -378,111 +415,209 @@ void Partition_GetMPIsize_(int* _ref,int* MPIsize,int* ierr){Partition_GetMPIsiz
 void InitBinding() {
 MonoClass *klass;
 MonoMethodDesc* desc_X;
+MonoMethod* meth_X;
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "MsrMatrix_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.MsrMatrix_:New(int&,int&,int&,int&,int&,int&)", 1);
 assert(desc_X);
-pMsrMatrix_New = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pMsrMatrix_New = (tMsrMatrix_New) mono_method_get_unmanaged_thunk (meth_X);
 assert(pMsrMatrix_New);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "IMutableMatrix_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.IMutableMatrix_:SetEntry(int&,int&,int&,double&,int&)", 1);
 assert(desc_X);
-pIMutableMatrix_SetEntry = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pIMutableMatrix_SetEntry = (tIMutableMatrix_SetEntry) mono_method_get_unmanaged_thunk (meth_X);
 assert(pIMutableMatrix_SetEntry);
+desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.IMutableMatrix_:SetRowsCSR(int&,int&,int&,int*,int*,double*,int&)", 1);
+assert(desc_X);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pIMutableMatrix_SetRowsCSR = (tIMutableMatrix_SetRowsCSR) mono_method_get_unmanaged_thunk (meth_X);
+assert(pIMutableMatrix_SetRowsCSR);
+desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.IMutableMatrix_:SetBlockRowsCSR(int&,int&,int&,int&,int&,int*,int*,double*,int&)", 1);
+assert(desc_X);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pIMutableMatrix_SetBlockRowsCSR = (tIMutableMatrix_SetBlockRowsCSR) mono_method_get_unmanaged_thunk (meth_X);
+assert(pIMutableMatrix_SetBlockRowsCSR);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "Common_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Common_:ReleaseObject(int&,int&)", 1);
 assert(desc_X);
-pCommon_ReleaseObject = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pCommon_ReleaseObject = (tCommon_ReleaseObject) mono_method_get_unmanaged_thunk (meth_X);
 assert(pCommon_ReleaseObject);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Common_:Test(int&,int&)", 1);
 assert(desc_X);
-pCommon_Test = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pCommon_Test = (tCommon_Test) mono_method_get_unmanaged_thunk (meth_X);
 assert(pCommon_Test);
+desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Common_:GetAllocatedBytes(double&,int&)", 1);
+assert(desc_X);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pCommon_GetAllocatedBytes = (tCommon_GetAllocatedBytes) mono_method_get_unmanaged_thunk (meth_X);
+assert(pCommon_GetAllocatedBytes);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Common_:ilPSPInitialize()", 1);
 assert(desc_X);
-pCommon_ilPSPInitialize = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pCommon_ilPSPInitialize = (tCommon_ilPSPInitialize) mono_method_get_unmanaged_thunk (meth_X);
 assert(pCommon_ilPSPInitialize);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Common_:ilPSPFinalize()", 1);
 assert(desc_X);
-pCommon_ilPSPFinalize = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pCommon_ilPSPFinalize = (tCommon_ilPSPFinalize) mono_method_get_unmanaged_thunk (meth_X);
 assert(pCommon_ilPSPFinalize);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "IMutableMatrixEx_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.IMutableMatrixEx_:SaveToTextFileSparse(int&,byte*,int&)", 1);
 assert(desc_X);
-pIMutableMatrixEx_SaveToTextFileSparse = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pIMutableMatrixEx_SaveToTextFileSparse = (tIMutableMatrixEx_SaveToTextFileSparse) mono_method_get_unmanaged_thunk (meth_X);
 assert(pIMutableMatrixEx_SaveToTextFileSparse);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.IMutableMatrixEx_:SaveToTextFileSparseF(int&,byte*,byte*,int&)", 1);
 assert(desc_X);
-pIMutableMatrixEx_SaveToTextFileSparseF = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pIMutableMatrixEx_SaveToTextFileSparseF = (tIMutableMatrixEx_SaveToTextFileSparseF) mono_method_get_unmanaged_thunk (meth_X);
 assert(pIMutableMatrixEx_SaveToTextFileSparseF);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "ISparseMatrix_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseMatrix_:GetI0(int&,int&,int&)", 1);
 assert(desc_X);
-pISparseMatrix_GetI0 = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseMatrix_GetI0 = (tISparseMatrix_GetI0) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseMatrix_GetI0);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseMatrix_:GetLocLen(int&,int&,int&)", 1);
 assert(desc_X);
-pISparseMatrix_GetLocLen = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseMatrix_GetLocLen = (tISparseMatrix_GetLocLen) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseMatrix_GetLocLen);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseMatrix_:GetRowPart(int&,int&,int&)", 1);
 assert(desc_X);
-pISparseMatrix_GetRowPart = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseMatrix_GetRowPart = (tISparseMatrix_GetRowPart) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseMatrix_GetRowPart);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "ISparseSolver_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXML(int&,byte*,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXML = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXML = (tISparseSolver_FromXML) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXML);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXMLBegin(byte*,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXMLBegin = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXMLBegin = (tISparseSolver_FromXMLBegin) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXMLBegin);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXMLSubmit(byte*,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXMLSubmit = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXMLSubmit = (tISparseSolver_FromXMLSubmit) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXMLSubmit);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXMLEnd(int&,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXMLEnd = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXMLEnd = (tISparseSolver_FromXMLEnd) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXMLEnd);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXMLFileF(int&,byte*,byte*,byte*,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXMLFileF = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXMLFileF = (tISparseSolver_FromXMLFileF) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXMLFileF);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:FromXMLFile(int&,byte*,byte*,int&)", 1);
 assert(desc_X);
-pISparseSolver_FromXMLFile = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_FromXMLFile = (tISparseSolver_FromXMLFile) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_FromXMLFile);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:DefineMatrix(int&,int&,int&)", 1);
 assert(desc_X);
-pISparseSolver_DefineMatrix = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_DefineMatrix = (tISparseSolver_DefineMatrix) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_DefineMatrix);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:Solve(int&,int&,double*,double*,int&)", 1);
 assert(desc_X);
-pISparseSolver_Solve = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_Solve = (tISparseSolver_Solve) mono_method_get_unmanaged_thunk (meth_X);
 assert(pISparseSolver_Solve);
+desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.ISparseSolver_:SolveInPlace(int&,int&,double*,double*,int&)", 1);
+assert(desc_X);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pISparseSolver_SolveInPlace = (tISparseSolver_SolveInPlace) mono_method_get_unmanaged_thunk (meth_X);
+assert(pISparseSolver_SolveInPlace);
 klass = mono_class_from_name (img, "ilPSP.ExternalBinding", "Partition_");
 assert(klass);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Partition_:GetI0(int&,int&,int&)", 1);
 assert(desc_X);
-pPartition_GetI0 = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pPartition_GetI0 = (tPartition_GetI0) mono_method_get_unmanaged_thunk (meth_X);
 assert(pPartition_GetI0);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Partition_:GetLocLen(int&,int&,int&)", 1);
 assert(desc_X);
-pPartition_GetLocLen = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pPartition_GetLocLen = (tPartition_GetLocLen) mono_method_get_unmanaged_thunk (meth_X);
 assert(pPartition_GetLocLen);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Partition_:GetMPIrank(int&,int&,int&)", 1);
 assert(desc_X);
-pPartition_GetMPIrank = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pPartition_GetMPIrank = (tPartition_GetMPIrank) mono_method_get_unmanaged_thunk (meth_X);
 assert(pPartition_GetMPIrank);
 desc_X = mono_method_desc_new ("ilPSP.ExternalBinding.Partition_:GetMPIsize(int&,int&,int&)", 1);
 assert(desc_X);
-pPartition_GetMPIsize = mono_method_desc_search_in_class (desc_X, klass);
+meth_X = mono_method_desc_search_in_class (desc_X, klass);
+assert(meth_X);
+mono_method_desc_free (desc_X);
+pPartition_GetMPIsize = (tPartition_GetMPIsize) mono_method_get_unmanaged_thunk (meth_X);
 assert(pPartition_GetMPIsize);
 }
 
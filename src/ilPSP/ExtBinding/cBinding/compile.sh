@@ -6,8 +6,10 @@ rm *.o
 gcc monkey.c -c `pkg-config --cflags mono`
 gcc binding.c -c `pkg-config --cflags mono`
 mpicc example.c -c 
+mpicc bench.c -c `pkg-config --cflags mono`
 mpif77 fexample.f -c
 
 mpicc  monkey.o binding.o example.o  -o cExample.out `pkg-config --libs mono` 
 mpif77 monkey.o binding.o fexample.o -o fExample.out `pkg-config --libs mono` 
+mpicc  monkey.o binding.o bench.o    -o cBench.out `pkg-config --libs mono` 
 
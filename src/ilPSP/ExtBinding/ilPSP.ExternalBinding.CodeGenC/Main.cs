@@ -31,6 +31,7 @@ namespace ilPSP.ExternalBinding.CodeGenC
 			BindingDotC_2.WriteLine("void InitBinding() {");
             BindingDotC_2.WriteLine("MonoClass *klass;");
             BindingDotC_2.WriteLine("MonoMethodDesc* desc_X;");
+            BindingDotC_2.WriteLine("MonoMethod* meth_X;");
 			
 			
 			foreach(var t in TypesToExprt)
@@ -96,6 +97,7 @@ namespace ilPSP.ExternalBinding.CodeGenC
 				case "Double&": CArgs[i] = "double*"; sStrArgs[i] = "double&"; break;
 				case "Byte*": CArgs[i] = "char*"; sStrArgs[i] = "byte*"; break;
 				case "Double*": CArgs[i] = "double*"; sStrArgs[i] = "double*"; break;
+				case "Int32*": CArgs[i] = "int*"; sStrArgs[i] = "int*"; break;
 				default: throw new ApplicationException("unsupported parameter type '" + pi.ParameterType.Name + "', method '" + mi.DeclaringType.FullName + ":" + mi.Name + "'");
 				}
 				
@@ -106,15 +108,32 @@ namespace ilPSP.ExternalBinding.CodeGenC
 			}
 			searchString.Write(")");
 			
-			// declare mono variable
+			// declare function pointer to the unmanaged thunk;
+			// (the thunk has the same arguments as the managed method, plus an 
+			// additional 'MonoObject**' for the exception, so we can call it directly
+			// instead of going through 'mono_runtime_invoke', which marshals reflectively on each call)
 			string methname = mi.DeclaringType.Name + mi.Name;
 			string varName = "p" + methname;
-			BindingDotC_1.WriteLine("MonoMethod *" + varName + ";");
+			string typeName = "t" + methname;
+			{
+				StringWriter tdW = new StringWriter();
+				tdW.Write("typedef void (*" + typeName + ")(");
+				for( int i = 0; i < CArgs.Length; i++) {
+					tdW.Write(CArgs[i]);
+					tdW.Write(",");
+				}
+				tdW.Write("MonoObject** exc);");
+				BindingDotC_1.WriteLine(tdW.ToString());
+			}
+			BindingDotC_1.WriteLine(typeName + " " + varName + ";");
 			
-			// code for mono lookup
+			// code for mono lookup; the thunk is resolved only once, here.
 			BindingDotC_2.WriteLine( "desc_X = mono_method_desc_new (\"" + searchString + "\", 1);");
             BindingDotC_2.WriteLine( "assert(desc_X);");
-		    BindingDotC_2.WriteLine( varName + " = mono_method_desc_search_in_class (desc_X, klass);");
+		    BindingDotC_2.WriteLine( "meth_X = mono_method_desc_search_in_class (desc_X, klass);");
+            BindingDotC_2.WriteLine( "assert(meth_X);");
+            BindingDotC_2.WriteLine( "mono_method_desc_free (desc_X);");
+            BindingDotC_2.WriteLine( varName + " = (" + typeName + ") mono_method_get_unmanaged_thunk (meth_X);");
             BindingDotC_2.WriteLine( "assert(" + varName + ");");
 			
 			// function signature
@@ -133,10 +152,12 @@ namespace ilPSP.ExternalBinding.CodeGenC
 			
 			// c-wrapper
 			BindingDotC_1.WriteLine(sig + "{");
-			BindingDotC_1.WriteLine("void* args["+ CArgs.Length + "];");
+			BindingDotC_1.WriteLine("MonoObject* exc = NULL;");
+			BindingDotC_1.Write(varName + "(");
 			for( int i = 0; i < CArgs.Length; i++)
-				BindingDotC_1.WriteLine("args [" + i + "] = "+ parameters[i].Name +";");
-    		BindingDotC_1.WriteLine("mono_runtime_invoke ("+varName+", NULL, args, NULL);");
+				BindingDotC_1.Write(parameters[i].Name + ",");
+    		BindingDotC_1.WriteLine("&exc);");
+			BindingDotC_1.WriteLine("assert(exc == NULL);");
 			BindingDotC_1.WriteLine("}");
 			
 			// c-protoype
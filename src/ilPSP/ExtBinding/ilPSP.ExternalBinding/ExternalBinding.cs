@@ -29,6 +29,21 @@ namespace ilPSP.ExternalBinding {
 			Console.WriteLine("Hello from Test: " + (dummy));	
 		}	
 		
+		/// <summary>
+		/// total number of bytes allocated on the managed heap, since the first call to this method
+		/// (for benchmarking).
+		/// </summary>
+		public static void GetAllocatedBytes(out double bytes, out int ierr) {
+			ierr = 0;
+			bytes = -1;
+			try {
+				AppDomain.MonitoringIsEnabled = true;
+				bytes = AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize;
+			} catch (Exception e) {
+				ierr = Infrastructure.ErrorHandler(e);
+			}
+		}
+		
 		static bool mustFinalizeMPI;
 		
 		public static void ilPSPInitialize() {
@@ -156,6 +171,123 @@ namespace ilPSP.ExternalBinding {
 				ierr = Infrastructure.ErrorHandler(e);
 			}
 		}
+
+		/// <summary>
+		/// sets multiple rows at once, from a compressed-sparse-row (CSR) representation;
+		/// all previous entries in these rows are overwritten.
+		/// </summary>
+		/// <param name="i0">global index of the first row to set</param>
+		/// <param name="nrows">number of rows to set</param>
+		/// <param name="rowptr">
+		/// row pointer, length <paramref name="nrows"/>+1; the entries of row <c>i0 + i</c> are
+		/// found at <c>rowptr[i] - rowptr[0]</c> to <c>rowptr[i+1] - rowptr[0] - 1</c>
+		/// (so 0- and 1-based row pointers are both fine);
+		/// </param>
+		/// <param name="cols">global (0-based) column indices</param>
+		/// <param name="vals">matrix entries</param>
+		unsafe public static void SetRowsCSR(ref int _ref, ref int i0, ref int nrows, int* rowptr, int* cols, double* vals, out int ierr) {
+			ierr = 0;
+			try {
+				IMutableMatrix M = (IMutableMatrix) Infrastructure.GetObject(_ref);
+				MsrMatrix msr = M as MsrMatrix;
+				int offset = rowptr[0];
+
+				for(int i = 0; i < nrows; i++) {
+					int k0 = rowptr[i] - offset;
+					int L = rowptr[i+1] - rowptr[i];
+					if(L < 0)
+						throw new ArgumentException("row pointer must be non-decreasing.");
+
+					if(msr != null) {
+						// fast path: build the row directly, no intermediate arrays
+						var row = new MsrMatrix.MatrixEntry[L];
+						for(int l = 0; l < L; l++) {
+							row[l].m_ColIndex = cols[k0 + l];
+							row[l].Value = vals[k0 + l];
+						}
+						msr.SetRow(i0 + i, row);
+					} else {
+						int[] _cols = new int[L];
+						double[] _vals = new double[L];
+						Marshal.Copy((IntPtr)(cols + k0), _cols, 0, L);
+						Marshal.Copy((IntPtr)(vals + k0), _vals, 0, L);
+						M.SetValues(i0 + i, _cols, _vals);
+					}
+				}
+			} catch (Exception e) {
+				ierr = Infrastructure.ErrorHandler(e);
+			}
+		}
+
+		/// <summary>
+		/// sets multiple block rows at once, from a block-compressed-sparse-row (BSR) representation;
+		/// all previous entries in these rows are overwritten.
+		/// </summary>
+		/// <param name="i0">global index of the first (scalar) row to set</param>
+		/// <param name="nblkrows">number of block rows to set</param>
+		/// <param name="RowsPerBlock">number of rows in each block</param>
+		/// <param name="ColPerBlock">number of columns in each block</param>
+		/// <param name="blkrowptr">
+		/// block row pointer, length <paramref name="nblkrows"/>+1;
+		/// same convention as the row pointer in <see cref="SetRowsCSR"/>;
+		/// </param>
+		/// <param name="blkcols">
+		/// global (0-based) block column indices, i.e. block <c>k</c> starts at column <c>blkcols[k]*ColPerBlock</c>
+		/// </param>
+		/// <param name="vals">
+		/// dense blocks, each stored row-major, one after another
+		/// </param>
+		unsafe public static void SetBlockRowsCSR(ref int _ref, ref int i0, ref int nblkrows, ref int RowsPerBlock, ref int ColPerBlock, int* blkrowptr, int* blkcols, double* vals, out int ierr) {
+			ierr = 0;
+			try {
+				IMutableMatrix M = (IMutableMatrix) Infrastructure.GetObject(_ref);
+				MsrMatrix msr = M as MsrMatrix;
+				int offset = blkrowptr[0];
+				int R = RowsPerBlock, C = ColPerBlock;
+
+				for(int ib = 0; ib < nblkrows; ib++) {
+					int k0 = blkrowptr[ib] - offset;
+					int Lb = blkrowptr[ib+1] - blkrowptr[ib];
+					if(Lb < 0)
+						throw new ArgumentException("block row pointer must be non-decreasing.");
+
+					for(int r = 0; r < R; r++) {
+						int iRow = i0 + ib*R + r;
+
+						int[] _cols = null;
+						double[] _vals = null;
+						MsrMatrix.MatrixEntry[] row = null;
+						if(msr != null) {
+							row = new MsrMatrix.MatrixEntry[Lb*C];
+						} else {
+							_cols = new int[Lb*C];
+							_vals = new double[Lb*C];
+						}
+
+						for(int l = 0; l < Lb; l++) {
+							int j0 = blkcols[k0 + l]*C;
+							double* pBlkRow = vals + ((long)(k0 + l)*R + r)*C;
+							for(int c = 0; c < C; c++) {
+								if(row != null) {
+									row[l*C + c].m_ColIndex = j0 + c;
+									row[l*C + c].Value = pBlkRow[c];
+								} else {
+									_cols[l*C + c] = j0 + c;
+									_vals[l*C + c] = pBlkRow[c];
+								}
+							}
+						}
+
+						if(row != null)
+							msr.SetRow(iRow, row);
+						else
+							M.SetValues(iRow, _cols, _vals);
+					}
+				}
+			} catch (Exception e) {
+				ierr = Infrastructure.ErrorHandler(e);
+			}
+		}
 		#endregion
 	}
 	
@@ -350,6 +482,22 @@ namespace ilPSP.ExternalBinding {
 				ierr = Infrastructure.ErrorHandler(e);
 			}
 		}
+		
+		/// <summary>
+		/// Like <see cref="Solve"/>, but the solver operates directly on the caller-owned buffers
+		/// <paramref name="x"/> and <paramref name="rhs"/> (via <see cref="UnmanagedVector"/>), 
+		/// i.e. without intermediate managed copies;
+		/// <paramref name="rhs"/> may be overwritten.
+		/// </summary>
+		unsafe public static void SolveInPlace(ref int SolverRef, ref int N, double* x, double* rhs, out int ierr) {
+			ierr = 0;
+			try {
+				ISparseSolver solver = (ISparseSolver) Infrastructure.GetObject(SolverRef);
+				solver.Solve(new UnmanagedVector(x, N), new UnmanagedVector(rhs, N));
+			} catch (Exception e) {
+				ierr = Infrastructure.ErrorHandler(e);
+			}
+		}
 	
 	}
 }
@@ -511,6 +511,163 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetLocalCSR
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_IJMatrixSetLocalCSR( HYPRE_IJMatrix matrix, HYPRE_Int nrows,
+                           const HYPRE_Int *row_ptr, const HYPRE_Int *cols,
+                           const double *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!cols && row_ptr[nrows] > row_ptr[0])
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!values && row_ptr[nrows] > row_ptr[0])
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+      return( hypre_IJMatrixSetLocalCSRParCSR( ijmatrix, nrows, row_ptr,
+                                               cols, values ) );
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixCheckLocalCSRPattern
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_IJMatrixCheckLocalCSRPattern( HYPRE_IJMatrix matrix, HYPRE_Int nrows,
+                                    const HYPRE_Int *row_ptr,
+                                    const HYPRE_Int *cols, HYPRE_Int *match )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!cols && row_ptr[nrows] > row_ptr[0])
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!match)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+      return( hypre_IJMatrixCheckLocalCSRPatternParCSR( ijmatrix, nrows,
+                                                        row_ptr, cols, match ) );
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixUpdateLocalCSRValues
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_IJMatrixUpdateLocalCSRValues( HYPRE_IJMatrix matrix, HYPRE_Int nrows,
+                                    const HYPRE_Int *row_ptr,
+                                    const HYPRE_Int *cols,
+                                    const double *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!cols && row_ptr[nrows] > row_ptr[0])
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!values && row_ptr[nrows] > row_ptr[0])
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+      return( hypre_IJMatrixUpdateLocalCSRValuesParCSR( ijmatrix, nrows,
+                                                        row_ptr, cols, values ) );
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixGetRowCounts
  *--------------------------------------------------------------------------*/
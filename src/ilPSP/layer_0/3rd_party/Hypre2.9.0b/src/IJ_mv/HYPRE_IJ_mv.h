@@ -145,6 +145,57 @@ HYPRE_Int HYPRE_IJMatrixAddToValues(HYPRE_IJMatrix  matrix,
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * Sets all local rows of the matrix at once from a CSR structure and
+ * assembles it; this replaces the sequence \Ref{HYPRE_IJMatrixInitialize},
+ * \Ref{HYPRE_IJMatrixSetValues} and \Ref{HYPRE_IJMatrixAssemble}, and
+ * avoids the auxiliary storage used by them.  {\tt nrows} must be the
+ * number of local rows ({\tt iupper}-{\tt ilower}+1).  The entries of
+ * local row {\tt i} are {\tt cols[k]}, {\tt values[k]} for {\tt row\_ptr[i]}
+ * $\leq$ {\tt k} $<$ {\tt row\_ptr[i+1]}; {\tt cols} contains global
+ * column indices, each column may occur only once per row.  Any previous
+ * contents of the matrix are replaced.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetLocalCSR(HYPRE_IJMatrix   matrix,
+                              HYPRE_Int              nrows,
+                              const HYPRE_Int       *row_ptr,
+                              const HYPRE_Int       *cols,
+                              const double    *values);
+
+/**
+ * Checks whether the local rows given in CSR format (as for
+ * \Ref{HYPRE_IJMatrixSetLocalCSR}) have the same sparsity pattern as the
+ * assembled matrix.  On return, {\tt match} is 1 if every local row contains
+ * exactly the same columns, and 0 otherwise.  The order of the columns
+ * within a row does not matter.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixCheckLocalCSRPattern(HYPRE_IJMatrix   matrix,
+                                       HYPRE_Int              nrows,
+                                       const HYPRE_Int       *row_ptr,
+                                       const HYPRE_Int       *cols,
+                                       HYPRE_Int             *match);
+
+/**
+ * Overwrites the values of an assembled matrix from local rows given in
+ * CSR format (as for \Ref{HYPRE_IJMatrixSetLocalCSR}) that have the same
+ * sparsity pattern.  The structure of the matrix, its column map and
+ * its communication package are kept, so no re-assembly is needed.
+ * If the pattern does not match, an error is returned and the values of
+ * the matrix are undefined; use \Ref{HYPRE_IJMatrixCheckLocalCSRPattern}
+ * to check beforehand.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixUpdateLocalCSRValues(HYPRE_IJMatrix   matrix,
+                                       HYPRE_Int              nrows,
+                                       const HYPRE_Int       *row_ptr,
+                                       const HYPRE_Int       *cols,
+                                       const double    *values);
+
 /**
  * Gets number of nonzeros elements for {\tt nrows} rows specified in {\tt rows}
  * and returns them in {\tt ncols}, which needs to be allocated by the
@@ -1977,6 +1977,530 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetLocalCSRParCSR
+ *
+ * builds the ParCSRMatrix directly from the local rows given in CSR format
+ * (row pointers, global column indices, values), without AuxParCSRMatrix;
+ * the diagonal entry of each row of diag is moved into first space, the
+ * column indices of offd are compressed to col_map_offd.  Any previous
+ * contents of the matrix are replaced.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixSetLocalCSRParCSR( hypre_IJMatrix  *matrix,
+                                 HYPRE_Int        nrows,
+                                 const HYPRE_Int *row_ptr,
+                                 const HYPRE_Int *cols,
+                                 const double    *values )
+{
+   MPI_Comm comm = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix *par_matrix;
+   hypre_AuxParCSRMatrix *aux_matrix = hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_CSRMatrix *diag;
+   hypre_CSRMatrix *offd;
+   HYPRE_Int *diag_i;
+   HYPRE_Int *diag_j = NULL;
+   double *diag_data = NULL;
+   HYPRE_Int *offd_i;
+   HYPRE_Int *offd_j = NULL;
+   double *offd_data = NULL;
+   HYPRE_Int *col_map_offd;
+   HYPRE_Int *aux_offd_j;
+   HYPRE_Int *diag_cnt;
+   HYPRE_Int *offd_cnt;
+   HYPRE_Int num_rows, num_cols_offd, nnz_offd;
+   HYPRE_Int col_0, col_n;
+   HYPRE_Int i, j, cnt, i_diag, i_offd, diag_pos;
+   HYPRE_Int my_id, num_threads, ii, ns, ne, size, rest;
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   HYPRE_Int base = hypre_IJMatrixGlobalFirstCol(matrix);
+#else
+   HYPRE_Int base = col_partitioning[0];
+#endif
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_rows = row_partitioning[1] - row_partitioning[0];
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1]-1;
+#else
+   num_rows = row_partitioning[my_id+1] - row_partitioning[my_id];
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1]-1;
+#endif
+
+   if (nrows != num_rows)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   /* replace any previous contents */
+   if (aux_matrix)
+   {
+      hypre_AuxParCSRMatrixDestroy(aux_matrix);
+      hypre_IJMatrixTranslator(matrix) = NULL;
+   }
+   if (hypre_IJMatrixObject(matrix))
+   {
+      hypre_ParCSRMatrixDestroy(hypre_IJMatrixObject(matrix));
+      hypre_IJMatrixObject(matrix) = NULL;
+   }
+   hypre_IJMatrixCreateParCSR(matrix);
+   par_matrix = hypre_IJMatrixObject(matrix);
+   diag = hypre_ParCSRMatrixDiag(par_matrix);
+   offd = hypre_ParCSRMatrixOffd(par_matrix);
+
+   diag_i = hypre_CTAlloc(HYPRE_Int, num_rows+1);
+   offd_i = hypre_CTAlloc(HYPRE_Int, num_rows+1);
+
+   /*-----------------------------------------------------------------------
+    *  First pass: count the entries of diag and offd in each row.
+    *-----------------------------------------------------------------------*/
+
+   num_threads = hypre_NumThreads();
+   diag_cnt = hypre_CTAlloc(HYPRE_Int, num_threads+1);
+   offd_cnt = hypre_CTAlloc(HYPRE_Int, num_threads+1);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,ii,ns,ne,size,rest,i_diag,i_offd) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      size = num_rows/num_threads;
+      rest = num_rows - size*num_threads;
+      if (ii < rest)
+      {
+         ns = ii*size+ii;
+         ne = (ii+1)*size+ii+1;
+      }
+      else
+      {
+         ns = ii*size+rest;
+         ne = (ii+1)*size+rest;
+      }
+
+      i_diag = 0;
+      i_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+         {
+            if (cols[j] < col_0 || cols[j] > col_n)
+               i_offd++;
+            else
+               i_diag++;
+         }
+         diag_i[i+1] = i_diag;
+         offd_i[i+1] = i_offd;
+      }
+      diag_cnt[ii+1] = i_diag;
+      offd_cnt[ii+1] = i_offd;
+   }
+
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      diag_cnt[ii+1] += diag_cnt[ii];
+      offd_cnt[ii+1] += offd_cnt[ii];
+   }
+
+   if (diag_cnt[num_threads])
+   {
+      diag_j = hypre_CTAlloc(HYPRE_Int, diag_cnt[num_threads]);
+      diag_data = hypre_CTAlloc(double, diag_cnt[num_threads]);
+   }
+   if (offd_cnt[num_threads])
+   {
+      offd_j = hypre_CTAlloc(HYPRE_Int, offd_cnt[num_threads]);
+      offd_data = hypre_CTAlloc(double, offd_cnt[num_threads]);
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Second pass: shift the row pointers of each chunk and copy the
+    *  entries; offd_j keeps the global column indices for now.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,ii,ns,ne,size,rest,i_diag,i_offd,diag_pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      size = num_rows/num_threads;
+      rest = num_rows - size*num_threads;
+      if (ii < rest)
+      {
+         ns = ii*size+ii;
+         ne = (ii+1)*size+ii+1;
+      }
+      else
+      {
+         ns = ii*size+rest;
+         ne = (ii+1)*size+rest;
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         diag_i[i+1] += diag_cnt[ii];
+         offd_i[i+1] += offd_cnt[ii];
+      }
+
+      i_diag = diag_cnt[ii];
+      i_offd = offd_cnt[ii];
+      for (i = ns; i < ne; i++)
+      {
+         diag_pos = -1;
+         for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+            if (cols[j]-col_0 == i)
+            {
+               diag_pos = j;
+               break;
+            }
+         if (diag_pos > -1)
+         {
+            diag_j[i_diag] = i;
+            diag_data[i_diag++] = values[diag_pos];
+         }
+         for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+         {
+            if (cols[j] < col_0 || cols[j] > col_n)
+            {
+               offd_j[i_offd] = cols[j];
+               offd_data[i_offd++] = values[j];
+            }
+            else if (j != diag_pos)
+            {
+               diag_j[i_diag] = cols[j] - col_0;
+               diag_data[i_diag++] = values[j];
+            }
+         }
+      }
+   }
+
+   hypre_CSRMatrixI(diag) = diag_i;
+   hypre_CSRMatrixJ(diag) = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixI(offd) = offd_i;
+   hypre_CSRMatrixJ(offd) = offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+   hypre_TFree(diag_cnt);
+   hypre_TFree(offd_cnt);
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+
+   /*  generate col_map_offd */
+   nnz_offd = offd_i[num_rows];
+   if (nnz_offd)
+   {
+      aux_offd_j = hypre_CTAlloc(HYPRE_Int, nnz_offd);
+      for (i=0; i < nnz_offd; i++)
+         aux_offd_j[i] = offd_j[i];
+      qsort0(aux_offd_j,0,nnz_offd-1);
+      num_cols_offd = 1;
+      for (i=0; i < nnz_offd-1; i++)
+      {
+         if (aux_offd_j[i+1] > aux_offd_j[i])
+            num_cols_offd++;
+      }
+      col_map_offd = hypre_CTAlloc(HYPRE_Int,num_cols_offd);
+      col_map_offd[0] = aux_offd_j[0];
+      cnt = 0;
+      for (i=1; i < nnz_offd; i++)
+      {
+         if (aux_offd_j[i] > col_map_offd[cnt])
+         {
+            cnt++;
+            col_map_offd[cnt] = aux_offd_j[i];
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i=0; i < nnz_offd; i++)
+      {
+         offd_j[i]=hypre_BinarySearch(col_map_offd,offd_j[i],num_cols_offd);
+      }
+      if (base)
+      {
+         for (i=0; i < num_cols_offd; i++)
+            col_map_offd[i] -= base;
+      }
+      hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+      hypre_CSRMatrixNumCols(offd) = num_cols_offd;
+      hypre_TFree(aux_offd_j);
+   }
+
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixMatchLocalCSRParCSR
+ *
+ * compares the local rows given in CSR format (row pointers, global column
+ * indices) with the sparsity pattern of the assembled ParCSRMatrix; if
+ * values is not NULL, the matching entries of diag and offd are overwritten.
+ * Entries are first looked up at the position hypre_IJMatrixSetLocalCSRParCSR
+ * would have put them, so a matrix built from the same source is matched
+ * without searching.  match is set to 1 if every row has the same number of
+ * entries in diag and offd and each column is found, 0 otherwise.
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixMatchLocalCSRParCSR( hypre_IJMatrix  *matrix,
+                                   HYPRE_Int        nrows,
+                                   const HYPRE_Int *row_ptr,
+                                   const HYPRE_Int *cols,
+                                   const double    *values,
+                                   HYPRE_Int       *match )
+{
+   MPI_Comm comm = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix *par_matrix = hypre_IJMatrixObject(matrix);
+   HYPRE_Int *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int *diag_j = hypre_CSRMatrixJ(diag);
+   double *diag_data = hypre_CSRMatrixData(diag);
+   HYPRE_Int *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int *offd_j = hypre_CSRMatrixJ(offd);
+   double *offd_data = hypre_CSRMatrixData(offd);
+   HYPRE_Int *col_map_offd = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int *thread_match;
+   HYPRE_Int col_0, col_n, col;
+   HYPRE_Int i, j, k, n_diag, n_offd, pos_diag, pos_offd, j_offd, found;
+   HYPRE_Int my_id, num_threads, ii, ns, ne, size, rest;
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   HYPRE_Int base = hypre_IJMatrixGlobalFirstCol(matrix);
+#else
+   HYPRE_Int base = col_partitioning[0];
+#endif
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1]-1;
+#else
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1]-1;
+#endif
+
+   num_threads = hypre_NumThreads();
+   thread_match = hypre_CTAlloc(HYPRE_Int, num_threads);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k,ii,ns,ne,size,rest,col,n_diag,n_offd,pos_diag,pos_offd,j_offd,found) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      size = nrows/num_threads;
+      rest = nrows - size*num_threads;
+      if (ii < rest)
+      {
+         ns = ii*size+ii;
+         ne = (ii+1)*size+ii+1;
+      }
+      else
+      {
+         ns = ii*size+rest;
+         ne = (ii+1)*size+rest;
+      }
+
+      thread_match[ii] = 1;
+      for (i = ns; i < ne && thread_match[ii]; i++)
+      {
+         n_diag = 0;
+         n_offd = 0;
+         for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+         {
+            if (cols[j] < col_0 || cols[j] > col_n)
+               n_offd++;
+            else
+               n_diag++;
+         }
+         if (n_diag != diag_i[i+1]-diag_i[i] || n_offd != offd_i[i+1]-offd_i[i])
+         {
+            thread_match[ii] = 0;
+            break;
+         }
+
+         /* expected positions: diagonal entry first, then source order */
+         pos_diag = diag_i[i];
+         if (pos_diag < diag_i[i+1] && diag_j[pos_diag] == i)
+            pos_diag++;
+         pos_offd = offd_i[i];
+
+         for (j = row_ptr[i]; j < row_ptr[i+1]; j++)
+         {
+            found = -1;
+            if (cols[j] < col_0 || cols[j] > col_n)
+            {
+               if (pos_offd < offd_i[i+1]
+                   && col_map_offd[offd_j[pos_offd]] == cols[j]-base)
+               {
+                  found = pos_offd++;
+               }
+               else
+               {
+                  j_offd = hypre_BinarySearch(col_map_offd, cols[j]-base,
+                                              num_cols_offd);
+                  for (k = offd_i[i]; j_offd > -1 && k < offd_i[i+1]; k++)
+                     if (offd_j[k] == j_offd)
+                     {
+                        found = k;
+                        pos_offd = k+1;
+                        break;
+                     }
+               }
+               if (found > -1 && values)
+                  offd_data[found] = values[j];
+            }
+            else
+            {
+               col = cols[j]-col_0;
+               if (col == i)
+               {
+                  if (diag_j[diag_i[i]] == i)
+                     found = diag_i[i];
+               }
+               else if (pos_diag < diag_i[i+1] && diag_j[pos_diag] == col)
+               {
+                  found = pos_diag++;
+               }
+               else
+               {
+                  for (k = diag_i[i]; k < diag_i[i+1]; k++)
+                     if (diag_j[k] == col)
+                     {
+                        found = k;
+                        pos_diag = k+1;
+                        break;
+                     }
+               }
+               if (found > -1 && values)
+                  diag_data[found] = values[j];
+            }
+            if (found < 0)
+            {
+               thread_match[ii] = 0;
+               break;
+            }
+         }
+      }
+   }
+
+   *match = 1;
+   for (ii = 0; ii < num_threads; ii++)
+      if (!thread_match[ii]) *match = 0;
+
+   hypre_TFree(thread_match);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixCheckLocalCSRPatternParCSR
+ *
+ * checks whether the local rows given in CSR format have the same sparsity
+ * pattern as the assembled ParCSRMatrix (match = 1) or not (match = 0)
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixCheckLocalCSRPatternParCSR( hypre_IJMatrix  *matrix,
+                                          HYPRE_Int        nrows,
+                                          const HYPRE_Int *row_ptr,
+                                          const HYPRE_Int *cols,
+                                          HYPRE_Int       *match )
+{
+   HYPRE_Int *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int num_rows, my_id;
+
+   *match = 0;
+
+   if (!hypre_IJMatrixAssembleFlag(matrix))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_rows = row_partitioning[1] - row_partitioning[0];
+#else
+   num_rows = row_partitioning[my_id+1] - row_partitioning[my_id];
+#endif
+   if (nrows != num_rows)
+      return hypre_error_flag;
+
+   return hypre_IJMatrixMatchLocalCSRParCSR(matrix, nrows, row_ptr, cols,
+                                            NULL, match);
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixUpdateLocalCSRValuesParCSR
+ *
+ * overwrites the values of an assembled ParCSRMatrix from local rows in CSR
+ * format with the same sparsity pattern; diag, offd, col_map_offd and the
+ * communication package are kept.  If the pattern does not match, an error
+ * is returned and the values of the matrix are undefined.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixUpdateLocalCSRValuesParCSR( hypre_IJMatrix  *matrix,
+                                          HYPRE_Int        nrows,
+                                          const HYPRE_Int *row_ptr,
+                                          const HYPRE_Int *cols,
+                                          const double    *values )
+{
+   HYPRE_Int *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int print_level = hypre_IJMatrixPrintLevel(matrix);
+   HYPRE_Int num_rows, my_id, match;
+
+   if (!hypre_IJMatrixAssembleFlag(matrix))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_rows = row_partitioning[1] - row_partitioning[0];
+#else
+   num_rows = row_partitioning[my_id+1] - row_partitioning[my_id];
+#endif
+   if (nrows != num_rows)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixMatchLocalCSRParCSR(matrix, nrows, row_ptr, cols,
+                                     values, &match);
+   if (!match)
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+      if (print_level)
+         hypre_printf(" Error, sparsity pattern does not match the matrix\n");
+   }
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixDestroyParCSR
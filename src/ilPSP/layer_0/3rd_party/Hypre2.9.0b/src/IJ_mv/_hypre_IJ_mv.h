@@ -371,6 +371,9 @@ HYPRE_Int hypre_IJMatrixGetValuesParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nro
 HYPRE_Int hypre_IJMatrixSetValuesParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_Int *rows , const HYPRE_Int *cols , const double *values );
 HYPRE_Int hypre_IJMatrixAddToValuesParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_Int *rows , const HYPRE_Int *cols , const double *values );
 HYPRE_Int hypre_IJMatrixAssembleParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixSetLocalCSRParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , const double *values );
+HYPRE_Int hypre_IJMatrixCheckLocalCSRPatternParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , HYPRE_Int *match );
+HYPRE_Int hypre_IJMatrixUpdateLocalCSRValuesParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , const double *values );
 HYPRE_Int hypre_IJMatrixDestroyParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixAssembleOffProcValsParCSR ( hypre_IJMatrix *matrix , HYPRE_Int off_proc_i_indx , HYPRE_Int max_off_proc_elmts , HYPRE_Int current_num_elmts , HYPRE_Int *off_proc_i , HYPRE_Int *off_proc_j , double *off_proc_data );
 HYPRE_Int hypre_FillResponseIJOffProcVals ( void *p_recv_contact_buf , HYPRE_Int contact_size , HYPRE_Int contact_proc , void *ro , MPI_Comm comm , void **p_send_response_buf , HYPRE_Int *response_message_size );
@@ -418,6 +421,9 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel ( HYPRE_IJMatrix matrix , HYPRE_Int print_
 HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_Int *rows , const HYPRE_Int *cols , const double *values );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_Int *rows , const HYPRE_Int *cols , const double *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixSetLocalCSR ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , const double *values );
+HYPRE_Int HYPRE_IJMatrixCheckLocalCSRPattern ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , HYPRE_Int *match );
+HYPRE_Int HYPRE_IJMatrixUpdateLocalCSRValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , const HYPRE_Int *row_ptr , const HYPRE_Int *cols , const double *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *rows , HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *ncols , HYPRE_Int *rows , HYPRE_Int *cols , double *values );
 HYPRE_Int HYPRE_IJMatrixSetObjectType ( HYPRE_IJMatrix matrix , HYPRE_Int type );
@@ -78,7 +78,13 @@ void Euclid_dhApply(Euclid_dh ctx, double *rhs, double *lhs)
   /* sequential and mpi block jacobi cases */
   if (np_dh == 1 ||
       ! strcmp(ctx->algo_par, "bj") ) {
-    Factor_dhSolveSeq(rhs_, lhs_, ctx); CHECK_V_ERROR;
+    if (! strcmp(ctx->triSolve, "level")) {
+      Factor_dhSolveSeqLevels(rhs_, lhs_, ctx); CHECK_V_ERROR;
+    } else if (! strcmp(ctx->triSolve, "jacobi")) {
+      Factor_dhSolveSeqJacobi(rhs_, lhs_, ctx); CHECK_V_ERROR;
+    } else {
+      Factor_dhSolveSeq(rhs_, lhs_, ctx); CHECK_V_ERROR;
+    }
   }
 
 
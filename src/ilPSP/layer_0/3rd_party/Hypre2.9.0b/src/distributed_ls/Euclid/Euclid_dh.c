@@ -68,6 +68,8 @@ void Euclid_dhCreate(Euclid_dh *ctxOUT)
   ctx->pivotMin = 0.0;
   ctx->pivotFix = PIVOT_FIX_DEFAULT;
   ctx->maxVal = 0.0;
+  strcpy(ctx->triSolve, "seq");
+  ctx->triSolveSweeps = 3;
 
   ctx->slist = NULL;
   ctx->extRows = NULL;
@@ -283,6 +285,16 @@ void Euclid_dhSetup(Euclid_dh ctx)
     ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
   }
 
+  /*-------------------------------------------------------------- 
+   * for level-scheduled triangular solves (seq and bj), compute
+   * the level sets of L and U once per factorization.
+   *--------------------------------------------------------------*/
+  else if (! strcmp(ctx->triSolve, "level") && strcmp(ctx->algo_par, "none")) {
+    t1 = hypre_MPI_Wtime();
+    Factor_dhSolveLevelSetup(ctx->F); CHECK_V_ERROR;
+    ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
+  }
+
 END_OF_FUNCTION: ;
 
   /*-------------------------------------------------------
@@ -357,6 +369,14 @@ void get_runtime_params_private(Euclid_dh ctx)
     ctx->isScaled = true;
   }
 
+  /* triangular solves (seq, level, jacobi) */
+  tmp = NULL;
+  Parser_dhReadString(parser_dh, "-triSolve", &tmp);
+  if (tmp != NULL) {
+    strcpy(ctx->triSolve, tmp);
+  }
+  Parser_dhReadInt(parser_dh, "-triSolveSweeps", &ctx->triSolveSweeps);
+
   /* solve method */
   tmp = NULL;
   Parser_dhReadString(parser_dh, "-ksp_type", &tmp);
@@ -703,6 +723,7 @@ void Euclid_dhPrintStats(Euclid_dh ctx, FILE *fp)
   fprintf_dh(fp, "   tri solves:             %i\n", ctx->itsTotal);
   fprintf_dh(fp, "   parallelization method: %s\n", ctx->algo_par);
   fprintf_dh(fp, "   factorization method:   %s\n", ctx->algo_ilu);
+  fprintf_dh(fp, "   triangular solves:      %s\n", ctx->triSolve);
   fprintf_dh(fp, "   matrix was row scaled:  %i\n", ctx->isScaled);
 
   fprintf_dh(fp, "   matrix row count:       %i\n", ctx->n);
@@ -921,6 +942,7 @@ void Euclid_dhPrintHypreReport(Euclid_dh ctx, FILE *fp)
   fprintf_dh(fp, "   tri solves:             %i\n", ctx->itsTotal);
   fprintf_dh(fp, "   parallelization method: %s\n", ctx->algo_par);
   fprintf_dh(fp, "   factorization method:   %s\n", ctx->algo_ilu);
+  fprintf_dh(fp, "   triangular solves:      %s\n", ctx->triSolve);
   if (! strcmp(ctx->algo_ilu, "iluk")) {
     fprintf_dh(fp, "      level:               %i\n", ctx->level);
   }
@@ -136,6 +136,10 @@ struct _mpi_interface_dh {
   double pivotFix;    /* multiplier for adjusting small pivots */
   double maxVal;      /* largest abs. value in matrix */
 
+  /* triangular solves for seq and bj (seq, level, jacobi) */
+  char triSolve[MAX_OPT_LEN];
+  HYPRE_Int triSolveSweeps;  /* for jacobi */
+
   /* data structures for parallel ilu (pilu) */
   SortedList_dh   slist;
   ExternalRows_dh extRows;
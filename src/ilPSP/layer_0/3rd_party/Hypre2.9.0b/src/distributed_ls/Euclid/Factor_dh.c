@@ -31,6 +31,7 @@ void Factor_dh_junk()
 }
 
 static void adjust_bj_private(Factor_dh mat);
+static void free_levels_private(Factor_dh mat);
 static void unadjust_bj_private(Factor_dh mat);
 
 
@@ -73,6 +74,13 @@ void Factor_dhCreate(Factor_dh *mat)
   tmp->solveIsSetup = false;
   tmp->numbSolve = NULL;
 
+  tmp->numLevelsL = tmp->numLevelsU = 0;
+  tmp->levelPtrL = tmp->levelRowsL = NULL;
+  tmp->levelPtrU = tmp->levelRowsU = NULL;
+  tmp->rpL = tmp->cvalL = tmp->rpU = tmp->cvalU = NULL;
+  tmp->avalL = tmp->avalU = NULL;
+  tmp->work_jacobi = NULL;
+
   tmp->debug = Parser_dhHasSwitch(parser_dh, "-debug_Factor");
 
 /*  Factor_dhZeroTiming(tmp); CHECK_V_ERROR; */
@@ -99,6 +107,9 @@ void Factor_dhDestroy(Factor_dh mat)
   if (mat->sendindHi != NULL) { FREE_DH(mat->sendindHi); CHECK_V_ERROR; }
 
   if (mat->numbSolve != NULL) { Numbering_dhDestroy(mat->numbSolve); CHECK_V_ERROR; }
+
+  free_levels_private(mat); CHECK_V_ERROR;
+  if (mat->work_jacobi != NULL) { FREE_DH(mat->work_jacobi); CHECK_V_ERROR; }
   FREE_DH(mat); CHECK_V_ERROR; 
   END_FUNC_DH
 }
@@ -1065,6 +1076,258 @@ void Factor_dhSolveSeq(double *rhs, double *lhs, Euclid_dh ctx)
   END_FUNC_DH
 }
 
+/*---------------------------------------------------------------
+ * multithreaded triangular solves for the seq and bj cases.
+ * Factor_dhSolveSeqLevels() gives the same result as
+ * Factor_dhSolveSeq(); Factor_dhSolveSeqJacobi() replaces each
+ * triangular solve by a few jacobi sweeps, which is exact once
+ * the number of sweeps reaches the number of levels.
+ *---------------------------------------------------------------*/
+
+#undef __FUNC__
+#define __FUNC__ "bucket_levels_private"
+static void bucket_levels_private(HYPRE_Int m, HYPRE_Int *level, HYPRE_Int numLevels,
+                                  HYPRE_Int **ptrOUT, HYPRE_Int **rowsOUT)
+{
+  START_FUNC_DH
+  HYPRE_Int i, *ptr, *rows;
+
+  ptr = (HYPRE_Int*)MALLOC_DH((numLevels+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  rows = (HYPRE_Int*)MALLOC_DH((m+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  for (i=0; i<=numLevels; ++i) ptr[i] = 0;
+  for (i=0; i<m; ++i) ptr[level[i]+1] += 1;
+  for (i=0; i<numLevels; ++i) ptr[i+1] += ptr[i];
+  for (i=0; i<m; ++i) rows[ptr[level[i]]++] = i;
+  for (i=numLevels; i>0; --i) ptr[i] = ptr[i-1];
+  ptr[0] = 0;
+
+  *ptrOUT = ptr;
+  *rowsOUT = rows;
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "free_levels_private"
+static void free_levels_private(Factor_dh mat)
+{
+  START_FUNC_DH
+  if (mat->levelPtrL != NULL) { FREE_DH(mat->levelPtrL); CHECK_V_ERROR; }
+  if (mat->levelRowsL != NULL) { FREE_DH(mat->levelRowsL); CHECK_V_ERROR; }
+  if (mat->levelPtrU != NULL) { FREE_DH(mat->levelPtrU); CHECK_V_ERROR; }
+  if (mat->levelRowsU != NULL) { FREE_DH(mat->levelRowsU); CHECK_V_ERROR; }
+  if (mat->rpL != NULL) { FREE_DH(mat->rpL); CHECK_V_ERROR; }
+  if (mat->cvalL != NULL) { FREE_DH(mat->cvalL); CHECK_V_ERROR; }
+  if (mat->avalL != NULL) { FREE_DH(mat->avalL); CHECK_V_ERROR; }
+  if (mat->rpU != NULL) { FREE_DH(mat->rpU); CHECK_V_ERROR; }
+  if (mat->cvalU != NULL) { FREE_DH(mat->cvalU); CHECK_V_ERROR; }
+  if (mat->avalU != NULL) { FREE_DH(mat->avalU); CHECK_V_ERROR; }
+  mat->levelPtrL = mat->levelRowsL = mat->levelPtrU = mat->levelRowsU = NULL;
+  mat->rpL = mat->cvalL = mat->rpU = mat->cvalU = NULL;
+  mat->avalL = mat->avalU = NULL;
+  END_FUNC_DH
+}
+
+/* copies the entries first[i] <= j < last[i] of the rows i = rows[0..m-1]
+   into level-ordered storage
+ */
+#undef __FUNC__
+#define __FUNC__ "copy_levels_private"
+static void copy_levels_private(HYPRE_Int m, HYPRE_Int *rows,
+                                HYPRE_Int *first, HYPRE_Int *last, HYPRE_Int *cval,
+                                REAL_DH *aval, HYPRE_Int **rpOUT,
+                                HYPRE_Int **cvalOUT, REAL_DH **avalOUT)
+{
+  START_FUNC_DH
+  HYPRE_Int i, j, k, nz, *rpC, *cvalC;
+  REAL_DH *avalC;
+
+  rpC = (HYPRE_Int*)MALLOC_DH((m+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  rpC[0] = 0;
+  for (k=0; k<m; ++k) {
+    i = rows[k];
+    rpC[k+1] = rpC[k] + (last[i] - first[i]);
+  }
+  nz = rpC[m];
+  cvalC = (HYPRE_Int*)MALLOC_DH((nz+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  avalC = (REAL_DH*)MALLOC_DH((nz+1)*sizeof(REAL_DH)); CHECK_V_ERROR;
+  for (k=0; k<m; ++k) {
+    i = rows[k];
+    nz = rpC[k];
+    for (j=first[i]; j<last[i]; ++j, ++nz) {
+      cvalC[nz] = cval[j];
+      avalC[nz] = aval[j];
+    }
+  }
+
+  *rpOUT = rpC;
+  *cvalOUT = cvalC;
+  *avalOUT = avalC;
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveLevelSetup"
+void Factor_dhSolveLevelSetup(Factor_dh mat)
+{
+  START_FUNC_DH
+  HYPRE_Int i, j, lev, maxLev, m = mat->m;
+  HYPRE_Int *rp = mat->rp, *cval = mat->cval, *diag = mat->diag;
+  HYPRE_Int *level;
+
+  free_levels_private(mat); CHECK_V_ERROR;
+
+  level = (HYPRE_Int*)MALLOC_DH((m+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  /* L: row i depends on the rows cval[j] < i */
+  maxLev = 0;
+  for (i=0; i<m; ++i) {
+    lev = 0;
+    for (j=rp[i]; j<diag[i]; ++j) lev = MAX(lev, level[cval[j]]+1);
+    level[i] = lev;
+    maxLev = MAX(maxLev, lev);
+  }
+  mat->numLevelsL = maxLev+1;
+  bucket_levels_private(m, level, mat->numLevelsL,
+                        &(mat->levelPtrL), &(mat->levelRowsL)); CHECK_V_ERROR;
+  copy_levels_private(m, mat->levelRowsL, rp, diag, cval, mat->aval,
+                      &(mat->rpL), &(mat->cvalL), &(mat->avalL)); CHECK_V_ERROR;
+
+  /* U: row i depends on the rows cval[j] > i; the (inverted) diagonal 
+     is kept as first entry of each row
+   */
+  maxLev = 0;
+  for (i=m-1; i>=0; --i) {
+    lev = 0;
+    for (j=diag[i]+1; j<rp[i+1]; ++j) lev = MAX(lev, level[cval[j]]+1);
+    level[i] = lev;
+    maxLev = MAX(maxLev, lev);
+  }
+  mat->numLevelsU = maxLev+1;
+  bucket_levels_private(m, level, mat->numLevelsU,
+                        &(mat->levelPtrU), &(mat->levelRowsU)); CHECK_V_ERROR;
+  copy_levels_private(m, mat->levelRowsU, diag, rp+1, cval, mat->aval,
+                      &(mat->rpU), &(mat->cvalU), &(mat->avalU)); CHECK_V_ERROR;
+
+  FREE_DH(level); CHECK_V_ERROR;
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveSeqLevels"
+void Factor_dhSolveSeqLevels(double *rhs, double *lhs, Euclid_dh ctx)
+{
+  START_FUNC_DH
+  Factor_dh F = ctx->F;
+  HYPRE_Int *ptrL = F->levelPtrL, *rowsL = F->levelRowsL;
+  HYPRE_Int *ptrU = F->levelPtrU, *rowsU = F->levelRowsU;
+  HYPRE_Int *rpL = F->rpL, *cvalL = F->cvalL, *rpU = F->rpU, *cvalU = F->cvalU;
+  HYPRE_Int numLevelsL = F->numLevelsL, numLevelsU = F->numLevelsU;
+  HYPRE_Int i, j, k, lev;
+  REAL_DH *avalL = F->avalL, *avalU = F->avalU, *work = ctx->work;
+  REAL_DH sum;
+
+  if (ptrL == NULL) {
+    SET_V_ERROR("level schedule not computed; call Factor_dhSolveLevelSetup()");
+  }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,k,lev,sum)
+#endif
+  {
+    /* forward solve lower triangle, one level at a time */
+    for (lev=0; lev<numLevelsL; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (k=ptrL[lev]; k<ptrL[lev+1]; ++k) {
+        i = rowsL[k];
+        sum = rhs[i];
+        for (j=rpL[k]; j<rpL[k+1]; ++j) sum -= avalL[j] * work[cvalL[j]];
+        work[i] = sum;
+      }
+    }
+
+    /* backward solve upper triangle, one level at a time */
+    for (lev=0; lev<numLevelsU; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (k=ptrU[lev]; k<ptrU[lev+1]; ++k) {
+        i = rowsU[k];
+        sum = work[i];
+        for (j=rpU[k]+1; j<rpU[k+1]; ++j) sum -= avalU[j] * work[cvalU[j]];
+        lhs[i] = work[i] = sum*avalU[rpU[k]];
+      }
+    }
+  }
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveSeqJacobi"
+void Factor_dhSolveSeqJacobi(double *rhs, double *lhs, Euclid_dh ctx)
+{
+  START_FUNC_DH
+  Factor_dh F = ctx->F;
+  HYPRE_Int *rp = F->rp, *cval = F->cval, *diag = F->diag;
+  HYPRE_Int i, j, s, m = F->m, sweeps = ctx->triSolveSweeps;
+  REAL_DH *aval = F->aval;
+  REAL_DH *y, *yOld, *x, *xOld, *tmp, *other;
+  REAL_DH sum;
+
+  if (F->work_jacobi == NULL) {
+    F->work_jacobi = (REAL_DH*)MALLOC_DH(m*sizeof(REAL_DH)); CHECK_V_ERROR;
+  }
+
+  /* L (unit diagonal): y_{s+1} = b - (L-I) y_s, y_0 = b */
+  yOld = rhs;
+  y = ctx->work;
+  tmp = F->work_jacobi;
+  for (s=0; s<sweeps; ++s) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,sum) schedule(static)
+#endif
+    for (i=0; i<m; ++i) {
+      sum = rhs[i];
+      for (j=rp[i]; j<diag[i]; ++j) sum -= aval[j] * yOld[cval[j]];
+      y[i] = sum;
+    }
+    yOld = y;
+    y = tmp;
+    tmp = yOld;
+  }
+  y = yOld;
+  other = (y == ctx->work) ? F->work_jacobi : ctx->work;
+
+  /* U (inverted diagonal stored): x_{s+1} = D^{-1} (y - (U-D) x_s), x_0 = D^{-1} y;
+     x alternates between lhs and the work vector not holding y, such
+     that the last sweep writes to lhs.
+   */
+  x = (sweeps % 2 == 0) ? lhs : other;
+  xOld = (sweeps % 2 == 0) ? other : lhs;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) schedule(static)
+#endif
+  for (i=0; i<m; ++i) x[i] = y[i]*aval[diag[i]];
+
+  for (s=0; s<sweeps; ++s) {
+    tmp = xOld;
+    xOld = x;
+    x = tmp;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,sum) schedule(static)
+#endif
+    for (i=0; i<m; ++i) {
+      sum = y[i];
+      for (j=diag[i]+1; j<rp[i+1]; ++j) sum -= aval[j] * xOld[cval[j]];
+      x[i] = sum*aval[diag[i]];
+    }
+  }
+  END_FUNC_DH
+}
+
 /*---------------------------------------------------------------
  * next two are used by Factor_dhPrintXXX methods
  *---------------------------------------------------------------*/
@@ -57,6 +57,19 @@ struct _factor_dh {
   hypre_MPI_Request  requests[MAX_MPI_TASKS];
   hypre_MPI_Status   status[MAX_MPI_TASKS];  
 
+  /* level schedules for multithreaded triangular solves (seq and bj only);
+     the rows of level k of L are levelRowsL[levelPtrL[k]..levelPtrL[k+1]-1];
+     rows within a level do not depend on each other.  For locality, the
+     strict triangles are copied in level order: the entries of the k-th
+     row of levelRowsL are cvalL/avalL[rpL[k]..rpL[k+1]-1] (same for U).
+  */
+  HYPRE_Int    numLevelsL, numLevelsU;
+  HYPRE_Int    *levelPtrL, *levelRowsL;
+  HYPRE_Int    *levelPtrU, *levelRowsU;
+  HYPRE_Int    *rpL, *cvalL, *rpU, *cvalU;
+  REAL_DH      *avalL, *avalU;
+  double       *work_jacobi;  /* second work vector for jacobi-type solves */
+
   bool debug;
 };
 
@@ -80,6 +93,14 @@ extern void Factor_dhSolveSetup(Factor_dh mat, SubdomainGraph_dh sg);
 extern void Factor_dhSolve(double *rhs, double *lhs, Euclid_dh ctx);
 extern void Factor_dhSolveSeq(double *rhs, double *lhs, Euclid_dh ctx);
 
+  /* multithreaded alternatives to Factor_dhSolveSeq() */
+extern void Factor_dhSolveLevelSetup(Factor_dh mat);
+  /* computes the level schedules of L and U; call once after factorization */
+extern void Factor_dhSolveSeqLevels(double *rhs, double *lhs, Euclid_dh ctx);
+  /* exact solves; the rows of each level are processed in parallel */
+extern void Factor_dhSolveSeqJacobi(double *rhs, double *lhs, Euclid_dh ctx);
+  /* approximate solves by ctx->triSolveSweeps jacobi sweeps on L and U */
+
   /* functions for monitoring stability */
 extern double Factor_dhCondEst(Factor_dh mat, Euclid_dh ctx);
 extern double Factor_dhMaxValue(Factor_dh mat);
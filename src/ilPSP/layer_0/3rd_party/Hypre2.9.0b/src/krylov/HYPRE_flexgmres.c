@@ -172,6 +172,24 @@ HYPRE_FlexGMRESGetMaxIter( HYPRE_Solver solver,
    return( hypre_FlexGMRESGetMaxIter( (void *) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_FlexGMRESSetOrthMethod, HYPRE_FlexGMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_FlexGMRESSetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int    orth_method )
+{
+   return( hypre_FlexGMRESSetOrthMethod( (void *) solver, orth_method ) );
+}
+
+HYPRE_Int
+HYPRE_FlexGMRESGetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int  * orth_method )
+{
+   return( hypre_FlexGMRESGetOrthMethod( (void *) solver, orth_method ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -59,10 +59,16 @@ HYPRE_GMRESSolve( HYPRE_Solver solver,
                         HYPRE_Vector b,
                         HYPRE_Vector x      )
 {
-   return( hypre_GMRESSolve( solver,
-                             A,
-                             b,
-                             x ) );
+   HYPRE_Int ierr;
+
+   hypre_ProfileBegin(HYPRE_PROFILE_GMRES_SOLVE);
+   ierr = hypre_GMRESSolve( solver,
+                            A,
+                            b,
+                            x );
+   hypre_ProfileEnd(HYPRE_PROFILE_GMRES_SOLVE);
+
+   return ierr;
 }
 
 /*--------------------------------------------------------------------------
@@ -172,6 +178,24 @@ HYPRE_GMRESGetMaxIter( HYPRE_Solver solver,
    return( hypre_GMRESGetMaxIter( (void *) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_GMRESSetOrthMethod, HYPRE_GMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GMRESSetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int    orth_method )
+{
+   return( hypre_GMRESSetOrthMethod( (void *) solver, orth_method ) );
+}
+
+HYPRE_Int
+HYPRE_GMRESGetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int  * orth_method )
+{
+   return( hypre_GMRESGetOrthMethod( (void *) solver, orth_method ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_GMRESSetStopCrit, HYPRE_GMRESGetStopCrit - OBSOLETE
  *--------------------------------------------------------------------------*/
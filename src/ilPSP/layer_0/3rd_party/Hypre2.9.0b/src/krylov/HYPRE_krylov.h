@@ -178,6 +178,18 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                    HYPRE_Int          recompute_residual_p);
 
+/**
+ * (Optional) Select the CG variant: 0 is the standard algorithm (default),
+ * 1 combines all inner products of an iteration in a single reduction
+ * (Chronopoulos/Gear), 2 additionally overlaps this reduction with the
+ * preconditioner and the matvec (pipelined CG, Ghysels/Vanroose).
+ * The variants 1 and 2 only support the default convergence test (with
+ * or without two-norm) and RecomputeResidualP; with other stopping
+ * options, the standard algorithm is used.
+ **/
+HYPRE_Int HYPRE_PCGSetVariant(HYPRE_Solver solver,
+                              HYPRE_Int    variant);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -256,6 +268,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                           HYPRE_Int          *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetVariant(HYPRE_Solver  solver,
+                              HYPRE_Int    *variant);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -346,6 +363,20 @@ HYPRE_Int HYPRE_GMRESSetMinIter(HYPRE_Solver solver, HYPRE_Int min_iter);
 HYPRE_Int HYPRE_GMRESSetMaxIter(HYPRE_Solver solver,
                           HYPRE_Int          max_iter);
 
+/**
+ * (Optional) Set the orthogonalization of the Krylov basis:
+ * 0 is modified Gram-Schmidt (default), with one global reduction per
+ * basis vector; 1 is classical Gram-Schmidt with reorthogonalization
+ * (CGS2) and 2 is classical Gram-Schmidt without it.  The classical
+ * variants compute all inner products of one pass with a single reduction
+ * (two resp. one reduction per iteration, independent of the Krylov
+ * dimension).  CGS2 is as robust as modified Gram-Schmidt; plain classical
+ * Gram-Schmidt may lose orthogonality and stagnate for ill-conditioned,
+ * poorly preconditioned systems.
+ **/
+HYPRE_Int HYPRE_GMRESSetOrthMethod(HYPRE_Solver solver,
+                          HYPRE_Int    orth_method);
+
 /**
  * (Optional) Set the maximum size of the Krylov space.
  **/
@@ -437,6 +468,11 @@ HYPRE_Int HYPRE_GMRESGetMinIter(HYPRE_Solver solver, HYPRE_Int *min_iter);
 HYPRE_Int HYPRE_GMRESGetMaxIter(HYPRE_Solver  solver,
                           HYPRE_Int          *max_iter);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetOrthMethod(HYPRE_Solver  solver,
+                          HYPRE_Int    *orth_method);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
@@ -527,6 +563,12 @@ HYPRE_Int HYPRE_FlexGMRESSetMinIter(HYPRE_Solver solver, HYPRE_Int min_iter);
 HYPRE_Int HYPRE_FlexGMRESSetMaxIter(HYPRE_Solver solver,
                               HYPRE_Int          max_iter);
 
+/**
+ * (Optional) Set the orthogonalization, see HYPRE\_GMRESSetOrthMethod.
+ **/
+HYPRE_Int HYPRE_FlexGMRESSetOrthMethod(HYPRE_Solver solver,
+                          HYPRE_Int    orth_method);
+
 /**
  * (Optional) Set the maximum size of the Krylov space.
  **/
@@ -596,6 +638,11 @@ HYPRE_Int HYPRE_FlexGMRESGetMinIter(HYPRE_Solver solver, HYPRE_Int *min_iter);
 HYPRE_Int HYPRE_FlexGMRESGetMaxIter(HYPRE_Solver  solver,
                               HYPRE_Int          *max_iter);
 
+/**
+ **/
+HYPRE_Int HYPRE_FlexGMRESGetOrthMethod(HYPRE_Solver  solver,
+                          HYPRE_Int    *orth_method);
+
 /**
  **/
 HYPRE_Int HYPRE_FlexGMRESGetKDim(HYPRE_Solver  solver,
@@ -692,6 +739,12 @@ HYPRE_Int
 HYPRE_LGMRESSetMaxIter(HYPRE_Solver solver,
                        HYPRE_Int          max_iter);
 
+/**
+ * (Optional) Set the orthogonalization, see HYPRE\_GMRESSetOrthMethod.
+ **/
+HYPRE_Int HYPRE_LGMRESSetOrthMethod(HYPRE_Solver solver,
+                          HYPRE_Int    orth_method);
+
 /**
  * (Optional) Set the maximum size of the approximation space
  * (includes the augmentation vectors).
@@ -769,6 +822,11 @@ HYPRE_Int HYPRE_LGMRESGetMinIter(HYPRE_Solver solver, HYPRE_Int *min_iter);
 HYPRE_Int HYPRE_LGMRESGetMaxIter(HYPRE_Solver  solver,
                            HYPRE_Int          *max_iter);
 
+/**
+ **/
+HYPRE_Int HYPRE_LGMRESGetOrthMethod(HYPRE_Solver  solver,
+                          HYPRE_Int    *orth_method);
+
 /**
  **/
 HYPRE_Int HYPRE_LGMRESGetKDim(HYPRE_Solver  solver,
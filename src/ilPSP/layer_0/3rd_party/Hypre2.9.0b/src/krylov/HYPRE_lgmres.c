@@ -189,6 +189,24 @@ HYPRE_LGMRESGetMaxIter( HYPRE_Solver solver,
    return( hypre_LGMRESGetMaxIter( (void *) solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_LGMRESSetOrthMethod, HYPRE_LGMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_LGMRESSetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int    orth_method )
+{
+   return( hypre_LGMRESSetOrthMethod( (void *) solver, orth_method ) );
+}
+
+HYPRE_Int
+HYPRE_LGMRESGetOrthMethod( HYPRE_Solver solver,
+                       HYPRE_Int  * orth_method )
+{
+   return( hypre_LGMRESGetOrthMethod( (void *) solver, orth_method ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
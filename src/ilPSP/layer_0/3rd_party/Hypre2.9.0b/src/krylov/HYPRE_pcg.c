@@ -72,10 +72,16 @@ HYPRE_PCGSolve( HYPRE_Solver solver,
                 HYPRE_Vector b,
                 HYPRE_Vector x      )
 {
-   return( hypre_PCGSolve( (void *) solver,
-                           (void *) A,
-                           (void *) b,
-                           (void *) x ) );
+   HYPRE_Int ierr;
+
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG_SOLVE);
+   ierr = hypre_PCGSolve( (void *) solver,
+                          (void *) A,
+                          (void *) b,
+                          (void *) x );
+   hypre_ProfileEnd(HYPRE_PROFILE_PCG_SOLVE);
+
+   return ierr;
 }
 
 /*--------------------------------------------------------------------------
@@ -277,6 +283,24 @@ HYPRE_PCGGetRecomputeResidualP( HYPRE_Solver solver,
    return( hypre_PCGGetRecomputeResidualP( (void *) solver, recompute_residual_p ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetVariant, HYPRE_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetVariant( HYPRE_Solver solver,
+                     HYPRE_Int    variant )
+{
+   return( hypre_PCGSetVariant( (void *) solver, variant ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetVariant( HYPRE_Solver solver,
+                     HYPRE_Int  * variant )
+{
+   return( hypre_PCGGetVariant( (void *) solver, variant ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -67,6 +67,7 @@ hypre_FlexGMRESFunctionsCreate(
    fgmres_functions->ClearVector = ClearVector;
    fgmres_functions->ScaleVector = ScaleVector;
    fgmres_functions->Axpy = Axpy;
+   fgmres_functions->MultiInnerProd = NULL;
 /* default preconditioner must be set here but can be changed later... */
    fgmres_functions->precond_setup = PrecondSetup;
    fgmres_functions->precond       = Precond;
@@ -77,6 +78,22 @@ hypre_FlexGMRESFunctionsCreate(
    return fgmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESFunctionsSetMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESFunctionsSetMultiInnerProd(
+   hypre_FlexGMRESFunctions *fgmres_functions,
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod )
+   )
+{
+   fgmres_functions->MultiInnerProd = MultiInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -98,6 +115,7 @@ hypre_FlexGMRESCreate( hypre_FlexGMRESFunctions *fgmres_functions )
    (fgmres_data -> min_iter)       = 0;
    (fgmres_data -> max_iter)       = 1000;
    (fgmres_data -> rel_change)     = 0;
+   (fgmres_data -> orth_method)    = 0;
    (fgmres_data -> stop_crit)      = 0; /* rel. residual norm */
    (fgmres_data -> converged)      = 0;
    (fgmres_data -> precond_data)   = NULL;
@@ -259,6 +277,68 @@ hypre_FlexGMRESSetup( void *fgmres_vdata,
    return hypre_error_flag;
 }
  
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESClassicalGramSchmidt
+ *
+ * orthogonalizes p[i] against p[0], ..., p[i-1] by classical Gram-Schmidt
+ * with one reorthogonalization (orth_method 1, CGS2) or without it
+ * (orth_method 2, a single reduction, but orthogonality may be lost for
+ * ill-conditioned bases).  All inner products of a pass, including <p[i],p[i]>,
+ * are computed by one MultiInnerProd, i.e. with a single global reduction;
+ * the norm of the result follows from
+ *    ||p[i] - sum_j h_j p[j]||^2 = <p[i],p[i]> - sum_j h_j^2.
+ * The coefficients are returned in hh[j][i-1], the norm as return value;
+ * dots is work space of length 2*(i+1).
+ *--------------------------------------------------------------------------*/
+
+static double
+hypre_FlexGMRESClassicalGramSchmidt( hypre_FlexGMRESFunctions *fgmres_functions,
+                                 HYPRE_Int   orth_method,
+                                 HYPRE_Int   i,
+                                 void      **p,
+                                 double    **hh,
+                                 double     *dots )
+{
+   double    *local_prod = dots;
+   double    *prod       = dots + (i+1);
+   double     pp = 0.0, t = 0.0;
+   HYPRE_Int  j, pass;
+   HYPRE_Int  num_passes = (orth_method == 1) ? 2 : 1;
+
+   for (j=0; j < i; j++)
+      hh[j][i-1] = 0.0;
+
+   for (pass=0; pass < num_passes; pass++)
+   {
+      /* prod[j] = <p[j],p[i]>, j <= i */
+      if (fgmres_functions->MultiInnerProd != NULL)
+      {
+         (*(fgmres_functions->MultiInnerProd))(i+1, p, p[i], local_prod, prod);
+      }
+      else
+      {
+         for (j=0; j <= i; j++)
+            prod[j] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
+      }
+
+      pp = prod[i];
+      t  = pp;
+      for (j=0; j < i; j++)
+      {
+         hh[j][i-1] += prod[j];
+         (*(fgmres_functions->Axpy))(-prod[j],p[j],p[i]);
+         t -= prod[j]*prod[j];
+      }
+   }
+
+   /* the norm drops by more than a factor of 10: the difference above is
+      dominated by rounding errors, compute the norm explicitly */
+   if (t <= 1.0e-2*pp)
+      t = (*(fgmres_functions->InnerProd))(p[i],p[i]);
+
+   return sqrt(t);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESSolve
  *-------------------------------------------------------------------------*/
@@ -272,6 +352,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    hypre_FlexGMRESData  *fgmres_data   = fgmres_vdata;
    hypre_FlexGMRESFunctions *fgmres_functions = fgmres_data->functions;
    HYPRE_Int 		     k_dim        = (fgmres_data -> k_dim);
+   HYPRE_Int               orth_method  = (fgmres_data -> orth_method);
    HYPRE_Int               min_iter     = (fgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (fgmres_data -> max_iter);
    HYPRE_Int               rel_change   = (fgmres_data -> rel_change);
@@ -300,6 +381,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    double     *rs, **hh, *c, *s; 
+   double     *dots = NULL;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    double     epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -344,6 +426,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 
 
   /* fgmres mod. - need non-modified hessenberg ???? */
+   if (orth_method) dots = hypre_CTAllocF(double,2*(k_dim+1),fgmres_functions);
    hh = hypre_CTAllocF(double*,k_dim+1,fgmres_functions); 
    for (i=0; i < k_dim+1; i++)
    {	
@@ -476,6 +559,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            }
 
            hypre_TFreeF(hh,fgmres_functions); 
+           if (orth_method) hypre_TFreeF(dots,fgmres_functions);
 	   return hypre_error_flag;
            
 	}
@@ -528,13 +612,22 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
            (*(fgmres_functions->Matvec))(matvec_data, 1.0, A, pre_vecs[i-1], 0.0, p[i]);
            
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if (orth_method == 0)
+           {
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
+           }
+           else
            {
-              hh[j][i-1] = (*(fgmres_functions->InnerProd))(p[j],p[i]);
-              (*(fgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* classical Gram-Schmidt, batched inner products */
+              t = hypre_FlexGMRESClassicalGramSchmidt(fgmres_functions, orth_method,
+                                                  i, p, hh, dots);
            }
-           t = sqrt((*(fgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -710,6 +803,7 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
    	hypre_TFreeF(hh[i],fgmres_functions);
    }
    hypre_TFreeF(hh,fgmres_functions); 
+   if (orth_method) hypre_TFreeF(dots,fgmres_functions);
 
    return hypre_error_flag;
 }
@@ -882,6 +976,37 @@ hypre_FlexGMRESGetMaxIter( void *fgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESSetOrthMethod, hypre_FlexGMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESSetOrthMethod( void   *fgmres_vdata,
+                   HYPRE_Int   orth_method )
+{
+   hypre_FlexGMRESData *fgmres_data = fgmres_vdata;
+
+   if (orth_method < 0 || orth_method > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (fgmres_data -> orth_method) = orth_method;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_FlexGMRESGetOrthMethod( void   *fgmres_vdata,
+                   HYPRE_Int * orth_method )
+{
+   hypre_FlexGMRESData *fgmres_data = fgmres_vdata;
+
+   *orth_method = (fgmres_data -> orth_method);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESSetStopCrit, hypre_FlexGMRESGetStopCrit
@@ -65,6 +65,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->MultiInnerProd = NULL;
 /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -72,6 +73,22 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetMultiInnerProd(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod )
+   )
+{
+   gmres_functions->MultiInnerProd = MultiInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -93,6 +110,7 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> min_iter)       = 0;
    (gmres_data -> max_iter)       = 1000;
    (gmres_data -> rel_change)     = 0;
+   (gmres_data -> orth_method)    = 0;
    (gmres_data -> skip_real_r_check) = 0;
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
@@ -236,6 +254,68 @@ hypre_GMRESSetup( void *gmres_vdata,
    return hypre_error_flag;
 }
  
+/*--------------------------------------------------------------------------
+ * hypre_GMRESClassicalGramSchmidt
+ *
+ * orthogonalizes p[i] against p[0], ..., p[i-1] by classical Gram-Schmidt
+ * with one reorthogonalization (orth_method 1, CGS2) or without it
+ * (orth_method 2, a single reduction, but orthogonality may be lost for
+ * ill-conditioned bases).  All inner products of a pass, including <p[i],p[i]>,
+ * are computed by one MultiInnerProd, i.e. with a single global reduction;
+ * the norm of the result follows from
+ *    ||p[i] - sum_j h_j p[j]||^2 = <p[i],p[i]> - sum_j h_j^2.
+ * The coefficients are returned in hh[j][i-1], the norm as return value;
+ * dots is work space of length 2*(i+1).
+ *--------------------------------------------------------------------------*/
+
+static double
+hypre_GMRESClassicalGramSchmidt( hypre_GMRESFunctions *gmres_functions,
+                                 HYPRE_Int   orth_method,
+                                 HYPRE_Int   i,
+                                 void      **p,
+                                 double    **hh,
+                                 double     *dots )
+{
+   double    *local_prod = dots;
+   double    *prod       = dots + (i+1);
+   double     pp = 0.0, t = 0.0;
+   HYPRE_Int  j, pass;
+   HYPRE_Int  num_passes = (orth_method == 1) ? 2 : 1;
+
+   for (j=0; j < i; j++)
+      hh[j][i-1] = 0.0;
+
+   for (pass=0; pass < num_passes; pass++)
+   {
+      /* prod[j] = <p[j],p[i]>, j <= i */
+      if (gmres_functions->MultiInnerProd != NULL)
+      {
+         (*(gmres_functions->MultiInnerProd))(i+1, p, p[i], local_prod, prod);
+      }
+      else
+      {
+         for (j=0; j <= i; j++)
+            prod[j] = (*(gmres_functions->InnerProd))(p[j],p[i]);
+      }
+
+      pp = prod[i];
+      t  = pp;
+      for (j=0; j < i; j++)
+      {
+         hh[j][i-1] += prod[j];
+         (*(gmres_functions->Axpy))(-prod[j],p[j],p[i]);
+         t -= prod[j]*prod[j];
+      }
+   }
+
+   /* the norm drops by more than a factor of 10: the difference above is
+      dominated by rounding errors, compute the norm explicitly */
+   if (t <= 1.0e-2*pp)
+      t = (*(gmres_functions->InnerProd))(p[i],p[i]);
+
+   return sqrt(t);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSolve
  *-------------------------------------------------------------------------*/
@@ -249,6 +329,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    hypre_GMRESData  *gmres_data   = gmres_vdata;
    hypre_GMRESFunctions *gmres_functions = gmres_data->functions;
    HYPRE_Int 		     k_dim        = (gmres_data -> k_dim);
+   HYPRE_Int               orth_method  = (gmres_data -> orth_method);
    HYPRE_Int               min_iter     = (gmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (gmres_data -> max_iter);
    HYPRE_Int               rel_change   = (gmres_data -> rel_change);
@@ -279,6 +360,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    double     *rs, **hh, *c, *s, *rs_2; 
+   double     *dots = NULL;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    double     epsilon, gamma, t, r_norm, b_norm, den_norm, x_norm;
@@ -321,6 +403,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    
 
 
+   if (orth_method) dots = hypre_CTAllocF(double,2*(k_dim+1),gmres_functions);
    hh = hypre_CTAllocF(double*,k_dim+1,gmres_functions); 
    for (i=0; i < k_dim+1; i++)
    {	
@@ -454,6 +537,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
            if (rel_change)  hypre_TFreeF(rs_2,gmres_functions);
            for (i=0; i < k_dim+1; i++) hypre_TFreeF(hh[i],gmres_functions);
            hypre_TFreeF(hh,gmres_functions); 
+           if (orth_method) hypre_TFreeF(dots,gmres_functions);
 	   return hypre_error_flag;
            
 	}
@@ -497,13 +581,22 @@ hypre_GMRESSolve(void  *gmres_vdata,
            (*(gmres_functions->ClearVector))(r);
            precond(precond_data, A, p[i-1], r);
            (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if (orth_method == 0)
            {
-              hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-              (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
+                 (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
+           }
+           else
+           {
+              /* classical Gram-Schmidt, batched inner products */
+              t = hypre_GMRESClassicalGramSchmidt(gmres_functions, orth_method,
+                                                  i, p, hh, dots);
            }
-           t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -847,6 +940,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    	hypre_TFreeF(hh[i],gmres_functions);
    }
    hypre_TFreeF(hh,gmres_functions); 
+   if (orth_method) hypre_TFreeF(dots,gmres_functions);
 
    return hypre_error_flag;
 }
@@ -1018,6 +1112,37 @@ hypre_GMRESGetMaxIter( void *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetOrthMethod, hypre_GMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetOrthMethod( void   *gmres_vdata,
+                   HYPRE_Int   orth_method )
+{
+   hypre_GMRESData *gmres_data = gmres_vdata;
+
+   if (orth_method < 0 || orth_method > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (gmres_data -> orth_method) = orth_method;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetOrthMethod( void   *gmres_vdata,
+                   HYPRE_Int * orth_method )
+{
+   hypre_GMRESData *gmres_data = gmres_vdata;
+
+   *orth_method = (gmres_data -> orth_method);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetRelChange, hypre_GMRESGetRelChange
  *--------------------------------------------------------------------------*/
@@ -73,6 +73,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: prod[k] = <x[k],y>, k < n, with a single reduction,
+      using local_prod as work space */
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -89,6 +94,7 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
+   HYPRE_Int      orth_method; /* 0: MGS, 1: CGS2, 2: CGS (one reduction) */
    HYPRE_Int      skip_real_r_check;
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
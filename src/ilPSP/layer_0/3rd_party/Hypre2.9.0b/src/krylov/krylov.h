@@ -457,6 +457,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: prod[k] = <x[k],y>, k < n, with a single reduction,
+      using local_prod as work space */
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -473,6 +478,7 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
+   HYPRE_Int      orth_method; /* 0: MGS, 1: CGS2, 2: CGS (one reduction) */
    HYPRE_Int      skip_real_r_check;
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
@@ -625,6 +631,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: prod[k] = <x[k],y>, k < n, with a single reduction,
+      using local_prod as work space */
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -642,6 +653,7 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
+   HYPRE_Int      orth_method; /* 0: MGS, 1: CGS2, 2: CGS (one reduction) */
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    double   tol;
@@ -802,6 +814,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: prod[k] = <x[k],y>, k < n, with a single reduction,
+      using local_prod as work space */
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -822,6 +839,7 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
+   HYPRE_Int      orth_method; /* 0: MGS, 1: CGS2, 2: CGS (one reduction) */
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    double   tol;
@@ -978,6 +996,15 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: n inner products <x[k],y[k]> with a single (nonblocking)
+      reduction; the local products are stored in local_prod and the
+      reduced ones in prod, which is only valid after MultiInnerProdWait.
+      If not set, the single-reduction variants fall back to InnerProd. */
+   HYPRE_Int    (*MultiInnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                   double *local_prod, double *prod,
+                                   hypre_MPI_Request *request );
+   HYPRE_Int    (*MultiInnerProdWait)  ( hypre_MPI_Request *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 } hypre_PCGFunctions;
@@ -1015,6 +1042,13 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - variant selects the CG recurrence: 0 is the standard PCG (default) with
+ two or three separate inner products per iteration; 1 is the single-reduction
+ variant (Chronopoulos/Gear), all inner products of an iteration are combined
+ in one reduction; 2 is the pipelined variant (Ghysels/Vanroose), where this
+ reduction is overlapped with the preconditioner and the matvec.  The variants
+ 1 and 2 use the standard algorithm if rel_change, rtol, cf_tol, stop_crit,
+ atolf or recompute_residual are set.
  */
 
 typedef struct
@@ -1038,6 +1072,14 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   HYPRE_Int      variant;
+   void    *u, *w;       /* variant>0: u = C*r, w = A*u */
+   void    *m, *n;       /* variant 2: m = C*w, n = A*m */
+   void    *q, *z;       /* variant 2: q = C*s, z = A*q */
+   double   local_prods[4];
+   double   prods[4];
+   hypre_MPI_Request request;
+
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
    void    *precond_data;
@@ -1149,6 +1191,7 @@ HYPRE_Int hypre_CGNRGetFinalRelativeResidualNorm ( void *cgnr_vdata , double *re
 
 /* gmres.c */
 hypre_GMRESFunctions *hypre_GMRESFunctionsCreate ( char *(*CAlloc )(size_t count ,size_t elt_size ), HYPRE_Int (*Free )(char *ptr ), HYPRE_Int (*CommInfo )(void *A ,HYPRE_Int *my_id ,HYPRE_Int *num_procs ), void *(*CreateVector )(void *vector ), void *(*CreateVectorArray )(HYPRE_Int size ,void *vectors ), HYPRE_Int (*DestroyVector )(void *vector ), void *(*MatvecCreate )(void *A ,void *x ), HYPRE_Int (*Matvec )(void *matvec_data ,double alpha ,void *A ,void *x ,double beta ,void *y ), HYPRE_Int (*MatvecDestroy )(void *matvec_data ), double (*InnerProd )(void *x ,void *y ), HYPRE_Int (*CopyVector )(void *x ,void *y ), HYPRE_Int (*ClearVector )(void *x ), HYPRE_Int (*ScaleVector )(double alpha ,void *x ), HYPRE_Int (*Axpy )(double alpha ,void *x ,void *y ), HYPRE_Int (*PrecondSetup )(void *vdata ,void *A ,void *b ,void *x ), HYPRE_Int (*Precond )(void *vdata ,void *A ,void *b ,void *x ));
+HYPRE_Int hypre_GMRESFunctionsSetMultiInnerProd ( hypre_GMRESFunctions *gmres_functions , HYPRE_Int (*MultiInnerProd )(HYPRE_Int n ,void **x ,void *y ,double *local_prod ,double *prod ));
 void *hypre_GMRESCreate ( hypre_GMRESFunctions *gmres_functions );
 HYPRE_Int hypre_GMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_GMRESGetResidual ( void *gmres_vdata , void **residual );
@@ -1166,6 +1209,8 @@ HYPRE_Int hypre_GMRESSetMinIter ( void *gmres_vdata , HYPRE_Int min_iter );
 HYPRE_Int hypre_GMRESGetMinIter ( void *gmres_vdata , HYPRE_Int *min_iter );
 HYPRE_Int hypre_GMRESSetMaxIter ( void *gmres_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_GMRESGetMaxIter ( void *gmres_vdata , HYPRE_Int *max_iter );
+HYPRE_Int hypre_GMRESSetOrthMethod ( void *gmres_vdata , HYPRE_Int orth_method );
+HYPRE_Int hypre_GMRESGetOrthMethod ( void *gmres_vdata , HYPRE_Int *orth_method );
 HYPRE_Int hypre_GMRESSetRelChange ( void *gmres_vdata , HYPRE_Int rel_change );
 HYPRE_Int hypre_GMRESGetRelChange ( void *gmres_vdata , HYPRE_Int *rel_change );
 HYPRE_Int hypre_GMRESSetSkipRealResidualCheck ( void *gmres_vdata , HYPRE_Int skip_real_r_check );
@@ -1184,6 +1229,7 @@ HYPRE_Int hypre_GMRESGetFinalRelativeResidualNorm ( void *gmres_vdata , double *
 
 /* flexgmres.c */
 hypre_FlexGMRESFunctions *hypre_FlexGMRESFunctionsCreate ( char *(*CAlloc )(size_t count ,size_t elt_size ), HYPRE_Int (*Free )(char *ptr ), HYPRE_Int (*CommInfo )(void *A ,HYPRE_Int *my_id ,HYPRE_Int *num_procs ), void *(*CreateVector )(void *vector ), void *(*CreateVectorArray )(HYPRE_Int size ,void *vectors ), HYPRE_Int (*DestroyVector )(void *vector ), void *(*MatvecCreate )(void *A ,void *x ), HYPRE_Int (*Matvec )(void *matvec_data ,double alpha ,void *A ,void *x ,double beta ,void *y ), HYPRE_Int (*MatvecDestroy )(void *matvec_data ), double (*InnerProd )(void *x ,void *y ), HYPRE_Int (*CopyVector )(void *x ,void *y ), HYPRE_Int (*ClearVector )(void *x ), HYPRE_Int (*ScaleVector )(double alpha ,void *x ), HYPRE_Int (*Axpy )(double alpha ,void *x ,void *y ), HYPRE_Int (*PrecondSetup )(void *vdata ,void *A ,void *b ,void *x ), HYPRE_Int (*Precond )(void *vdata ,void *A ,void *b ,void *x ));
+HYPRE_Int hypre_FlexGMRESFunctionsSetMultiInnerProd ( hypre_FlexGMRESFunctions *fgmres_functions , HYPRE_Int (*MultiInnerProd )(HYPRE_Int n ,void **x ,void *y ,double *local_prod ,double *prod ));
 void *hypre_FlexGMRESCreate ( hypre_FlexGMRESFunctions *fgmres_functions );
 HYPRE_Int hypre_FlexGMRESDestroy ( void *fgmres_vdata );
 HYPRE_Int hypre_FlexGMRESGetResidual ( void *fgmres_vdata , void **residual );
@@ -1201,6 +1247,8 @@ HYPRE_Int hypre_FlexGMRESSetMinIter ( void *fgmres_vdata , HYPRE_Int min_iter );
 HYPRE_Int hypre_FlexGMRESGetMinIter ( void *fgmres_vdata , HYPRE_Int *min_iter );
 HYPRE_Int hypre_FlexGMRESSetMaxIter ( void *fgmres_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_FlexGMRESGetMaxIter ( void *fgmres_vdata , HYPRE_Int *max_iter );
+HYPRE_Int hypre_FlexGMRESSetOrthMethod ( void *fgmres_vdata , HYPRE_Int orth_method );
+HYPRE_Int hypre_FlexGMRESGetOrthMethod ( void *fgmres_vdata , HYPRE_Int *orth_method );
 HYPRE_Int hypre_FlexGMRESSetStopCrit ( void *fgmres_vdata , HYPRE_Int stop_crit );
 HYPRE_Int hypre_FlexGMRESGetStopCrit ( void *fgmres_vdata , HYPRE_Int *stop_crit );
 HYPRE_Int hypre_FlexGMRESSetPrecond ( void *fgmres_vdata , HYPRE_Int (*precond )(), HYPRE_Int (*precond_setup )(), void *precond_data );
@@ -1217,6 +1265,7 @@ HYPRE_Int hypre_FlexGMRESModifyPCDefault ( void *precond_data , HYPRE_Int iterat
 
 /* lgmres.c */
 hypre_LGMRESFunctions *hypre_LGMRESFunctionsCreate ( char *(*CAlloc )(size_t count ,size_t elt_size ), HYPRE_Int (*Free )(char *ptr ), HYPRE_Int (*CommInfo )(void *A ,HYPRE_Int *my_id ,HYPRE_Int *num_procs ), void *(*CreateVector )(void *vector ), void *(*CreateVectorArray )(HYPRE_Int size ,void *vectors ), HYPRE_Int (*DestroyVector )(void *vector ), void *(*MatvecCreate )(void *A ,void *x ), HYPRE_Int (*Matvec )(void *matvec_data ,double alpha ,void *A ,void *x ,double beta ,void *y ), HYPRE_Int (*MatvecDestroy )(void *matvec_data ), double (*InnerProd )(void *x ,void *y ), HYPRE_Int (*CopyVector )(void *x ,void *y ), HYPRE_Int (*ClearVector )(void *x ), HYPRE_Int (*ScaleVector )(double alpha ,void *x ), HYPRE_Int (*Axpy )(double alpha ,void *x ,void *y ), HYPRE_Int (*PrecondSetup )(void *vdata ,void *A ,void *b ,void *x ), HYPRE_Int (*Precond )(void *vdata ,void *A ,void *b ,void *x ));
+HYPRE_Int hypre_LGMRESFunctionsSetMultiInnerProd ( hypre_LGMRESFunctions *lgmres_functions , HYPRE_Int (*MultiInnerProd )(HYPRE_Int n ,void **x ,void *y ,double *local_prod ,double *prod ));
 void *hypre_LGMRESCreate ( hypre_LGMRESFunctions *lgmres_functions );
 HYPRE_Int hypre_LGMRESDestroy ( void *lgmres_vdata );
 HYPRE_Int hypre_LGMRESGetResidual ( void *lgmres_vdata , void **residual );
@@ -1236,6 +1285,8 @@ HYPRE_Int hypre_LGMRESSetMinIter ( void *lgmres_vdata , HYPRE_Int min_iter );
 HYPRE_Int hypre_LGMRESGetMinIter ( void *lgmres_vdata , HYPRE_Int *min_iter );
 HYPRE_Int hypre_LGMRESSetMaxIter ( void *lgmres_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_LGMRESGetMaxIter ( void *lgmres_vdata , HYPRE_Int *max_iter );
+HYPRE_Int hypre_LGMRESSetOrthMethod ( void *lgmres_vdata , HYPRE_Int orth_method );
+HYPRE_Int hypre_LGMRESGetOrthMethod ( void *lgmres_vdata , HYPRE_Int *orth_method );
 HYPRE_Int hypre_LGMRESSetStopCrit ( void *lgmres_vdata , HYPRE_Int stop_crit );
 HYPRE_Int hypre_LGMRESGetStopCrit ( void *lgmres_vdata , HYPRE_Int *stop_crit );
 HYPRE_Int hypre_LGMRESSetPrecond ( void *lgmres_vdata , HYPRE_Int (*precond )(), HYPRE_Int (*precond_setup )(), void *precond_data );
@@ -1295,6 +1346,8 @@ HYPRE_Int HYPRE_GMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
 HYPRE_Int HYPRE_GMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
 HYPRE_Int HYPRE_GMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_GMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+HYPRE_Int HYPRE_GMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
+HYPRE_Int HYPRE_GMRESGetOrthMethod ( HYPRE_Solver solver , HYPRE_Int *orth_method );
 HYPRE_Int HYPRE_GMRESSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_GMRESGetStopCrit ( HYPRE_Solver solver , HYPRE_Int *stop_crit );
 HYPRE_Int HYPRE_GMRESSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
@@ -1327,6 +1380,8 @@ HYPRE_Int HYPRE_FlexGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter )
 HYPRE_Int HYPRE_FlexGMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
 HYPRE_Int HYPRE_FlexGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_FlexGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+HYPRE_Int HYPRE_FlexGMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
+HYPRE_Int HYPRE_FlexGMRESGetOrthMethod ( HYPRE_Solver solver , HYPRE_Int *orth_method );
 HYPRE_Int HYPRE_FlexGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_FlexGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_FlexGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1356,6 +1411,8 @@ HYPRE_Int HYPRE_LGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
 HYPRE_Int HYPRE_LGMRESGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
 HYPRE_Int HYPRE_LGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_LGMRESGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+HYPRE_Int HYPRE_LGMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
+HYPRE_Int HYPRE_LGMRESGetOrthMethod ( HYPRE_Solver solver , HYPRE_Int *orth_method );
 HYPRE_Int HYPRE_LGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_LGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_LGMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1392,6 +1449,8 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int recomp
 HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
 HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+HYPRE_Int HYPRE_PCGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
+HYPRE_Int HYPRE_PCGGetVariant ( HYPRE_Solver solver , HYPRE_Int *variant );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1405,11 +1464,13 @@ HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver , void **residual );
 
 /* pcg.c */
 hypre_PCGFunctions *hypre_PCGFunctionsCreate ( char *(*CAlloc )(size_t count ,size_t elt_size ), HYPRE_Int (*Free )(char *ptr ), HYPRE_Int (*CommInfo )(void *A ,HYPRE_Int *my_id ,HYPRE_Int *num_procs ), void *(*CreateVector )(void *vector ), HYPRE_Int (*DestroyVector )(void *vector ), void *(*MatvecCreate )(void *A ,void *x ), HYPRE_Int (*Matvec )(void *matvec_data ,double alpha ,void *A ,void *x ,double beta ,void *y ), HYPRE_Int (*MatvecDestroy )(void *matvec_data ), double (*InnerProd )(void *x ,void *y ), HYPRE_Int (*CopyVector )(void *x ,void *y ), HYPRE_Int (*ClearVector )(void *x ), HYPRE_Int (*ScaleVector )(double alpha ,void *x ), HYPRE_Int (*Axpy )(double alpha ,void *x ,void *y ), HYPRE_Int (*PrecondSetup )(void *vdata ,void *A ,void *b ,void *x ), HYPRE_Int (*Precond )(void *vdata ,void *A ,void *b ,void *x ));
+HYPRE_Int hypre_PCGFunctionsSetMultiInnerProd ( hypre_PCGFunctions *pcg_functions , HYPRE_Int (*MultiInnerProdStart )(HYPRE_Int n ,void **x ,void **y ,double *local_prod ,double *prod ,hypre_MPI_Request *request ), HYPRE_Int (*MultiInnerProdWait )(hypre_MPI_Request *request ));
 void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
 HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata , void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+HYPRE_Int hypre_PCGSolveSingleReduction ( void *pcg_vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata , double tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata , double *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata , double a_tol );
@@ -1430,6 +1491,8 @@ HYPRE_Int hypre_PCGSetRecomputeResidual ( void *pcg_vdata , HYPRE_Int recompute_
 HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
 HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
 HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+HYPRE_Int hypre_PCGSetVariant ( void *pcg_vdata , HYPRE_Int variant );
+HYPRE_Int hypre_PCGGetVariant ( void *pcg_vdata , HYPRE_Int *variant );
 HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
 HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
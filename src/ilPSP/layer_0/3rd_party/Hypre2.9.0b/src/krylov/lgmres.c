@@ -65,6 +65,7 @@ hypre_LGMRESFunctionsCreate(
    lgmres_functions->ClearVector = ClearVector;
    lgmres_functions->ScaleVector = ScaleVector;
    lgmres_functions->Axpy = Axpy;
+   lgmres_functions->MultiInnerProd = NULL;
 /* default preconditioner must be set here but can be changed later... */
    lgmres_functions->precond_setup = PrecondSetup;
    lgmres_functions->precond       = Precond;
@@ -72,6 +73,22 @@ hypre_LGMRESFunctionsCreate(
    return lgmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESFunctionsSetMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESFunctionsSetMultiInnerProd(
+   hypre_LGMRESFunctions *lgmres_functions,
+   HYPRE_Int    (*MultiInnerProd) ( HYPRE_Int n, void **x, void *y,
+                                    double *local_prod, double *prod )
+   )
+{
+   lgmres_functions->MultiInnerProd = MultiInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_LGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -93,6 +110,7 @@ hypre_LGMRESCreate( hypre_LGMRESFunctions *lgmres_functions )
    (lgmres_data -> min_iter)       = 0;
    (lgmres_data -> max_iter)       = 1000;
    (lgmres_data -> rel_change)     = 0;
+   (lgmres_data -> orth_method)    = 0;
    (lgmres_data -> stop_crit)      = 0; /* rel. residual norm */
    (lgmres_data -> converged)      = 0;
    (lgmres_data -> precond_data)   = NULL;
@@ -275,6 +293,68 @@ hypre_LGMRESSetup( void *lgmres_vdata,
    return hypre_error_flag;
 }
  
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESClassicalGramSchmidt
+ *
+ * orthogonalizes p[i] against p[0], ..., p[i-1] by classical Gram-Schmidt
+ * with one reorthogonalization (orth_method 1, CGS2) or without it
+ * (orth_method 2, a single reduction, but orthogonality may be lost for
+ * ill-conditioned bases).  All inner products of a pass, including <p[i],p[i]>,
+ * are computed by one MultiInnerProd, i.e. with a single global reduction;
+ * the norm of the result follows from
+ *    ||p[i] - sum_j h_j p[j]||^2 = <p[i],p[i]> - sum_j h_j^2.
+ * The coefficients are returned in hh[j][i-1], the norm as return value;
+ * dots is work space of length 2*(i+1).
+ *--------------------------------------------------------------------------*/
+
+static double
+hypre_LGMRESClassicalGramSchmidt( hypre_LGMRESFunctions *lgmres_functions,
+                                 HYPRE_Int   orth_method,
+                                 HYPRE_Int   i,
+                                 void      **p,
+                                 double    **hh,
+                                 double     *dots )
+{
+   double    *local_prod = dots;
+   double    *prod       = dots + (i+1);
+   double     pp = 0.0, t = 0.0;
+   HYPRE_Int  j, pass;
+   HYPRE_Int  num_passes = (orth_method == 1) ? 2 : 1;
+
+   for (j=0; j < i; j++)
+      hh[j][i-1] = 0.0;
+
+   for (pass=0; pass < num_passes; pass++)
+   {
+      /* prod[j] = <p[j],p[i]>, j <= i */
+      if (lgmres_functions->MultiInnerProd != NULL)
+      {
+         (*(lgmres_functions->MultiInnerProd))(i+1, p, p[i], local_prod, prod);
+      }
+      else
+      {
+         for (j=0; j <= i; j++)
+            prod[j] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
+      }
+
+      pp = prod[i];
+      t  = pp;
+      for (j=0; j < i; j++)
+      {
+         hh[j][i-1] += prod[j];
+         (*(lgmres_functions->Axpy))(-prod[j],p[j],p[i]);
+         t -= prod[j]*prod[j];
+      }
+   }
+
+   /* the norm drops by more than a factor of 10: the difference above is
+      dominated by rounding errors, compute the norm explicitly */
+   if (t <= 1.0e-2*pp)
+      t = (*(lgmres_functions->InnerProd))(p[i],p[i]);
+
+   return sqrt(t);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_LGMRESSolve
 
@@ -291,6 +371,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    hypre_LGMRESData  *lgmres_data   = lgmres_vdata;
    hypre_LGMRESFunctions *lgmres_functions = lgmres_data->functions;
    HYPRE_Int 		     k_dim        = (lgmres_data -> k_dim);
+   HYPRE_Int               orth_method  = (lgmres_data -> orth_method);
    HYPRE_Int               min_iter     = (lgmres_data -> min_iter);
    HYPRE_Int 		     max_iter     = (lgmres_data -> max_iter);
    HYPRE_Int               rel_change   = (lgmres_data -> rel_change);
@@ -326,6 +407,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    HYPRE_Int        break_value = 0;
    HYPRE_Int	      i, j, k;
    double     *rs, **hh, *c, *s; 
+   double     *dots = NULL;
    HYPRE_Int        iter; 
    HYPRE_Int        my_id, num_procs;
    double     epsilon, gamma, t, r_norm, b_norm, den_norm;
@@ -369,6 +451,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
 
    
   /* lgmres mod. - need non-modified hessenberg to avoid aug_dim matvecs */
+   if (orth_method) dots = hypre_CTAllocF(double,2*(k_dim+aug_dim+1),lgmres_functions);
    hh = hypre_CTAllocF(double*,k_dim+aug_dim+1,lgmres_functions); 
    for (i=0; i < k_dim+aug_dim+1; i++)
    {	
@@ -508,6 +591,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            }
 
            hypre_TFreeF(hh,lgmres_functions); 
+           if (orth_method) hypre_TFreeF(dots,lgmres_functions);
 	   return hypre_error_flag;
            
 	}
@@ -585,13 +669,22 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
            }
            /*---*/
 
-           /* modified Gram_Schmidt */
-           for (j=0; j < i; j++)
+           if (orth_method == 0)
+           {
+              /* modified Gram_Schmidt */
+              for (j=0; j < i; j++)
+              {
+                 hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
+                 (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              }
+              t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
+           }
+           else
            {
-              hh[j][i-1] = (*(lgmres_functions->InnerProd))(p[j],p[i]);
-              (*(lgmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+              /* classical Gram-Schmidt, batched inner products */
+              t = hypre_LGMRESClassicalGramSchmidt(lgmres_functions, orth_method,
+                                                  i, p, hh, dots);
            }
-           t = sqrt((*(lgmres_functions->InnerProd))(p[i],p[i]));
            hh[i][i-1] = t;	
            if (t != 0.0)
            {
@@ -861,6 +954,7 @@ hypre_LGMRESSolve(void  *lgmres_vdata,
    	hypre_TFreeF(hh[i],lgmres_functions);
    }
    hypre_TFreeF(hh,lgmres_functions); 
+   if (orth_method) hypre_TFreeF(dots,lgmres_functions);
 
    return hypre_error_flag;
 }
@@ -1071,6 +1165,37 @@ hypre_LGMRESGetMaxIter( void *lgmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_LGMRESSetOrthMethod, hypre_LGMRESGetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LGMRESSetOrthMethod( void   *lgmres_vdata,
+                   HYPRE_Int   orth_method )
+{
+   hypre_LGMRESData *lgmres_data = lgmres_vdata;
+
+   if (orth_method < 0 || orth_method > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (lgmres_data -> orth_method) = orth_method;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_LGMRESGetOrthMethod( void   *lgmres_vdata,
+                   HYPRE_Int * orth_method )
+{
+   hypre_LGMRESData *lgmres_data = lgmres_vdata;
+
+   *orth_method = (lgmres_data -> orth_method);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_LGMRESSetStopCrit, hypre_LGMRESGetStopCrit
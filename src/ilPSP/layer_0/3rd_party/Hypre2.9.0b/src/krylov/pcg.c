@@ -73,6 +73,8 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->MultiInnerProdStart = NULL;
+   pcg_functions->MultiInnerProdWait = NULL;
 /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -80,6 +82,79 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetMultiInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetMultiInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*MultiInnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                   double *local_prod, double *prod,
+                                   hypre_MPI_Request *request ),
+   HYPRE_Int    (*MultiInnerProdWait)  ( hypre_MPI_Request *request )
+   )
+{
+   pcg_functions->MultiInnerProdStart = MultiInnerProdStart;
+   pcg_functions->MultiInnerProdWait  = MultiInnerProdWait;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGVariantVectorsCreate, hypre_PCGVariantVectorsDestroy
+ *
+ * the additional vectors of the single-reduction (u, w) and the pipelined
+ * (u, w, m, n, q, z) variant; only missing vectors are created.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGVariantVectorsCreate( hypre_PCGData *pcg_data, void *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void **vectors[6];
+   HYPRE_Int k, num_vectors;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> q);
+   vectors[5] = &(pcg_data -> z);
+
+   num_vectors = 0;
+   if ( (pcg_data -> variant) == 1 ) num_vectors = 2;
+   if ( (pcg_data -> variant) == 2 ) num_vectors = 6;
+
+   for (k = 0; k < num_vectors; k++)
+      if ( *(vectors[k]) == NULL )
+         *(vectors[k]) = (*(pcg_functions->CreateVector))(x);
+}
+
+static void
+hypre_PCGVariantVectorsDestroy( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void **vectors[6];
+   HYPRE_Int k;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> q);
+   vectors[5] = &(pcg_data -> z);
+
+   for (k = 0; k < 6; k++)
+   {
+      if ( *(vectors[k]) != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*(vectors[k]));
+         *(vectors[k]) = NULL;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -116,6 +191,13 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> variant)      = 0;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> q)            = NULL;
+   (pcg_data -> z)            = NULL;
 
    return (void *) pcg_data;
 }
@@ -162,6 +244,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGVariantVectorsDestroy(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -219,6 +302,9 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGVariantVectorsDestroy(pcg_data);
+   hypre_PCGVariantVectorsCreate(pcg_data, x);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -316,6 +402,12 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int             i = 0;
    HYPRE_Int             my_id, num_procs;
 
+   if ( (pcg_data -> variant) > 0 && !rel_change && rtol == 0.0 &&
+        cf_tol <= 0.0 && !stop_crit && atolf <= 0.0 && !recompute_residual )
+   {
+      return hypre_PCGSolveSingleReduction(pcg_vdata, A, b, x);
+   }
+
    (pcg_data -> converged) = 0;
 
    (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
@@ -725,6 +817,368 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGMultiInnerProdStart, hypre_PCGMultiInnerProdWait
+ *
+ * prods[k] = <x[k],y[k]>, k < n, with a single reduction; the results are
+ * in (pcg_data -> prods) after hypre_PCGMultiInnerProdWait.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGMultiInnerProdStart( hypre_PCGData *pcg_data,
+                              HYPRE_Int      n,
+                              void         **x,
+                              void         **y )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int k;
+
+   if ( pcg_functions->MultiInnerProdStart != NULL )
+   {
+      (*(pcg_functions->MultiInnerProdStart))(n, x, y,
+                                              (pcg_data -> local_prods),
+                                              (pcg_data -> prods),
+                                              &(pcg_data -> request));
+   }
+   else
+   {
+      for (k = 0; k < n; k++)
+         (pcg_data -> prods)[k] = (*(pcg_functions->InnerProd))(x[k], y[k]);
+   }
+}
+
+static void
+hypre_PCGMultiInnerProdWait( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   if ( pcg_functions->MultiInnerProdStart != NULL )
+      (*(pcg_functions->MultiInnerProdWait))(&(pcg_data -> request));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveSingleReduction
+ *--------------------------------------------------------------------------
+ *
+ * PCG with a single global reduction per iteration (variant 1, Chronopoulos
+ * and Gear) and its pipelined form (variant 2, Ghysels and Vanroose).
+ * With u = C*r and w = A*u, the step length is computed from
+ *
+ *       gamma = <r,u>,  delta = <w,u>,
+ *       alpha = gamma / (delta - beta*gamma/alpha_old),
+ *
+ * and s = A*p is updated by the recurrence s = w + beta*s, so all inner
+ * products of one iteration are available at the same time.  The pipelined
+ * variant also updates u and w by recurrences (with q = C*s, z = A*q);
+ * this allows to start the reduction before m = C*w and n = A*m are
+ * computed, and to complete it afterwards.
+ *
+ * The convergence test is the default one of hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolveSingleReduction( void *pcg_vdata,
+                               void *A,
+                               void *b,
+                               void *x         )
+{
+   hypre_PCGData  *pcg_data     = pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   double          r_tol        = (pcg_data -> tol);
+   double          a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int             max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int             two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int             recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int             pipelined    = ((pcg_data -> variant) == 2);
+   void           *p, *s, *r, *u, *w, *m, *n, *q, *z;
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int           (*precond)()   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int             print_level  = (pcg_data -> print_level);
+   HYPRE_Int             logging      = (pcg_data -> logging);
+   double         *norms        = (pcg_data -> norms);
+   double         *rel_norms    = (pcg_data -> rel_norms);
+   double         *prods        = (pcg_data -> prods);
+
+   void           *xv[4], *yv[4];
+   HYPRE_Int             num_prods;
+   double          alpha = 0.0, beta;
+   double          gamma, gamma_old, delta, denom;
+   double          bi_prod, i_prod, eps;
+   double          ieee_check = 0.;
+
+   HYPRE_Int             recompute_true_residual = 0;
+
+   HYPRE_Int             i = 0;
+   HYPRE_Int             my_id, num_procs;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   hypre_PCGVariantVectorsCreate(pcg_data, x);
+   p = (pcg_data -> p);
+   s = (pcg_data -> s);
+   r = (pcg_data -> r);
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   q = (pcg_data -> q);
+   z = (pcg_data -> z);
+
+   /*-----------------------------------------------------------------------
+    * Start pcg solve
+    *-----------------------------------------------------------------------*/
+
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   /* u = C*r, w = A*u */
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   /* bi_prod = <b,b> or <C*b,b>, gamma = <r,u>, delta = <w,u>
+      (and <r,r>) in one reduction */
+   if (two_norm)
+   {
+      xv[0] = b; yv[0] = b;
+   }
+   else
+   {
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      xv[0] = p; yv[0] = b;
+   }
+   xv[1] = r; yv[1] = u;
+   xv[2] = w; yv[2] = u;
+   xv[3] = r; yv[3] = r;
+   num_prods = two_norm ? 4 : 3;
+   hypre_PCGMultiInnerProdStart(pcg_data, num_prods, xv, yv);
+
+   if (pipelined)
+   {
+      /* m = C*w, n = A*m */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+   }
+
+   hypre_PCGMultiInnerProdWait(pcg_data);
+   bi_prod = prods[0];
+   gamma   = prods[1];
+   delta   = prods[2];
+   i_prod  = two_norm ? prods[3] : gamma;
+
+   if (print_level > 1 && my_id == 0)
+   {
+      if (two_norm)
+         hypre_printf("<b,b>: %e\n",bi_prod);
+      else
+         hypre_printf("<C*b,b>: %e\n",bi_prod);
+   }
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input (INFs or NaNs, see
+      hypre_PCGSolve). */
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (gamma != 0.) ieee_check += gamma/gamma;
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolveSingleReduction: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
+   }
+
+   if ( bi_prod > 0.0 )
+   {
+      /* convergence criteria:  <C*r,r>  <= max( a_tol^2, r_tol^2 * <C*b,b> ) */
+      eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      (pcg_data -> num_iterations) = 0;
+      (pcg_data -> rel_residual_norm) = 0.0;
+
+      return hypre_error_flag;
+   }
+
+   /* Set initial residual norm */
+   if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod);
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while ((i+1) <= max_iter)
+   {
+      /*--------------------------------------------------------------------
+       * the core CG calculations...
+       *--------------------------------------------------------------------*/
+      i++;
+
+      recompute_true_residual = recompute_residual_p && !(i%recompute_residual_p);
+
+      /* beta = gamma / gamma_old, alpha = gamma / (delta - beta*gamma/alpha) */
+      if (i == 1)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta*gamma/alpha;
+      }
+      if ( denom==0.0 )
+         break;
+      alpha = gamma / denom;
+
+      /* p = u + beta p, s = w + beta s (q = m + beta q, z = n + beta z) */
+      if (i == 1)
+      {
+         (*(pcg_functions->CopyVector))(u, p);
+         (*(pcg_functions->CopyVector))(w, s);
+         if (pipelined)
+         {
+            (*(pcg_functions->CopyVector))(m, q);
+            (*(pcg_functions->CopyVector))(n, z);
+         }
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         if (pipelined)
+         {
+            (*(pcg_functions->ScaleVector))(beta, q);
+            (*(pcg_functions->Axpy))(1.0, m, q);
+            (*(pcg_functions->ScaleVector))(beta, z);
+            (*(pcg_functions->Axpy))(1.0, n, z);
+         }
+      }
+
+      /* x = x + alpha*p */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+
+      if ( !recompute_true_residual )
+      {
+         /* r = r - alpha*s (u = u - alpha*q, w = w - alpha*z) */
+         (*(pcg_functions->Axpy))(-alpha, s, r);
+         if (pipelined)
+         {
+            (*(pcg_functions->Axpy))(-alpha, q, u);
+            (*(pcg_functions->Axpy))(-alpha, z, w);
+         }
+      }
+      else
+      {
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      }
+
+      if ( !pipelined || recompute_true_residual )
+      {
+         /* u = C*r, w = A*u */
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+      }
+
+      /* gamma = <r,u>, delta = <w,u> (and <r,r>) in one reduction */
+      gamma_old = gamma;
+      xv[0] = r; yv[0] = u;
+      xv[1] = w; yv[1] = u;
+      xv[2] = r; yv[2] = r;
+      num_prods = two_norm ? 3 : 2;
+      hypre_PCGMultiInnerProdStart(pcg_data, num_prods, xv, yv);
+
+      if (pipelined)
+      {
+         /* m = C*w, n = A*m, overlapped with the reduction */
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+      }
+
+      hypre_PCGMultiInnerProdWait(pcg_data);
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      /* print norm info */
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+      }
+      if ( print_level > 1 && my_id==0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i]/norms[i-1], rel_norms[i] );
+      }
+
+      /*--------------------------------------------------------------------
+       * check for convergence
+       *--------------------------------------------------------------------*/
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if ( (gamma<1.0e-292) && ((-gamma)<1.0e-292) ) {
+         hypre_error(HYPRE_ERROR_CONV);
+         break;
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -991,6 +1445,37 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetVariant, hypre_PCGGetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetVariant( void *pcg_vdata,
+                     HYPRE_Int   variant  )
+{
+   hypre_PCGData *pcg_data = pcg_vdata;
+
+   if (variant < 0 || variant > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (pcg_data -> variant) = variant;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetVariant( void *pcg_vdata,
+                     HYPRE_Int * variant  )
+{
+   hypre_PCGData *pcg_data = pcg_vdata;
+
+   *variant = (pcg_data -> variant);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
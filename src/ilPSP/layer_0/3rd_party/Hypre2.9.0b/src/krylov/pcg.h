@@ -73,6 +73,15 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( double alpha, void *x );
    HYPRE_Int    (*Axpy)          ( double alpha, void *x, void *y );
 
+   /* optional: n inner products <x[k],y[k]> with a single (nonblocking)
+      reduction; the local products are stored in local_prod and the
+      reduced ones in prod, which is only valid after MultiInnerProdWait.
+      If not set, the single-reduction variants fall back to InnerProd. */
+   HYPRE_Int    (*MultiInnerProdStart) ( HYPRE_Int n, void **x, void **y,
+                                   double *local_prod, double *prod,
+                                   hypre_MPI_Request *request );
+   HYPRE_Int    (*MultiInnerProdWait)  ( hypre_MPI_Request *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 } hypre_PCGFunctions;
@@ -110,6 +119,13 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - variant selects the CG recurrence: 0 is the standard PCG (default) with
+ two or three separate inner products per iteration; 1 is the single-reduction
+ variant (Chronopoulos/Gear), all inner products of an iteration are combined
+ in one reduction; 2 is the pipelined variant (Ghysels/Vanroose), where this
+ reduction is overlapped with the preconditioner and the matvec.  The variants
+ 1 and 2 use the standard algorithm if rel_change, rtol, cf_tol, stop_crit,
+ atolf or recompute_residual are set.
 */
 
 typedef struct
@@ -133,6 +149,14 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   HYPRE_Int      variant;
+   void    *u, *w;       /* variant>0: u = C*r, w = A*u */
+   void    *m, *n;       /* variant 2: m = C*w, n = A*m */
+   void    *q, *z;       /* variant 2: q = C*s, z = A*q */
+   double   local_prods[4];
+   double   prods[4];
+   hypre_MPI_Request request;
+
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
    void    *precond_data;
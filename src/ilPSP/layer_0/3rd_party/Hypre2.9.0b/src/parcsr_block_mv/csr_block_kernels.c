@@ -0,0 +1,455 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 2.0 $
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Block size specialized kernels for the hypre_CSRBlockMatrix class.
+ *
+ * The generic block routines loop over a block size that is only known at
+ * run time, so the compiler can neither unroll the block loops nor keep a
+ * block row in registers.  For the block sizes that occur for DG
+ * discretizations (3, 4, 6, 10 and 20, i.e. P1/P2/P3 modes in 2D and 3D)
+ * the kernels below are instantiated with a compile-time block size, see
+ * hypre_CSRBlockKernelInstance.  Inside a block the loops are arranged so
+ * that the innermost loop runs over independent entries (the rows of the
+ * block for the matvec, the columns for the transposed matvec and the
+ * elimination), which the compiler can vectorize.
+ *
+ * Every entry is accumulated in exactly the same order as in the generic
+ * routines, so the results are bit-identical.  Other block sizes use the
+ * same loops with a run-time block size (except for the matvec, which
+ * keeps the generic loop); block sizes above hypre_CSRBlockKernelMaxSize
+ * are passed to the generic routines.
+ *
+ *****************************************************************************/
+
+#include "csr_block_matrix.h"
+
+/* largest block size handled with stack storage */
+#define hypre_CSRBlockKernelMaxSize 32
+
+/* pivot threshold of hypre_CSRBlockMatrixBlockInvMatvec */
+#define hypre_CSRBlockKernelEps 1.0e-6
+
+/* mark an inner loop as free of loop-carried dependencies */
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#define hypre_CSRBlockKernelSimd _Pragma("omp simd")
+#elif defined(__clang__)
+#define hypre_CSRBlockKernelSimd _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define hypre_CSRBlockKernelSimd _Pragma("GCC ivdep")
+#elif defined(__INTEL_COMPILER)
+#define hypre_CSRBlockKernelSimd _Pragma("ivdep")
+#else
+#define hypre_CSRBlockKernelSimd
+#endif
+
+/*--------------------------------------------------------------------------
+ * Kernel bodies, parameterized by the block size BS (a constant for the
+ * specialized instances, the variable bs for the generic ones).
+ *--------------------------------------------------------------------------*/
+
+/* y(i) += sum_jj A(jj) * x(A_j(jj)) for the block rows start <= i < end */
+#define hypre_CSRBlockKernelMatvecBody(BS)                                   \
+{                                                                            \
+   HYPRE_Int  i, jj, b1, b2;                                                 \
+   double     acc[hypre_CSRBlockKernelMaxSize];                              \
+   double    *a, *xj, *yi, xv;                                               \
+                                                                             \
+   for (i = start; i < end; i++)                                             \
+   {                                                                         \
+      yi = y_data + i*(BS);                                                  \
+      for (b1 = 0; b1 < (BS); b1++)                                          \
+         acc[b1] = yi[b1];                                                   \
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)                                 \
+      {                                                                      \
+         a  = A_data + jj*(BS)*(BS);                                         \
+         xj = x_data + A_j[jj]*(BS);                                         \
+         for (b2 = 0; b2 < (BS); b2++)                                       \
+         {                                                                   \
+            xv = xj[b2];                                                     \
+            hypre_CSRBlockKernelSimd                                         \
+            for (b1 = 0; b1 < (BS); b1++)                                    \
+               acc[b1] += a[b1*(BS)+b2] * xv;                                \
+         }                                                                   \
+      }                                                                      \
+      for (b1 = 0; b1 < (BS); b1++)                                          \
+         yi[b1] = acc[b1];                                                   \
+   }                                                                         \
+}
+
+/* y(A_j(jj)) += A(jj)^T * x(i) for the block rows start <= i < end */
+#define hypre_CSRBlockKernelMatvecTBody(BS)                                  \
+{                                                                            \
+   HYPRE_Int  i, jj, b1, b2;                                                 \
+   double    *a, *xi, *yj, xv;                                               \
+                                                                             \
+   for (i = start; i < end; i++)                                             \
+   {                                                                         \
+      xi = x_data + i*(BS);                                                  \
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)                                 \
+      {                                                                      \
+         a  = A_data + jj*(BS)*(BS);                                         \
+         yj = y_data + A_j[jj]*(BS);                                         \
+         for (b1 = 0; b1 < (BS); b1++)                                       \
+         {                                                                   \
+            xv = xi[b1];                                                     \
+            hypre_CSRBlockKernelSimd                                         \
+            for (b2 = 0; b2 < (BS); b2++)                                    \
+               yj[b2] += a[b1*(BS)+b2] * xv;                                 \
+         }                                                                   \
+      }                                                                      \
+   }                                                                         \
+}
+
+/* ov OP= mat * v, with OP one of += and -= */
+#define hypre_CSRBlockKernelBlockMatvecBody(BS, OP)                          \
+{                                                                            \
+   HYPRE_Int  r, c;                                                          \
+   double     acc[hypre_CSRBlockKernelMaxSize], vc;                          \
+                                                                             \
+   for (r = 0; r < (BS); r++)                                                \
+      acc[r] = ov[r];                                                        \
+   for (c = 0; c < (BS); c++)                                                \
+   {                                                                         \
+      vc = v[c];                                                             \
+      hypre_CSRBlockKernelSimd                                               \
+      for (r = 0; r < (BS); r++)                                             \
+         acc[r] OP mat[r*(BS)+c] * vc;                                       \
+   }                                                                         \
+   for (r = 0; r < (BS); r++)                                                \
+      ov[r] = acc[r];                                                        \
+}
+
+/* ov = mat^{-1} * v by Gaussian elimination with partial pivoting; the
+ * same steps as hypre_CSRBlockMatrixBlockInvMatvec, without the heap copy */
+#define hypre_CSRBlockKernelInvMatvecBody(BS)                                \
+{                                                                            \
+   HYPRE_Int  j, k, c, piv_row;                                              \
+   double     m[hypre_CSRBlockKernelMaxSize*hypre_CSRBlockKernelMaxSize];    \
+   double     factor, piv, tmp;                                              \
+                                                                             \
+   for (k = 0; k < (BS); k++)                                                \
+   {                                                                         \
+      ov[k] = v[k];                                                          \
+      for (j = 0; j < (BS); j++)                                             \
+         m[k*(BS)+j] = mat[k*(BS)+j];                                        \
+   }                                                                         \
+                                                                             \
+   for (k = 0; k < (BS)-1; k++)                                              \
+   {                                                                         \
+      piv = m[k*(BS)+k];                                                     \
+      piv_row = k;                                                           \
+      for (j = k+1; j < (BS); j++)                                           \
+      {                                                                      \
+         if (fabs(m[j*(BS)+k]) > fabs(piv))                                  \
+         {                                                                   \
+            piv = m[j*(BS)+k];                                               \
+            piv_row = j;                                                     \
+         }                                                                   \
+      }                                                                      \
+      /* columns left of k are not read again, so they need no swap */       \
+      if (piv_row != k)                                                      \
+      {                                                                      \
+         for (c = k; c < (BS); c++)                                          \
+         {                                                                   \
+            tmp = m[k*(BS)+c];                                               \
+            m[k*(BS)+c] = m[piv_row*(BS)+c];                                 \
+            m[piv_row*(BS)+c] = tmp;                                         \
+         }                                                                   \
+         tmp = ov[k];                                                        \
+         ov[k] = ov[piv_row];                                                \
+         ov[piv_row] = tmp;                                                  \
+      }                                                                      \
+      if (!(fabs(piv) > hypre_CSRBlockKernelEps))                            \
+         return -1;                                                          \
+      for (j = k+1; j < (BS); j++)                                           \
+      {                                                                      \
+         factor = m[j*(BS)+k]/piv;                                           \
+         hypre_CSRBlockKernelSimd                                            \
+         for (c = k+1; c < (BS); c++)                                        \
+            m[j*(BS)+c] -= factor * m[k*(BS)+c];                             \
+         ov[j] -= factor * ov[k];                                            \
+      }                                                                      \
+   }                                                                         \
+   k = (BS)-1;                                                               \
+   if (fabs(m[k*(BS)+k]) < hypre_CSRBlockKernelEps)                          \
+      return -1;                                                             \
+                                                                             \
+   for (k = (BS)-1; k > 0; --k)                                              \
+   {                                                                         \
+      ov[k] /= m[k*(BS)+k];                                                  \
+      for (j = 0; j < k; j++)                                                \
+      {                                                                      \
+         if (m[j*(BS)+k] != 0.0)                                             \
+            ov[j] -= ov[k] * m[j*(BS)+k];                                    \
+      }                                                                      \
+   }                                                                         \
+   ov[0] /= m[0];                                                            \
+                                                                             \
+   return 0;                                                                 \
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockKernelInstance: the kernels for one fixed block size
+ *--------------------------------------------------------------------------*/
+
+#define hypre_CSRBlockKernelInstance(BS)                                     \
+static void                                                                  \
+hypre_CSRBlockKernelMatvec##BS( HYPRE_Int start, HYPRE_Int end,              \
+                                HYPRE_Int *A_i, HYPRE_Int *A_j,              \
+                                double *A_data, double *x_data,              \
+                                double *y_data )                             \
+hypre_CSRBlockKernelMatvecBody(BS)                                           \
+                                                                             \
+static void                                                                  \
+hypre_CSRBlockKernelMatvecT##BS( HYPRE_Int start, HYPRE_Int end,             \
+                                 HYPRE_Int *A_i, HYPRE_Int *A_j,             \
+                                 double *A_data, double *x_data,             \
+                                 double *y_data )                            \
+hypre_CSRBlockKernelMatvecTBody(BS)                                          \
+                                                                             \
+static void                                                                  \
+hypre_CSRBlockKernelBlockAdd##BS( double *mat, double *v, double *ov )       \
+hypre_CSRBlockKernelBlockMatvecBody(BS, +=)                                  \
+                                                                             \
+static void                                                                  \
+hypre_CSRBlockKernelBlockSub##BS( double *mat, double *v, double *ov )       \
+hypre_CSRBlockKernelBlockMatvecBody(BS, -=)                                  \
+                                                                             \
+static HYPRE_Int                                                             \
+hypre_CSRBlockKernelInvMatvec##BS( double *mat, double *v, double *ov )      \
+hypre_CSRBlockKernelInvMatvecBody(BS)
+
+hypre_CSRBlockKernelInstance(3)
+hypre_CSRBlockKernelInstance(4)
+hypre_CSRBlockKernelInstance(6)
+hypre_CSRBlockKernelInstance(10)
+hypre_CSRBlockKernelInstance(20)
+
+/*--------------------------------------------------------------------------
+ * Run-time block size versions (bs <= hypre_CSRBlockKernelMaxSize)
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRBlockKernelMatvecTN( HYPRE_Int bs, HYPRE_Int start, HYPRE_Int end,
+                              HYPRE_Int *A_i, HYPRE_Int *A_j,
+                              double *A_data, double *x_data, double *y_data )
+hypre_CSRBlockKernelMatvecTBody(bs)
+
+static void
+hypre_CSRBlockKernelBlockAddN( HYPRE_Int bs, double *mat, double *v, double *ov )
+hypre_CSRBlockKernelBlockMatvecBody(bs, +=)
+
+static void
+hypre_CSRBlockKernelBlockSubN( HYPRE_Int bs, double *mat, double *v, double *ov )
+hypre_CSRBlockKernelBlockMatvecBody(bs, -=)
+
+static HYPRE_Int
+hypre_CSRBlockKernelInvMatvecN( HYPRE_Int bs, double *mat, double *v, double *ov )
+hypre_CSRBlockKernelInvMatvecBody(bs)
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockKernelMatvec
+ *
+ *   y += A*x for the block rows start <= i < end, where A is given by its
+ *   block CSR arrays.  The caller does the scaling by alpha and beta and
+ *   distributes the rows over the threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBlockKernelMatvec( HYPRE_Int block_size, HYPRE_Int start, HYPRE_Int end,
+                            HYPRE_Int *A_i, HYPRE_Int *A_j, double *A_data,
+                            double *x_data, double *y_data )
+{
+   HYPRE_Int i, jj, b1, b2, bnnz = block_size*block_size;
+   double    temp;
+
+   switch (block_size)
+   {
+      case 3:
+         hypre_CSRBlockKernelMatvec3(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 4:
+         hypre_CSRBlockKernelMatvec4(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 6:
+         hypre_CSRBlockKernelMatvec6(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 10:
+         hypre_CSRBlockKernelMatvec10(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 20:
+         hypre_CSRBlockKernelMatvec20(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      default:
+         /* with a run-time block size the strided row loop does not pay
+            off, so keep the dot products of the generic routine */
+         for (i = start; i < end; i++)
+         {
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               for (b1 = 0; b1 < block_size; b1++)
+               {
+                  temp = y_data[i*block_size+b1];
+                  for (b2 = 0; b2 < block_size; b2++)
+                     temp += A_data[jj*bnnz+b1*block_size+b2] *
+                        x_data[A_j[jj]*block_size+b2];
+                  y_data[i*block_size+b1] = temp;
+               }
+            }
+         }
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockKernelMatvecT
+ *
+ *   y += A^T*x for the block rows start <= i < end.  Different rows
+ *   update the same entries of y, so this must not be called for
+ *   overlapping ranges of y from several threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBlockKernelMatvecT( HYPRE_Int block_size, HYPRE_Int start, HYPRE_Int end,
+                             HYPRE_Int *A_i, HYPRE_Int *A_j, double *A_data,
+                             double *x_data, double *y_data )
+{
+   HYPRE_Int i, j, jj, b1, b2, bnnz = block_size*block_size;
+
+   switch (block_size)
+   {
+      case 3:
+         hypre_CSRBlockKernelMatvecT3(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 4:
+         hypre_CSRBlockKernelMatvecT4(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 6:
+         hypre_CSRBlockKernelMatvecT6(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 10:
+         hypre_CSRBlockKernelMatvecT10(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      case 20:
+         hypre_CSRBlockKernelMatvecT20(start, end, A_i, A_j, A_data, x_data, y_data);
+         break;
+      default:
+         if (block_size <= hypre_CSRBlockKernelMaxSize)
+         {
+            hypre_CSRBlockKernelMatvecTN(block_size, start, end,
+                                         A_i, A_j, A_data, x_data, y_data);
+            break;
+         }
+         for (i = start; i < end; i++)
+         {
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               j = A_j[jj];
+               for (b1 = 0; b1 < block_size; b1++)
+                  for (b2 = 0; b2 < block_size; b2++)
+                     y_data[j*block_size+b2] += A_data[jj*bnnz+b1*block_size+b2] *
+                        x_data[i*block_size+b1];
+            }
+         }
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockKernelBlockMatvec
+ *
+ *   Drop-in replacement of hypre_CSRBlockMatrixBlockMatvec
+ *   (ov = alpha*mat*v + beta*ov).  The update ov +/-= mat*v used by the
+ *   block relaxations is done by the specialized kernels, everything else
+ *   by the generic routine.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBlockKernelBlockMatvec( double alpha, double *mat, double *v,
+                                 double beta, double *ov, HYPRE_Int block_size )
+{
+#if LB_VERSION
+   return hypre_CSRBlockMatrixBlockMatvec(alpha, mat, v, beta, ov, block_size);
+#else
+   if (beta != 1.0 || (alpha != 1.0 && alpha != -1.0) ||
+       block_size > hypre_CSRBlockKernelMaxSize)
+   {
+      return hypre_CSRBlockMatrixBlockMatvec(alpha, mat, v, beta, ov, block_size);
+   }
+
+   /* the generic routine computes ov - mat*v as -((-ov) + mat*v), which
+      rounds to the same value */
+   if (alpha == 1.0)
+   {
+      switch (block_size)
+      {
+         case 3:  hypre_CSRBlockKernelBlockAdd3(mat, v, ov);  break;
+         case 4:  hypre_CSRBlockKernelBlockAdd4(mat, v, ov);  break;
+         case 6:  hypre_CSRBlockKernelBlockAdd6(mat, v, ov);  break;
+         case 10: hypre_CSRBlockKernelBlockAdd10(mat, v, ov); break;
+         case 20: hypre_CSRBlockKernelBlockAdd20(mat, v, ov); break;
+         default: hypre_CSRBlockKernelBlockAddN(block_size, mat, v, ov); break;
+      }
+   }
+   else
+   {
+      switch (block_size)
+      {
+         case 3:  hypre_CSRBlockKernelBlockSub3(mat, v, ov);  break;
+         case 4:  hypre_CSRBlockKernelBlockSub4(mat, v, ov);  break;
+         case 6:  hypre_CSRBlockKernelBlockSub6(mat, v, ov);  break;
+         case 10: hypre_CSRBlockKernelBlockSub10(mat, v, ov); break;
+         case 20: hypre_CSRBlockKernelBlockSub20(mat, v, ov); break;
+         default: hypre_CSRBlockKernelBlockSubN(block_size, mat, v, ov); break;
+      }
+   }
+
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRBlockKernelBlockInvMatvec
+ *
+ *   Drop-in replacement of hypre_CSRBlockMatrixBlockInvMatvec
+ *   (ov = mat^{-1} * v), returns -1 for a (nearly) singular block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRBlockKernelBlockInvMatvec( double *mat, double *v, double *ov,
+                                    HYPRE_Int block_size )
+{
+#if LB_VERSION
+   return hypre_CSRBlockMatrixBlockInvMatvec(mat, v, ov, block_size);
+#else
+   switch (block_size)
+   {
+      case 3:  return hypre_CSRBlockKernelInvMatvec3(mat, v, ov);
+      case 4:  return hypre_CSRBlockKernelInvMatvec4(mat, v, ov);
+      case 6:  return hypre_CSRBlockKernelInvMatvec6(mat, v, ov);
+      case 10: return hypre_CSRBlockKernelInvMatvec10(mat, v, ov);
+      case 20: return hypre_CSRBlockKernelInvMatvec20(mat, v, ov);
+   }
+   if (block_size == 1 || block_size > hypre_CSRBlockKernelMaxSize)
+   {
+      return hypre_CSRBlockMatrixBlockInvMatvec(mat, v, ov, block_size);
+   }
+
+   return hypre_CSRBlockKernelInvMatvecN(block_size, mat, v, ov);
+#endif
+}
@@ -136,6 +136,18 @@ hypre_CSRBlockMatrixBlockInvMatvec(double* mat, double* v,
 HYPRE_Int 
 hypre_CSRBlockMatrixBlockMatvec(double alpha, double* mat, double* v, double beta, 
                                 double* ov, HYPRE_Int block_size);
+
+/* csr_block_kernels.c */
+HYPRE_Int hypre_CSRBlockKernelMatvec(HYPRE_Int block_size, HYPRE_Int start, HYPRE_Int end,
+                                     HYPRE_Int *A_i, HYPRE_Int *A_j, double *A_data,
+                                     double *x_data, double *y_data);
+HYPRE_Int hypre_CSRBlockKernelMatvecT(HYPRE_Int block_size, HYPRE_Int start, HYPRE_Int end,
+                                      HYPRE_Int *A_i, HYPRE_Int *A_j, double *A_data,
+                                      double *x_data, double *y_data);
+HYPRE_Int hypre_CSRBlockKernelBlockMatvec(double alpha, double *mat, double *v, double beta,
+                                          double *ov, HYPRE_Int block_size);
+HYPRE_Int hypre_CSRBlockKernelBlockInvMatvec(double *mat, double *v, double *ov,
+                                             HYPRE_Int block_size);
    
 
 HYPRE_Int hypre_CSRBlockMatrixBlockNorm(HYPRE_Int norm_type, double* data, double* out, HYPRE_Int block_size);
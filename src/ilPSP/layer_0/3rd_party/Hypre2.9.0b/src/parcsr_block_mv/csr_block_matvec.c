@@ -23,6 +23,9 @@
 #include "../seq_mv/seq_mv.h"
 #include <assert.h>
 
+/* block rows per call of the block size specialized kernel */
+#define hypre_CSRBlockMatvecChunk 64
+
 /*--------------------------------------------------------------------------
  * hypre_CSRBlockMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -43,7 +46,7 @@ hypre_CSRBlockMatrixMatvec(double alpha, hypre_CSRBlockMatrix *A,
    HYPRE_Int         x_size = hypre_VectorSize(x);
    HYPRE_Int         y_size = hypre_VectorSize(y);
 
-   HYPRE_Int         i, b1, b2, jj, bnnz=blk_size*blk_size;
+   HYPRE_Int         i;
    HYPRE_Int         ierr = 0;
    double      temp;
 
@@ -107,21 +110,12 @@ hypre_CSRBlockMatrixMatvec(double alpha, hypre_CSRBlockMatrix *A,
     *-----------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,jj,b1,b2,temp) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-
-   for (i = 0; i < num_rows; i++)
+   for (i = 0; i < num_rows; i += hypre_CSRBlockMatvecChunk)
    {
-      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
-      {
-         for (b1 = 0; b1 < blk_size; b1++)
-         {
-            temp = y_data[i*blk_size+b1];
-            for (b2 = 0; b2 < blk_size; b2++)
-               temp += A_data[jj*bnnz+b1*blk_size+b2] * x_data[A_j[jj]*blk_size+b2];
-            y_data[i*blk_size+b1] = temp;
-         }
-      }
+      hypre_CSRBlockKernelMatvec(blk_size, i, hypre_min(i+hypre_CSRBlockMatvecChunk, num_rows),
+                                 A_i, A_j, A_data, x_data, y_data);
    }
 
    /*-----------------------------------------------------------------
@@ -169,12 +163,10 @@ hypre_CSRBlockMatrixMatvecT( double               alpha,
 
    double      temp;
    
-   HYPRE_Int         i, j, jj;
+   HYPRE_Int         i;
    HYPRE_Int         ierr  = 0;
-   HYPRE_Int         b1, b2;
    
    HYPRE_Int         blk_size = hypre_CSRBlockMatrixBlockSize(A);
-   HYPRE_Int         bnnz=blk_size*blk_size;
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  MatvecT returns ierr = 1 if
@@ -240,24 +232,9 @@ hypre_CSRBlockMatrixMatvecT( double               alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
  
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i, jj,j, b1, b2) HYPRE_SMP_SCHEDULE
-#endif
-    
-   for (i = 0; i < num_rows; i++)
-   {
-      for (jj = A_i[i]; jj < A_i[i+1]; jj++) /*each nonzero in that row*/
-      {
-         for (b1 = 0; b1 < blk_size; b1++) /*row */
-         {
-            for (b2 = 0; b2 < blk_size; b2++) /*col*/
-            {
-               j = A_j[jj]; /*col */
-               y_data[j*blk_size+b2] += A_data[jj*bnnz+b1*blk_size+b2] * x_data[i*blk_size + b1];
-            }
-         }
-      }
-   }
+   /* rows of A scatter into the same entries of y, so this is not
+      split over the threads */
+   hypre_CSRBlockKernelMatvecT(blk_size, 0, num_rows, A_i, A_j, A_data, x_data, y_data);
       
    /*-----------------------------------------------------------------
     * y = alpha*y
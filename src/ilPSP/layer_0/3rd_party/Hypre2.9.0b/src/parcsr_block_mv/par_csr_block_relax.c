@@ -279,7 +279,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                {
                   ii = A_diag_j[jj];
                   /* res -= A_diag_data[jj] * Vtemp_data[ii]; */
-                  hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                  hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                   &Vtemp_data[ii*block_size], 
                                                   1.0, res_vec, block_size);
                }
@@ -287,13 +287,13 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                {
                   ii = A_offd_j[jj];
                   /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                  hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                  hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                   &Vext_data[ii*block_size], 
                                                   1.0, res_vec, block_size);
                }
                
                /* if diag is singular, then skip this point */ 
-               if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+               if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                        out_vec, block_size) == 0)
                {
                   for (k=0; k< block_size; k++) 
@@ -331,7 +331,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                   {
                      ii = A_diag_j[jj];
                      /* res -= A_diag_data[jj] * Vtemp_data[ii]; */
-                     hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                     hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                      &Vtemp_data[ii*block_size], 
                                                      1.0, res_vec, block_size);
                   }
@@ -339,13 +339,13 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                   {
                      ii = A_offd_j[jj];
                      /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                     hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                     hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                      &Vext_data[ii*block_size], 
                                                      1.0, res_vec, block_size);
                   }
                   
                   /* if diag is singular, then skip this point */ 
-                  if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                  if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                           out_vec, block_size) == 0)
                   {
                      for (k=0; k< block_size; k++) 
@@ -471,14 +471,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            if (ii >= ns && ii < ne)
                            {
                               /*  res -= A_diag_data[jj] * u_data[ii]; */
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                               &u_data[ii*block_size], 
                                                               1.0, res_vec, block_size);
                            }
                            else
                            {
                               /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                               &tmp_data[ii*block_size], 
                                                               1.0, res_vec, block_size);
                            }
@@ -487,14 +487,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            ii = A_offd_j[jj];
                            /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                           hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                           hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                            &Vext_data[ii*block_size], 
                                                            1.0, res_vec, block_size);
                            
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */ 
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                        if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                 out_vec, block_size) == 0)
                         {
                            for (k=0; k< block_size; k++) 
@@ -522,7 +522,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         ii = A_diag_j[jj];
                         /* res -= A_diag_data[jj] * u_data[ii]; */
-                        hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                        hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                         &u_data[ii*block_size], 
                                                         1.0, res_vec, block_size);
                      }
@@ -530,12 +530,12 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         ii = A_offd_j[jj];
                         /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                        hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                        hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                         &Vext_data[ii*block_size], 
                                                         1.0, res_vec, block_size);
                      }
                     /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                     if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                             out_vec, block_size) == 0)
                      {
                         for (k=0; k< block_size; k++) 
@@ -591,14 +591,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                               if (ii >= ns && ii < ne)
                               {
                                  /* res -= A_diag_data[jj] * u_data[ii]; */
-                                 hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                 hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                  &u_data[ii*block_size], 
                                                                  1.0, res_vec, block_size);
                               }
                               else
                               {
                                  /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                 hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                 hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                  &tmp_data[ii*block_size], 
                                                                  1.0, res_vec, block_size);
                               }
@@ -607,14 +607,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            {
                               ii = A_offd_j[jj];
                               /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                               &Vext_data[ii*block_size], 
                                                               1.0, res_vec, block_size);
                              
                            }
                            /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                            /* if diag is singular, then skip this point */ 
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                           if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                    out_vec, block_size) == 0)
                            {
                               for (k=0; k< block_size; k++) 
@@ -645,7 +645,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            ii = A_diag_j[jj];
                            /* res -= A_diag_data[jj] * u_data[ii]; */
-                           hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                           hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                               &u_data[ii*block_size], 
                                                            1.0, res_vec, block_size);
                         }
@@ -653,14 +653,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            ii = A_offd_j[jj];
                            /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                           hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                           hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                            &Vext_data[ii*block_size], 
                                                            1.0, res_vec, block_size);
                            
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */ 
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                        if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                 out_vec, block_size) == 0)
                         {
                            for (k=0; k< block_size; k++) 
@@ -724,18 +724,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            if (ii >= ns && ii < ne)
                            {
                               /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                               &u_data[ii*block_size], 
                                                               1.0, res0_vec, block_size);
                               /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                              hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                               &Vtemp_data[ii*block_size], 
                                                               1.0, res2_vec, block_size);
                            }
                            else
                            {
                               /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                               &tmp_data[ii*block_size], 
                                                               1.0, res_vec, block_size);
                            }
@@ -744,7 +744,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            ii = A_offd_j[jj];
                            /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                           hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                           hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                            &Vext_data[ii*block_size], 
                                                            1.0, res_vec, block_size);
                         }
@@ -755,7 +755,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                        if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                 out_vec, block_size) == 0)
                         {
                            for (k=0; k< block_size; k++) 
@@ -786,11 +786,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         ii = A_diag_j[jj];
                         /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                        hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                        hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                         &u_data[ii*block_size], 
                                                         1.0, res0_vec, block_size);
                         /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                        hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                        hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                         &Vtemp_data[ii*block_size], 
                                                         1.0, res2_vec, block_size);
                      }
@@ -798,7 +798,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         ii = A_offd_j[jj];
                         /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                        hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                        hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                         &Vext_data[ii*block_size], 
                                                         1.0, res_vec, block_size);
                      }
@@ -809,7 +809,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                      }
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                     if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                              out_vec, block_size) == 0)
                      {
                         for (k=0; k< block_size; k++) 
@@ -870,18 +870,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                              if (ii >= ns && ii < ne)
                              {
                                 /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &u_data[ii*block_size], 
                                                                 1.0, res0_vec, block_size);
                                 /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                                hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                                 &Vtemp_data[ii*block_size], 
                                                                 1.0, res2_vec, block_size);
                              }
                              else
                              {
                                 /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &tmp_data[ii*block_size], 
                                                                 1.0, res_vec, block_size);
                              }
@@ -890,7 +890,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              ii = A_offd_j[jj];
                              /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                              &Vext_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -901,7 +901,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                           }
-                          if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                          if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                   out_vec, block_size) == 0)
                           {
                              for (k=0; k< block_size; k++) 
@@ -940,11 +940,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_diag_j[jj];
                           /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                           &u_data[ii*block_size], 
                                                           1.0, res0_vec, block_size);
                           /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                           &Vtemp_data[ii*block_size], 
                                                           1.0, res2_vec, block_size);
                        }
@@ -952,7 +952,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -963,7 +963,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                        }
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1086,14 +1086,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           if (ii >= ns && ii < ne)
                           {
                              /* res -= A_diag_data[jj] * u_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &u_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
                           else
                           {
                              /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &tmp_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -1104,13 +1104,13 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           ii = A_offd_j[jj];
                           
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
                        /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                        /* if diag is singular, then skip this point */ 
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1139,7 +1139,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              
                              /* res -= A_diag_data[jj] * u_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &u_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                              
@@ -1147,7 +1147,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           else
                           {
                              /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &tmp_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                              
@@ -1157,13 +1157,13 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
                        /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                        /* if diag is singular, then skip this point */ 
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1191,7 +1191,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_diag_j[jj];
                        /* res -= A_diag_data[jj] * u_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                        &u_data[ii*block_size], 
                                                        1.0, res_vec, block_size);
                     }
@@ -1200,12 +1200,12 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        ii = A_offd_j[jj];
                        
                        /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                         &Vext_data[ii*block_size], 
                                                         1.0, res_vec, block_size);
                     }
                     /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                    if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                    if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                             out_vec, block_size) == 0)
                     {
                        for (k=0; k< block_size; k++) 
@@ -1229,7 +1229,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_diag_j[jj];
                        /* res -= A_diag_data[jj] * u_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                        &u_data[ii*block_size], 
                                                        1.0, res_vec, block_size);
                     }
@@ -1237,12 +1237,12 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_offd_j[jj];
                        /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                        &Vext_data[ii*block_size], 
                                                        1.0, res_vec, block_size);
                     }
                     /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                    if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                    if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                             out_vec, block_size) == 0)
                     {
                        for (k=0; k< block_size; k++) 
@@ -1299,14 +1299,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                               if (ii >= ns && ii < ne)
                               {
                                  /* res -= A_diag_data[jj] * u_data[ii]; */
-                                 hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                 hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                  &u_data[ii*block_size], 
                                                                  1.0, res_vec, block_size);
                               }
                               else
                               {
                                  /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                 hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                 hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                  &tmp_data[ii*block_size], 
                                                                  1.0, res_vec, block_size);
                               }
@@ -1315,14 +1315,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            {
                               ii = A_offd_j[jj];
                               /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                              hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                              hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                               &Vext_data[ii*block_size], 
                                                               1.0, res_vec, block_size);
                              
                            }
                            /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                            /* if diag is singular, then skip this point */ 
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                           if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                    out_vec, block_size) == 0)
                            {
                               for (k=0; k< block_size; k++) 
@@ -1353,14 +1353,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                              if (ii >= ns && ii < ne)
                              {
                                 /* res -= A_diag_data[jj] * u_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &u_data[ii*block_size], 
                                                                 1.0, res_vec, block_size);
                              }
                              else
                              {
                                 /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &tmp_data[ii*block_size], 
                                                                 1.0, res_vec, block_size);
                              }
@@ -1369,14 +1369,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              ii = A_offd_j[jj];
                              /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                              &Vext_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                              
                           }
                           /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                           /* if diag is singular, then skip this point */ 
-                          if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                          if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                   out_vec, block_size) == 0)
                           {
                              for (k=0; k< block_size; k++) 
@@ -1410,7 +1410,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_diag_j[jj];
                           /* res -= A_diag_data[jj] * u_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                           &u_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -1418,14 +1418,14 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                           
                        }
                        /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                        /* if diag is singular, then skip this point */ 
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1454,7 +1454,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_diag_j[jj];
                           /* res -= A_diag_data[jj] * u_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                           &u_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -1462,13 +1462,13 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
                        /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                        /* if diag is singular, then skip this point */ 
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1535,18 +1535,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           if (ii >= ns && ii < ne)
                           {
                              /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &u_data[ii*block_size], 
                                                              1.0, res0_vec, block_size);
                              /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                              &Vtemp_data[ii*block_size], 
                                                              1.0, res2_vec, block_size);
                           }
                           else
                           {
                              /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &tmp_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -1556,7 +1556,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
 
@@ -1569,7 +1569,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                        }
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1599,18 +1599,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           if (ii >= ns && ii < ne)
                           {
                              /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &u_data[ii*block_size], 
                                                              1.0, res0_vec, block_size);
                              /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                              &Vtemp_data[ii*block_size], 
                                                              1.0, res2_vec, block_size);
                           }
                           else
                           {
                              /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                              &tmp_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -1619,7 +1619,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -1630,7 +1630,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                        }
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1661,11 +1661,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_diag_j[jj];
                        /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                        &u_data[ii*block_size], 
                                                        1.0, res0_vec, block_size);
                        /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                       hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                        &Vtemp_data[ii*block_size], 
                                                        1.0, res2_vec, block_size);
                     }
@@ -1673,7 +1673,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_offd_j[jj];
                        /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                        &Vext_data[ii*block_size], 
                                                        1.0, res_vec, block_size);
                     }
@@ -1684,7 +1684,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                     }
-                    if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                    if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                             out_vec, block_size) == 0)
                     {
                        for (k=0; k< block_size; k++) 
@@ -1710,11 +1710,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_diag_j[jj];
                        /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                        &u_data[ii*block_size], 
                                                        1.0, res0_vec, block_size);
                        /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                       hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                        &Vtemp_data[ii*block_size], 
                                                        1.0, res2_vec, block_size);
                     }
@@ -1722,7 +1722,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        ii = A_offd_j[jj];
                        /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                       hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                       hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                        &Vext_data[ii*block_size], 
                                                        1.0, res_vec, block_size);
                     }
@@ -1733,7 +1733,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                     {
                        tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                     }
-                    if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                    if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                             out_vec, block_size) == 0)
                     {
                        for (k=0; k< block_size; k++) 
@@ -1796,18 +1796,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                              if (ii >= ns && ii < ne)
                              {
                                 /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &u_data[ii*block_size], 
                                                                 1.0, res0_vec, block_size);
                                 /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                                hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                                 &Vtemp_data[ii*block_size], 
                                                                 1.0, res2_vec, block_size);
                              }
                              else
                              {
                                 /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &tmp_data[ii*block_size], 
                                                                 1.0, res_vec, block_size);
                              }
@@ -1816,7 +1816,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              ii = A_offd_j[jj];
                              /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                              &Vext_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -1827,7 +1827,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                           }
-                          if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                          if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                   out_vec, block_size) == 0)
                           {
                              for (k=0; k< block_size; k++) 
@@ -1862,18 +1862,18 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                              if (ii >= ns && ii < ne)
                              {
                                 /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &u_data[ii*block_size], 
                                                                 1.0, res0_vec, block_size);
                                 /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                                hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                                 &Vtemp_data[ii*block_size], 
                                                                 1.0, res2_vec, block_size);
                              }
                              else
                              {
                                 /* res -= A_diag_data[jj] * tmp_data[ii]; */
-                                hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                                hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                                 &tmp_data[ii*block_size], 
                                                                 1.0, res_vec, block_size);
                              }
@@ -1882,7 +1882,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              ii = A_offd_j[jj];
                              /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                             hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                             hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                              &Vext_data[ii*block_size], 
                                                              1.0, res_vec, block_size);
                           }
@@ -1893,7 +1893,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                           {
                              tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                           }
-                          if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                          if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                   out_vec, block_size) == 0)
                           {
                              for (k=0; k< block_size; k++) 
@@ -1929,11 +1929,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_diag_j[jj];
                           /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                           &u_data[ii*block_size], 
                                                           1.0, res0_vec, block_size);
                           /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                           &Vtemp_data[ii*block_size], 
                                                           1.0, res2_vec, block_size);
                        }
@@ -1941,7 +1941,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -1952,7 +1952,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                        }
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -1984,11 +1984,11 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_diag_j[jj];
                           /* res0 -= A_diag_data[jj] * u_data[ii]; */
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_diag_data[jj*bnnz], 
                                                           &u_data[ii*block_size], 
                                                           1.0, res0_vec, block_size);
                           /* res2 += A_diag_data[jj] * Vtemp_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(1.0, &A_diag_data[jj*bnnz], 
                                                           &Vtemp_data[ii*block_size], 
                                                           1.0, res2_vec, block_size);
                        }
@@ -1996,7 +1996,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           ii = A_offd_j[jj];
                           /* res -= A_offd_data[jj] * Vext_data[ii];*/
-                          hypre_CSRBlockMatrixBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
+                          hypre_CSRBlockKernelBlockMatvec(-1.0, &A_offd_data[jj*bnnz], 
                                                           &Vext_data[ii*block_size], 
                                                           1.0, res_vec, block_size);
                        }
@@ -2007,7 +2007,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                        {
                           tmp_vec[k] =  omega*res_vec[k] + res0_vec[k] + one_minus_omega*res2_vec[k];
                        }
-                       if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
+                       if (hypre_CSRBlockKernelBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec, 
                                                                out_vec, block_size) == 0)
                        {
                           for (k=0; k< block_size; k++) 
@@ -415,3 +415,31 @@ HYPRE_EuclidSetRowScale(HYPRE_Solver solver,
   HYPRE_EUCLID_ERRCHKA;
   END_FUNC_VAL(0)
 }
+
+HYPRE_Int
+HYPRE_EuclidSetTriSolve(HYPRE_Solver solver, 
+				HYPRE_Int tri_solve)
+{
+  START_FUNC_DH
+  if (tri_solve == 1) {
+    Parser_dhInsert(parser_dh, "-triSolve", "level"); 
+  } else if (tri_solve == 2) {
+    Parser_dhInsert(parser_dh, "-triSolve", "jacobi"); 
+  } else {
+    Parser_dhInsert(parser_dh, "-triSolve", "seq"); 
+  }
+  HYPRE_EUCLID_ERRCHKA;
+  END_FUNC_VAL(0)
+}
+
+HYPRE_Int
+HYPRE_EuclidSetTriSolveSweeps(HYPRE_Solver solver, 
+				HYPRE_Int sweeps)
+{
+  char str_sweeps[8];
+  START_FUNC_DH
+  hypre_sprintf(str_sweeps,"%d",sweeps);
+  Parser_dhInsert(parser_dh, "-triSolveSweeps", str_sweeps); 
+  HYPRE_EUCLID_ERRCHKA;
+  END_FUNC_VAL(0)
+}
@@ -407,6 +407,60 @@ HYPRE_BoomerAMGSetSetupType( HYPRE_Solver solver,
    return( hypre_BoomerAMGSetSetupType( (void *) solver, setup_type ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetResetupType, HYPRE_BoomerAMGGetResetupType
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetResetupType( HYPRE_Solver solver,
+                               HYPRE_Int          resetup_type  )
+{
+   return( hypre_BoomerAMGSetResetupType( (void *) solver, resetup_type ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetResetupType( HYPRE_Solver solver,
+                               HYPRE_Int        * resetup_type  )
+{
+   return( hypre_BoomerAMGGetResetupType( (void *) solver, resetup_type ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRAPAccumType, HYPRE_BoomerAMGGetRAPAccumType
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRAPAccumType( HYPRE_Solver solver,
+                                HYPRE_Int          rap_accum_type  )
+{
+   return( hypre_BoomerAMGSetRAPAccumType( (void *) solver, rap_accum_type ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetRAPAccumType( HYPRE_Solver solver,
+                                HYPRE_Int        * rap_accum_type  )
+{
+   return( hypre_BoomerAMGGetRAPAccumType( (void *) solver, rap_accum_type ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision, HYPRE_BoomerAMGGetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision( HYPRE_Solver solver,
+                                  HYPRE_Int          mixed_precision  )
+{
+   return( hypre_BoomerAMGSetMixedPrecision( (void *) solver, mixed_precision ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetMixedPrecision( HYPRE_Solver solver,
+                                  HYPRE_Int        * mixed_precision  )
+{
+   return( hypre_BoomerAMGGetMixedPrecision( (void *) solver, mixed_precision ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetCycleType, HYPRE_BoomerAMGGetCycleType
  *--------------------------------------------------------------------------*/
@@ -863,6 +917,17 @@ HYPRE_BoomerAMGGetCumNumIterations( HYPRE_Solver  solver,
    return( hypre_BoomerAMGGetCumNumIterations( (void *) solver, cum_num_iterations ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetNumCycleAllocs
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNumCycleAllocs( HYPRE_Solver  solver,
+                                  HYPRE_Int          *num_cycle_allocs  )
+{
+   return( hypre_BoomerAMGGetNumCycleAllocs( (void *) solver, num_cycle_allocs ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGGetResidual
  *--------------------------------------------------------------------------*/
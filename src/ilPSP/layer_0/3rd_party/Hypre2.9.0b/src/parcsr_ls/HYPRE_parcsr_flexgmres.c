@@ -37,6 +37,7 @@ HYPRE_ParCSRFlexGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_FlexGMRESFunctionsSetMultiInnerProd( fgmres_functions, hypre_ParKrylovMultiInnerProd );
    *solver = ( (HYPRE_Solver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
    return hypre_error_flag;
@@ -137,6 +138,17 @@ HYPRE_ParCSRFlexGMRESSetMaxIter( HYPRE_Solver solver,
    return( HYPRE_FlexGMRESSetMaxIter( solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRFlexGMRESSetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRFlexGMRESSetOrthMethod( HYPRE_Solver solver,
+                             HYPRE_Int    orth_method )
+{
+   return( HYPRE_FlexGMRESSetOrthMethod( solver, orth_method ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRFlexGMRESSetPrecond
  *--------------------------------------------------------------------------*/
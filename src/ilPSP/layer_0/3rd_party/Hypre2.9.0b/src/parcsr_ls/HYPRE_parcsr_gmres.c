@@ -37,6 +37,7 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_GMRESFunctionsSetMultiInnerProd( gmres_functions, hypre_ParKrylovMultiInnerProd );
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -138,6 +139,17 @@ HYPRE_ParCSRGMRESSetMaxIter( HYPRE_Solver solver,
    return( HYPRE_GMRESSetMaxIter( solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGMRESSetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGMRESSetOrthMethod( HYPRE_Solver solver,
+                             HYPRE_Int    orth_method )
+{
+   return( HYPRE_GMRESSetOrthMethod( solver, orth_method ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRGMRESSetStopCrit - OBSOLETE
  *--------------------------------------------------------------------------*/
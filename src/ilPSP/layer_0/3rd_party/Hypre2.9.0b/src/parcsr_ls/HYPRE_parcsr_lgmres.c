@@ -37,6 +37,7 @@ HYPRE_ParCSRLGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_LGMRESFunctionsSetMultiInnerProd( lgmres_functions, hypre_ParKrylovMultiInnerProd );
    *solver = ( (HYPRE_Solver) hypre_LGMRESCreate( lgmres_functions ) );
 
    return hypre_error_flag;
@@ -148,6 +149,17 @@ HYPRE_ParCSRLGMRESSetMaxIter( HYPRE_Solver solver,
    return( HYPRE_LGMRESSetMaxIter( solver, max_iter ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRLGMRESSetOrthMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRLGMRESSetOrthMethod( HYPRE_Solver solver,
+                             HYPRE_Int    orth_method )
+{
+   return( HYPRE_LGMRESSetOrthMethod( solver, orth_method ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRLGMRESSetPrecond
  *--------------------------------------------------------------------------*/
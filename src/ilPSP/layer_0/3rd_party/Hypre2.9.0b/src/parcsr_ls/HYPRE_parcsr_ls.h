@@ -235,6 +235,75 @@ HYPRE_Int HYPRE_BoomerAMGSetCoarsenType(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetMeasureType(HYPRE_Solver solver,
                                   HYPRE_Int          measure_type);
 
+/**
+ * (Optional) Defines what a repeated call of HYPRE\_BoomerAMGSetup does
+ * when a hierarchy exists and the matrix has the same size and sparsity
+ * pattern, but new values (e.g. in the next step of an implicit time
+ * integration):
+ *
+ * \begin{tabular}{|c|l|} \hline
+ * 0 & full setup (default) \\
+ * 1 & keep the CF-splittings of all levels, recompute the interpolation \\
+ *   & and the values of the coarse grid operators \\
+ * 2 & keep the CF-splittings and the interpolation, recompute only \\
+ *   & the values of the coarse grid operators \\
+ * \hline
+ * \end{tabular}
+ *
+ * In both cases the relaxation data (l1 norms, Chebyshev bounds, Gaussian
+ * elimination on the coarsest grid) are recomputed; relaxation weights
+ * determined in the first setup are kept.  If the new operator leads to
+ * nonzeros outside the stored pattern of a coarse grid operator, that
+ * operator is rebuilt.  Options 1 and 2 fall back to a full setup for
+ * block/nodal systems, aggressive coarsening, complex smoothers,
+ * interpolation vectors, the redundant coarse grid solve and single
+ * precision hierarchies (see HYPRE\_BoomerAMGSetMixedPrecision); option 1
+ * also for interpolation types other than 0-9 and 12-14.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetResetupType(HYPRE_Solver solver,
+                                  HYPRE_Int          resetup_type);
+
+/**
+ * (Optional) Defines how the entries of a row of the coarse grid operator
+ * are collected in the Galerkin product:
+ *
+ * \begin{tabular}{|c|l|} \hline
+ * 0 & dense marker array over all coarse columns (default) \\
+ * 1 & hash table sized to the row, for wide rows (e.g. DG discretizations \\
+ *   & or aggressive coarsening) and large numbers of coarse points \\
+ * \hline
+ * \end{tabular}
+ *
+ * Both options give identical coarse grid operators.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRAPAccumType(HYPRE_Solver solver,
+                                   HYPRE_Int          rap_accum_type);
+
+/**
+ * (Optional) Stores the matrix values of the intermediate levels (coarse
+ * grid operators, interpolation and restriction of all levels except the
+ * finest and the coarsest one) in single precision, which reduces the
+ * memory and bandwidth of the cycle.  Vectors and all arithmetic stay in
+ * double precision, so BoomerAMG is still a fixed linear preconditioner
+ * for an outer Krylov method:
+ *
+ * \begin{tabular}{|c|l|} \hline
+ * 0 & double precision hierarchy (default) \\
+ * 1 & single precision values on the intermediate levels \\
+ * \hline
+ * \end{tabular}
+ *
+ * Only available for the relaxation types 0, 3, 4 and 6 on the down and up
+ * cycle, without block/nodal relaxation, complex smoothers below the finest
+ * level or a redundant coarse grid solve; otherwise the hierarchy stays in
+ * double precision.  If a hierarchy already exists, it is converted
+ * immediately and the iterations of the last solve are kept to report the
+ * change in the iteration count (print level 2 or 3).  The saved memory is
+ * printed after the setup (print level 1 or 3).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                     HYPRE_Int          mixed_precision);
+
 /**
  * (Optional) Defines the type of cycle.
  * For a V-cycle, set cycle\_type to 1, for a W-cycle
@@ -473,6 +542,14 @@ HYPRE_Int HYPRE_BoomerAMGGetResidual(HYPRE_Solver     solver,
 HYPRE_Int HYPRE_BoomerAMGGetNumIterations(HYPRE_Solver  solver,
                                     HYPRE_Int          *num_iterations);
 
+/**
+ * Returns the number of heap allocations made by the last solve after its
+ * first cycle.  Only counted if the library is compiled with
+ * HYPRE_MEMORY_COUNT, otherwise -1 is returned.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetNumCycleAllocs(HYPRE_Solver  solver,
+                                     HYPRE_Int          *num_cycle_allocs);
+
 /**
  * Returns the norm of the final relative residual.
  **/
@@ -1254,6 +1331,30 @@ HYPRE_Int HYPRE_EuclidSetRowScale(HYPRE_Solver solver,
 HYPRE_Int HYPRE_EuclidSetILUT(HYPRE_Solver solver,
                         double       drop_tol);
 
+/**
+ * Selects the triangular solves used when applying the factors in the
+ * sequential and block Jacobi cases.  Default: 0.
+ *
+ * The options are:
+ * \begin{tabular}{|c|l|} \hline
+ * 0 & sequential forward/backward substitution \\
+ * 1 & level-scheduled substitution; the rows of each level are processed
+ *     in parallel by the OpenMP threads (same result as 0) \\
+ * 2 & approximate solves by Jacobi sweeps on L and U, see
+ *     \Ref{HYPRE_EuclidSetTriSolveSweeps} \\
+ * \hline
+ * \end{tabular}
+ **/
+HYPRE_Int HYPRE_EuclidSetTriSolve(HYPRE_Solver solver,
+                            HYPRE_Int          tri_solve);
+
+/**
+ * Defines the number of Jacobi sweeps per triangular solve for
+ * tri\_solve = 2.  Default: 3.
+ **/
+HYPRE_Int HYPRE_EuclidSetTriSolveSweeps(HYPRE_Solver solver,
+                                  HYPRE_Int          sweeps);
+
 /*@}*/
 
 /*--------------------------------------------------------------------------
@@ -1863,6 +1964,12 @@ HYPRE_Int HYPRE_ParCSRPCGSetStopCrit(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm(HYPRE_Solver solver,
                               HYPRE_Int          two_norm);
 
+/*
+ * see HYPRE_PCGSetVariant
+ **/
+HYPRE_Int HYPRE_ParCSRPCGSetVariant(HYPRE_Solver solver,
+                              HYPRE_Int          variant);
+
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange(HYPRE_Solver solver,
                                 HYPRE_Int          rel_change);
 
@@ -1954,6 +2061,12 @@ HYPRE_Int HYPRE_ParCSRGMRESSetMinIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRGMRESSetMaxIter(HYPRE_Solver solver,
                                 HYPRE_Int          max_iter);
 
+/*
+ * see HYPRE_GMRESSetOrthMethod
+ **/
+HYPRE_Int HYPRE_ParCSRGMRESSetOrthMethod(HYPRE_Solver solver,
+                                HYPRE_Int          orth_method);
+
 /*
  * Obsolete
  **/
@@ -2032,6 +2145,12 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESSetMinIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetMaxIter(HYPRE_Solver solver,
                                     HYPRE_Int          max_iter);
 
+/*
+ * see HYPRE_FlexGMRESSetOrthMethod
+ **/
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetOrthMethod(HYPRE_Solver solver,
+                                HYPRE_Int          orth_method);
+
 
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetPrecond(HYPRE_Solver             solver,
                                     HYPRE_PtrToParSolverFcn  precond,
@@ -2110,6 +2229,12 @@ HYPRE_Int HYPRE_ParCSRLGMRESSetMinIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRLGMRESSetMaxIter(HYPRE_Solver solver,
                                  HYPRE_Int          max_iter);
 
+/*
+ * see HYPRE_LGMRESSetOrthMethod
+ **/
+HYPRE_Int HYPRE_ParCSRLGMRESSetOrthMethod(HYPRE_Solver solver,
+                                HYPRE_Int          orth_method);
+
 HYPRE_Int HYPRE_ParCSRLGMRESSetPrecond(HYPRE_Solver             solver,
                                  HYPRE_PtrToParSolverFcn  precond,
                                  HYPRE_PtrToParSolverFcn  precond_setup,
@@ -36,6 +36,9 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetMultiInnerProd(
+      pcg_functions,
+      hypre_ParKrylovMultiInnerProdStart, hypre_ParKrylovMultiInnerProdWait );
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -137,6 +140,17 @@ HYPRE_ParCSRPCGSetTwoNorm( HYPRE_Solver solver,
    return( HYPRE_PCGSetTwoNorm( solver, two_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPCGSetVariant
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPCGSetVariant( HYPRE_Solver solver,
+                           HYPRE_Int    variant )
+{
+   return( HYPRE_PCGSetVariant( solver, variant ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRPCGSetRelChange
  *--------------------------------------------------------------------------*/
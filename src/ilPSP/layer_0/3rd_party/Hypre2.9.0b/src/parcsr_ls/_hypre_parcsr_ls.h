@@ -73,6 +73,8 @@ typedef struct
    double   CR_strong_th;
    HYPRE_Int      measure_type;
    HYPRE_Int      setup_type;
+   HYPRE_Int      resetup_type;
+   HYPRE_Int      rap_accum_type;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
    HYPRE_Int      interp_type;
@@ -228,6 +230,15 @@ typedef struct
    double *b_vec;
    HYPRE_Int *comm_info;
 
+ /* arena for the temporaries of the solve cycle, sized in setup */
+   hypre_Workspace *workspace;
+   HYPRE_Int  num_cycle_allocs; /* heap allocations after the first cycle */
+
+ /* single precision storage of the coarse levels, see par_amg_mixed.c */
+   HYPRE_Int  mixed_precision;
+   HYPRE_Int  mp_num_levels;     /* levels stored in single precision */
+   HYPRE_Int  mp_ref_iterations; /* iterations of the last solve in double */
+
 } hypre_ParAMGData;
 
 /*--------------------------------------------------------------------------
@@ -252,6 +263,8 @@ typedef struct
 #define hypre_ParAMGDataCoarsenType(amg_data) ((amg_data)->coarsen_type)
 #define hypre_ParAMGDataMeasureType(amg_data) ((amg_data)->measure_type)
 #define hypre_ParAMGDataSetupType(amg_data) ((amg_data)->setup_type)
+#define hypre_ParAMGDataResetupType(amg_data) ((amg_data)->resetup_type)
+#define hypre_ParAMGDataRAPAccumType(amg_data) ((amg_data)->rap_accum_type)
 #define hypre_ParAMGDataPMaxElmts(amg_data) ((amg_data)->P_max_elmts)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data) ((amg_data)->agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data) ((amg_data)->agg_P12_max_elmts)
@@ -406,6 +419,13 @@ typedef struct
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
+#define hypre_ParAMGDataWorkspace(amg_data) ((amg_data)->workspace)
+#define hypre_ParAMGDataNumCycleAllocs(amg_data) ((amg_data)->num_cycle_allocs)
+
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataMPNumLevels(amg_data) ((amg_data)->mp_num_levels)
+#define hypre_ParAMGDataMPRefIterations(amg_data) ((amg_data)->mp_ref_iterations)
+
 #endif
 
 
@@ -691,6 +711,12 @@ HYPRE_Int HYPRE_BoomerAMGGetCoarsenType ( HYPRE_Solver solver , HYPRE_Int *coars
 HYPRE_Int HYPRE_BoomerAMGSetMeasureType ( HYPRE_Solver solver , HYPRE_Int measure_type );
 HYPRE_Int HYPRE_BoomerAMGGetMeasureType ( HYPRE_Solver solver , HYPRE_Int *measure_type );
 HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver , HYPRE_Int setup_type );
+HYPRE_Int HYPRE_BoomerAMGSetResetupType ( HYPRE_Solver solver , HYPRE_Int resetup_type );
+HYPRE_Int HYPRE_BoomerAMGGetResetupType ( HYPRE_Solver solver , HYPRE_Int *resetup_type );
+HYPRE_Int HYPRE_BoomerAMGSetRAPAccumType ( HYPRE_Solver solver , HYPRE_Int rap_accum_type );
+HYPRE_Int HYPRE_BoomerAMGGetRAPAccumType ( HYPRE_Solver solver , HYPRE_Int *rap_accum_type );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver , HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGGetMixedPrecision ( HYPRE_Solver solver , HYPRE_Int *mixed_precision );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver , HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetTol ( HYPRE_Solver solver , double tol );
@@ -727,6 +753,7 @@ HYPRE_Int HYPRE_BoomerAMGSetDebugFlag ( HYPRE_Solver solver , HYPRE_Int debug_fl
 HYPRE_Int HYPRE_BoomerAMGGetDebugFlag ( HYPRE_Solver solver , HYPRE_Int *debug_flag );
 HYPRE_Int HYPRE_BoomerAMGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
 HYPRE_Int HYPRE_BoomerAMGGetCumNumIterations ( HYPRE_Solver solver , HYPRE_Int *cum_num_iterations );
+HYPRE_Int HYPRE_BoomerAMGGetNumCycleAllocs ( HYPRE_Solver solver , HYPRE_Int *num_cycle_allocs );
 HYPRE_Int HYPRE_BoomerAMGGetResidual ( HYPRE_Solver solver , HYPRE_ParVector *residual );
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , double *rel_resid_norm );
 HYPRE_Int HYPRE_BoomerAMGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
@@ -840,6 +867,8 @@ HYPRE_Int HYPRE_EuclidSetMem ( HYPRE_Solver solver , HYPRE_Int eu_mem );
 HYPRE_Int HYPRE_EuclidSetILUT ( HYPRE_Solver solver , double ilut );
 HYPRE_Int HYPRE_EuclidSetSparseA ( HYPRE_Solver solver , double sparse_A );
 HYPRE_Int HYPRE_EuclidSetRowScale ( HYPRE_Solver solver , HYPRE_Int row_scale );
+HYPRE_Int HYPRE_EuclidSetTriSolve ( HYPRE_Solver solver , HYPRE_Int tri_solve );
+HYPRE_Int HYPRE_EuclidSetTriSolveSweeps ( HYPRE_Solver solver , HYPRE_Int sweeps );
 
 /* HYPRE_parcsr_flexgmres.c */
 HYPRE_Int HYPRE_ParCSRFlexGMRESCreate ( MPI_Comm comm , HYPRE_Solver *solver );
@@ -851,6 +880,7 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESSetTol ( HYPRE_Solver solver , double tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetAbsoluteTol ( HYPRE_Solver solver , double a_tol );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRFlexGMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRFlexGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
@@ -869,6 +899,7 @@ HYPRE_Int HYPRE_ParCSRGMRESSetTol ( HYPRE_Solver solver , double tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetAbsoluteTol ( HYPRE_Solver solver , double a_tol );
 HYPRE_Int HYPRE_ParCSRGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
 HYPRE_Int HYPRE_ParCSRGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRGMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
 HYPRE_Int HYPRE_ParCSRGMRESSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
@@ -956,6 +987,7 @@ HYPRE_Int HYPRE_ParCSRLGMRESSetTol ( HYPRE_Solver solver , double tol );
 HYPRE_Int HYPRE_ParCSRLGMRESSetAbsoluteTol ( HYPRE_Solver solver , double a_tol );
 HYPRE_Int HYPRE_ParCSRLGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
 HYPRE_Int HYPRE_ParCSRLGMRESSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRLGMRESSetOrthMethod ( HYPRE_Solver solver , HYPRE_Int orth_method );
 HYPRE_Int HYPRE_ParCSRLGMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRLGMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
 HYPRE_Int HYPRE_ParCSRLGMRESSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
@@ -1007,6 +1039,7 @@ HYPRE_Int HYPRE_ParCSRPCGSetAbsoluteTol ( HYPRE_Solver solver , double a_tol );
 HYPRE_Int HYPRE_ParCSRPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
 HYPRE_Int HYPRE_ParCSRPCGSetStopCrit ( HYPRE_Solver solver , HYPRE_Int stop_crit );
 HYPRE_Int HYPRE_ParCSRPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_ParCSRPCGSetVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_ParCSRPCGSetRelChange ( HYPRE_Solver solver , HYPRE_Int rel_change );
 HYPRE_Int HYPRE_ParCSRPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_ParCSRPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
@@ -1079,6 +1112,12 @@ HYPRE_Int hypre_BoomerAMGSetMeasureType ( void *data , HYPRE_Int measure_type );
 HYPRE_Int hypre_BoomerAMGGetMeasureType ( void *data , HYPRE_Int *measure_type );
 HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data , HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data , HYPRE_Int *setup_type );
+HYPRE_Int hypre_BoomerAMGSetResetupType ( void *data , HYPRE_Int resetup_type );
+HYPRE_Int hypre_BoomerAMGGetResetupType ( void *data , HYPRE_Int *resetup_type );
+HYPRE_Int hypre_BoomerAMGSetRAPAccumType ( void *data , HYPRE_Int rap_accum_type );
+HYPRE_Int hypre_BoomerAMGGetRAPAccumType ( void *data , HYPRE_Int *rap_accum_type );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data , HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGGetMixedPrecision ( void *data , HYPRE_Int *mixed_precision );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data , HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data , HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetTol ( void *data , double tol );
@@ -1152,6 +1191,7 @@ HYPRE_Int hypre_BoomerAMGSetPointDofMap ( void *data , HYPRE_Int *point_dof_map
 HYPRE_Int hypre_BoomerAMGSetDofPoint ( void *data , HYPRE_Int *dof_point );
 HYPRE_Int hypre_BoomerAMGGetNumIterations ( void *data , HYPRE_Int *num_iterations );
 HYPRE_Int hypre_BoomerAMGGetCumNumIterations ( void *data , HYPRE_Int *cum_num_iterations );
+HYPRE_Int hypre_BoomerAMGGetNumCycleAllocs ( void *data , HYPRE_Int *num_cycle_allocs );
 HYPRE_Int hypre_BoomerAMGGetResidual ( void *data , hypre_ParVector **resid );
 HYPRE_Int hypre_BoomerAMGGetRelResidualNorm ( void *data , double *rel_resid_norm );
 HYPRE_Int hypre_BoomerAMGSetVariant ( void *data , HYPRE_Int variant );
@@ -1183,6 +1223,14 @@ HYPRE_Int hypre_BoomerAMGSetSmoothInterpVectors ( void *solver , HYPRE_Int smoot
 HYPRE_Int hypre_BoomerAMGSetInterpRefine ( void *data , HYPRE_Int num_refine );
 HYPRE_Int hypre_BoomerAMGSetInterpVecFirstLevel ( void *data , HYPRE_Int level );
 
+/* par_amg_mixed.c */
+HYPRE_Int hypre_BoomerAMGMixedPrecisionSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGRelaxSP ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , double relax_weight , double omega , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupCheck ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1306,6 +1354,8 @@ HYPRE_Int hypre_BoomerAMGCreateScalarCF ( HYPRE_Int *CFN_marker , HYPRE_Int num_
 /* par_rap.c */
 hypre_CSRMatrix *hypre_ExchangeRAPData ( hypre_CSRMatrix *RAP_int , hypre_ParCSRCommPkg *comm_pkg_RT );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorAccum ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , HYPRE_Int rap_accum_type , hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorNumeric ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP , HYPRE_Int *num_missing_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT , hypre_ParCSRMatrix *A , HYPRE_Int *fine_to_coarse_offd );
@@ -1355,6 +1405,8 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data , HYPRE_Int *dof_func );
 
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGMixedPrecisionStats ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGMixedPrecisionSolveStats ( void *amg_vdata );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
 
 /* par_strength.c */
@@ -1405,6 +1457,9 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , double alpha , void *A , v
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , double alpha , void *A , void *x , double beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 double hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovMultiInnerProdStart ( HYPRE_Int n , void **x , void **y , double *local_prod , double *prod , hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovMultiInnerProdWait ( hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovMultiInnerProd ( HYPRE_Int n , void **x , void *y , double *local_prod , double *prod );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( double alpha , void *x );
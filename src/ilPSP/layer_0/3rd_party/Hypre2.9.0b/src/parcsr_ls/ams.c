@@ -94,7 +94,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
          HYPRE_Int i, j;
          HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
          HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-         double *u_offd_data = hypre_TAlloc(double,num_cols_offd);
+         double *u_offd_data = hypre_WorkspaceTAlloc(double,num_cols_offd);
 
          double res;
 
@@ -118,7 +118,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
             }
 
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-            u_buf_data = hypre_TAlloc(double,
+            u_buf_data = hypre_WorkspaceTAlloc(double,
                                       hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
             for (i = 0; i < num_sends; i++)
@@ -130,7 +130,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
             comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,u_buf_data,u_offd_data);
             hypre_ParCSRCommHandleDestroy(comm_handle);
 
-            hypre_TFree(u_buf_data);
+            hypre_WorkspaceTFree(u_buf_data);
          }
 
          if (relax_weight == 1.0 && omega == 1.0) /* symmetric Gauss-Seidel */
@@ -224,7 +224,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
             }
          }
 
-         hypre_TFree(u_offd_data);
+         hypre_WorkspaceTFree(u_offd_data);
       }
       else if (relax_type == 3) /* Kaczmarz */
       {
@@ -241,7 +241,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
          HYPRE_Int i, j;
          HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
          HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-         double *u_offd_data = hypre_TAlloc(double,num_cols_offd);
+         double *u_offd_data = hypre_WorkspaceTAlloc(double,num_cols_offd);
 
          double res;
 
@@ -265,7 +265,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
             }
 
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-            u_buf_data = hypre_TAlloc(double,
+            u_buf_data = hypre_WorkspaceTAlloc(double,
                                       hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
             for (i = 0; i < num_sends; i++)
@@ -277,7 +277,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
             comm_handle = hypre_ParCSRCommHandleCreate(1,comm_pkg,u_buf_data,u_offd_data);
             hypre_ParCSRCommHandleDestroy(comm_handle);
 
-            hypre_TFree(u_buf_data);
+            hypre_WorkspaceTFree(u_buf_data);
          }
 
          /* Forward local pass */
@@ -308,7 +308,7 @@ HYPRE_Int hypre_ParCSRRelax(/* matrix to relax with */
                u_data[A_diag_J[j]] += omega * res * A_diag_data[j];
          }
 
-         hypre_TFree(u_offd_data);
+         hypre_WorkspaceTFree(u_offd_data);
       }
       else /* call BoomerAMG relaxation */
       {
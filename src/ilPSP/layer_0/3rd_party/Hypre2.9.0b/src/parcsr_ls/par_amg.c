@@ -51,6 +51,8 @@ hypre_BoomerAMGCreate()
    HYPRE_Int      coarsen_type;
    HYPRE_Int      measure_type;
    HYPRE_Int      setup_type;
+   HYPRE_Int      resetup_type;
+   HYPRE_Int      rap_accum_type;
    HYPRE_Int      P_max_elmts;
    HYPRE_Int 	    num_functions;
    HYPRE_Int 	    nodal, nodal_levels, nodal_diag;
@@ -132,6 +134,8 @@ hypre_BoomerAMGCreate()
    coarsen_type = 6;
    measure_type = 0;
    setup_type = 1;
+   resetup_type = 0;
+   rap_accum_type = 0;
    P_max_elmts = 0;
    agg_P_max_elmts = 0;
    agg_P12_max_elmts = 0;
@@ -223,6 +227,8 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetMeasureType(amg_data, measure_type);
    hypre_BoomerAMGSetCoarsenType(amg_data, coarsen_type);
    hypre_BoomerAMGSetSetupType(amg_data, setup_type);
+   hypre_BoomerAMGSetResetupType(amg_data, resetup_type);
+   hypre_BoomerAMGSetRAPAccumType(amg_data, rap_accum_type);
    hypre_BoomerAMGSetPMaxElmts(amg_data, P_max_elmts);
    hypre_BoomerAMGSetAggPMaxElmts(amg_data, agg_P_max_elmts);
    hypre_BoomerAMGSetAggP12MaxElmts(amg_data, agg_P12_max_elmts);
@@ -347,6 +353,13 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataBVec(amg_data) = NULL;
    hypre_ParAMGDataCommInfo(amg_data) = NULL;
 
+   hypre_ParAMGDataWorkspace(amg_data) = NULL;
+   hypre_ParAMGDataNumCycleAllocs(amg_data) = 0;
+
+   hypre_ParAMGDataMixedPrecision(amg_data) = 0;
+   hypre_ParAMGDataMPNumLevels(amg_data) = 0;
+   hypre_ParAMGDataMPRefIterations(amg_data) = -1;
+
    return (void *) amg_data;
 }
 
@@ -568,6 +581,7 @@ hypre_BoomerAMGDestroy( void *data )
    if (hypre_ParAMGDataAMat(amg_data)) hypre_TFree(hypre_ParAMGDataAMat(amg_data));
    if (hypre_ParAMGDataBVec(amg_data)) hypre_TFree(hypre_ParAMGDataBVec(amg_data));
    if (hypre_ParAMGDataCommInfo(amg_data)) hypre_TFree(hypre_ParAMGDataCommInfo(amg_data));
+   hypre_WorkspaceDestroy(hypre_ParAMGDataWorkspace(amg_data));
 
    if (new_comm != hypre_MPI_COMM_NULL) 
    {
@@ -1303,6 +1317,145 @@ hypre_BoomerAMGGetSetupType( void  *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetResetupType( void  *data,
+                               HYPRE_Int    resetup_type )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   if (resetup_type < 0 || resetup_type > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataResetupType(amg_data) = resetup_type;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetResetupType( void  *data,
+                               HYPRE_Int  *  resetup_type )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   *resetup_type = hypre_ParAMGDataResetupType(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRAPAccumType( void  *data,
+                                HYPRE_Int    rap_accum_type )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   if (rap_accum_type < 0 || rap_accum_type > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataRAPAccumType(amg_data) = rap_accum_type;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetRAPAccumType( void  *data,
+                                HYPRE_Int  *  rap_accum_type )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   *rap_accum_type = hypre_ParAMGDataRAPAccumType(amg_data);
+
+   return hypre_error_flag;
+}
+
+/* switching on single precision storage with an existing hierarchy converts
+   it right away; the iterations of the last solve are kept as reference for
+   hypre_BoomerAMGMixedPrecisionSolveStats */
+
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void  *data,
+                                  HYPRE_Int    mixed_precision )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   if (mixed_precision < 0 || mixed_precision > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+
+   if (mixed_precision && hypre_ParAMGDataAArray(amg_data) &&
+       hypre_ParAMGDataMPNumLevels(amg_data) == 0)
+   {
+      if (hypre_ParAMGDataNumIterations(amg_data) > 0)
+         hypre_ParAMGDataMPRefIterations(amg_data) =
+            hypre_ParAMGDataNumIterations(amg_data);
+      hypre_BoomerAMGMixedPrecisionSetup(amg_data);
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetMixedPrecision( void  *data,
+                                  HYPRE_Int  *  mixed_precision )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+
+   *mixed_precision = hypre_ParAMGDataMixedPrecision(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetCycleType( void  *data,
                           HYPRE_Int    cycle_type )
@@ -2930,6 +3083,23 @@ hypre_BoomerAMGGetCumNumIterations( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGGetNumCycleAllocs( void     *data,
+                                  HYPRE_Int      *num_cycle_allocs )
+{
+   hypre_ParAMGData  *amg_data = data;
+
+   if (!amg_data)
+   {
+      hypre_printf("Warning! BoomerAMG object empty!\n");
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   } 
+   *num_cycle_allocs = hypre_ParAMGDataNumCycleAllocs(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGGetResidual( void * data, hypre_ParVector ** resid )
 {
@@ -42,6 +42,8 @@ typedef struct
    double   CR_strong_th;
    HYPRE_Int      measure_type;
    HYPRE_Int      setup_type;
+   HYPRE_Int      resetup_type;
+   HYPRE_Int      rap_accum_type;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
    HYPRE_Int      interp_type;
@@ -197,6 +199,15 @@ typedef struct
    double *b_vec;
    HYPRE_Int *comm_info;
 
+ /* arena for the temporaries of the solve cycle, sized in setup */
+   hypre_Workspace *workspace;
+   HYPRE_Int  num_cycle_allocs; /* heap allocations after the first cycle */
+
+ /* single precision storage of the coarse levels, see par_amg_mixed.c */
+   HYPRE_Int  mixed_precision;
+   HYPRE_Int  mp_num_levels;     /* levels stored in single precision */
+   HYPRE_Int  mp_ref_iterations; /* iterations of the last solve in double */
+
 } hypre_ParAMGData;
 
 /*--------------------------------------------------------------------------
@@ -221,6 +232,8 @@ typedef struct
 #define hypre_ParAMGDataCoarsenType(amg_data) ((amg_data)->coarsen_type)
 #define hypre_ParAMGDataMeasureType(amg_data) ((amg_data)->measure_type)
 #define hypre_ParAMGDataSetupType(amg_data) ((amg_data)->setup_type)
+#define hypre_ParAMGDataResetupType(amg_data) ((amg_data)->resetup_type)
+#define hypre_ParAMGDataRAPAccumType(amg_data) ((amg_data)->rap_accum_type)
 #define hypre_ParAMGDataPMaxElmts(amg_data) ((amg_data)->P_max_elmts)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data) ((amg_data)->agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data) ((amg_data)->agg_P12_max_elmts)
@@ -375,6 +388,13 @@ typedef struct
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
+#define hypre_ParAMGDataWorkspace(amg_data) ((amg_data)->workspace)
+#define hypre_ParAMGDataNumCycleAllocs(amg_data) ((amg_data)->num_cycle_allocs)
+
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataMPNumLevels(amg_data) ((amg_data)->mp_num_levels)
+#define hypre_ParAMGDataMPRefIterations(amg_data) ((amg_data)->mp_ref_iterations)
+
 #endif
 
 
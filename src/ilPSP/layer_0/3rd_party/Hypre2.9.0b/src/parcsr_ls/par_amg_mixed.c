@@ -0,0 +1,374 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 2.0 $
+ ***********************************************************************EHEADER*/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+#include <float.h>
+
+/*****************************************************************************
+ *
+ * Mixed precision hierarchy (mixed_precision = 1):
+ *
+ * After the setup the values of the coarse grid operators A_1 ... A_{L-2}
+ * and of the interpolation operators P_0 ... P_{L-2} (R = P^T) are moved to
+ * single precision (see hypre_CSRMatrixSetSinglePrecision).  The finest
+ * operator, which is the user's matrix and is needed for the residual in
+ * double precision, and the coarsest operator (direct solve) are kept.
+ * Vectors and all arithmetic stay in double precision, the float values are
+ * converted while they are streamed from memory, so the cycle is still a
+ * fixed linear operator and can be used as preconditioner of pcg.c and
+ * gmres.c.  Relaxation on the single precision levels is done by
+ * hypre_BoomerAMGRelaxSP.
+ *
+ *****************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionSetup
+ *
+ * Converts the hierarchy if mixed_precision is set and the cycle only uses
+ * routines which know about single precision values; otherwise the
+ * hierarchy stays in double precision.  The decision is the same on all
+ * processors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionSetup( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data = amg_vdata;
+
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            print_level = hypre_ParAMGDataPrintLevel(amg_data);
+
+   MPI_Comm             comm;
+   hypre_CSRMatrix     *matrices[4];
+   double              *data;
+   double               max_value, global_max_value;
+   HYPRE_Int            supported, level, i, k, m, my_id;
+
+   if (!hypre_ParAMGDataMixedPrecision(amg_data) ||
+       hypre_ParAMGDataMPNumLevels(amg_data) > 0 ||
+       A_array == NULL || num_levels < 2)
+      return hypre_error_flag;
+
+   comm = hypre_ParCSRMatrixComm(A_array[0]);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* relaxation on the intermediate levels has to be one of the types
+      implemented in hypre_BoomerAMGRelaxSP */
+   supported = 1;
+   if (hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 1 ||
+       hypre_ParAMGDataCoarseSolver(amg_data) != NULL)
+      supported = 0;
+   for (k = 1; k < 3; k++)
+   {
+      switch (grid_relax_type[k])
+      {
+         case 0: case 3: case 4: case 6:
+            break;
+         default:
+            supported = 0;
+      }
+   }
+
+   if (!supported)
+   {
+      if (my_id == 0 && print_level > 0)
+         hypre_printf("Warning! BoomerAMG mixed precision is not available for the chosen smoothers, hierarchy kept in double precision\n");
+      return hypre_error_flag;
+   }
+
+   /* all values have to fit into a float */
+   max_value = 0.0;
+   for (level = 0; level < num_levels-1; level++)
+   {
+      m = 0;
+      if (level > 0)
+      {
+         matrices[m++] = hypre_ParCSRMatrixDiag(A_array[level]);
+         matrices[m++] = hypre_ParCSRMatrixOffd(A_array[level]);
+      }
+      matrices[m++] = hypre_ParCSRMatrixDiag(P_array[level]);
+      matrices[m++] = hypre_ParCSRMatrixOffd(P_array[level]);
+      for (k = 0; k < m; k++)
+      {
+         data = hypre_CSRMatrixData(matrices[k]);
+         for (i = 0; i < hypre_CSRMatrixNumNonzeros(matrices[k]); i++)
+            if (fabs(data[i]) > max_value) max_value = fabs(data[i]);
+      }
+   }
+   hypre_MPI_Allreduce(&max_value, &global_max_value, 1, hypre_MPI_DOUBLE,
+                       hypre_MPI_MAX, comm);
+   if (global_max_value > FLT_MAX)
+   {
+      if (my_id == 0 && print_level > 0)
+         hypre_printf("Warning! BoomerAMG mixed precision: values exceed the single precision range, hierarchy kept in double precision\n");
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels-1; level++)
+   {
+      if (level > 0)
+      {
+         hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixDiag(A_array[level]));
+         hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixOffd(A_array[level]));
+      }
+      hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixDiag(P_array[level]));
+      hypre_CSRMatrixSetSinglePrecision(hypre_ParCSRMatrixOffd(P_array[level]));
+   }
+   hypre_ParAMGDataMPNumLevels(amg_data) = num_levels-1;
+
+   if (print_level == 1 || print_level == 3)
+      hypre_BoomerAMGMixedPrecisionStats(amg_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RelaxSPRows
+ *
+ * relaxes the rows ns ... ne-1 of a single precision matrix, forward or
+ * backward (Gauss-Seidel) or all from the old iterate (Jacobi).  Columns
+ * in [lo,hi) are taken from u (Gauss-Seidel), all others from tmp_data.
+ * With outer weights v_data holds the iterate before the sweep; the update
+ * is the one of hypre_BoomerAMGRelax.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RelaxSPRows( hypre_CSRMatrix *A_diag,
+                   hypre_CSRMatrix *A_offd,
+                   double          *f_data,
+                   double          *u_data,
+                   double          *v_data,
+                   double          *tmp_data,
+                   double          *Vext_data,
+                   HYPRE_Int       *cf_marker,
+                   HYPRE_Int        relax_points,
+                   HYPRE_Int        ns,
+                   HYPRE_Int        ne,
+                   HYPRE_Int        backward,
+                   HYPRE_Int        lo,
+                   HYPRE_Int        hi,
+                   double           relax_weight,
+                   double           omega )
+{
+   float      *A_diag_data = hypre_CSRMatrixSPData(A_diag);
+   HYPRE_Int  *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int  *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   float      *A_offd_data = hypre_CSRMatrixSPData(A_offd);
+   HYPRE_Int  *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int  *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+
+   HYPRE_Int   weighted = (relax_weight != 1.0 || omega != 1.0);
+   double      prod = 1.0 - relax_weight*omega;
+   double      one_minus_omega = 1.0 - omega;
+   double      diag, res, res0, res2;
+   HYPRE_Int   i, ii, jj, k;
+
+   for (k = 0; k < ne-ns; k++)
+   {
+      i = backward ? ne-1-k : ns+k;
+
+      /*-----------------------------------------------------------
+       * If i is of the right type ( C or F ) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+
+      if (relax_points != 0 && cf_marker[i] != relax_points)
+         continue;
+      diag = (double) A_diag_data[A_diag_i[i]];
+      if (diag == 0.0)
+         continue;
+
+      res  = f_data[i];
+      res0 = 0.0;
+      res2 = 0.0;
+      for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+      {
+         ii = A_diag_j[jj];
+         if (ii >= lo && ii < hi)
+         {
+            res0 -= (double) A_diag_data[jj] * u_data[ii];
+            if (v_data) res2 += (double) A_diag_data[jj] * v_data[ii];
+         }
+         else
+            res -= (double) A_diag_data[jj] * tmp_data[ii];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         ii = A_offd_j[jj];
+         res -= (double) A_offd_data[jj] * Vext_data[ii];
+      }
+
+      if (weighted)
+      {
+         u_data[i] *= prod;
+         u_data[i] += relax_weight*(omega*res + res0 +
+                                    one_minus_omega*res2) / diag;
+      }
+      else
+         u_data[i] = (res + res0) / diag;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxSP
+ *
+ * relaxation on a level with single precision values; relax_type 0
+ * (weighted Jacobi), 3, 4 and 6 (hybrid forward, backward and symmetric
+ * Gauss-Seidel/SOR) with the same results as hypre_BoomerAMGRelax up to
+ * the rounding of the matrix values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxSP( hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *f,
+                        HYPRE_Int          *cf_marker,
+                        HYPRE_Int           relax_type,
+                        HYPRE_Int           relax_points,
+                        double              relax_weight,
+                        double              omega,
+                        hypre_ParVector    *u,
+                        hypre_ParVector    *Vtemp,
+                        hypre_ParVector    *Ztemp )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix      *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Int             n = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   double               *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   double               *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   double               *Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   double               *Vext_data = NULL;
+   double               *v_buf_data = NULL;
+   double               *v_data = NULL;
+   double               *tmp_data = NULL;
+
+   HYPRE_Int             num_procs, num_threads, num_sends;
+   HYPRE_Int             i, j, index, start, ns, ne, size, rest;
+   HYPRE_Int             relax_error = 0;
+
+   if (relax_type != 0 && relax_type != 3 && relax_type != 4 && relax_type != 6)
+   {
+      hypre_error_in_arg(4);
+      return 1;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_WorkspaceCTAlloc(double,
+                        hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+      Vext_data = hypre_WorkspaceCTAlloc(double, num_cols_offd);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+            v_buf_data[index++]
+               = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
+                                                  Vext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+   }
+
+   /*-----------------------------------------------------------------
+    * Jacobi reads the old iterate from Vtemp; Gauss-Seidel keeps it in
+    * Vtemp for the outer weights and, with threads, reads the values of
+    * the other threads' rows from a copy in Ztemp.
+    *-----------------------------------------------------------------*/
+
+   if (relax_type == 0 || relax_weight != 1.0 || omega != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+         Vtemp_data[i] = u_data[i];
+   }
+
+   if (relax_type == 0)
+   {
+      tmp_data = Vtemp_data;
+      omega = 1.0;
+   }
+   else
+   {
+      if (relax_weight != 1.0 || omega != 1.0)
+         v_data = Vtemp_data;
+      if (num_threads > 1)
+      {
+         tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(Ztemp));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < n; i++)
+            tmp_data[i] = u_data[i];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j,ns,ne,rest,size) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      size = n/num_threads;
+      rest = n - size*num_threads;
+      if (j < rest)
+      {
+         ns = j*size+j;
+         ne = (j+1)*size+j+1;
+      }
+      else
+      {
+         ns = j*size+rest;
+         ne = (j+1)*size+rest;
+      }
+
+      if (relax_type == 0)
+         hypre_RelaxSPRows(A_diag, A_offd, f_data, u_data, NULL, tmp_data,
+                           Vext_data, cf_marker, relax_points, ns, ne, 0,
+                           0, 0, relax_weight, omega);
+      if (relax_type == 3 || relax_type == 6)
+         hypre_RelaxSPRows(A_diag, A_offd, f_data, u_data, v_data, tmp_data,
+                           Vext_data, cf_marker, relax_points, ns, ne, 0,
+                           ns, ne, relax_weight, omega);
+      if (relax_type == 4 || relax_type == 6)
+         hypre_RelaxSPRows(A_diag, A_offd, f_data, u_data, v_data, tmp_data,
+                           Vext_data, cf_marker, relax_points, ns, ne, 1,
+                           ns, ne, relax_weight, omega);
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_WorkspaceTFree(Vext_data);
+      hypre_WorkspaceTFree(v_buf_data);
+   }
+
+   return relax_error;
+}
@@ -0,0 +1,438 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 1.0 $
+ ***********************************************************************EHEADER*/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*****************************************************************************
+ *
+ * Numeric re-setup of an existing AMG hierarchy for a matrix with the same
+ * sparsity pattern (e.g. the next time step of an implicit scheme):
+ *
+ *   resetup_type = 1: the CF-splittings of all levels are kept, S and P
+ *                     are recomputed from the new values, the coarse grid
+ *                     operators are recomputed in their existing pattern
+ *   resetup_type = 2: as 1, but P is kept as well (frozen interpolation)
+ *
+ * If the product R*A*P of a level has nonzeros outside the stored pattern
+ * of the coarse grid operator (e.g. because truncation of P selected
+ * different entries), the coarse grid operator of that level is rebuilt.
+ * Relaxation weights computed during the first setup are kept.
+ *
+ *****************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCheck
+ *
+ * Returns 1 if the hierarchy stored in amg_data can be re-used for A with
+ * the current resetup_type, 0 if a full setup has to be done.  The result
+ * is the same on all processors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupCheck( void               *amg_vdata,
+                             hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData   *amg_data = amg_vdata;
+
+   MPI_Comm            comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int           resetup_type = hypre_ParAMGDataResetupType(amg_data);
+   HYPRE_Int           num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int          *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int           interp_type = hypre_ParAMGDataInterpType(amg_data);
+   hypre_ParCSRMatrix **P_array = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParVector    *Vtemp = hypre_ParAMGDataVtemp(amg_data);
+   HYPRE_Int           local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+
+   HYPRE_Int           possible, global_possible;
+   HYPRE_Int           i;
+
+   if (resetup_type == 0)
+      return 0;
+
+   possible = 1;
+
+   /* a hierarchy has to exist and match the size of A */
+   if (Vtemp == NULL || hypre_ParAMGDataAArray(amg_data) == NULL)
+      possible = 0;
+   else if (hypre_ParVectorGlobalSize(Vtemp) != hypre_ParCSRMatrixGlobalNumRows(A) ||
+            hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) != local_size)
+      possible = 0;
+   else if (num_levels > 1 &&
+            hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P_array[0])) != local_size)
+      possible = 0;
+
+   /* features which are set up in ways not covered by the re-setup */
+   if (hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataAggNumLevels(amg_data) > 0 ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+       hypre_ParAMGInterpVecVariant(amg_data) > 0 ||
+       hypre_ParAMGDataGSMG(amg_data) ||
+       hypre_ParAMGDataCoarseSolver(amg_data) != NULL ||
+       hypre_ParAMGDataMPNumLevels(amg_data) > 0)
+      possible = 0;
+   for (i=0; i < 4; i++)
+      if (grid_relax_type[i] == 15)
+         possible = 0;
+
+   /* recomputing P is supported for the scalar interpolation routines */
+   if (resetup_type == 1)
+   {
+      if (hypre_ParAMGDataNodal(amg_data) != 0 ||
+          hypre_ParAMGDataPostInterpType(amg_data) > 0)
+         possible = 0;
+      switch (interp_type)
+      {
+         case 0: case 2: case 3: case 4: case 5: case 6: case 7:
+         case 8: case 9: case 12: case 13: case 14:
+            break;
+         default:
+            possible = 0;
+      }
+   }
+
+   hypre_MPI_Allreduce(&possible, &global_possible, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+
+   return global_possible;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupInterp
+ *
+ * Builds the interpolation of 'level' from the stored CF-splitting, in the
+ * same way as hypre_BoomerAMGSetup does for a scalar problem.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupInterp( hypre_ParAMGData    *amg_data,
+                              HYPRE_Int            level,
+                              hypre_ParCSRMatrix **P_ptr )
+{
+   hypre_ParCSRMatrix  *A = hypre_ParAMGDataAArray(amg_data)[level];
+   HYPRE_Int           *CF_marker = hypre_ParAMGDataCFMarkerArray(amg_data)[level];
+   HYPRE_Int           *dof_func = hypre_ParAMGDataDofFuncArray(amg_data)[level];
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            local_num_vars = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int            num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int            interp_type = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int            debug_flag = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Int            P_max_elmts = hypre_ParAMGDataPMaxElmts(amg_data);
+   double               trunc_factor = hypre_ParAMGDataTruncFactor(amg_data);
+   double               strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   double               max_row_sum = hypre_ParAMGDataMaxRowSum(amg_data);
+   double               S_commpkg_switch = hypre_ParAMGDataSCommPkgSwitch(amg_data);
+
+   hypre_ParCSRMatrix  *S = NULL;
+   hypre_ParCSRMatrix  *P = NULL;
+   HYPRE_Int           *col_offd_S_to_A = NULL;
+   HYPRE_Int           *coarse_pnts_global = NULL;
+   HYPRE_Int           *coarse_dof_func = NULL;
+   HYPRE_Int            sep_weight = 0;
+   HYPRE_Int            dbg_flg;
+
+   /* see hypre_BoomerAMGSetup */
+   if (interp_type == 9)
+   {
+      interp_type = 8;
+      sep_weight = 1;
+   }
+   else if (interp_type == 5)
+   {
+      interp_type = 4;
+      sep_weight = 1;
+   }
+
+   hypre_BoomerAMGCreateS(A, strong_threshold, max_row_sum,
+                          num_functions, dof_func, &S);
+   if (strong_threshold > S_commpkg_switch)
+      hypre_BoomerAMGCreateSCommPkg(A, S, &col_offd_S_to_A);
+
+   hypre_BoomerAMGCoarseParms(comm, local_num_vars, num_functions, dof_func,
+                              CF_marker, &coarse_dof_func, &coarse_pnts_global);
+
+   switch (interp_type)
+   {
+      case 2:
+         hypre_BoomerAMGBuildInterpHE(A, CF_marker, S, coarse_pnts_global,
+                                      num_functions, dof_func, debug_flag,
+                                      trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 3:
+         hypre_BoomerAMGBuildDirInterp(A, CF_marker, S, coarse_pnts_global,
+                                       num_functions, dof_func, debug_flag,
+                                       trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 4:
+         hypre_BoomerAMGBuildMultipass(A, CF_marker, S, coarse_pnts_global,
+                                       num_functions, dof_func, debug_flag,
+                                       trunc_factor, P_max_elmts, sep_weight,
+                                       col_offd_S_to_A, &P);
+         break;
+      case 6:
+         hypre_BoomerAMGBuildExtPIInterp(A, CF_marker, S, coarse_pnts_global,
+                                         num_functions, dof_func, debug_flag,
+                                         trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 7:
+         hypre_BoomerAMGBuildExtPICCInterp(A, CF_marker, S, coarse_pnts_global,
+                                           num_functions, dof_func, debug_flag,
+                                           trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 8:
+         hypre_BoomerAMGBuildStdInterp(A, CF_marker, S, coarse_pnts_global,
+                                       num_functions, dof_func, debug_flag,
+                                       trunc_factor, P_max_elmts, sep_weight,
+                                       col_offd_S_to_A, &P);
+         break;
+      case 12:
+         hypre_BoomerAMGBuildFFInterp(A, CF_marker, S, coarse_pnts_global,
+                                      num_functions, dof_func, debug_flag,
+                                      trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 13:
+         hypre_BoomerAMGBuildFF1Interp(A, CF_marker, S, coarse_pnts_global,
+                                       num_functions, dof_func, debug_flag,
+                                       trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      case 14:
+         hypre_BoomerAMGBuildExtInterp(A, CF_marker, S, coarse_pnts_global,
+                                       num_functions, dof_func, debug_flag,
+                                       trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+         break;
+      default:
+         dbg_flg = debug_flag;
+         if (hypre_ParAMGDataPrintLevel(amg_data)) dbg_flg = -debug_flag;
+         hypre_BoomerAMGBuildInterp(A, CF_marker, S, coarse_pnts_global,
+                                    num_functions, dof_func, dbg_flg,
+                                    trunc_factor, P_max_elmts, col_offd_S_to_A, &P);
+   }
+
+   hypre_TFree(col_offd_S_to_A);
+   hypre_TFree(coarse_dof_func);
+   hypre_ParCSRMatrixDestroy(S);
+
+   *P_ptr = P;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupRelax
+ *
+ * Recomputes the data of the relaxation schemes which depend on the
+ * values of the operators (l1 norms, eigenvalue estimates for Chebyshev,
+ * dense coarsest grid operator for Gaussian elimination).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupRelax( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order = hypre_ParAMGDataRelaxOrder(amg_data);
+   double             **l1_norms = hypre_ParAMGDataL1Norms(amg_data);
+   double              *max_eig_est = hypre_ParAMGDataMaxEigEst(amg_data);
+   double              *min_eig_est = hypre_ParAMGDataMinEigEst(amg_data);
+   HYPRE_Int            num_threads = hypre_NumThreads();
+   HYPRE_Int           *cf_marker;
+   HYPRE_Int            option;
+   HYPRE_Int            j;
+   MPI_Comm             new_comm;
+
+   for (j = 0; j < num_levels; j++)
+   {
+      /* l1 norms for relaxation 8 (option 4) and 18 (option 1) */
+      option = 0;
+      cf_marker = NULL;
+      if (grid_relax_type[1] == 8 && j < num_levels-1)
+      {
+         option = 4;
+         if (relax_order) cf_marker = CF_marker_array[j];
+      }
+      else if (grid_relax_type[3] == 8 && j == num_levels-1)
+         option = 4;
+      if (grid_relax_type[1] == 18 && j < num_levels-1)
+      {
+         option = 1;
+         if (relax_order) cf_marker = CF_marker_array[j];
+      }
+      else if (grid_relax_type[3] == 18 && j == num_levels-1)
+         option = 1;
+
+      if (option && l1_norms)
+      {
+         if (l1_norms[j])
+            hypre_TFree(l1_norms[j]);
+         if (num_threads == 1)
+            hypre_ParCSRComputeL1Norms(A_array[j], option, cf_marker, &l1_norms[j]);
+         else
+            hypre_ParCSRComputeL1NormsThreads(A_array[j], option, num_threads,
+                                              cf_marker, &l1_norms[j]);
+      }
+
+      if ((grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
+           (grid_relax_type[3] == 16 && j == (num_levels-1))) && max_eig_est)
+      {
+         hypre_ParCSRMaxEigEstimateCG(A_array[j], 1, 10,
+                                      &max_eig_est[j], &min_eig_est[j]);
+      }
+   }
+
+   /* dense coarsest grid operator for Gaussian elimination */
+   if (hypre_ParAMGDataAMat(amg_data))
+   {
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data));
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data));
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data));
+      new_comm = hypre_ParAMGDataNewComm(amg_data);
+      if (new_comm != hypre_MPI_COMM_NULL)
+         hypre_MPI_Comm_free(&new_comm);
+      hypre_ParAMGDataAMat(amg_data) = NULL;
+      hypre_ParAMGDataBVec(amg_data) = NULL;
+      hypre_ParAMGDataCommInfo(amg_data) = NULL;
+      hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+   }
+   if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99)
+      hypre_GaussElimSetup(amg_data, num_levels-1, grid_relax_type[3]);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetup
+ *
+ * Re-setup of the hierarchy in amg_vdata for the new values of A; call
+ * only if hypre_BoomerAMGResetupCheck returned 1.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetup( void               *amg_vdata,
+                        hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *f,
+                        hypre_ParVector    *u )
+{
+   hypre_ParAMGData   *amg_data = amg_vdata;
+
+   HYPRE_Int           resetup_type = hypre_ParAMGDataResetupType(amg_data);
+   HYPRE_Int           num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           debug_flag = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Int           amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   hypre_ParCSRMatrix **A_array = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParVector    *temp_vectors[5];
+
+   hypre_ParCSRMatrix *P, *A_H;
+   HYPRE_Int          *row_starts = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_Int           num_missing;
+   HYPRE_Int           level, my_id, i;
+   double              wall_time = 0.0;
+
+   hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(A), &my_id);
+
+   /*-----------------------------------------------------------------------
+    * The finest level: A may be a new matrix object (the old one may have
+    * been destroyed), so everything referring to its partitioning is
+    * redirected to A.
+    *-----------------------------------------------------------------------*/
+
+   A_array[0] = A;
+   hypre_ParAMGDataFArray(amg_data)[0] = f;
+   hypre_ParAMGDataUArray(amg_data)[0] = u;
+   if (!hypre_ParCSRMatrixCommPkg(A))
+      hypre_MatvecCommPkgCreate(A);
+
+   temp_vectors[0] = hypre_ParAMGDataVtemp(amg_data);
+   temp_vectors[1] = hypre_ParAMGDataPtemp(amg_data);
+   temp_vectors[2] = hypre_ParAMGDataRtemp(amg_data);
+   temp_vectors[3] = hypre_ParAMGDataZtemp(amg_data);
+   temp_vectors[4] = hypre_ParAMGDataResidual(amg_data);
+   for (i=0; i < 5; i++)
+      if (temp_vectors[i] && !hypre_ParVectorOwnsPartitioning(temp_vectors[i]))
+         hypre_ParVectorPartitioning(temp_vectors[i]) = row_starts;
+
+   if (num_levels > 1 && !hypre_ParCSRMatrixOwnsRowStarts(P_array[0]))
+      hypre_ParCSRMatrixRowStarts(P_array[0]) = row_starts;
+
+   /*-----------------------------------------------------------------------
+    * Interpolation and coarse grid operators
+    *-----------------------------------------------------------------------*/
+
+   for (level = 0; level < num_levels-1; level++)
+   {
+      A_H = A_array[level+1];
+
+      if (resetup_type == 1)
+      {
+         if (debug_flag==1) wall_time = time_getWallclockSeconds();
+
+         hypre_BoomerAMGResetupInterp(amg_data, level, &P);
+
+         /* the coarse partitioning is owned by A_H (see par_rap.c) and
+            referenced by the vectors and P of the next level */
+         if (hypre_ParCSRMatrixOwnsColStarts(P))
+            hypre_TFree(hypre_ParCSRMatrixColStarts(P));
+         hypre_ParCSRMatrixColStarts(P) = hypre_ParCSRMatrixRowStarts(A_H);
+         hypre_ParCSRMatrixSetColStartsOwner(P,0);
+
+         hypre_ParCSRMatrixDestroy(P_array[level]);
+         P_array[level] = P;
+
+         if (debug_flag==1)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d    Level = %d    Build Interp Time = %f\n",
+                         my_id, level, wall_time);
+            fflush(NULL);
+         }
+      }
+
+      if (debug_flag==1) wall_time = time_getWallclockSeconds();
+
+      hypre_BoomerAMGBuildCoarseOperatorNumeric(P_array[level], A_array[level],
+                                                P_array[level], A_H, &num_missing);
+      if (num_missing)
+      {
+         /* pattern changed: rebuild, keeping the coarse partitioning */
+         hypre_ParCSRMatrixSetRowStartsOwner(A_H,0);
+         hypre_ParCSRMatrixSetColStartsOwner(A_H,0);
+         hypre_ParCSRMatrixDestroy(A_H);
+         hypre_BoomerAMGBuildCoarseOperatorAccum(P_array[level], A_array[level],
+                                  P_array[level],
+                                  hypre_ParAMGDataRAPAccumType(amg_data), &A_H);
+         hypre_ParCSRMatrixSetNumNonzeros(A_H);
+         hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+         A_array[level+1] = A_H;
+      }
+
+      if (debug_flag==1)
+      {
+         wall_time = time_getWallclockSeconds() - wall_time;
+         hypre_printf("Proc = %d    Level = %d    Build Coarse Operator Time = %f (%s)\n",
+                      my_id, level, wall_time, num_missing ? "rebuilt" : "numeric");
+         fflush(NULL);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Relaxation data
+    *-----------------------------------------------------------------------*/
+
+   hypre_BoomerAMGResetupRelax(amg_data);
+
+   if (amg_print_level == 1 || amg_print_level == 3)
+      hypre_BoomerAMGSetupStats(amg_data,A);
+
+   return hypre_error_flag;
+}
@@ -23,6 +23,99 @@
  *
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupWorkspace
+ *
+ * Creates or grows the arena for the temporaries of the solve cycle: halo
+ * buffers and communication handles of the smoothers, the per-thread
+ * buffers of the restriction, the Gaussian elimination on the coarsest
+ * level and the cycle's own arrays.  The
+ * estimate need not be exact; hypre_BoomerAMGCycle grows the arena after
+ * a cycle whose temporaries did not fit.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSetupWorkspace( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix  **A_array = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRCommPkg  *comm_pkg;
+   size_t                size, level_size, max_size = 0;
+   HYPRE_Int             level, n, num_cols_offd, num_requests, send_len;
+   HYPRE_Int             n_global, num_procs;
+   HYPRE_Int             num_threads = hypre_NumThreads();
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (!A_array[level])
+      {
+         continue;
+      }
+      n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_array[level]));
+      num_cols_offd =
+         hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A_array[level]));
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A_array[level]);
+      num_requests = 0;
+      send_len = 0;
+      if (comm_pkg)
+      {
+         num_requests = hypre_ParCSRCommPkgNumSends(comm_pkg) +
+            hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+         send_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                       hypre_ParCSRCommPkgNumSends(comm_pkg));
+      }
+
+      /* smoother: send/receive buffers, requests, two vectors */
+      level_size =
+         hypre_WorkspaceBlockSize(send_len*sizeof(double)) +
+         hypre_WorkspaceBlockSize(num_cols_offd*sizeof(double)) +
+         hypre_WorkspaceBlockSize(num_requests*sizeof(hypre_MPI_Request)) +
+         hypre_WorkspaceBlockSize(num_requests*sizeof(hypre_MPI_Status)) +
+         2*hypre_WorkspaceBlockSize(n*sizeof(double));
+      /* communication handle */
+      level_size +=
+         hypre_WorkspaceBlockSize(num_requests*sizeof(hypre_MPI_Request)) +
+         hypre_WorkspaceBlockSize(sizeof(hypre_ParCSRCommHandle)) +
+         hypre_WorkspaceBlockSize(num_requests*sizeof(hypre_MPI_Status));
+      /* threaded restriction to the next level */
+      if (num_threads > 1 && level < num_levels-1 && A_array[level+1])
+      {
+         level_size += hypre_WorkspaceBlockSize(num_threads*sizeof(double)*
+            hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A_array[level+1])));
+      }
+
+      max_size = hypre_max(max_size, level_size);
+   }
+
+   if (hypre_ParAMGDataAMat(amg_data) && num_levels > 0)
+   {
+      /* Gaussian elimination on the coarsest level */
+      n_global = hypre_ParCSRMatrixGlobalNumRows(A_array[num_levels-1]);
+      hypre_MPI_Comm_size(hypre_ParAMGDataNewComm(amg_data), &num_procs);
+      level_size =
+         hypre_WorkspaceBlockSize((size_t)n_global*n_global*sizeof(double)) +
+         hypre_WorkspaceBlockSize(n_global*sizeof(HYPRE_Int)) +
+         2*hypre_WorkspaceBlockSize(num_procs*sizeof(HYPRE_Int));
+
+      max_size = hypre_max(max_size, level_size);
+   }
+
+   /* the cycle's level counters and coefficient counts */
+   size = max_size + hypre_WorkspaceBlockSize(num_levels*sizeof(HYPRE_Int)) +
+      hypre_WorkspaceBlockSize(num_levels*sizeof(double));
+
+   if (hypre_ParAMGDataWorkspace(amg_data))
+   {
+      hypre_WorkspaceReserve(hypre_ParAMGDataWorkspace(amg_data), size);
+   }
+   else
+   {
+      hypre_ParAMGDataWorkspace(amg_data) = hypre_WorkspaceCreate(size);
+   }
+
+   return hypre_error_flag;
+}
+
 /*****************************************************************************
  * hypre_BoomerAMGSetup
  *****************************************************************************/
@@ -103,6 +196,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       coarsen_type;
    HYPRE_Int       measure_type;
    HYPRE_Int       setup_type;
+   HYPRE_Int       rap_accum_type;
    HYPRE_Int       fine_size;
    HYPRE_Int       rest, tms, indx;
    double    size;
@@ -183,6 +277,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    coarsen_type = hypre_ParAMGDataCoarsenType(amg_data);
    measure_type = hypre_ParAMGDataMeasureType(amg_data);
    setup_type = hypre_ParAMGDataSetupType(amg_data);
+   rap_accum_type = hypre_ParAMGDataRAPAccumType(amg_data);
    debug_flag = hypre_ParAMGDataDebugFlag(amg_data);
    relax_weight = hypre_ParAMGDataRelaxWeight(amg_data);
    omega = hypre_ParAMGDataOmega(amg_data);
@@ -214,6 +309,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (num_procs == 1) seq_threshold = 0;
    if (setup_type == 0) return Setup_err_flag;
 
+   hypre_ProfileBegin(HYPRE_PROFILE_AMG_SETUP);
+
    S = NULL;
 
    A_array = hypre_ParAMGDataAArray(amg_data);
@@ -308,6 +405,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* numeric-only re-setup of an existing hierarchy (see par_amg_resetup.c) */
+   if (hypre_BoomerAMGResetupCheck(amg_data, A))
+   {
+      Setup_err_flag = hypre_BoomerAMGResetup(amg_data, A, f, u);
+      hypre_ProfileEnd(HYPRE_PROFILE_AMG_SETUP);
+      return Setup_err_flag;
+   }
+
 
 
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array || dof_func_array)
@@ -648,6 +753,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        * for the level.  Returns strength matrix, S  
        *--------------------------------------------------------------*/
      
+      hypre_ProfileBeginTag(HYPRE_PROFILE_COARSEN, level);
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
       if (debug_flag==3)
       {
@@ -960,6 +1066,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
    /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+         hypre_ProfileEnd(HYPRE_PROFILE_COARSEN);
+         hypre_ProfileBeginTag(HYPRE_PROFILE_INTERP, level);
+
          if (level < agg_num_levels)
          {
             if (nodal == 0)
@@ -1679,6 +1788,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        * Build coarse-grid operator, A_array[level+1] by R*A*P
        *--------------------------------------------------------------*/
 
+      hypre_ProfileEnd(HYPRE_PROFILE_INTERP);
+      hypre_ProfileBeginTag(HYPRE_PROFILE_RAP, level);
+
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
 
       if (block_mode)
@@ -1696,9 +1808,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       else
       {
          
-         hypre_BoomerAMGBuildCoarseOperator(P_array[level], A_array[level] , 
-                                            P_array[level], &A_H);
+         hypre_BoomerAMGBuildCoarseOperatorAccum(P_array[level], A_array[level] , 
+                                      P_array[level], rap_accum_type, &A_H);
       }
+      hypre_ProfileEnd(HYPRE_PROFILE_RAP);
  
       if (debug_flag==1)
       {
@@ -2178,5 +2291,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /* single precision storage of the coarse levels (par_amg_mixed.c) */
+   hypre_ParAMGDataMPNumLevels(amg_data) = 0;
+   hypre_BoomerAMGMixedPrecisionSetup(amg_data);
+
+   hypre_BoomerAMGSetupWorkspace(amg_data);
+
+   hypre_ProfileEnd(HYPRE_PROFILE_AMG_SETUP);
+
    return(Setup_err_flag);
 }  
@@ -43,6 +43,9 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Int      amg_print_level;
    HYPRE_Int      amg_logging;
    HYPRE_Int      cycle_count;
+#ifdef HYPRE_MEMORY_COUNT
+   size_t         alloc_count = 0;
+#endif
    HYPRE_Int      num_levels;
    /* HYPRE_Int      num_unknowns; */
    double   tol;
@@ -89,6 +92,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_MPI_Comm_size(comm, &num_procs);   
    hypre_MPI_Comm_rank(comm,&my_id);
 
+   hypre_ProfileBegin(HYPRE_PROFILE_AMG_SOLVE);
+
    amg_print_level    = hypre_ParAMGDataPrintLevel(amg_data);
    amg_logging      = hypre_ParAMGDataLogging(amg_data);
    if ( amg_logging > 1 )
@@ -211,6 +216,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
           hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
         }
         hypre_error(HYPRE_ERROR_GENERIC);
+        hypre_ProfileEnd(HYPRE_PROFILE_AMG_SOLVE);
         return hypre_error_flag;
      }
 
@@ -285,6 +291,10 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
 
       ++cycle_count;
+#ifdef HYPRE_MEMORY_COUNT
+      /* the first cycle may still grow the workspace */
+      if (cycle_count == 1) alloc_count = hypre_MemoryGetAllocCount();
+#endif
 
       hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
 #ifdef CUMNUMIT
@@ -298,6 +308,13 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
    }
 
+#ifdef HYPRE_MEMORY_COUNT
+   hypre_ParAMGDataNumCycleAllocs(amg_data) = (cycle_count > 1) ?
+      (HYPRE_Int) (hypre_MemoryGetAllocCount() - alloc_count) : 0;
+#else
+   hypre_ParAMGDataNumCycleAllocs(amg_data) = -1;
+#endif
+
    if (cycle_count == max_iter && tol > 0.)
    {
       Solve_err_flag = 1;
@@ -344,11 +361,18 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_printf("\n\n     Complexity:    grid = %f\n",grid_cmplxty);
       hypre_printf("                operator = %f\n",operat_cmplxty);
       hypre_printf("                   cycle = %f\n\n\n\n",cycle_cmplxty);
+      hypre_BoomerAMGMixedPrecisionSolveStats(amg_data);
+#ifdef HYPRE_MEMORY_COUNT
+      hypre_printf(" Heap allocations after the first cycle = %d\n\n",
+                   hypre_ParAMGDataNumCycleAllocs(amg_data));
+#endif
    }
 
    hypre_TFree(num_coeffs);
    hypre_TFree(num_variables);
 
+   hypre_ProfileEnd(HYPRE_PROFILE_AMG_SOLVE);
+
    return hypre_error_flag;
 }
 
@@ -2086,8 +2086,14 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
    measure_array = hypre_CTAlloc(double, num_variables+num_cols_offd);
 
    /* first calculate the local part of the sums for the external nodes */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=0; i < S_offd_i[num_variables]; i++)
    { 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
       measure_array[num_variables + S_offd_j[i]] += 1.0;
    }
 
@@ -2097,8 +2103,14 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
                         &measure_array[num_variables], buf_data);
 
    /* calculate the local part for the local nodes */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=0; i < S_diag_i[num_variables]; i++)
    { 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
       measure_array[S_diag_j[i]] += 1.0;
    }
 
@@ -2117,6 +2129,9 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
    }
 
    /* set the measures of the external nodes to zero */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=num_variables; i < num_variables+num_cols_offd; i++)
    { 
       measure_array[i] = 0;
@@ -2140,6 +2155,9 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
    else
       graph_array_offd = NULL;
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < num_cols_offd; ig++)
       graph_array_offd[ig] = ig;
 
@@ -2203,6 +2221,9 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
    else
      CF_marker_offd = NULL;
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=0; i < num_cols_offd; i++)
 	CF_marker_offd[i] = 0;
   
@@ -2351,8 +2372,16 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
       iter++;
      /*------------------------------------------------
       * Set C-pts and F-pts.
+      *
+      * The points can be treated in parallel: the only marker that
+      * changes from C to F below is that of a point with measure < 1,
+      * i.e. a point that does not appear in any row of S, so the test
+      * CF_marker[j] > 0 never races with an update.
       *------------------------------------------------*/
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i,jS,j) HYPRE_SMP_SCHEDULE
+#endif
      for (ig = 0; ig < graph_size; ig++) {
        i = graph_array[ig];
 
@@ -2496,6 +2525,9 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
       * points above; now remove the columns.)
       *---------------------------------------------*/
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i,jS,j) HYPRE_SMP_SCHEDULE
+#endif
      for (ig = 0; ig < graph_size; ig++) {
        i = graph_array[ig];
 
@@ -2577,11 +2609,17 @@ hypre_BoomerAMGCoarsenPMIS( hypre_ParCSRMatrix    *S,
     *---------------------------------------------------*/
 
    /* Reset S_matrix */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=0; i < S_diag_i[num_variables]; i++)
    {
       if (S_diag_j[i] < 0)
          S_diag_j[i] = -S_diag_j[i]-1;
    }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i=0; i < S_offd_i[num_variables]; i++)
    {
       if (S_offd_j[i] < 0)
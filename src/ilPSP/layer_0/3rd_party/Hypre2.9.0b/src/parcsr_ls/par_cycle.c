@@ -111,6 +111,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    HYPRE_Int seq_cg = 0;
 
+   hypre_Workspace *workspace, *prev_workspace;
+
 #if 0
    double   *D_mat;
    double   *S_vec;
@@ -155,7 +157,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    cycle_op_count = hypre_ParAMGDataCycleOpCount(amg_data);
 
-   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels);
+   /* temporaries of the cycle come from the hierarchy's arena */
+   workspace = hypre_ParAMGDataWorkspace(amg_data);
+   prev_workspace = hypre_WorkspaceSetActive(workspace);
+   hypre_ProfileBegin(HYPRE_PROFILE_CYCLE);
+
+   lev_counter = hypre_WorkspaceCTAlloc(HYPRE_Int, num_levels);
 
    if (hypre_ParAMGDataACoarse(amg_data)) seq_cg = 1;
 
@@ -165,7 +172,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    if (grid_relax_points) old_version = 1;
 
-   num_coeffs = hypre_CTAlloc(double, num_levels);
+   num_coeffs = hypre_WorkspaceCTAlloc(double, num_levels);
    num_coeffs[0]    = hypre_ParCSRMatrixDNumNonzeros(A_array[0]);
    comm = hypre_ParCSRMatrixComm(A_array[0]);
 
@@ -288,6 +295,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       else
          l1_norms_level = NULL;
 
+      hypre_ProfileBeginTag(HYPRE_PROFILE_RELAX, level);
       if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
@@ -512,7 +520,13 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 	      }
  
               if (Solve_err_flag != 0)
+              {
+                 hypre_WorkspaceTFree(lev_counter);
+                 hypre_WorkspaceTFree(num_coeffs);
+                 hypre_WorkspaceSetActive(prev_workspace);
+                 hypre_ProfileEnd(HYPRE_PROFILE_CYCLE);
                  return(Solve_err_flag);
+              }
            }
            if  (smooth_num_levels > level && smooth_type > 9)
            {
@@ -533,6 +547,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
            }
         }
       }
+      hypre_ProfileEnd(HYPRE_PROFILE_RELAX);
 
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
@@ -553,6 +568,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         hypre_ProfileBeginTag(HYPRE_PROFILE_RESTRICT, fine_grid);
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0); 
           
          hypre_ParVectorCopy(F_array[fine_grid],Vtemp);
@@ -583,6 +599,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             hypre_ParCSRMatrixMatvecT(alpha,R_array[fine_grid],Vtemp,
                                       beta,F_array[coarse_grid]);
          }
+         hypre_ProfileEnd(HYPRE_PROFILE_RESTRICT);
 
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level],cycle_type);
@@ -602,6 +619,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+         hypre_ProfileBeginTag(HYPRE_PROFILE_PROLONG, fine_grid);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid], 
@@ -614,6 +632,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                      U_array[coarse_grid],
                                      beta, U_array[fine_grid]);            
          }
+         hypre_ProfileEnd(HYPRE_PROFILE_PROLONG);
          
          --level;
          cycle_param = 2;
@@ -626,8 +645,16 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
 
-   hypre_TFree(lev_counter);
-   hypre_TFree(num_coeffs);
+   hypre_WorkspaceTFree(lev_counter);
+   hypre_WorkspaceTFree(num_coeffs);
+   hypre_WorkspaceSetActive(prev_workspace);
+   hypre_ProfileEnd(HYPRE_PROFILE_CYCLE);
+
+   /* grow the arena if some temporaries did not fit, so that the next
+      cycle runs without heap allocations */
+   if (workspace && hypre_WorkspacePeak(workspace) > hypre_WorkspaceSize(workspace))
+      hypre_WorkspaceReserve(workspace, 0);
+
    if (smooth_num_levels > 0)
    {
      if (smooth_type == 7 || smooth_type == 8 || smooth_type == 9 || 
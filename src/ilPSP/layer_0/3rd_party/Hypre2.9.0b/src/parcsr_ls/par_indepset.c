@@ -135,6 +135,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
 	S_offd_j = hypre_CSRMatrixJ(S_offd);
    }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -143,6 +146,9 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
          IS_marker[i] = 1;
       }
    }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_offd_size; ig++)
    {
       i = graph_array_offd[ig];
@@ -154,8 +160,15 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
 
    /*-------------------------------------------------------
     * Remove nodes from the initial independent set
+    *
+    * Threads only ever clear markers and read the (fixed) measures, so
+    * concurrent updates of the same marker are harmless and the result
+    * does not depend on the number of threads.
     *-------------------------------------------------------*/
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i,jS,j,jj) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < graph_array_size; ig++)
    {
       i = graph_array[ig];
@@ -58,9 +58,33 @@
  *               temporarily? 
  *--------------------------------------------------------------------------*/
          
-hypre_CSRMatrix *
-hypre_ExchangeRAPData( hypre_CSRMatrix *RAP_int,
-                       hypre_ParCSRCommPkg *comm_pkg_RT)
+/*--------------------------------------------------------------------------
+ * state of a pending exchange of RAP_int, see hypre_ExchangeRAPDataBegin
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRCommHandle *comm_handle_data;
+   hypre_ParCSRCommHandle *comm_handle_j;
+   hypre_ParCSRCommPkg    *tmp_comm_pkg;
+   HYPRE_Int              *jdata_recv_vec_starts;
+   HYPRE_Int              *jdata_send_map_starts;
+
+} hypre_RAPExchangeHandle;
+
+/*--------------------------------------------------------------------------
+ * hypre_ExchangeRAPDataBegin
+ *
+ * Exchanges the row lengths of RAP_int and posts the (nonblocking)
+ * exchange of its column indices and values.  The returned RAP_ext is
+ * complete only after hypre_ExchangeRAPDataEnd; until then RAP_int must
+ * not be changed or freed.
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+hypre_ExchangeRAPDataBegin( hypre_CSRMatrix         *RAP_int,
+                            hypre_ParCSRCommPkg     *comm_pkg_RT,
+                            hypre_RAPExchangeHandle *handle )
 {
    HYPRE_Int     *RAP_int_i;
    HYPRE_Int     *RAP_int_j = NULL;
@@ -170,13 +194,19 @@ hypre_ExchangeRAPData( hypre_CSRMatrix *RAP_int,
    hypre_ParCSRCommPkgRecvVecStarts(tmp_comm_pkg) = jdata_send_map_starts;      
    hypre_ParCSRCommPkgSendMapStarts(tmp_comm_pkg) = jdata_recv_vec_starts;      
 
-   comm_handle = hypre_ParCSRCommHandleCreate(1,tmp_comm_pkg,RAP_int_data,
-                                        RAP_ext_data);
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-   comm_handle = NULL;
+/*--------------------------------------------------------------------------
+ * post the exchange of values and column indices; the two messages
+ * between a pair of processors are matched in the order they are posted
+ *--------------------------------------------------------------------------*/
+
+   handle -> comm_handle_data = hypre_ParCSRCommHandleCreate(1,tmp_comm_pkg,
+                                        RAP_int_data, RAP_ext_data);
+   handle -> comm_handle_j = hypre_ParCSRCommHandleCreate(11,tmp_comm_pkg,
+                                        RAP_int_j, RAP_ext_j);
+   handle -> tmp_comm_pkg = tmp_comm_pkg;
+   handle -> jdata_recv_vec_starts = jdata_recv_vec_starts;
+   handle -> jdata_send_map_starts = jdata_send_map_starts;
 
-   comm_handle = hypre_ParCSRCommHandleCreate(11,tmp_comm_pkg,RAP_int_j,
-                                        RAP_ext_j);
    RAP_ext = hypre_CSRMatrixCreate(num_rows,num_cols,num_nonzeros);
 
    hypre_CSRMatrixI(RAP_ext) = RAP_ext_i;
@@ -186,551 +216,1115 @@ hypre_ExchangeRAPData( hypre_CSRMatrix *RAP_int,
       hypre_CSRMatrixData(RAP_ext) = RAP_ext_data;
    }
 
-   hypre_ParCSRCommHandleDestroy(comm_handle); 
-   comm_handle = NULL;
-
-   hypre_TFree(jdata_recv_vec_starts);
-   hypre_TFree(jdata_send_map_starts);
-   hypre_TFree(tmp_comm_pkg);
-
    return RAP_ext;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_BoomerAMGBuildCoarseOperator
+ * hypre_ExchangeRAPDataEnd
+ *
+ * Completes an exchange started by hypre_ExchangeRAPDataBegin.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
-                                    hypre_ParCSRMatrix  *A,
-                                    hypre_ParCSRMatrix  *P,
-                                    hypre_ParCSRMatrix **RAP_ptr )
-
+static HYPRE_Int
+hypre_ExchangeRAPDataEnd( hypre_RAPExchangeHandle *handle )
 {
-   MPI_Comm        comm = hypre_ParCSRMatrixComm(A);
-
-   hypre_CSRMatrix *RT_diag = hypre_ParCSRMatrixDiag(RT);
-   hypre_CSRMatrix *RT_offd = hypre_ParCSRMatrixOffd(RT);
-   HYPRE_Int             num_cols_diag_RT = hypre_CSRMatrixNumCols(RT_diag);
-   HYPRE_Int             num_cols_offd_RT = hypre_CSRMatrixNumCols(RT_offd);
-   HYPRE_Int             num_rows_offd_RT = hypre_CSRMatrixNumRows(RT_offd);
-   hypre_ParCSRCommPkg   *comm_pkg_RT = hypre_ParCSRMatrixCommPkg(RT);
-   HYPRE_Int             num_recvs_RT = 0;
-   HYPRE_Int             num_sends_RT = 0;
-   HYPRE_Int             *send_map_starts_RT;
-   HYPRE_Int             *send_map_elmts_RT;
+   hypre_ParCSRCommHandleDestroy(handle -> comm_handle_data);
+   hypre_ParCSRCommHandleDestroy(handle -> comm_handle_j);
 
-   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
-   
-   double          *A_diag_data = hypre_CSRMatrixData(A_diag);
-   HYPRE_Int             *A_diag_i = hypre_CSRMatrixI(A_diag);
-   HYPRE_Int             *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   hypre_TFree(handle -> jdata_recv_vec_starts);
+   hypre_TFree(handle -> jdata_send_map_starts);
+   hypre_TFree(handle -> tmp_comm_pkg);
 
-   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
-   
-   double          *A_offd_data = hypre_CSRMatrixData(A_offd);
-   HYPRE_Int             *A_offd_i = hypre_CSRMatrixI(A_offd);
-   HYPRE_Int             *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   return hypre_error_flag;
+}
 
-   HYPRE_Int  num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
-   HYPRE_Int  num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+hypre_CSRMatrix *
+hypre_ExchangeRAPData( hypre_CSRMatrix *RAP_int,
+                       hypre_ParCSRCommPkg *comm_pkg_RT)
+{
+   hypre_CSRMatrix         *RAP_ext;
+   hypre_RAPExchangeHandle  handle;
 
-   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
-   
-   double          *P_diag_data = hypre_CSRMatrixData(P_diag);
-   HYPRE_Int             *P_diag_i = hypre_CSRMatrixI(P_diag);
-   HYPRE_Int             *P_diag_j = hypre_CSRMatrixJ(P_diag);
+   RAP_ext = hypre_ExchangeRAPDataBegin(RAP_int, comm_pkg_RT, &handle);
+   hypre_ExchangeRAPDataEnd(&handle);
 
-   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
-   HYPRE_Int             *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
-   
-   double          *P_offd_data = hypre_CSRMatrixData(P_offd);
-   HYPRE_Int             *P_offd_i = hypre_CSRMatrixI(P_offd);
-   HYPRE_Int             *P_offd_j = hypre_CSRMatrixJ(P_offd);
+   return RAP_ext;
+}
 
-   HYPRE_Int  first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
-   HYPRE_Int  last_col_diag_P;
-   HYPRE_Int  num_cols_diag_P = hypre_CSRMatrixNumCols(P_diag);
-   HYPRE_Int  num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
-   HYPRE_Int *coarse_partitioning = hypre_ParCSRMatrixColStarts(P);
-   HYPRE_Int *RT_partitioning = hypre_ParCSRMatrixColStarts(RT);
+/*--------------------------------------------------------------------------
+ * Operands of the product R_diag * A * P for the interior coarse points,
+ * and the rows of RAP_ext which are added to them: row ic receives the
+ * rows ext_row_j[ext_row_i[ic]..ext_row_i[ic+1]-1] of RAP_ext.
+ *--------------------------------------------------------------------------*/
 
-   hypre_ParCSRMatrix *RAP;
-   HYPRE_Int                *col_map_offd_RAP;
-   HYPRE_Int                *new_col_map_offd_RAP;
+typedef struct
+{
+   HYPRE_Int  *R_diag_i;
+   HYPRE_Int  *R_diag_j;
+   double     *R_diag_data;
+
+   HYPRE_Int  *A_diag_i;
+   HYPRE_Int  *A_diag_j;
+   double     *A_diag_data;
+   HYPRE_Int  *A_offd_i;
+   HYPRE_Int  *A_offd_j;
+   double     *A_offd_data;
+   HYPRE_Int   num_cols_offd_A;
+
+   HYPRE_Int  *P_diag_i;
+   HYPRE_Int  *P_diag_j;
+   double     *P_diag_data;
+   HYPRE_Int  *P_offd_i;
+   HYPRE_Int  *P_offd_j;
+   double     *P_offd_data;
+   HYPRE_Int   num_cols_diag_P;
+   HYPRE_Int   num_cols_offd_P;
+
+   HYPRE_Int  *P_ext_diag_i;
+   HYPRE_Int  *P_ext_diag_j;
+   double     *P_ext_diag_data;
+   HYPRE_Int  *P_ext_offd_i;
+   HYPRE_Int  *P_ext_offd_j;
+   double     *P_ext_offd_data;
+
+   HYPRE_Int  *ext_row_i;
+   HYPRE_Int  *ext_row_j;
+   HYPRE_Int  *RAP_ext_i;
+   HYPRE_Int  *RAP_ext_j;
+   double     *RAP_ext_data;
+
+   HYPRE_Int   square;
+
+} hypre_RAPInteriorData;
 
-   hypre_CSRMatrix *RAP_int = NULL;
+/*--------------------------------------------------------------------------
+ * Thread-local accumulator for the rows of RAP_diag and RAP_offd.
+ *
+ * Columns are numbered 0..num_cols_diag-1 for RAP_diag, followed by the
+ * columns of RAP_offd.  With a dense marker array (rap_accum_type 0),
+ * marker[col] holds the position of entry col in the current row, or a
+ * value smaller than the row beginning; the array has the length of the
+ * coarse column space, so for large problems the accesses are scattered.
+ * Alternatively (rap_accum_type 1) the positions are kept in an open
+ * addressing hash table whose size is adapted to the number of products
+ * of the row; for wide rows it stays in cache.
+ *
+ * If diag_data is NULL (symbolic pass), only the entries are counted.
+ *--------------------------------------------------------------------------*/
 
-   double          *RAP_int_data;
-   HYPRE_Int             *RAP_int_i;
-   HYPRE_Int             *RAP_int_j;
+typedef struct
+{
+   HYPRE_Int  *marker;
+   HYPRE_Int  *A_marker;
+
+   HYPRE_Int  *hash_keys;
+   HYPRE_Int  *hash_pos;
+   HYPRE_Int  *hash_used;
+   HYPRE_Int   hash_size;
+   HYPRE_Int   num_used;
+
+   HYPRE_Int   num_cols_diag;
+   HYPRE_Int   num_cols;
+
+   HYPRE_Int   jj_count_diag;
+   HYPRE_Int   jj_count_offd;
+   HYPRE_Int   jj_row_begin_diag;
+   HYPRE_Int   jj_row_begin_offd;
+   HYPRE_Int  *diag_j;
+   double     *diag_data;
+   HYPRE_Int  *offd_j;
+   double     *offd_data;
+
+} hypre_RAPAccumulator;
+
+static void
+hypre_RAPAccumulatorCreate( hypre_RAPAccumulator *acc,
+                            HYPRE_Int             accum_type,
+                            HYPRE_Int             num_cols_diag,
+                            HYPRE_Int             num_cols_offd,
+                            HYPRE_Int             num_nz_cols_A )
+{
+   HYPRE_Int i;
+
+   acc -> marker = NULL;
+   acc -> A_marker = NULL;
+   acc -> hash_keys = NULL;
+   acc -> hash_pos = NULL;
+   acc -> hash_used = NULL;
+   acc -> hash_size = 0;
+   acc -> num_used = 0;
+   acc -> num_cols_diag = num_cols_diag;
+   acc -> num_cols = num_cols_diag + num_cols_offd;
+   acc -> jj_count_diag = 0;
+   acc -> jj_count_offd = 0;
+   acc -> diag_j = NULL;
+   acc -> diag_data = NULL;
+   acc -> offd_j = NULL;
+   acc -> offd_data = NULL;
+
+   if (accum_type == 0)
+   {
+      acc -> marker = hypre_CTAlloc(HYPRE_Int, acc -> num_cols);
+      for (i = 0; i < acc -> num_cols; i++)
+         acc -> marker[i] = -1;
+      acc -> A_marker = hypre_CTAlloc(HYPRE_Int, num_nz_cols_A);
+      for (i = 0; i < num_nz_cols_A; i++)
+         acc -> A_marker[i] = -1;
+   }
+}
 
-   hypre_CSRMatrix *RAP_ext;
+static void
+hypre_RAPAccumulatorDestroy( hypre_RAPAccumulator *acc )
+{
+   hypre_TFree(acc -> marker);
+   hypre_TFree(acc -> A_marker);
+   hypre_TFree(acc -> hash_keys);
+   hypre_TFree(acc -> hash_pos);
+   hypre_TFree(acc -> hash_used);
+}
 
-   double          *RAP_ext_data = NULL;
-   HYPRE_Int             *RAP_ext_i = NULL;
-   HYPRE_Int             *RAP_ext_j = NULL;
+/* prepare the hash table for a row with at most max_entries entries */
+static void
+hypre_RAPAccumulatorHashReserve( hypre_RAPAccumulator *acc,
+                                 HYPRE_Int             max_entries )
+{
+   HYPRE_Int size, i;
+
+   if (max_entries > acc -> num_cols)
+      max_entries = acc -> num_cols;
+   if (2*max_entries <= acc -> hash_size)
+      return;
+
+   size = 64;
+   while (size < 2*max_entries)
+      size *= 2;
+
+   hypre_TFree(acc -> hash_keys);
+   hypre_TFree(acc -> hash_pos);
+   hypre_TFree(acc -> hash_used);
+   acc -> hash_keys = hypre_CTAlloc(HYPRE_Int, size);
+   acc -> hash_pos = hypre_CTAlloc(HYPRE_Int, size);
+   acc -> hash_used = hypre_CTAlloc(HYPRE_Int, size/2);
+   for (i = 0; i < size; i++)
+      acc -> hash_keys[i] = -1;
+   acc -> hash_size = size;
+   acc -> num_used = 0;
+}
 
-   hypre_CSRMatrix *RAP_diag;
+/*--------------------------------------------------------------------------
+ * Adds value to entry col of the current row (hash table); a new entry is
+ * created if col has not yet been visited in this row.
+ *--------------------------------------------------------------------------*/
 
-   double          *RAP_diag_data;
-   HYPRE_Int             *RAP_diag_i;
-   HYPRE_Int             *RAP_diag_j;
+static void
+hypre_RAPAccumulate( hypre_RAPAccumulator *acc,
+                     HYPRE_Int             col,
+                     double                value )
+{
+   HYPRE_Int  pos, h, mask;
+   HYPRE_Int *keys = acc -> hash_keys;
+
+   mask = acc -> hash_size - 1;
+   h = (HYPRE_Int) (((unsigned int) col * 2654435761u) & (unsigned int) mask);
+   while (keys[h] != col && keys[h] != -1)
+      h = (h+1) & mask;
+   if (keys[h] == col)
+   {
+      pos = acc -> hash_pos[h];
+      if (!acc -> diag_data)
+         return;
+      if (col < acc -> num_cols_diag)
+         acc -> diag_data[pos] += value;
+      else
+         acc -> offd_data[pos] += value;
+      return;
+   }
 
-   hypre_CSRMatrix *RAP_offd;
+   keys[h] = col;
+   acc -> hash_used[acc -> num_used++] = h;
+   if (col < acc -> num_cols_diag)
+   {
+      pos = acc -> jj_count_diag++;
+      if (acc -> diag_data)
+      {
+         acc -> diag_data[pos] = value;
+         acc -> diag_j[pos] = col;
+      }
+   }
+   else
+   {
+      pos = acc -> jj_count_offd++;
+      if (acc -> diag_data)
+      {
+         acc -> offd_data[pos] = value;
+         acc -> offd_j[pos] = col - acc -> num_cols_diag;
+      }
+   }
+   acc -> hash_pos[h] = pos;
+}
 
-   double          *RAP_offd_data = NULL;
-   HYPRE_Int             *RAP_offd_i = NULL;
-   HYPRE_Int             *RAP_offd_j = NULL;
+/*--------------------------------------------------------------------------
+ * Adds scale * data[k] to the entries cols[k] (mapped by map, if given,
+ * and shifted by shift) of the current row, begin <= k < end.
+ *--------------------------------------------------------------------------*/
 
-   HYPRE_Int              RAP_size;
-   HYPRE_Int              RAP_ext_size;
-   HYPRE_Int              RAP_diag_size;
-   HYPRE_Int              RAP_offd_size;
-   HYPRE_Int              P_ext_diag_size;
-   HYPRE_Int              P_ext_offd_size;
-   HYPRE_Int              first_col_diag_RAP;
-   HYPRE_Int              last_col_diag_RAP;
-   HYPRE_Int              num_cols_offd_RAP = 0;
-   
-   hypre_CSRMatrix *R_diag;
-   
-   double          *R_diag_data;
-   HYPRE_Int             *R_diag_i;
-   HYPRE_Int             *R_diag_j;
+static void
+hypre_RAPAccumulateRow( hypre_RAPAccumulator *acc,
+                        HYPRE_Int             begin,
+                        HYPRE_Int             end,
+                        HYPRE_Int            *cols,
+                        double               *data,
+                        HYPRE_Int            *map,
+                        HYPRE_Int             shift,
+                        double                scale )
+{
+   HYPRE_Int k, col;
 
-   hypre_CSRMatrix *R_offd;
-   
-   double          *R_offd_data;
-   HYPRE_Int             *R_offd_i;
-   HYPRE_Int             *R_offd_j;
+   for (k = begin; k < end; k++)
+   {
+      col = (map ? map[cols[k]] : cols[k]) + shift;
+      hypre_RAPAccumulate(acc, col, acc -> diag_data ? scale * data[k] : 0.0);
+   }
+}
 
-   hypre_CSRMatrix *Ps_ext;
-   
-   double          *Ps_ext_data;
-   HYPRE_Int             *Ps_ext_i;
-   HYPRE_Int             *Ps_ext_j;
+/*--------------------------------------------------------------------------
+ * hypre_RAPInteriorRowHash
+ *
+ * Row ic of RAP_diag and RAP_offd: the diagonal entry (if square), the
+ * rows of RAP_ext which belong to ic (if with_ext), and the products
+ * R_diag * A * P, in the order of hypre_RAPInteriorRowMarker.  The offd
+ * columns of P and P_ext are mapped to the accumulator's column space by
+ * map_P_offd and map_P_ext_offd.
+ *--------------------------------------------------------------------------*/
 
-   double          *P_ext_diag_data = NULL;
-   HYPRE_Int             *P_ext_diag_i = NULL;
-   HYPRE_Int             *P_ext_diag_j = NULL;
+static void
+hypre_RAPInteriorRowHash( hypre_RAPInteriorData *rd,
+                          HYPRE_Int             *map_P_offd,
+                          HYPRE_Int             *map_P_ext_offd,
+                          HYPRE_Int              with_ext,
+                          hypre_RAPAccumulator  *acc,
+                          HYPRE_Int              ic )
+{
+   HYPRE_Int  num_cols_diag_P = rd -> num_cols_diag_P;
+   HYPRE_Int  num_cols_offd_A = rd -> num_cols_offd_A;
+   HYPRE_Int  num_cols_offd_P = rd -> num_cols_offd_P;
+   HYPRE_Int  i, j, i1, i2, jj1, jj2, num_products;
+   double     r_entry, r_a_product;
+
+   acc -> jj_row_begin_diag = acc -> jj_count_diag;
+   acc -> jj_row_begin_offd = acc -> jj_count_offd;
+
+   /* upper bound for the row length: number of contributions */
+   num_products = 1;
+   if (with_ext)
+      for (i = rd -> ext_row_i[ic]; i < rd -> ext_row_i[ic+1]; i++)
+      {
+         j = rd -> ext_row_j[i];
+         num_products += rd -> RAP_ext_i[j+1] - rd -> RAP_ext_i[j];
+      }
+   for (jj1 = rd -> R_diag_i[ic]; jj1 < rd -> R_diag_i[ic+1]; jj1++)
+   {
+      i1 = rd -> R_diag_j[jj1];
+      if (num_cols_offd_A)
+         for (jj2 = rd -> A_offd_i[i1]; jj2 < rd -> A_offd_i[i1+1]; jj2++)
+         {
+            i2 = rd -> A_offd_j[jj2];
+            num_products += rd -> P_ext_diag_i[i2+1] - rd -> P_ext_diag_i[i2]
+                          + rd -> P_ext_offd_i[i2+1] - rd -> P_ext_offd_i[i2];
+         }
+      for (jj2 = rd -> A_diag_i[i1]; jj2 < rd -> A_diag_i[i1+1]; jj2++)
+      {
+         i2 = rd -> A_diag_j[jj2];
+         num_products += rd -> P_diag_i[i2+1] - rd -> P_diag_i[i2];
+         if (num_cols_offd_P)
+            num_products += rd -> P_offd_i[i2+1] - rd -> P_offd_i[i2];
+      }
+   }
+   hypre_RAPAccumulatorHashReserve(acc, num_products);
 
-   double          *P_ext_offd_data = NULL;
-   HYPRE_Int             *P_ext_offd_i = NULL;
-   HYPRE_Int             *P_ext_offd_j = NULL;
+   if (rd -> square)
+      hypre_RAPAccumulate(acc, ic, 0.0);
 
-   HYPRE_Int             *col_map_offd_Pext;
-   HYPRE_Int             *map_P_to_Pext = NULL;
-   HYPRE_Int             *map_P_to_RAP = NULL;
-   HYPRE_Int             *map_Pext_to_RAP = NULL;
+   if (with_ext)
+   {
+      for (i = rd -> ext_row_i[ic]; i < rd -> ext_row_i[ic+1]; i++)
+      {
+         j = rd -> ext_row_j[i];
+         hypre_RAPAccumulateRow(acc, rd -> RAP_ext_i[j], rd -> RAP_ext_i[j+1],
+                                rd -> RAP_ext_j, rd -> RAP_ext_data,
+                                NULL, 0, 1.0);
+      }
+   }
 
-   HYPRE_Int             *P_marker;
-   HYPRE_Int            **P_mark_array;
-   HYPRE_Int            **A_mark_array;
-   HYPRE_Int             *A_marker;
-   HYPRE_Int             *temp;
+   for (jj1 = rd -> R_diag_i[ic]; jj1 < rd -> R_diag_i[ic+1]; jj1++)
+   {
+      i1 = rd -> R_diag_j[jj1];
+      r_entry = rd -> R_diag_data[jj1];
 
-   HYPRE_Int              n_coarse, n_coarse_RT;
-   HYPRE_Int              square = 1;
-   HYPRE_Int              num_cols_offd_Pext = 0;
-   
-   HYPRE_Int              ic, i, j, k;
-   HYPRE_Int              i1, i2, i3, ii, ns, ne, size, rest;
-   HYPRE_Int              cnt, cnt_offd, cnt_diag, value;
-   HYPRE_Int              jj1, jj2, jj3, jcol;
-   
-   HYPRE_Int             *jj_count, *jj_cnt_diag, *jj_cnt_offd;
-   HYPRE_Int              jj_counter, jj_count_diag, jj_count_offd;
-   HYPRE_Int              jj_row_begining, jj_row_begin_diag, jj_row_begin_offd;
-   HYPRE_Int              start_indexing = 0; /* start indexing for RAP_data at 0 */
-   HYPRE_Int              num_nz_cols_A;
-   HYPRE_Int              num_procs;
-   HYPRE_Int              num_threads;
+      if (num_cols_offd_A)
+      {
+         for (jj2 = rd -> A_offd_i[i1]; jj2 < rd -> A_offd_i[i1+1]; jj2++)
+         {
+            i2 = rd -> A_offd_j[jj2];
+            r_a_product = r_entry * rd -> A_offd_data[jj2];
+            hypre_RAPAccumulateRow(acc, rd -> P_ext_diag_i[i2],
+                                   rd -> P_ext_diag_i[i2+1],
+                                   rd -> P_ext_diag_j, rd -> P_ext_diag_data,
+                                   NULL, 0, r_a_product);
+            hypre_RAPAccumulateRow(acc, rd -> P_ext_offd_i[i2],
+                                   rd -> P_ext_offd_i[i2+1],
+                                   rd -> P_ext_offd_j, rd -> P_ext_offd_data,
+                                   map_P_ext_offd, num_cols_diag_P,
+                                   r_a_product);
+         }
+      }
 
-   double           r_entry;
-   double           r_a_product;
-   double           r_a_p_product;
-   
-   double           zero = 0.0;
+      for (jj2 = rd -> A_diag_i[i1]; jj2 < rd -> A_diag_i[i1+1]; jj2++)
+      {
+         i2 = rd -> A_diag_j[jj2];
+         r_a_product = r_entry * rd -> A_diag_data[jj2];
+         hypre_RAPAccumulateRow(acc, rd -> P_diag_i[i2], rd -> P_diag_i[i2+1],
+                                rd -> P_diag_j, rd -> P_diag_data,
+                                NULL, 0, r_a_product);
+         if (num_cols_offd_P)
+            hypre_RAPAccumulateRow(acc, rd -> P_offd_i[i2], rd -> P_offd_i[i2+1],
+                                   rd -> P_offd_j, rd -> P_offd_data,
+                                   map_P_offd, num_cols_diag_P, r_a_product);
+      }
+   }
 
-   /*-----------------------------------------------------------------------
-    *  Copy ParCSRMatrix RT into CSRMatrix R so that we have row-wise access 
-    *  to restriction .
-    *-----------------------------------------------------------------------*/
+   for (i = 0; i < acc -> num_used; i++)
+      acc -> hash_keys[acc -> hash_used[i]] = -1;
+   acc -> num_used = 0;
+}
 
-   hypre_MPI_Comm_size(comm,&num_procs);
-   num_threads = hypre_NumThreads();
+/*--------------------------------------------------------------------------
+ * hypre_RAPInteriorRowMarker
+ *
+ * Same as hypre_RAPInteriorRowHash with the dense marker arrays.  Points
+ * i2 of A which have been visited before in this row (A_marker[i2] = ic)
+ * yield no new entries; in the symbolic pass they are skipped, in the
+ * numeric pass their contributions are added to the existing entries.
+ *--------------------------------------------------------------------------*/
 
-   if (comm_pkg_RT)
+static void
+hypre_RAPInteriorRowMarker( hypre_RAPInteriorData *rd,
+                            HYPRE_Int             *map_P_offd,
+                            HYPRE_Int             *map_P_ext_offd,
+                            HYPRE_Int              with_ext,
+                            hypre_RAPAccumulator  *acc,
+                            HYPRE_Int              ic )
+{
+   HYPRE_Int  *R_diag_i = rd -> R_diag_i;
+   HYPRE_Int  *R_diag_j = rd -> R_diag_j;
+   double     *R_diag_data = rd -> R_diag_data;
+   HYPRE_Int  *A_diag_i = rd -> A_diag_i;
+   HYPRE_Int  *A_diag_j = rd -> A_diag_j;
+   double     *A_diag_data = rd -> A_diag_data;
+   HYPRE_Int  *A_offd_i = rd -> A_offd_i;
+   HYPRE_Int  *A_offd_j = rd -> A_offd_j;
+   double     *A_offd_data = rd -> A_offd_data;
+   HYPRE_Int  *P_diag_i = rd -> P_diag_i;
+   HYPRE_Int  *P_diag_j = rd -> P_diag_j;
+   double     *P_diag_data = rd -> P_diag_data;
+   HYPRE_Int  *P_offd_i = rd -> P_offd_i;
+   HYPRE_Int  *P_offd_j = rd -> P_offd_j;
+   double     *P_offd_data = rd -> P_offd_data;
+   HYPRE_Int  *P_ext_diag_i = rd -> P_ext_diag_i;
+   HYPRE_Int  *P_ext_diag_j = rd -> P_ext_diag_j;
+   double     *P_ext_diag_data = rd -> P_ext_diag_data;
+   HYPRE_Int  *P_ext_offd_i = rd -> P_ext_offd_i;
+   HYPRE_Int  *P_ext_offd_j = rd -> P_ext_offd_j;
+   double     *P_ext_offd_data = rd -> P_ext_offd_data;
+   HYPRE_Int   num_cols_diag_P = rd -> num_cols_diag_P;
+   HYPRE_Int   num_cols_offd_P = rd -> num_cols_offd_P;
+   HYPRE_Int   num_cols_offd_A = rd -> num_cols_offd_A;
+
+   HYPRE_Int  *P_marker = acc -> marker;
+   HYPRE_Int  *A_marker = acc -> A_marker;
+   HYPRE_Int  *RAP_diag_j = acc -> diag_j;
+   double     *RAP_diag_data = acc -> diag_data;
+   HYPRE_Int  *RAP_offd_j = acc -> offd_j;
+   double     *RAP_offd_data = acc -> offd_data;
+   HYPRE_Int   jj_count_diag = acc -> jj_count_diag;
+   HYPRE_Int   jj_count_offd = acc -> jj_count_offd;
+   HYPRE_Int   jj_row_begin_diag = jj_count_diag;
+   HYPRE_Int   jj_row_begin_offd = jj_count_offd;
+
+   HYPRE_Int   i, j, k, jcol, i1, i2, i3, jj1, jj2, jj3;
+   double      r_entry, r_a_product, r_a_p_product;
+
+   if (rd -> square)
    {
-        num_recvs_RT = hypre_ParCSRCommPkgNumRecvs(comm_pkg_RT);
-        num_sends_RT = hypre_ParCSRCommPkgNumSends(comm_pkg_RT);
-        send_map_starts_RT =hypre_ParCSRCommPkgSendMapStarts(comm_pkg_RT);
-        send_map_elmts_RT = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_RT);
+      P_marker[ic] = jj_count_diag;
+      if (RAP_diag_data)
+      {
+         RAP_diag_data[jj_count_diag] = 0.0;
+         RAP_diag_j[jj_count_diag] = ic;
+      }
+      jj_count_diag++;
    }
 
-   hypre_CSRMatrixTranspose(RT_diag,&R_diag,1); 
-   if (num_cols_offd_RT) 
+   if (with_ext)
    {
-        hypre_CSRMatrixTranspose(RT_offd,&R_offd,1); 
-        R_offd_data = hypre_CSRMatrixData(R_offd);
-        R_offd_i    = hypre_CSRMatrixI(R_offd);
-        R_offd_j    = hypre_CSRMatrixJ(R_offd);
+      for (i = rd -> ext_row_i[ic]; i < rd -> ext_row_i[ic+1]; i++)
+      {
+         j = rd -> ext_row_j[i];
+         for (k = rd -> RAP_ext_i[j]; k < rd -> RAP_ext_i[j+1]; k++)
+         {
+            jcol = rd -> RAP_ext_j[k];
+            if (jcol < num_cols_diag_P)
+            {
+               if (P_marker[jcol] < jj_row_begin_diag)
+               {
+                  P_marker[jcol] = jj_count_diag;
+                  if (RAP_diag_data)
+                  {
+                     RAP_diag_data[jj_count_diag] = rd -> RAP_ext_data[k];
+                     RAP_diag_j[jj_count_diag] = jcol;
+                  }
+                  jj_count_diag++;
+               }
+               else if (RAP_diag_data)
+                  RAP_diag_data[P_marker[jcol]] += rd -> RAP_ext_data[k];
+            }
+            else
+            {
+               if (P_marker[jcol] < jj_row_begin_offd)
+               {
+                  P_marker[jcol] = jj_count_offd;
+                  if (RAP_diag_data)
+                  {
+                     RAP_offd_data[jj_count_offd] = rd -> RAP_ext_data[k];
+                     RAP_offd_j[jj_count_offd] = jcol - num_cols_diag_P;
+                  }
+                  jj_count_offd++;
+               }
+               else if (RAP_diag_data)
+                  RAP_offd_data[P_marker[jcol]] += rd -> RAP_ext_data[k];
+            }
+         }
+      }
    }
 
-   /*-----------------------------------------------------------------------
-    *  Access the CSR vectors for R. Also get sizes of fine and
-    *  coarse grids.
-    *-----------------------------------------------------------------------*/
+   for (jj1 = R_diag_i[ic]; jj1 < R_diag_i[ic+1]; jj1++)
+   {
+      i1 = R_diag_j[jj1];
+      r_entry = R_diag_data[jj1];
 
-   R_diag_data = hypre_CSRMatrixData(R_diag);
-   R_diag_i    = hypre_CSRMatrixI(R_diag);
-   R_diag_j    = hypre_CSRMatrixJ(R_diag);
+      /*-----------------------------------------------------------------
+       *  Loop over entries in row i1 of A_offd, and rows i2 of P_ext.
+       *-----------------------------------------------------------------*/
 
-   n_coarse = hypre_ParCSRMatrixGlobalNumCols(P);
-   num_nz_cols_A = num_cols_diag_A + num_cols_offd_A;
+      if (num_cols_offd_A)
+      {
+         for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
+         {
+            i2 = A_offd_j[jj2];
 
-   n_coarse_RT = hypre_ParCSRMatrixGlobalNumCols(RT);
-   if (n_coarse != n_coarse_RT)
-      square = 0;
+            if (!RAP_diag_data)
+            {
+               if (A_marker[i2] == ic)
+                  continue;
+               A_marker[i2] = ic;
 
-   /*-----------------------------------------------------------------------
-    *  Generate Ps_ext, i.e. portion of P that is stored on neighbor procs
-    *  and needed locally for triple matrix product 
-    *-----------------------------------------------------------------------*/
+               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_diag_j[jj3];
+                  if (P_marker[i3] < jj_row_begin_diag)
+                     P_marker[i3] = jj_count_diag++;
+               }
+               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_ext_offd[P_ext_offd_j[jj3]] + num_cols_diag_P;
+                  if (P_marker[i3] < jj_row_begin_offd)
+                     P_marker[i3] = jj_count_offd++;
+               }
+               continue;
+            }
 
-   if (num_procs > 1) 
-   {
-        Ps_ext = hypre_ParCSRMatrixExtractBExt(P,A,1);
-        Ps_ext_data = hypre_CSRMatrixData(Ps_ext);
-        Ps_ext_i    = hypre_CSRMatrixI(Ps_ext);
-        Ps_ext_j    = hypre_CSRMatrixJ(Ps_ext);
-   }
+            r_a_product = r_entry * A_offd_data[jj2];
 
-   P_ext_diag_i = hypre_CTAlloc(HYPRE_Int,num_cols_offd_A+1);
-   P_ext_offd_i = hypre_CTAlloc(HYPRE_Int,num_cols_offd_A+1);
-   P_ext_diag_size = 0;
-   P_ext_offd_size = 0;
-   last_col_diag_P = first_col_diag_P + num_cols_diag_P - 1;
+            if (A_marker[i2] != ic)
+            {
+               A_marker[i2] = ic;
 
-   for (i=0; i < num_cols_offd_A; i++)
-   {
-      for (j=Ps_ext_i[i]; j < Ps_ext_i[i+1]; j++)
-         if (Ps_ext_j[j] < first_col_diag_P || Ps_ext_j[j] > last_col_diag_P)
-            P_ext_offd_size++;
-         else
-            P_ext_diag_size++;
-      P_ext_diag_i[i+1] = P_ext_diag_size;
-      P_ext_offd_i[i+1] = P_ext_offd_size;
-   }
-   
-   if (P_ext_diag_size)
-   {
-      P_ext_diag_j = hypre_CTAlloc(HYPRE_Int, P_ext_diag_size);
-      P_ext_diag_data = hypre_CTAlloc(double, P_ext_diag_size);
-   }
-   if (P_ext_offd_size)
-   {
-      P_ext_offd_j = hypre_CTAlloc(HYPRE_Int, P_ext_offd_size);
-      P_ext_offd_data = hypre_CTAlloc(double, P_ext_offd_size);
-   }
+               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_diag_j[jj3];
+                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
+                  if (P_marker[i3] < jj_row_begin_diag)
+                  {
+                     P_marker[i3] = jj_count_diag;
+                     RAP_diag_data[jj_count_diag] = r_a_p_product;
+                     RAP_diag_j[jj_count_diag] = i3;
+                     jj_count_diag++;
+                  }
+                  else
+                     RAP_diag_data[P_marker[i3]] += r_a_p_product;
+               }
+               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_ext_offd[P_ext_offd_j[jj3]] + num_cols_diag_P;
+                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
+                  if (P_marker[i3] < jj_row_begin_offd)
+                  {
+                     P_marker[i3] = jj_count_offd;
+                     RAP_offd_data[jj_count_offd] = r_a_p_product;
+                     RAP_offd_j[jj_count_offd] = i3 - num_cols_diag_P;
+                     jj_count_offd++;
+                  }
+                  else
+                     RAP_offd_data[P_marker[i3]] += r_a_p_product;
+               }
+            }
+            else
+            {
+               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_diag_j[jj3];
+                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
+                  RAP_diag_data[P_marker[i3]] += r_a_p_product;
+               }
+               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_ext_offd[P_ext_offd_j[jj3]] + num_cols_diag_P;
+                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
+                  RAP_offd_data[P_marker[i3]] += r_a_p_product;
+               }
+            }
+         }
+      }
 
-   cnt_offd = 0;
-   cnt_diag = 0;
-   cnt = 0;
-   for (i=0; i < num_cols_offd_A; i++)
-   {
-      for (j=Ps_ext_i[i]; j < Ps_ext_i[i+1]; j++)
-         if (Ps_ext_j[j] < first_col_diag_P || Ps_ext_j[j] > last_col_diag_P)
+      /*-----------------------------------------------------------------
+       *  Loop over entries in row i1 of A_diag, and rows i2 of P.
+       *-----------------------------------------------------------------*/
+
+      for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
+      {
+         i2 = A_diag_j[jj2];
+
+         if (!RAP_diag_data)
          {
-            P_ext_offd_j[cnt_offd] = Ps_ext_j[j];
-            P_ext_offd_data[cnt_offd++] = Ps_ext_data[j];
+            if (A_marker[i2+num_cols_offd_A] == ic)
+               continue;
+            A_marker[i2+num_cols_offd_A] = ic;
+
+            for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
+            {
+               i3 = P_diag_j[jj3];
+               if (P_marker[i3] < jj_row_begin_diag)
+                  P_marker[i3] = jj_count_diag++;
+            }
+            if (num_cols_offd_P)
+            {
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_offd[P_offd_j[jj3]] + num_cols_diag_P;
+                  if (P_marker[i3] < jj_row_begin_offd)
+                     P_marker[i3] = jj_count_offd++;
+               }
+            }
+            continue;
+         }
+
+         r_a_product = r_entry * A_diag_data[jj2];
+
+         if (A_marker[i2+num_cols_offd_A] != ic)
+         {
+            A_marker[i2+num_cols_offd_A] = ic;
+
+            for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
+            {
+               i3 = P_diag_j[jj3];
+               r_a_p_product = r_a_product * P_diag_data[jj3];
+               if (P_marker[i3] < jj_row_begin_diag)
+               {
+                  P_marker[i3] = jj_count_diag;
+                  RAP_diag_data[jj_count_diag] = r_a_p_product;
+                  RAP_diag_j[jj_count_diag] = i3;
+                  jj_count_diag++;
+               }
+               else
+                  RAP_diag_data[P_marker[i3]] += r_a_p_product;
+            }
+            if (num_cols_offd_P)
+            {
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_offd[P_offd_j[jj3]] + num_cols_diag_P;
+                  r_a_p_product = r_a_product * P_offd_data[jj3];
+                  if (P_marker[i3] < jj_row_begin_offd)
+                  {
+                     P_marker[i3] = jj_count_offd;
+                     RAP_offd_data[jj_count_offd] = r_a_p_product;
+                     RAP_offd_j[jj_count_offd] = i3 - num_cols_diag_P;
+                     jj_count_offd++;
+                  }
+                  else
+                     RAP_offd_data[P_marker[i3]] += r_a_p_product;
+               }
+            }
          }
          else
          {
-            P_ext_diag_j[cnt_diag] = Ps_ext_j[j] - first_col_diag_P;
-            P_ext_diag_data[cnt_diag++] = Ps_ext_data[j];
+            for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
+            {
+               i3 = P_diag_j[jj3];
+               r_a_p_product = r_a_product * P_diag_data[jj3];
+               RAP_diag_data[P_marker[i3]] += r_a_p_product;
+            }
+            if (num_cols_offd_P)
+            {
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_offd[P_offd_j[jj3]] + num_cols_diag_P;
+                  r_a_p_product = r_a_product * P_offd_data[jj3];
+                  RAP_offd_data[P_marker[i3]] += r_a_p_product;
+               }
+            }
          }
-   }
-   if (num_procs > 1) 
-   {
-      hypre_CSRMatrixDestroy(Ps_ext);
-      Ps_ext = NULL;
+      }
    }
 
-   if (P_ext_offd_size || num_cols_offd_P)
-   {
-      temp = hypre_CTAlloc(HYPRE_Int, P_ext_offd_size+num_cols_offd_P);
-      for (i=0; i < P_ext_offd_size; i++)
-         temp[i] = P_ext_offd_j[i];
-      cnt = P_ext_offd_size;
-      for (i=0; i < num_cols_offd_P; i++)
-         temp[cnt++] = col_map_offd_P[i];
-   }
-   if (cnt)
-   {
-      qsort0(temp, 0, cnt-1);
+   acc -> jj_row_begin_diag = jj_row_begin_diag;
+   acc -> jj_row_begin_offd = jj_row_begin_offd;
+   acc -> jj_count_diag = jj_count_diag;
+   acc -> jj_count_offd = jj_count_offd;
+}
 
-      num_cols_offd_Pext = 1;
-      value = temp[0];
-      for (i=1; i < cnt; i++)
+/*--------------------------------------------------------------------------
+ * hypre_RAPInteriorRows
+ *
+ * Computes the interior rows of RAP, distributed over the threads in
+ * contiguous chunks, each with its own accumulator.
+ *
+ * pass 0: symbolic, rows without contributions from RAP_ext
+ * pass 1: symbolic, rows with contributions from RAP_ext
+ * pass 2: numeric, all rows
+ *
+ * The symbolic passes store the row lengths in RAP_diag_i[ic+1] and
+ * RAP_offd_i[ic+1]; the numeric pass expects the row pointers.  Pass 0
+ * does not need RAP_ext, and runs while RAP_ext is communicated; its
+ * accumulator works in the column space of P_ext.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RAPInteriorRows( hypre_RAPInteriorData *rd,
+                       HYPRE_Int              pass,
+                       HYPRE_Int              accum_type,
+                       HYPRE_Int              num_rows,
+                       HYPRE_Int              num_cols_offd,
+                       HYPRE_Int              num_nz_cols_A,
+                       HYPRE_Int             *map_P_offd,
+                       HYPRE_Int             *map_P_ext_offd,
+                       HYPRE_Int             *RAP_diag_i,
+                       HYPRE_Int             *RAP_diag_j,
+                       double                *RAP_diag_data,
+                       HYPRE_Int             *RAP_offd_i,
+                       HYPRE_Int             *RAP_offd_j,
+                       double                *RAP_offd_data )
+{
+   hypre_RAPAccumulator acc;
+   HYPRE_Int num_threads = hypre_NumThreads();
+   HYPRE_Int ii, ns, ne, size, rest, ic, with_ext;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,ns,ne,size,rest,ic,with_ext,acc) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      size = num_rows/num_threads;
+      rest = num_rows - size*num_threads;
+      if (ii < rest)
       {
-         if (temp[i] > value)
-         {
-            value = temp[i];
-            temp[num_cols_offd_Pext++] = value;
-         }
+         ns = ii*size+ii;
+         ne = (ii+1)*size+ii+1;
+      }
+      else
+      {
+         ns = ii*size+rest;
+         ne = (ii+1)*size+rest;
       }
-   }
- 
-   if (num_cols_offd_Pext)
-        col_map_offd_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_Pext);
 
-   for (i=0; i < num_cols_offd_Pext; i++)
-      col_map_offd_Pext[i] = temp[i];
+      hypre_RAPAccumulatorCreate(&acc, accum_type, rd -> num_cols_diag_P,
+                                 num_cols_offd, num_nz_cols_A);
+      if (pass == 2)
+      {
+         acc.jj_count_diag = RAP_diag_i[ns];
+         acc.jj_count_offd = RAP_offd_i[ns];
+         acc.diag_j = RAP_diag_j;
+         acc.diag_data = RAP_diag_data;
+         acc.offd_j = RAP_offd_j;
+         acc.offd_data = RAP_offd_data;
+      }
 
-   if (P_ext_offd_size || num_cols_offd_P)
-      hypre_TFree(temp);
+      for (ic = ns; ic < ne; ic++)
+      {
+         with_ext = (rd -> ext_row_i && rd -> ext_row_i[ic+1] > rd -> ext_row_i[ic]);
+         if ((pass == 0 && with_ext) || (pass == 1 && !with_ext))
+            continue;
 
-   for (i=0 ; i < P_ext_offd_size; i++)
-      P_ext_offd_j[i] = hypre_BinarySearch(col_map_offd_Pext,
-                                           P_ext_offd_j[i],
-                                           num_cols_offd_Pext);
-   if (num_cols_offd_P)
-   {
-      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_P);
+         if (accum_type == 0)
+            hypre_RAPInteriorRowMarker(rd, map_P_offd, map_P_ext_offd,
+                                       with_ext, &acc, ic);
+         else
+            hypre_RAPInteriorRowHash(rd, map_P_offd, map_P_ext_offd,
+                                     with_ext, &acc, ic);
 
-      cnt = 0;
-      for (i=0; i < num_cols_offd_Pext; i++)
-         if (col_map_offd_Pext[i] == col_map_offd_P[cnt])
+         if (pass < 2)
          {
-            map_P_to_Pext[cnt++] = i;
-            if (cnt == num_cols_offd_P) break;
+            RAP_diag_i[ic+1] = acc.jj_count_diag - acc.jj_row_begin_diag;
+            RAP_offd_i[ic+1] = acc.jj_count_offd - acc.jj_row_begin_offd;
          }
+      }
+
+      hypre_RAPAccumulatorDestroy(&acc);
    }
+}
 
-   /*-----------------------------------------------------------------------
-    *  First Pass: Determine size of RAP_int and set up RAP_int_i if there 
-    *  are more than one processor and nonzero elements in R_offd
-    *-----------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperator
+ *--------------------------------------------------------------------------*/
 
-  P_mark_array = hypre_CTAlloc(HYPRE_Int *, num_threads);
-  A_mark_array = hypre_CTAlloc(HYPRE_Int *, num_threads);
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
+                                    hypre_ParCSRMatrix  *A,
+                                    hypre_ParCSRMatrix  *P,
+                                    hypre_ParCSRMatrix **RAP_ptr )
+{
+   return hypre_BoomerAMGBuildCoarseOperatorAccum(RT, A, P, 0, RAP_ptr);
+}
 
-  if (num_cols_offd_RT)
-  {
-   jj_count = hypre_CTAlloc(HYPRE_Int, num_threads);
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorAccum
+ *
+ * rap_accum_type selects the accumulator for the rows of the interior
+ * product (see hypre_RAPAccumulator): 0 - dense marker array,
+ * 1 - hash table per row.  Both give identical results.
+ *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker) HYPRE_SMP_SCHEDULE
-#endif
-   for (ii = 0; ii < num_threads; ii++)
-   {
-     size = num_cols_offd_RT/num_threads;
-     rest = num_cols_offd_RT - size*num_threads;
-     if (ii < rest)
-     {
-        ns = ii*size+ii;
-        ne = (ii+1)*size+ii+1;
-     }
-     else
-     {
-        ns = ii*size+rest;
-        ne = (ii+1)*size+rest;
-     }
-   
-   /*-----------------------------------------------------------------------
-    *  Allocate marker arrays.
-    *-----------------------------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorAccum( hypre_ParCSRMatrix  *RT,
+                                         hypre_ParCSRMatrix  *A,
+                                         hypre_ParCSRMatrix  *P,
+                                         HYPRE_Int            rap_accum_type,
+                                         hypre_ParCSRMatrix **RAP_ptr )
 
-   if (num_cols_offd_Pext || num_cols_diag_P)
-   {
-      P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_cols_diag_P+num_cols_offd_Pext);
-      P_marker = P_mark_array[ii];
-   }
-   A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_nz_cols_A);
-   A_marker = A_mark_array[ii];
-   /*-----------------------------------------------------------------------
-    *  Initialize some stuff.
-    *-----------------------------------------------------------------------*/
+{
+   MPI_Comm        comm = hypre_ParCSRMatrixComm(A);
 
-   jj_counter = start_indexing;
-   for (ic = 0; ic < num_cols_diag_P+num_cols_offd_Pext; ic++)
-   {      
-      P_marker[ic] = -1;
-   }
-   for (i = 0; i < num_nz_cols_A; i++)
-   {      
-      A_marker[i] = -1;
-   }   
+   hypre_CSRMatrix *RT_diag = hypre_ParCSRMatrixDiag(RT);
+   hypre_CSRMatrix *RT_offd = hypre_ParCSRMatrixOffd(RT);
+   HYPRE_Int             num_cols_diag_RT = hypre_CSRMatrixNumCols(RT_diag);
+   HYPRE_Int             num_cols_offd_RT = hypre_CSRMatrixNumCols(RT_offd);
+   HYPRE_Int             num_rows_offd_RT = hypre_CSRMatrixNumRows(RT_offd);
+   hypre_ParCSRCommPkg   *comm_pkg_RT = hypre_ParCSRMatrixCommPkg(RT);
+   HYPRE_Int             num_recvs_RT = 0;
+   HYPRE_Int             num_sends_RT = 0;
+   HYPRE_Int             *send_map_starts_RT;
+   HYPRE_Int             *send_map_elmts_RT;
 
-   /*-----------------------------------------------------------------------
-    *  Loop over exterior c-points
-    *-----------------------------------------------------------------------*/
-    
-   for (ic = ns; ic < ne; ic++)
-   {
-      
-      jj_row_begining = jj_counter;
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   
+   double          *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int             *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int             *A_diag_j = hypre_CSRMatrixJ(A_diag);
 
-      /*--------------------------------------------------------------------
-       *  Loop over entries in row ic of R_offd.
-       *--------------------------------------------------------------------*/
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
    
-      for (jj1 = R_offd_i[ic]; jj1 < R_offd_i[ic+1]; jj1++)
-      {
-         i1  = R_offd_j[jj1];
+   double          *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int             *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int             *A_offd_j = hypre_CSRMatrixJ(A_offd);
 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_offd.
-          *-----------------------------------------------------------------*/
-         
-         for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
-         {
-            i2 = A_offd_j[jj2];
+   HYPRE_Int  num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int  num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
 
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
+   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+   
+   double          *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int             *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int             *P_diag_j = hypre_CSRMatrixJ(P_diag);
 
-            if (A_marker[i2] != ic)
-            {
+   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int             *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
+   
+   double          *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int             *P_offd_i = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int             *P_offd_j = hypre_CSRMatrixJ(P_offd);
 
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
+   HYPRE_Int  first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_Int  last_col_diag_P;
+   HYPRE_Int  num_cols_diag_P = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int  num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Int *coarse_partitioning = hypre_ParCSRMatrixColStarts(P);
+   HYPRE_Int *RT_partitioning = hypre_ParCSRMatrixColStarts(RT);
 
-               A_marker[i2] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_ext.
-                *-----------------------------------------------------------*/
+   hypre_ParCSRMatrix *RAP;
+   HYPRE_Int                *col_map_offd_RAP;
+   HYPRE_Int                *new_col_map_offd_RAP;
 
-               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
-               {
-                  i3 = P_ext_diag_j[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+   hypre_CSRMatrix *RAP_int = NULL;
 
-                  if (P_marker[i3] < jj_row_begining)
-                  {
-                     P_marker[i3] = jj_counter;
-                     jj_counter++;
-                  }
-               }
-               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
-               {
-                  i3 = P_ext_offd_j[jj3] + num_cols_diag_P;
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+   double          *RAP_int_data;
+   HYPRE_Int             *RAP_int_i;
+   HYPRE_Int             *RAP_int_j;
 
-                  if (P_marker[i3] < jj_row_begining)
-                  {
-                     P_marker[i3] = jj_counter;
-                     jj_counter++;
-                  }
-               }
-            }
-         }
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_diag.
-          *-----------------------------------------------------------------*/
-         
-         for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
-         {
-            i2 = A_diag_j[jj2];
+   hypre_CSRMatrix *RAP_ext;
 
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
+   double          *RAP_ext_data = NULL;
+   HYPRE_Int             *RAP_ext_i = NULL;
+   HYPRE_Int             *RAP_ext_j = NULL;
 
-            if (A_marker[i2+num_cols_offd_A] != ic)
-            {
+   hypre_RAPExchangeHandle exchange_handle;
+   HYPRE_Int             *ext_row_i = NULL;
+   HYPRE_Int             *ext_row_j = NULL;
+   HYPRE_Int              num_ext_rows;
 
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
+   hypre_RAPInteriorData rd;
 
-               A_marker[i2+num_cols_offd_A] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_diag.
-                *-----------------------------------------------------------*/
+   hypre_CSRMatrix *RAP_diag;
 
-               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
-               {
-                  i3 = P_diag_j[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+   double          *RAP_diag_data = NULL;
+   HYPRE_Int             *RAP_diag_i;
+   HYPRE_Int             *RAP_diag_j = NULL;
 
-                  if (P_marker[i3] < jj_row_begining)
-                  {
-                     P_marker[i3] = jj_counter;
-                     jj_counter++;
-                  }
-               }
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_offd.
-                *-----------------------------------------------------------*/
+   hypre_CSRMatrix *RAP_offd;
 
-               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
-               {
-                  i3 = map_P_to_Pext[P_offd_j[jj3]] + num_cols_diag_P;
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+   double          *RAP_offd_data = NULL;
+   HYPRE_Int             *RAP_offd_i = NULL;
+   HYPRE_Int             *RAP_offd_j = NULL;
 
-                  if (P_marker[i3] < jj_row_begining)
-                  {
-                     P_marker[i3] = jj_counter;
-                     jj_counter++;
-                  }
-               }
-            }
-         }
-      }
-    }
+   HYPRE_Int              RAP_size;
+   HYPRE_Int              RAP_ext_size;
+   HYPRE_Int              RAP_diag_size;
+   HYPRE_Int              RAP_offd_size;
+   HYPRE_Int              P_ext_diag_size;
+   HYPRE_Int              P_ext_offd_size;
+   HYPRE_Int              first_col_diag_RAP;
+   HYPRE_Int              last_col_diag_RAP;
+   HYPRE_Int              num_cols_offd_RAP = 0;
+   
+   hypre_CSRMatrix *R_diag;
 
-    jj_count[ii] = jj_counter;
+   hypre_CSRMatrix *R_offd;
+   
+   double          *R_offd_data;
+   HYPRE_Int             *R_offd_i;
+   HYPRE_Int             *R_offd_j;
 
-   }
-  
-   /*-----------------------------------------------------------------------
-    *  Allocate RAP_int_data and RAP_int_j arrays.
-    *-----------------------------------------------------------------------*/
-   for (i = 0; i < num_threads-1; i++)
-      jj_count[i+1] += jj_count[i];
-    
-   RAP_size = jj_count[num_threads-1];
-   RAP_int_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_RT+1);
-   RAP_int_data = hypre_CTAlloc(double, RAP_size);
-   RAP_int_j    = hypre_CTAlloc(HYPRE_Int, RAP_size);
+   hypre_CSRMatrix *Ps_ext;
+   
+   double          *Ps_ext_data;
+   HYPRE_Int             *Ps_ext_i;
+   HYPRE_Int             *Ps_ext_j;
 
-   RAP_int_i[num_cols_offd_RT] = RAP_size;
+   double          *P_ext_diag_data = NULL;
+   HYPRE_Int             *P_ext_diag_i = NULL;
+   HYPRE_Int             *P_ext_diag_j = NULL;
+
+   double          *P_ext_offd_data = NULL;
+   HYPRE_Int             *P_ext_offd_i = NULL;
+   HYPRE_Int             *P_ext_offd_j = NULL;
+
+   HYPRE_Int             *col_map_offd_Pext;
+   HYPRE_Int             *map_P_to_Pext = NULL;
+   HYPRE_Int             *map_Pext_to_Pext = NULL;
+   HYPRE_Int             *map_P_to_RAP = NULL;
+   HYPRE_Int             *map_Pext_to_RAP = NULL;
+
+   HYPRE_Int             *P_marker;
+   HYPRE_Int            **P_mark_array;
+   HYPRE_Int            **A_mark_array;
+   HYPRE_Int             *A_marker;
+   HYPRE_Int             *temp;
+
+   HYPRE_Int              n_coarse, n_coarse_RT;
+   HYPRE_Int              square = 1;
+   HYPRE_Int              num_cols_offd_Pext = 0;
+   
+   HYPRE_Int              ic, i, j;
+   HYPRE_Int              i1, i2, i3, ii, ns, ne, size, rest;
+   HYPRE_Int              cnt, cnt_offd, cnt_diag, value;
+   HYPRE_Int              jj1, jj2, jj3;
+   
+   HYPRE_Int             *jj_count;
+   HYPRE_Int              jj_counter, jj_count_offd;
+   HYPRE_Int              jj_row_begining;
+   HYPRE_Int              start_indexing = 0; /* start indexing for RAP_data at 0 */
+   HYPRE_Int              num_nz_cols_A;
+   HYPRE_Int              num_procs;
+   HYPRE_Int              num_threads;
+
+   double           r_entry;
+   double           r_a_product;
+   double           r_a_p_product;
 
    /*-----------------------------------------------------------------------
-    *  Second Pass: Fill in RAP_int_data and RAP_int_j.
+    *  Copy ParCSRMatrix RT into CSRMatrix R so that we have row-wise access 
+    *  to restriction .
+    *-----------------------------------------------------------------------*/
+
+   hypre_MPI_Comm_size(comm,&num_procs);
+   num_threads = hypre_NumThreads();
+
+   if (comm_pkg_RT)
+   {
+        num_recvs_RT = hypre_ParCSRCommPkgNumRecvs(comm_pkg_RT);
+        num_sends_RT = hypre_ParCSRCommPkgNumSends(comm_pkg_RT);
+        send_map_starts_RT =hypre_ParCSRCommPkgSendMapStarts(comm_pkg_RT);
+        send_map_elmts_RT = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_RT);
+   }
+
+   hypre_CSRMatrixTranspose(RT_diag,&R_diag,1); 
+   if (num_cols_offd_RT) 
+   {
+        hypre_CSRMatrixTranspose(RT_offd,&R_offd,1); 
+        R_offd_data = hypre_CSRMatrixData(R_offd);
+        R_offd_i    = hypre_CSRMatrixI(R_offd);
+        R_offd_j    = hypre_CSRMatrixJ(R_offd);
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Get sizes of fine and coarse grids.
+    *-----------------------------------------------------------------------*/
+
+   n_coarse = hypre_ParCSRMatrixGlobalNumCols(P);
+   num_nz_cols_A = num_cols_diag_A + num_cols_offd_A;
+
+   n_coarse_RT = hypre_ParCSRMatrixGlobalNumCols(RT);
+   if (n_coarse != n_coarse_RT)
+      square = 0;
+
+   /*-----------------------------------------------------------------------
+    *  Generate Ps_ext, i.e. portion of P that is stored on neighbor procs
+    *  and needed locally for triple matrix product 
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1) 
+   {
+        Ps_ext = hypre_ParCSRMatrixExtractBExt(P,A,1);
+        Ps_ext_data = hypre_CSRMatrixData(Ps_ext);
+        Ps_ext_i    = hypre_CSRMatrixI(Ps_ext);
+        Ps_ext_j    = hypre_CSRMatrixJ(Ps_ext);
+   }
+
+   P_ext_diag_i = hypre_CTAlloc(HYPRE_Int,num_cols_offd_A+1);
+   P_ext_offd_i = hypre_CTAlloc(HYPRE_Int,num_cols_offd_A+1);
+   P_ext_diag_size = 0;
+   P_ext_offd_size = 0;
+   last_col_diag_P = first_col_diag_P + num_cols_diag_P - 1;
+
+   for (i=0; i < num_cols_offd_A; i++)
+   {
+      for (j=Ps_ext_i[i]; j < Ps_ext_i[i+1]; j++)
+         if (Ps_ext_j[j] < first_col_diag_P || Ps_ext_j[j] > last_col_diag_P)
+            P_ext_offd_size++;
+         else
+            P_ext_diag_size++;
+      P_ext_diag_i[i+1] = P_ext_diag_size;
+      P_ext_offd_i[i+1] = P_ext_offd_size;
+   }
+   
+   if (P_ext_diag_size)
+   {
+      P_ext_diag_j = hypre_CTAlloc(HYPRE_Int, P_ext_diag_size);
+      P_ext_diag_data = hypre_CTAlloc(double, P_ext_diag_size);
+   }
+   if (P_ext_offd_size)
+   {
+      P_ext_offd_j = hypre_CTAlloc(HYPRE_Int, P_ext_offd_size);
+      P_ext_offd_data = hypre_CTAlloc(double, P_ext_offd_size);
+   }
+
+   cnt_offd = 0;
+   cnt_diag = 0;
+   cnt = 0;
+   for (i=0; i < num_cols_offd_A; i++)
+   {
+      for (j=Ps_ext_i[i]; j < Ps_ext_i[i+1]; j++)
+         if (Ps_ext_j[j] < first_col_diag_P || Ps_ext_j[j] > last_col_diag_P)
+         {
+            P_ext_offd_j[cnt_offd] = Ps_ext_j[j];
+            P_ext_offd_data[cnt_offd++] = Ps_ext_data[j];
+         }
+         else
+         {
+            P_ext_diag_j[cnt_diag] = Ps_ext_j[j] - first_col_diag_P;
+            P_ext_diag_data[cnt_diag++] = Ps_ext_data[j];
+         }
+   }
+   if (num_procs > 1) 
+   {
+      hypre_CSRMatrixDestroy(Ps_ext);
+      Ps_ext = NULL;
+   }
+
+   if (P_ext_offd_size || num_cols_offd_P)
+   {
+      temp = hypre_CTAlloc(HYPRE_Int, P_ext_offd_size+num_cols_offd_P);
+      for (i=0; i < P_ext_offd_size; i++)
+         temp[i] = P_ext_offd_j[i];
+      cnt = P_ext_offd_size;
+      for (i=0; i < num_cols_offd_P; i++)
+         temp[cnt++] = col_map_offd_P[i];
+   }
+   if (cnt)
+   {
+      qsort0(temp, 0, cnt-1);
+
+      num_cols_offd_Pext = 1;
+      value = temp[0];
+      for (i=1; i < cnt; i++)
+      {
+         if (temp[i] > value)
+         {
+            value = temp[i];
+            temp[num_cols_offd_Pext++] = value;
+         }
+      }
+   }
+ 
+   if (num_cols_offd_Pext)
+        col_map_offd_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_Pext);
+
+   for (i=0; i < num_cols_offd_Pext; i++)
+      col_map_offd_Pext[i] = temp[i];
+
+   if (P_ext_offd_size || num_cols_offd_P)
+      hypre_TFree(temp);
+
+   for (i=0 ; i < P_ext_offd_size; i++)
+      P_ext_offd_j[i] = hypre_BinarySearch(col_map_offd_Pext,
+                                           P_ext_offd_j[i],
+                                           num_cols_offd_Pext);
+   if (num_cols_offd_P)
+   {
+      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_P);
+
+      cnt = 0;
+      for (i=0; i < num_cols_offd_Pext; i++)
+         if (col_map_offd_Pext[i] == col_map_offd_P[cnt])
+         {
+            map_P_to_Pext[cnt++] = i;
+            if (cnt == num_cols_offd_P) break;
+         }
+   }
+
+   /*-----------------------------------------------------------------------
+    *  First Pass: Determine size of RAP_int and set up RAP_int_i if there 
+    *  are more than one processor and nonzero elements in R_offd
     *-----------------------------------------------------------------------*/
 
+  P_mark_array = hypre_CTAlloc(HYPRE_Int *, num_threads);
+  A_mark_array = hypre_CTAlloc(HYPRE_Int *, num_threads);
+
+  if (num_cols_offd_RT)
+  {
+   jj_count = hypre_CTAlloc(HYPRE_Int, num_threads);
+
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
@@ -746,17 +1340,23 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
         ns = ii*size+rest;
         ne = (ii+1)*size+rest;
      }
-
+   
    /*-----------------------------------------------------------------------
-    *  Initialize some stuff.
+    *  Allocate marker arrays.
     *-----------------------------------------------------------------------*/
+
    if (num_cols_offd_Pext || num_cols_diag_P)
+   {
+      P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_cols_diag_P+num_cols_offd_Pext);
       P_marker = P_mark_array[ii];
+   }
+   A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_nz_cols_A);
    A_marker = A_mark_array[ii];
+   /*-----------------------------------------------------------------------
+    *  Initialize some stuff.
+    *-----------------------------------------------------------------------*/
 
    jj_counter = start_indexing;
-   if (ii > 0) jj_counter = jj_count[ii-1];
-
    for (ic = 0; ic < num_cols_diag_P+num_cols_offd_Pext; ic++)
    {      
       P_marker[ic] = -1;
@@ -765,16 +1365,15 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
    {      
       A_marker[i] = -1;
    }   
-   
+
    /*-----------------------------------------------------------------------
-    *  Loop over exterior c-points.
+    *  Loop over exterior c-points
     *-----------------------------------------------------------------------*/
     
    for (ic = ns; ic < ne; ic++)
    {
       
       jj_row_begining = jj_counter;
-      RAP_int_i[ic] = jj_counter;
 
       /*--------------------------------------------------------------------
        *  Loop over entries in row ic of R_offd.
@@ -783,7 +1382,6 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
       for (jj1 = R_offd_i[ic]; jj1 < R_offd_i[ic+1]; jj1++)
       {
          i1  = R_offd_j[jj1];
-         r_entry = R_offd_data[jj1];
 
          /*-----------------------------------------------------------------
           *  Loop over entries in row i1 of A_offd.
@@ -792,8 +1390,7 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
          for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
          {
             i2 = A_offd_j[jj2];
-            r_a_product = r_entry * A_offd_data[jj2];
-            
+
             /*--------------------------------------------------------------
              *  Check A_marker to see if point i2 has been previously
              *  visited. New entries in RAP only occur from unmarked points.
@@ -815,56 +1412,261 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
                for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
                {
                   i3 = P_ext_diag_j[jj3];
-                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
                   
                   /*--------------------------------------------------------
                    *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
+                   *  been accounted for. If it has not, mark it and increment
+                   *  counter.
                    *--------------------------------------------------------*/
 
                   if (P_marker[i3] < jj_row_begining)
                   {
                      P_marker[i3] = jj_counter;
-                     RAP_int_data[jj_counter] = r_a_p_product;
-                     RAP_int_j[jj_counter] = i3 + first_col_diag_P;
                      jj_counter++;
                   }
-                  else
-                  {
-                     RAP_int_data[P_marker[i3]] += r_a_p_product;
-                  }
                }
-
                for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
                {
                   i3 = P_ext_offd_j[jj3] + num_cols_diag_P;
-                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
                   
                   /*--------------------------------------------------------
                    *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
+                   *  been accounted for. If it has not, mark it and increment
+                   *  counter.
                    *--------------------------------------------------------*/
 
                   if (P_marker[i3] < jj_row_begining)
                   {
                      P_marker[i3] = jj_counter;
-                     RAP_int_data[jj_counter] = r_a_p_product;
-                     RAP_int_j[jj_counter] 
-                                = col_map_offd_Pext[i3-num_cols_diag_P];
                      jj_counter++;
                   }
-                  else
-                  {
-                     RAP_int_data[P_marker[i3]] += r_a_p_product;
-                  }
                }
             }
+         }
+         /*-----------------------------------------------------------------
+          *  Loop over entries in row i1 of A_diag.
+          *-----------------------------------------------------------------*/
+         
+         for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
+         {
+            i2 = A_diag_j[jj2];
 
             /*--------------------------------------------------------------
-             *  If i2 is previously visited ( A_marker[12]=ic ) it yields
-             *  no new entries in RAP and can just add new contributions.
+             *  Check A_marker to see if point i2 has been previously
+             *  visited. New entries in RAP only occur from unmarked points.
+             *--------------------------------------------------------------*/
+
+            if (A_marker[i2+num_cols_offd_A] != ic)
+            {
+
+               /*-----------------------------------------------------------
+                *  Mark i2 as visited.
+                *-----------------------------------------------------------*/
+
+               A_marker[i2+num_cols_offd_A] = ic;
+               
+               /*-----------------------------------------------------------
+                *  Loop over entries in row i2 of P_diag.
+                *-----------------------------------------------------------*/
+
+               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
+               {
+                  i3 = P_diag_j[jj3];
+                  
+                  /*--------------------------------------------------------
+                   *  Check P_marker to see that RAP_{ic,i3} has not already
+                   *  been accounted for. If it has not, mark it and increment
+                   *  counter.
+                   *--------------------------------------------------------*/
+
+                  if (P_marker[i3] < jj_row_begining)
+                  {
+                     P_marker[i3] = jj_counter;
+                     jj_counter++;
+                  }
+               }
+               /*-----------------------------------------------------------
+                *  Loop over entries in row i2 of P_offd.
+                *-----------------------------------------------------------*/
+
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_to_Pext[P_offd_j[jj3]] + num_cols_diag_P;
+                  
+                  /*--------------------------------------------------------
+                   *  Check P_marker to see that RAP_{ic,i3} has not already
+                   *  been accounted for. If it has not, mark it and increment
+                   *  counter.
+                   *--------------------------------------------------------*/
+
+                  if (P_marker[i3] < jj_row_begining)
+                  {
+                     P_marker[i3] = jj_counter;
+                     jj_counter++;
+                  }
+               }
+            }
+         }
+      }
+    }
+
+    jj_count[ii] = jj_counter;
+
+   }
+  
+   /*-----------------------------------------------------------------------
+    *  Allocate RAP_int_data and RAP_int_j arrays.
+    *-----------------------------------------------------------------------*/
+   for (i = 0; i < num_threads-1; i++)
+      jj_count[i+1] += jj_count[i];
+    
+   RAP_size = jj_count[num_threads-1];
+   RAP_int_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_RT+1);
+   RAP_int_data = hypre_CTAlloc(double, RAP_size);
+   RAP_int_j    = hypre_CTAlloc(HYPRE_Int, RAP_size);
+
+   RAP_int_i[num_cols_offd_RT] = RAP_size;
+
+   /*-----------------------------------------------------------------------
+    *  Second Pass: Fill in RAP_int_data and RAP_int_j.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+     size = num_cols_offd_RT/num_threads;
+     rest = num_cols_offd_RT - size*num_threads;
+     if (ii < rest)
+     {
+        ns = ii*size+ii;
+        ne = (ii+1)*size+ii+1;
+     }
+     else
+     {
+        ns = ii*size+rest;
+        ne = (ii+1)*size+rest;
+     }
+
+   /*-----------------------------------------------------------------------
+    *  Initialize some stuff.
+    *-----------------------------------------------------------------------*/
+   if (num_cols_offd_Pext || num_cols_diag_P)
+      P_marker = P_mark_array[ii];
+   A_marker = A_mark_array[ii];
+
+   jj_counter = start_indexing;
+   if (ii > 0) jj_counter = jj_count[ii-1];
+
+   for (ic = 0; ic < num_cols_diag_P+num_cols_offd_Pext; ic++)
+   {      
+      P_marker[ic] = -1;
+   }
+   for (i = 0; i < num_nz_cols_A; i++)
+   {      
+      A_marker[i] = -1;
+   }   
+   
+   /*-----------------------------------------------------------------------
+    *  Loop over exterior c-points.
+    *-----------------------------------------------------------------------*/
+    
+   for (ic = ns; ic < ne; ic++)
+   {
+      
+      jj_row_begining = jj_counter;
+      RAP_int_i[ic] = jj_counter;
+
+      /*--------------------------------------------------------------------
+       *  Loop over entries in row ic of R_offd.
+       *--------------------------------------------------------------------*/
+   
+      for (jj1 = R_offd_i[ic]; jj1 < R_offd_i[ic+1]; jj1++)
+      {
+         i1  = R_offd_j[jj1];
+         r_entry = R_offd_data[jj1];
+
+         /*-----------------------------------------------------------------
+          *  Loop over entries in row i1 of A_offd.
+          *-----------------------------------------------------------------*/
+         
+         for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
+         {
+            i2 = A_offd_j[jj2];
+            r_a_product = r_entry * A_offd_data[jj2];
+            
+            /*--------------------------------------------------------------
+             *  Check A_marker to see if point i2 has been previously
+             *  visited. New entries in RAP only occur from unmarked points.
+             *--------------------------------------------------------------*/
+
+            if (A_marker[i2] != ic)
+            {
+
+               /*-----------------------------------------------------------
+                *  Mark i2 as visited.
+                *-----------------------------------------------------------*/
+
+               A_marker[i2] = ic;
+               
+               /*-----------------------------------------------------------
+                *  Loop over entries in row i2 of P_ext.
+                *-----------------------------------------------------------*/
+
+               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_diag_j[jj3];
+                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
+                  
+                  /*--------------------------------------------------------
+                   *  Check P_marker to see that RAP_{ic,i3} has not already
+                   *  been accounted for. If it has not, create a new entry.
+                   *  If it has, add new contribution.
+                   *--------------------------------------------------------*/
+
+                  if (P_marker[i3] < jj_row_begining)
+                  {
+                     P_marker[i3] = jj_counter;
+                     RAP_int_data[jj_counter] = r_a_p_product;
+                     RAP_int_j[jj_counter] = i3 + first_col_diag_P;
+                     jj_counter++;
+                  }
+                  else
+                  {
+                     RAP_int_data[P_marker[i3]] += r_a_p_product;
+                  }
+               }
+
+               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_offd_j[jj3] + num_cols_diag_P;
+                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
+                  
+                  /*--------------------------------------------------------
+                   *  Check P_marker to see that RAP_{ic,i3} has not already
+                   *  been accounted for. If it has not, create a new entry.
+                   *  If it has, add new contribution.
+                   *--------------------------------------------------------*/
+
+                  if (P_marker[i3] < jj_row_begining)
+                  {
+                     P_marker[i3] = jj_counter;
+                     RAP_int_data[jj_counter] = r_a_p_product;
+                     RAP_int_j[jj_counter] 
+                                = col_map_offd_Pext[i3-num_cols_diag_P];
+                     jj_counter++;
+                  }
+                  else
+                  {
+                     RAP_int_data[P_marker[i3]] += r_a_p_product;
+                  }
+               }
+            }
+
+            /*--------------------------------------------------------------
+             *  If i2 is previously visited ( A_marker[12]=ic ) it yields
+             *  no new entries in RAP and can just add new contributions.
              *--------------------------------------------------------------*/
 
             else
@@ -995,10 +1797,88 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
    hypre_TFree(jj_count);
   }
 
+   /*-----------------------------------------------------------------------
+    *  Interior rows which receive rows of RAP_ext (see hypre_RAPInteriorData)
+    *-----------------------------------------------------------------------*/
+
+   if (num_sends_RT)
+   {
+      num_ext_rows = send_map_starts_RT[num_sends_RT];
+      ext_row_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_RT+1);
+      ext_row_j = hypre_CTAlloc(HYPRE_Int, num_ext_rows);
+      for (j = 0; j < num_ext_rows; j++)
+         ext_row_i[send_map_elmts_RT[j]+1]++;
+      for (ic = 0; ic < num_cols_diag_RT; ic++)
+         ext_row_i[ic+1] += ext_row_i[ic];
+      for (j = 0; j < num_ext_rows; j++)
+         ext_row_j[ext_row_i[send_map_elmts_RT[j]]++] = j;
+      for (ic = num_cols_diag_RT; ic > 0; ic--)
+         ext_row_i[ic] = ext_row_i[ic-1];
+      ext_row_i[0] = 0;
+   }
+
+   rd.R_diag_i = hypre_CSRMatrixI(R_diag);
+   rd.R_diag_j = hypre_CSRMatrixJ(R_diag);
+   rd.R_diag_data = hypre_CSRMatrixData(R_diag);
+   rd.A_diag_i = A_diag_i;
+   rd.A_diag_j = A_diag_j;
+   rd.A_diag_data = A_diag_data;
+   rd.A_offd_i = A_offd_i;
+   rd.A_offd_j = A_offd_j;
+   rd.A_offd_data = A_offd_data;
+   rd.num_cols_offd_A = num_cols_offd_A;
+   rd.P_diag_i = P_diag_i;
+   rd.P_diag_j = P_diag_j;
+   rd.P_diag_data = P_diag_data;
+   rd.P_offd_i = P_offd_i;
+   rd.P_offd_j = P_offd_j;
+   rd.P_offd_data = P_offd_data;
+   rd.num_cols_diag_P = num_cols_diag_P;
+   rd.num_cols_offd_P = num_cols_offd_P;
+   rd.P_ext_diag_i = P_ext_diag_i;
+   rd.P_ext_diag_j = P_ext_diag_j;
+   rd.P_ext_diag_data = P_ext_diag_data;
+   rd.P_ext_offd_i = P_ext_offd_i;
+   rd.P_ext_offd_j = P_ext_offd_j;
+   rd.P_ext_offd_data = P_ext_offd_data;
+   rd.ext_row_i = ext_row_i;
+   rd.ext_row_j = ext_row_j;
+   rd.RAP_ext_i = NULL;
+   rd.RAP_ext_j = NULL;
+   rd.RAP_ext_data = NULL;
+   rd.square = square;
+
+   RAP_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_RT+1);
+   RAP_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_RT+1);
+
+   /*-----------------------------------------------------------------------
+    *  Send the rows of RAP_int to their owners.  While the messages are in
+    *  transit, determine the row lengths of the interior rows which do not
+    *  receive rows of RAP_ext; these are computed in the column space of
+    *  P_ext, whose off-processor columns are a subset of those of RAP.
+    *-----------------------------------------------------------------------*/
+
    RAP_ext_size = 0;
+   if (num_sends_RT || num_recvs_RT)
+        RAP_ext = hypre_ExchangeRAPDataBegin(RAP_int, comm_pkg_RT,
+                                             &exchange_handle);
+
+   if (num_cols_offd_Pext)
+   {
+      map_Pext_to_Pext = hypre_CTAlloc(HYPRE_Int, num_cols_offd_Pext);
+      for (i = 0; i < num_cols_offd_Pext; i++)
+         map_Pext_to_Pext[i] = i;
+   }
+   hypre_RAPInteriorRows(&rd, 0, rap_accum_type, num_cols_diag_RT,
+                         num_cols_offd_Pext, num_nz_cols_A,
+                         map_P_to_Pext, map_Pext_to_Pext,
+                         RAP_diag_i, NULL, NULL, RAP_offd_i, NULL, NULL);
+   if (num_cols_offd_Pext)
+      hypre_TFree(map_Pext_to_Pext);
+
    if (num_sends_RT || num_recvs_RT)
    {
-        RAP_ext = hypre_ExchangeRAPData(RAP_int,comm_pkg_RT);
+        hypre_ExchangeRAPDataEnd(&exchange_handle);
         RAP_ext_i = hypre_CSRMatrixI(RAP_ext);
         RAP_ext_j = hypre_CSRMatrixJ(RAP_ext);
         RAP_ext_data = hypre_CSRMatrixData(RAP_ext);
@@ -1010,9 +1890,6 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
       RAP_int = NULL;
    }
  
-   RAP_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_RT+1);
-   RAP_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_RT+1);
-
    first_col_diag_RAP = first_col_diag_P;
    last_col_diag_RAP = first_col_diag_P + num_cols_diag_P - 1;
 
@@ -1096,719 +1973,739 @@ hypre_BoomerAMGBuildCoarseOperator( hypre_ParCSRMatrix  *RT,
       else
             RAP_ext_j[i] -= first_col_diag_RAP;
 
-/*   need to allocate new P_marker etc. and make further changes */
+   rd.RAP_ext_i = RAP_ext_i;
+   rd.RAP_ext_j = RAP_ext_j;
+   rd.RAP_ext_data = RAP_ext_data;
+
    /*-----------------------------------------------------------------------
-    *  Initialize some stuff.
+    *  Row lengths of the interior rows which receive rows of RAP_ext.
     *-----------------------------------------------------------------------*/
-   jj_cnt_diag = hypre_CTAlloc(HYPRE_Int, num_threads);
-   jj_cnt_offd = hypre_CTAlloc(HYPRE_Int, num_threads);
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
-#endif
-   for (ii = 0; ii < num_threads; ii++)
-   {
-     size = num_cols_diag_RT/num_threads;
-     rest = num_cols_diag_RT - size*num_threads;
-     if (ii < rest)
-     {
-        ns = ii*size+ii;
-        ne = (ii+1)*size+ii+1;
-     }
-     else
-     {
-        ns = ii*size+rest;
-        ne = (ii+1)*size+rest;
-     }
 
-   P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_cols_diag_P+num_cols_offd_RAP);
-   A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int, num_nz_cols_A);
-   P_marker = P_mark_array[ii];
-   A_marker = A_mark_array[ii];
-   jj_count_diag = start_indexing;
-   jj_count_offd = start_indexing;
+   if (ext_row_i)
+      hypre_RAPInteriorRows(&rd, 1, rap_accum_type, num_cols_diag_RT,
+                            num_cols_offd_RAP, num_nz_cols_A,
+                            map_P_to_RAP, map_Pext_to_RAP,
+                            RAP_diag_i, NULL, NULL, RAP_offd_i, NULL, NULL);
 
-   for (ic = 0; ic < num_cols_diag_P+num_cols_offd_RAP; ic++)
-   {      
-      P_marker[ic] = -1;
+   for (ic = 0; ic < num_cols_diag_RT; ic++)
+   {
+      RAP_diag_i[ic+1] += RAP_diag_i[ic];
+      RAP_offd_i[ic+1] += RAP_offd_i[ic];
    }
-   for (i = 0; i < num_nz_cols_A; i++)
-   {      
-      A_marker[i] = -1;
-   }   
+ 
+   /*-----------------------------------------------------------------------
+    *  Allocate RAP_diag_data and RAP_diag_j arrays.
+    *  Allocate RAP_offd_data and RAP_offd_j arrays.
+    *-----------------------------------------------------------------------*/
+ 
+   RAP_diag_size = RAP_diag_i[num_cols_diag_RT];
+   if (RAP_diag_size)
+   { 
+      RAP_diag_data = hypre_CTAlloc(double, RAP_diag_size);
+      RAP_diag_j    = hypre_CTAlloc(HYPRE_Int, RAP_diag_size);
+   } 
+ 
+   RAP_offd_size = RAP_offd_i[num_cols_diag_RT];
+   if (RAP_offd_size)
+   { 
+        RAP_offd_data = hypre_CTAlloc(double, RAP_offd_size);
+        RAP_offd_j    = hypre_CTAlloc(HYPRE_Int, RAP_offd_size);
+   } 
 
    /*-----------------------------------------------------------------------
-    *  Loop over interior c-points.
+    *  Second Pass: Fill in RAP_diag_data and RAP_diag_j.
+    *  Second Pass: Fill in RAP_offd_data and RAP_offd_j.
     *-----------------------------------------------------------------------*/
-   
-   for (ic = ns; ic < ne; ic++)
+
+   hypre_RAPInteriorRows(&rd, 2, rap_accum_type, num_cols_diag_RT,
+                         num_cols_offd_RAP, num_nz_cols_A,
+                         map_P_to_RAP, map_Pext_to_RAP,
+                         RAP_diag_i, RAP_diag_j, RAP_diag_data,
+                         RAP_offd_i, RAP_offd_j, RAP_offd_data);
+
+   if (num_sends_RT)
    {
-      
-      /*--------------------------------------------------------------------
-       *  Set marker for diagonal entry, RAP_{ic,ic}. and for all points
-       *  being added to row ic of RAP_diag and RAP_offd through RAP_ext
-       *--------------------------------------------------------------------*/
+      hypre_TFree(ext_row_i);
+      hypre_TFree(ext_row_j);
+   }
 
-      jj_row_begin_diag = jj_count_diag;
-      jj_row_begin_offd = jj_count_offd;
+   if (RAP_offd_size == 0 && num_cols_offd_RAP != 0)
+   {
+      num_cols_offd_RAP = 0;
+      hypre_TFree(col_map_offd_RAP);
+   }
 
-      if (square)
-         P_marker[ic] = jj_count_diag++;
 
-      for (i=0; i < num_sends_RT; i++)
-        for (j = send_map_starts_RT[i]; j < send_map_starts_RT[i+1]; j++)
-            if (send_map_elmts_RT[j] == ic)
-            {
-                for (k=RAP_ext_i[j]; k < RAP_ext_i[j+1]; k++)
-                {
-                   jcol = RAP_ext_j[k];
-                   if (jcol < num_cols_diag_P)
-                   {
-                        if (P_marker[jcol] < jj_row_begin_diag)
-                        {
-                                P_marker[jcol] = jj_count_diag;
-                                jj_count_diag++;
-                        }
-                   }
-                   else
-                   {
-                        if (P_marker[jcol] < jj_row_begin_offd)
-                        {
-                                P_marker[jcol] = jj_count_offd;
-                                jj_count_offd++;
-                        }
-                   }
-                }
-                break;
-            }
- 
-      /*--------------------------------------------------------------------
-       *  Loop over entries in row ic of R_diag.
-       *--------------------------------------------------------------------*/
-   
-      for (jj1 = R_diag_i[ic]; jj1 < R_diag_i[ic+1]; jj1++)
+   /* check if really all off-diagonal entries occurring in col_map_offd_RAP
+	are represented and eliminate if necessary */
+
+   P_marker = hypre_CTAlloc(HYPRE_Int,num_cols_offd_RAP);
+   for (i=0; i < num_cols_offd_RAP; i++)
+      P_marker[i] = -1;
+
+   jj_count_offd = 0;
+   for (i=0; i < RAP_offd_size; i++)
+   {
+      i3 = RAP_offd_j[i];
+      if (P_marker[i3])
       {
-         i1  = R_diag_j[jj1];
- 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_offd.
-          *-----------------------------------------------------------------*/
-         
-         if (num_cols_offd_A)
+	 P_marker[i3] = 0;
+	 jj_count_offd++;
+      }
+   }
+
+   if (jj_count_offd < num_cols_offd_RAP)
+   {
+      new_col_map_offd_RAP = hypre_CTAlloc(HYPRE_Int,jj_count_offd);
+      jj_counter = 0;
+      for (i=0; i < num_cols_offd_RAP; i++)
+         if (!P_marker[i]) 
          {
-           for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
-           {
-            i2 = A_offd_j[jj2];
- 
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
- 
-            if (A_marker[i2] != ic)
-            {
- 
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
- 
-               A_marker[i2] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_ext.
-                *-----------------------------------------------------------*/
+	    P_marker[i] = jj_counter;
+	    new_col_map_offd_RAP[jj_counter++] = col_map_offd_RAP[i];
+         }
  
-               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
-               {
-                  i3 = P_ext_diag_j[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+      for (i=0; i < RAP_offd_size; i++)
+      {
+	 i3 = RAP_offd_j[i];
+	 RAP_offd_j[i] = P_marker[i3];
+      }
+      
+      num_cols_offd_RAP = jj_count_offd;
+      hypre_TFree(col_map_offd_RAP);
+      col_map_offd_RAP = new_col_map_offd_RAP;
+   }
+   hypre_TFree(P_marker);
 
-                  if (P_marker[i3] < jj_row_begin_diag)
-                  {
-                     P_marker[i3] = jj_count_diag;
-                     jj_count_diag++;
-                  }
-               }
-               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
-               {
-                  i3 = map_Pext_to_RAP[P_ext_offd_j[jj3]]+num_cols_diag_P;
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
+   RAP = hypre_ParCSRMatrixCreate(comm, n_coarse_RT, n_coarse,
+                                  RT_partitioning, coarse_partitioning,
+                                  num_cols_offd_RAP, RAP_diag_size,
+                                  RAP_offd_size);
 
-                  if (P_marker[i3] < jj_row_begin_offd)
-                  {
-                     P_marker[i3] = jj_count_offd;
-                     jj_count_offd++;
-                  }
-               }
-            }
-           }
-         }
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_diag.
-          *-----------------------------------------------------------------*/
-         
-         for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
-         {
-            i2 = A_diag_j[jj2];
- 
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
- 
-            if (A_marker[i2+num_cols_offd_A] != ic)
-            {
- 
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
- 
-               A_marker[i2+num_cols_offd_A] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_diag.
-                *-----------------------------------------------------------*/
- 
-               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
-               {
-                  i3 = P_diag_j[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
- 
-                  if (P_marker[i3] < jj_row_begin_diag)
-                  {
-                     P_marker[i3] = jj_count_diag;
-                     jj_count_diag++;
-                  }
-               }
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_offd.
-                *-----------------------------------------------------------*/
+/* Have RAP own coarse_partitioning instead of P */
+   hypre_ParCSRMatrixSetColStartsOwner(P,0);
+   hypre_ParCSRMatrixSetColStartsOwner(RT,0);
 
-               if (num_cols_offd_P)
-               { 
-                 for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
-                 {
-                  i3 = map_P_to_RAP[P_offd_j[jj3]] + num_cols_diag_P;
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, mark it and increment
-                   *  counter.
-                   *--------------------------------------------------------*/
- 
-                  if (P_marker[i3] < jj_row_begin_offd)
-                  {
-                     P_marker[i3] = jj_count_offd;
-                     jj_count_offd++;
-                  }
-                 }
-               } 
-            }
-         }
-      }
-            
-      /*--------------------------------------------------------------------
-       * Set RAP_diag_i and RAP_offd_i for this row.
-       *--------------------------------------------------------------------*/
-/* 
-      RAP_diag_i[ic] = jj_row_begin_diag;
-      RAP_offd_i[ic] = jj_row_begin_offd;
-*/      
-    }
-    jj_cnt_diag[ii] = jj_count_diag;
-    jj_cnt_offd[ii] = jj_count_offd;
+   RAP_diag = hypre_ParCSRMatrixDiag(RAP);
+   hypre_CSRMatrixI(RAP_diag) = RAP_diag_i; 
+   if (RAP_diag_size)
+   {
+      hypre_CSRMatrixData(RAP_diag) = RAP_diag_data; 
+      hypre_CSRMatrixJ(RAP_diag) = RAP_diag_j; 
+   }
+
+   RAP_offd = hypre_ParCSRMatrixOffd(RAP);
+   hypre_CSRMatrixI(RAP_offd) = RAP_offd_i; 
+   if (num_cols_offd_RAP)
+   {
+        hypre_CSRMatrixData(RAP_offd) = RAP_offd_data; 
+        hypre_CSRMatrixJ(RAP_offd) = RAP_offd_j; 
+        hypre_ParCSRMatrixColMapOffd(RAP) = col_map_offd_RAP;
+   }
+   if (num_procs > 1)
+   {
+        /* hypre_GenerateRAPCommPkg(RAP, A); */
+        hypre_MatvecCommPkgCreate(RAP); 
+   }
+
+   *RAP_ptr = RAP;
+
+   /*-----------------------------------------------------------------------
+    *  Free R, P_ext and marker arrays.
+    *-----------------------------------------------------------------------*/
+
+   hypre_CSRMatrixDestroy(R_diag);
+   R_diag = NULL;
+
+   if (num_cols_offd_RT) 
+   {
+      hypre_CSRMatrixDestroy(R_offd);
+      R_offd = NULL;
+   }
+
+   if (num_sends_RT || num_recvs_RT) 
+   {
+      hypre_CSRMatrixDestroy(RAP_ext);
+      RAP_ext = NULL;
+   }
+   hypre_TFree(P_mark_array);   
+   hypre_TFree(A_mark_array);
+   hypre_TFree(P_ext_diag_i);
+   hypre_TFree(P_ext_offd_i);
+   if (num_cols_offd_P)
+   {
+      hypre_TFree(map_P_to_Pext);
+      hypre_TFree(map_P_to_RAP);
+   }
+   if (num_cols_offd_Pext)
+   {
+      hypre_TFree(col_map_offd_Pext);
+      hypre_TFree(map_Pext_to_RAP);
+   }
+   if (P_ext_diag_size)
+   {
+      hypre_TFree(P_ext_diag_data);
+      hypre_TFree(P_ext_diag_j);
    }
-
-   for (i=0; i < num_threads-1; i++)
+   if (P_ext_offd_size)
    {
-      jj_cnt_diag[i+1] += jj_cnt_diag[i];
-      jj_cnt_offd[i+1] += jj_cnt_offd[i];
+      hypre_TFree(P_ext_offd_data);
+      hypre_TFree(P_ext_offd_j);
    }
+   return(0);
+   
+}            
 
-   jj_count_diag = jj_cnt_diag[num_threads-1];
-   jj_count_offd = jj_cnt_offd[num_threads-1];
 
-   RAP_diag_i[num_cols_diag_RT] = jj_count_diag;
-   RAP_offd_i[num_cols_diag_RT] = jj_count_offd;
- 
-   /*-----------------------------------------------------------------------
-    *  Allocate RAP_diag_data and RAP_diag_j arrays.
-    *  Allocate RAP_offd_data and RAP_offd_j arrays.
-    *-----------------------------------------------------------------------*/
- 
-   RAP_diag_size = jj_count_diag;
-   if (RAP_diag_size)
-   { 
-      RAP_diag_data = hypre_CTAlloc(double, RAP_diag_size);
-      RAP_diag_j    = hypre_CTAlloc(HYPRE_Int, RAP_diag_size);
-   } 
- 
-   RAP_offd_size = jj_count_offd;
-   if (RAP_offd_size)
-   { 
-        RAP_offd_data = hypre_CTAlloc(double, RAP_offd_size);
-        RAP_offd_j    = hypre_CTAlloc(HYPRE_Int, RAP_offd_size);
-   } 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorNumeric
+ *
+ * Recomputes the values of RAP = RT^T * A * P for an RAP that has been
+ * generated by hypre_BoomerAMGBuildCoarseOperator, keeping its sparsity
+ * pattern, column map and communication package.  This is the numeric
+ * phase only: no memory is allocated for RAP and no new entries are
+ * created.  Entries of the stored pattern which do not occur in the new
+ * product are set to zero.
+ *
+ * On return, *num_missing_ptr contains the global number of nonzeros of
+ * the product which are not part of the stored pattern (summed over all
+ * processors).  If it is nonzero, the values of RAP are not the Galerkin
+ * product, and RAP has to be rebuilt by hypre_BoomerAMGBuildCoarseOperator.
+ *--------------------------------------------------------------------------*/
 
-   if (RAP_offd_size == 0 && num_cols_offd_RAP != 0)
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorNumeric( hypre_ParCSRMatrix  *RT,
+                                           hypre_ParCSRMatrix  *A,
+                                           hypre_ParCSRMatrix  *P,
+                                           hypre_ParCSRMatrix  *RAP,
+                                           HYPRE_Int           *num_missing_ptr )
+{
+   MPI_Comm        comm = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix *RT_diag = hypre_ParCSRMatrixDiag(RT);
+   hypre_CSRMatrix *RT_offd = hypre_ParCSRMatrixOffd(RT);
+   HYPRE_Int             num_cols_diag_RT = hypre_CSRMatrixNumCols(RT_diag);
+   HYPRE_Int             num_cols_offd_RT = hypre_CSRMatrixNumCols(RT_offd);
+   HYPRE_Int             num_rows_offd_RT = hypre_CSRMatrixNumRows(RT_offd);
+   hypre_ParCSRCommPkg   *comm_pkg_RT = hypre_ParCSRMatrixCommPkg(RT);
+   HYPRE_Int             num_recvs_RT = 0;
+   HYPRE_Int             num_sends_RT = 0;
+   HYPRE_Int             *send_map_starts_RT = NULL;
+   HYPRE_Int             *send_map_elmts_RT = NULL;
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   double          *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int             *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int             *A_diag_j = hypre_CSRMatrixJ(A_diag);
+
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   double          *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int             *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int             *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int              num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+   double          *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int             *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int             *P_diag_j = hypre_CSRMatrixJ(P_diag);
+
+   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int             *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
+   double          *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int             *P_offd_i = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int             *P_offd_j = hypre_CSRMatrixJ(P_offd);
+
+   HYPRE_Int  first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_Int  last_col_diag_P;
+   HYPRE_Int  num_cols_diag_P = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int  num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_CSRMatrix *RAP_diag = hypre_ParCSRMatrixDiag(RAP);
+   double          *RAP_diag_data = hypre_CSRMatrixData(RAP_diag);
+   HYPRE_Int             *RAP_diag_i = hypre_CSRMatrixI(RAP_diag);
+   HYPRE_Int             *RAP_diag_j = hypre_CSRMatrixJ(RAP_diag);
+
+   hypre_CSRMatrix *RAP_offd = hypre_ParCSRMatrixOffd(RAP);
+   double          *RAP_offd_data = hypre_CSRMatrixData(RAP_offd);
+   HYPRE_Int             *RAP_offd_i = hypre_CSRMatrixI(RAP_offd);
+   HYPRE_Int             *RAP_offd_j = hypre_CSRMatrixJ(RAP_offd);
+   HYPRE_Int              num_cols_offd_RAP = hypre_CSRMatrixNumCols(RAP_offd);
+   HYPRE_Int             *col_map_offd_RAP = hypre_ParCSRMatrixColMapOffd(RAP);
+
+   hypre_CSRMatrix *R_diag;
+   double          *R_diag_data;
+   HYPRE_Int             *R_diag_i;
+   HYPRE_Int             *R_diag_j;
+
+   hypre_CSRMatrix *R_offd = NULL;
+   double          *R_offd_data = NULL;
+   HYPRE_Int             *R_offd_i = NULL;
+   HYPRE_Int             *R_offd_j = NULL;
+
+   hypre_CSRMatrix *Ps_ext = NULL;
+   double          *Ps_ext_data = NULL;
+   HYPRE_Int             *Ps_ext_i = NULL;
+   HYPRE_Int             *Ps_ext_j = NULL;
+
+   HYPRE_Int             *P_ext_i = NULL;
+   HYPRE_Int             *P_ext_j = NULL;
+   double          *P_ext_data = NULL;
+   HYPRE_Int              P_ext_size = 0;
+
+   hypre_CSRMatrix *RAP_int = NULL;
+   double          *RAP_int_data = NULL;
+   HYPRE_Int             *RAP_int_i = NULL;
+   HYPRE_Int             *RAP_int_j = NULL;
+   HYPRE_Int              RAP_int_size = 0;
+
+   hypre_CSRMatrix *RAP_ext = NULL;
+   double          *RAP_ext_data = NULL;
+   HYPRE_Int             *RAP_ext_i = NULL;
+   HYPRE_Int             *RAP_ext_j = NULL;
+
+   HYPRE_Int             *col_map_offd_Pext = NULL;
+   HYPRE_Int              num_cols_offd_Pext = 0;
+   HYPRE_Int             *map_P_to_Pext = NULL;
+   HYPRE_Int             *map_RAP_to_Pext = NULL;
+   HYPRE_Int             *temp;
+
+   HYPRE_Int             *P_marker;
+   HYPRE_Int              num_cols_Pext;
+   HYPRE_Int              first_col_diag_RAP, last_col_diag_RAP;
+
+   HYPRE_Int              ic, i, j, k, i1, i2, i3, jj1, jj2, jj3, jcol;
+   HYPRE_Int              ii, ns, ne, size, rest, cnt, value;
+   HYPRE_Int              jj_counter, jj_row_begining;
+   HYPRE_Int              num_missing = 0, num_missing_local = 0;
+   HYPRE_Int              num_procs, num_threads;
+
+   double           r_entry, r_a_product;
+
+   hypre_MPI_Comm_size(comm,&num_procs);
+   num_threads = hypre_NumThreads();
+
+   if (comm_pkg_RT)
    {
-      num_cols_offd_RAP = 0;
-      hypre_TFree(col_map_offd_RAP);
+      num_recvs_RT = hypre_ParCSRCommPkgNumRecvs(comm_pkg_RT);
+      num_sends_RT = hypre_ParCSRCommPkgNumSends(comm_pkg_RT);
+      send_map_starts_RT = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_RT);
+      send_map_elmts_RT = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_RT);
    }
-   /*-----------------------------------------------------------------------
-    *  Second Pass: Fill in RAP_diag_data and RAP_diag_j.
-    *  Second Pass: Fill in RAP_offd_data and RAP_offd_j.
-    *-----------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
-#endif
-   for (ii = 0; ii < num_threads; ii++)
+   hypre_CSRMatrixTranspose(RT_diag,&R_diag,1); 
+   R_diag_data = hypre_CSRMatrixData(R_diag);
+   R_diag_i    = hypre_CSRMatrixI(R_diag);
+   R_diag_j    = hypre_CSRMatrixJ(R_diag);
+   if (num_cols_offd_RT) 
    {
-     size = num_cols_diag_RT/num_threads;
-     rest = num_cols_diag_RT - size*num_threads;
-     if (ii < rest)
-     {
-        ns = ii*size+ii;
-        ne = (ii+1)*size+ii+1;
-     }
-     else
-     {
-        ns = ii*size+rest;
-        ne = (ii+1)*size+rest;
-     }
+      hypre_CSRMatrixTranspose(RT_offd,&R_offd,1); 
+      R_offd_data = hypre_CSRMatrixData(R_offd);
+      R_offd_i    = hypre_CSRMatrixI(R_offd);
+      R_offd_j    = hypre_CSRMatrixJ(R_offd);
+   }
 
    /*-----------------------------------------------------------------------
-    *  Initialize some stuff.
+    *  Generate P_ext, i.e. the rows of P stored on neighbor procs, with
+    *  columns in a combined numbering: local coarse columns first,
+    *  followed by the columns of col_map_offd_Pext
     *-----------------------------------------------------------------------*/
 
-   P_marker = P_mark_array[ii];
-   A_marker = A_mark_array[ii];
-   for (ic = 0; ic < num_cols_diag_P+num_cols_offd_RAP; ic++)
-   {      
-      P_marker[ic] = -1;
-   }
-   for (i = 0; i < num_nz_cols_A ; i++)
-   {      
-      A_marker[i] = -1;
-   }   
-   
-   jj_count_diag = start_indexing;
-   jj_count_offd = start_indexing;
-   if (ii > 0)
+   last_col_diag_P = first_col_diag_P + num_cols_diag_P - 1;
+   P_ext_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A+1);
+   if (num_procs > 1) 
    {
-      jj_count_diag = jj_cnt_diag[ii-1];
-      jj_count_offd = jj_cnt_offd[ii-1];
+      Ps_ext = hypre_ParCSRMatrixExtractBExt(P,A,1);
+      Ps_ext_data = hypre_CSRMatrixData(Ps_ext);
+      Ps_ext_i    = hypre_CSRMatrixI(Ps_ext);
+      Ps_ext_j    = hypre_CSRMatrixJ(Ps_ext);
+      P_ext_size  = Ps_ext_i[num_cols_offd_A];
    }
 
-   /*-----------------------------------------------------------------------
-    *  Loop over interior c-points.
-    *-----------------------------------------------------------------------*/
-    
-   for (ic = ns; ic < ne; ic++)
+   cnt = 0;
+   if (P_ext_size || num_cols_offd_P)
    {
-      
-      /*--------------------------------------------------------------------
-       *  Create diagonal entry, RAP_{ic,ic} and add entries of RAP_ext 
-       *--------------------------------------------------------------------*/
+      temp = hypre_CTAlloc(HYPRE_Int, P_ext_size+num_cols_offd_P);
+      for (i=0; i < P_ext_size; i++)
+         if (Ps_ext_j[i] < first_col_diag_P || Ps_ext_j[i] > last_col_diag_P)
+            temp[cnt++] = Ps_ext_j[i];
+      for (i=0; i < num_cols_offd_P; i++)
+         temp[cnt++] = col_map_offd_P[i];
+   }
+   if (cnt)
+   {
+      qsort0(temp, 0, cnt-1);
 
-      jj_row_begin_diag = jj_count_diag;
-      jj_row_begin_offd = jj_count_offd;
-      RAP_diag_i[ic] = jj_row_begin_diag;
-      RAP_offd_i[ic] = jj_row_begin_offd;
+      num_cols_offd_Pext = 1;
+      value = temp[0];
+      for (i=1; i < cnt; i++)
+      {
+         if (temp[i] > value)
+         {
+            value = temp[i];
+            temp[num_cols_offd_Pext++] = value;
+         }
+      }
+      col_map_offd_Pext = hypre_CTAlloc(HYPRE_Int, num_cols_offd_Pext);
+      for (i=0; i < num_cols_offd_Pext; i++)
+         col_map_offd_Pext[i] = temp[i];
+   }
+   if (P_ext_size || num_cols_offd_P)
+      hypre_TFree(temp);
 
-      if (square)
+   if (P_ext_size)
+   {
+      P_ext_j = hypre_CTAlloc(HYPRE_Int, P_ext_size);
+      P_ext_data = hypre_CTAlloc(double, P_ext_size);
+   }
+   for (i=0; i < num_cols_offd_A; i++)
+   {
+      for (j=Ps_ext_i[i]; j < Ps_ext_i[i+1]; j++)
       {
-         P_marker[ic] = jj_count_diag;
-         RAP_diag_data[jj_count_diag] = zero;
-         RAP_diag_j[jj_count_diag] = ic;
-         jj_count_diag++;
+         if (Ps_ext_j[j] < first_col_diag_P || Ps_ext_j[j] > last_col_diag_P)
+            P_ext_j[j] = num_cols_diag_P + hypre_BinarySearch(col_map_offd_Pext,
+                                                              Ps_ext_j[j],
+                                                              num_cols_offd_Pext);
+         else
+            P_ext_j[j] = Ps_ext_j[j] - first_col_diag_P;
+         P_ext_data[j] = Ps_ext_data[j];
       }
+      P_ext_i[i+1] = Ps_ext_i[i+1];
+   }
+   if (num_procs > 1) 
+   {
+      hypre_CSRMatrixDestroy(Ps_ext);
+      Ps_ext = NULL;
+   }
 
-      for (i=0; i < num_sends_RT; i++)
-        for (j = send_map_starts_RT[i]; j < send_map_starts_RT[i+1]; j++)
-            if (send_map_elmts_RT[j] == ic)
-            {
-                for (k=RAP_ext_i[j]; k < RAP_ext_i[j+1]; k++)
-                {
-                   jcol = RAP_ext_j[k];
-                   if (jcol < num_cols_diag_P)
-                   {
-                        if (P_marker[jcol] < jj_row_begin_diag)
-                        {
-                                P_marker[jcol] = jj_count_diag;
-                                RAP_diag_data[jj_count_diag] 
-                                        = RAP_ext_data[k];
-                                RAP_diag_j[jj_count_diag] = jcol;
-                                jj_count_diag++;
-                        }
-                        else
-                                RAP_diag_data[P_marker[jcol]]
-                                        += RAP_ext_data[k];
-                   }
-                   else
-                   {
-                        if (P_marker[jcol] < jj_row_begin_offd)
-                        {
-                                P_marker[jcol] = jj_count_offd;
-                                RAP_offd_data[jj_count_offd] 
-                                        = RAP_ext_data[k];
-                                RAP_offd_j[jj_count_offd] 
-                                        = jcol-num_cols_diag_P;
-                                jj_count_offd++;
-                        }
-                        else
-                                RAP_offd_data[P_marker[jcol]]
-                                        += RAP_ext_data[k];
-                   }
-                }
-                break;
-            }
- 
-      /*--------------------------------------------------------------------
-       *  Loop over entries in row ic of R_diag.
-       *--------------------------------------------------------------------*/
+   if (num_cols_offd_P)
+   {
+      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_P);
+      for (i=0; i < num_cols_offd_P; i++)
+         map_P_to_Pext[i] = num_cols_diag_P + hypre_BinarySearch(col_map_offd_Pext,
+                                                                 col_map_offd_P[i],
+                                                                 num_cols_offd_Pext);
+   }
 
-      for (jj1 = R_diag_i[ic]; jj1 < R_diag_i[ic+1]; jj1++)
+   /* columns of RAP_offd that cannot be reached by local products are
+      marked with -1; they can only receive contributions through RAP_ext */
+   if (num_cols_offd_RAP)
+   {
+      map_RAP_to_Pext = hypre_CTAlloc(HYPRE_Int,num_cols_offd_RAP);
+      for (i=0; i < num_cols_offd_RAP; i++)
       {
-         i1  = R_diag_j[jj1];
-         r_entry = R_diag_data[jj1];
-
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_offd.
-          *-----------------------------------------------------------------*/
-         
-         if (num_cols_offd_A)
-         {
-          for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
-          {
-            i2 = A_offd_j[jj2];
-            r_a_product = r_entry * A_offd_data[jj2];
-            
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
+         j = hypre_BinarySearch(col_map_offd_Pext, col_map_offd_RAP[i],
+                                num_cols_offd_Pext);
+         map_RAP_to_Pext[i] = (j < 0) ? -1 : num_cols_diag_P + j;
+      }
+   }
 
-            if (A_marker[i2] != ic)
-            {
+   num_cols_Pext = num_cols_diag_P + num_cols_offd_Pext;
 
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
+   /*-----------------------------------------------------------------------
+    *  Compute RAP_int, i.e. the rows of RAP belonging to coarse points on
+    *  other processors.  These rows are not stored, so their pattern is
+    *  determined here: first pass counts, second pass fills.
+    *-----------------------------------------------------------------------*/
 
-               A_marker[i2] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_ext.
-                *-----------------------------------------------------------*/
+   if (num_cols_offd_RT)
+   {
+      P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_Pext);
+      for (i=0; i < num_cols_Pext; i++)
+         P_marker[i] = -1;
 
-               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
-               {
-                  i3 = P_ext_diag_j[jj3];
-                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
-                  if (P_marker[i3] < jj_row_begin_diag)
-                  {
-                        P_marker[i3] = jj_count_diag;
-                        RAP_diag_data[jj_count_diag] = r_a_p_product;
-                        RAP_diag_j[jj_count_diag] = i3;
-                        jj_count_diag++;
-                  }
-                  else
-                        RAP_diag_data[P_marker[i3]] += r_a_p_product;
-               }
-               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+      RAP_int_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_RT+1);
+      jj_counter = 0;
+      for (ic = 0; ic < num_cols_offd_RT; ic++)
+      {
+         jj_row_begining = jj_counter;
+         for (jj1 = R_offd_i[ic]; jj1 < R_offd_i[ic+1]; jj1++)
+         {
+            i1 = R_offd_j[jj1];
+            for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
+            {
+               i2 = A_offd_j[jj2];
+               for (jj3 = P_ext_i[i2]; jj3 < P_ext_i[i2+1]; jj3++)
                {
-                  i3 = map_Pext_to_RAP[P_ext_offd_j[jj3]] + num_cols_diag_P;
-                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
-                  if (P_marker[i3] < jj_row_begin_offd)
-                  {
-                        P_marker[i3] = jj_count_offd;
-                        RAP_offd_data[jj_count_offd] = r_a_p_product;
-                        RAP_offd_j[jj_count_offd] = i3 - num_cols_diag_P;
-                        jj_count_offd++;
-                  }
-                  else
-                        RAP_offd_data[P_marker[i3]] += r_a_p_product;
+                  i3 = P_ext_j[jj3];
+                  if (P_marker[i3] < jj_row_begining)
+                     P_marker[i3] = jj_counter++;
                }
             }
-
-            /*--------------------------------------------------------------
-             *  If i2 is previously visited ( A_marker[12]=ic ) it yields
-             *  no new entries in RAP and can just add new contributions.
-             *--------------------------------------------------------------*/
-            else
+            for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
             {
-               for (jj3 = P_ext_diag_i[i2]; jj3 < P_ext_diag_i[i2+1]; jj3++)
+               i2 = A_diag_j[jj2];
+               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
                {
-                  i3 = P_ext_diag_j[jj3];
-                  r_a_p_product = r_a_product * P_ext_diag_data[jj3];
-                  RAP_diag_data[P_marker[i3]] += r_a_p_product;
+                  i3 = P_diag_j[jj3];
+                  if (P_marker[i3] < jj_row_begining)
+                     P_marker[i3] = jj_counter++;
                }
-               for (jj3 = P_ext_offd_i[i2]; jj3 < P_ext_offd_i[i2+1]; jj3++)
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
                {
-                  i3 = map_Pext_to_RAP[P_ext_offd_j[jj3]] + num_cols_diag_P;
-                  r_a_p_product = r_a_product * P_ext_offd_data[jj3];
-                  RAP_offd_data[P_marker[i3]] += r_a_p_product;
+                  i3 = map_P_to_Pext[P_offd_j[jj3]];
+                  if (P_marker[i3] < jj_row_begining)
+                     P_marker[i3] = jj_counter++;
                }
             }
-          }
          }
+         RAP_int_i[ic+1] = jj_counter;
+      }
+      RAP_int_size = jj_counter;
 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_diag.
-          *-----------------------------------------------------------------*/
-         
-         for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
-         {
-            i2 = A_diag_j[jj2];
-            r_a_product = r_entry * A_diag_data[jj2];
-            
-            /*--------------------------------------------------------------
-             *  Check A_marker to see if point i2 has been previously
-             *  visited. New entries in RAP only occur from unmarked points.
-             *--------------------------------------------------------------*/
+      if (RAP_int_size)
+      {
+         RAP_int_j = hypre_CTAlloc(HYPRE_Int, RAP_int_size);
+         RAP_int_data = hypre_CTAlloc(double, RAP_int_size);
+      }
 
-            if (A_marker[i2+num_cols_offd_A] != ic)
+      for (i=0; i < num_cols_Pext; i++)
+         P_marker[i] = -1;
+      jj_counter = 0;
+      for (ic = 0; ic < num_cols_offd_RT; ic++)
+      {
+         jj_row_begining = jj_counter;
+         for (jj1 = R_offd_i[ic]; jj1 < R_offd_i[ic+1]; jj1++)
+         {
+            i1 = R_offd_j[jj1];
+            r_entry = R_offd_data[jj1];
+            for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
             {
-
-               /*-----------------------------------------------------------
-                *  Mark i2 as visited.
-                *-----------------------------------------------------------*/
-
-               A_marker[i2+num_cols_offd_A] = ic;
-               
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of P_diag.
-                *-----------------------------------------------------------*/
-
-               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
+               i2 = A_offd_j[jj2];
+               r_a_product = r_entry * A_offd_data[jj2];
+               for (jj3 = P_ext_i[i2]; jj3 < P_ext_i[i2+1]; jj3++)
                {
-                  i3 = P_diag_j[jj3];
-                  r_a_p_product = r_a_product * P_diag_data[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
-
-                  if (P_marker[i3] < jj_row_begin_diag)
+                  i3 = P_ext_j[jj3];
+                  if (P_marker[i3] < jj_row_begining)
                   {
-                     P_marker[i3] = jj_count_diag;
-                     RAP_diag_data[jj_count_diag] = r_a_p_product;
-                     RAP_diag_j[jj_count_diag] = P_diag_j[jj3];
-                     jj_count_diag++;
+                     P_marker[i3] = jj_counter;
+                     RAP_int_j[jj_counter] = i3;
+                     RAP_int_data[jj_counter++] = r_a_product * P_ext_data[jj3];
                   }
                   else
-                  {
-                     RAP_diag_data[P_marker[i3]] += r_a_p_product;
-                  }
+                     RAP_int_data[P_marker[i3]] += r_a_product * P_ext_data[jj3];
                }
-               if (num_cols_offd_P)
+            }
+            for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
+            {
+               i2 = A_diag_j[jj2];
+               r_a_product = r_entry * A_diag_data[jj2];
+               for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
                {
-                for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
-                {
-                  i3 = map_P_to_RAP[P_offd_j[jj3]] + num_cols_diag_P;
-                  r_a_p_product = r_a_product * P_offd_data[jj3];
-                  
-                  /*--------------------------------------------------------
-                   *  Check P_marker to see that RAP_{ic,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
-
-                  if (P_marker[i3] < jj_row_begin_offd)
+                  i3 = P_diag_j[jj3];
+                  if (P_marker[i3] < jj_row_begining)
                   {
-                     P_marker[i3] = jj_count_offd;
-                     RAP_offd_data[jj_count_offd] = r_a_p_product;
-                     RAP_offd_j[jj_count_offd] = i3 - num_cols_diag_P;
-                     jj_count_offd++;
+                     P_marker[i3] = jj_counter;
+                     RAP_int_j[jj_counter] = i3;
+                     RAP_int_data[jj_counter++] = r_a_product * P_diag_data[jj3];
                   }
                   else
+                     RAP_int_data[P_marker[i3]] += r_a_product * P_diag_data[jj3];
+               }
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
+               {
+                  i3 = map_P_to_Pext[P_offd_j[jj3]];
+                  if (P_marker[i3] < jj_row_begining)
                   {
-                     RAP_offd_data[P_marker[i3]] += r_a_p_product;
+                     P_marker[i3] = jj_counter;
+                     RAP_int_j[jj_counter] = i3;
+                     RAP_int_data[jj_counter++] = r_a_product * P_offd_data[jj3];
                   }
-                }
+                  else
+                     RAP_int_data[P_marker[i3]] += r_a_product * P_offd_data[jj3];
                }
             }
+         }
+      }
+      hypre_TFree(P_marker);
 
-            /*--------------------------------------------------------------
-             *  If i2 is previously visited ( A_marker[12]=ic ) it yields
-             *  no new entries in RAP and can just add new contributions.
-             *--------------------------------------------------------------*/
+      /* convert to global column numbers */
+      for (i=0; i < RAP_int_size; i++)
+      {
+         if (RAP_int_j[i] < num_cols_diag_P)
+            RAP_int_j[i] += first_col_diag_P;
+         else
+            RAP_int_j[i] = col_map_offd_Pext[RAP_int_j[i]-num_cols_diag_P];
+      }
 
-            else
+      RAP_int = hypre_CSRMatrixCreate(num_cols_offd_RT,num_rows_offd_RT,RAP_int_size);
+      hypre_CSRMatrixI(RAP_int) = RAP_int_i;
+      hypre_CSRMatrixJ(RAP_int) = RAP_int_j;
+      hypre_CSRMatrixData(RAP_int) = RAP_int_data;
+   }
+
+   if (num_sends_RT || num_recvs_RT)
+   {
+      RAP_ext = hypre_ExchangeRAPData(RAP_int,comm_pkg_RT);
+      RAP_ext_i = hypre_CSRMatrixI(RAP_ext);
+      RAP_ext_j = hypre_CSRMatrixJ(RAP_ext);
+      RAP_ext_data = hypre_CSRMatrixData(RAP_ext);
+   }
+   if (num_cols_offd_RT)
+   {
+      hypre_CSRMatrixDestroy(RAP_int);
+      RAP_int = NULL;
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Local rows of RAP: the positions of the stored entries of row ic are
+    *  entered into P_marker, the products are accumulated in place.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,r_entry,r_a_product,P_marker) reduction(+:num_missing_local) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_threads; ii++)
+   {
+      size = num_cols_diag_RT/num_threads;
+      rest = num_cols_diag_RT - size*num_threads;
+      if (ii < rest)
+      {
+         ns = ii*size+ii;
+         ne = (ii+1)*size+ii+1;
+      }
+      else
+      {
+         ns = ii*size+rest;
+         ne = (ii+1)*size+rest;
+      }
+
+      P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_Pext);
+      for (i=0; i < num_cols_Pext; i++)
+         P_marker[i] = -1;
+
+      for (ic = ns; ic < ne; ic++)
+      {
+         for (jj1 = RAP_diag_i[ic]; jj1 < RAP_diag_i[ic+1]; jj1++)
+         {
+            P_marker[RAP_diag_j[jj1]] = jj1;
+            RAP_diag_data[jj1] = 0.0;
+         }
+         for (jj1 = RAP_offd_i[ic]; jj1 < RAP_offd_i[ic+1]; jj1++)
+         {
+            i3 = map_RAP_to_Pext[RAP_offd_j[jj1]];
+            if (i3 > -1) P_marker[i3] = jj1;
+            RAP_offd_data[jj1] = 0.0;
+         }
+
+         for (jj1 = R_diag_i[ic]; jj1 < R_diag_i[ic+1]; jj1++)
+         {
+            i1 = R_diag_j[jj1];
+            r_entry = R_diag_data[jj1];
+            for (jj2 = A_offd_i[i1]; jj2 < A_offd_i[i1+1]; jj2++)
             {
+               i2 = A_offd_j[jj2];
+               r_a_product = r_entry * A_offd_data[jj2];
+               for (jj3 = P_ext_i[i2]; jj3 < P_ext_i[i2+1]; jj3++)
+               {
+                  i3 = P_ext_j[jj3];
+                  if (P_marker[i3] < 0)
+                     num_missing_local++;
+                  else if (i3 < num_cols_diag_P)
+                     RAP_diag_data[P_marker[i3]] += r_a_product * P_ext_data[jj3];
+                  else
+                     RAP_offd_data[P_marker[i3]] += r_a_product * P_ext_data[jj3];
+               }
+            }
+            for (jj2 = A_diag_i[i1]; jj2 < A_diag_i[i1+1]; jj2++)
+            {
+               i2 = A_diag_j[jj2];
+               r_a_product = r_entry * A_diag_data[jj2];
                for (jj3 = P_diag_i[i2]; jj3 < P_diag_i[i2+1]; jj3++)
                {
                   i3 = P_diag_j[jj3];
-                  r_a_p_product = r_a_product * P_diag_data[jj3];
-                  RAP_diag_data[P_marker[i3]] += r_a_p_product;
+                  if (P_marker[i3] < 0)
+                     num_missing_local++;
+                  else
+                     RAP_diag_data[P_marker[i3]] += r_a_product * P_diag_data[jj3];
                }
-               if (num_cols_offd_P)
+               for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
                {
-                for (jj3 = P_offd_i[i2]; jj3 < P_offd_i[i2+1]; jj3++)
-                {
-                  i3 = map_P_to_RAP[P_offd_j[jj3]] + num_cols_diag_P;
-                  r_a_p_product = r_a_product * P_offd_data[jj3];
-                  RAP_offd_data[P_marker[i3]] += r_a_p_product;
-                }
+                  i3 = map_P_to_Pext[P_offd_j[jj3]];
+                  if (P_marker[i3] < 0)
+                     num_missing_local++;
+                  else
+                     RAP_offd_data[P_marker[i3]] += r_a_product * P_offd_data[jj3];
                }
             }
          }
+
+         for (jj1 = RAP_diag_i[ic]; jj1 < RAP_diag_i[ic+1]; jj1++)
+            P_marker[RAP_diag_j[jj1]] = -1;
+         for (jj1 = RAP_offd_i[ic]; jj1 < RAP_offd_i[ic+1]; jj1++)
+         {
+            i3 = map_RAP_to_Pext[RAP_offd_j[jj1]];
+            if (i3 > -1) P_marker[i3] = -1;
+         }
       }
-   }
-      hypre_TFree(P_mark_array[ii]);   
-      hypre_TFree(A_mark_array[ii]);   
-   }
 
-   /* check if really all off-diagonal entries occurring in col_map_offd_RAP
-	are represented and eliminate if necessary */
+      hypre_TFree(P_marker);
+   }
 
-   P_marker = hypre_CTAlloc(HYPRE_Int,num_cols_offd_RAP);
-   for (i=0; i < num_cols_offd_RAP; i++)
-      P_marker[i] = -1;
+   /*-----------------------------------------------------------------------
+    *  Add the contributions of other processors (RAP_ext).  Several rows
+    *  of RAP_ext may belong to the same coarse point, so this is done
+    *  sequentially.
+    *-----------------------------------------------------------------------*/
 
-   jj_count_offd = 0;
-   for (i=0; i < RAP_offd_size; i++)
+   first_col_diag_RAP = first_col_diag_P;
+   last_col_diag_RAP = first_col_diag_P + num_cols_diag_P - 1;
+   if (num_sends_RT)
    {
-      i3 = RAP_offd_j[i];
-      if (P_marker[i3])
+      for (i=0; i < send_map_starts_RT[num_sends_RT]; i++)
       {
-	 P_marker[i3] = 0;
-	 jj_count_offd++;
-      }
-   }
-
-   if (jj_count_offd < num_cols_offd_RAP)
-   {
-      new_col_map_offd_RAP = hypre_CTAlloc(HYPRE_Int,jj_count_offd);
-      jj_counter = 0;
-      for (i=0; i < num_cols_offd_RAP; i++)
-         if (!P_marker[i]) 
+         ic = send_map_elmts_RT[i];
+         for (k = RAP_ext_i[i]; k < RAP_ext_i[i+1]; k++)
          {
-	    P_marker[i] = jj_counter;
-	    new_col_map_offd_RAP[jj_counter++] = col_map_offd_RAP[i];
+            jcol = RAP_ext_j[k];
+            if (jcol >= first_col_diag_RAP && jcol <= last_col_diag_RAP)
+            {
+               jcol -= first_col_diag_RAP;
+               for (j = RAP_diag_i[ic]; j < RAP_diag_i[ic+1]; j++)
+                  if (RAP_diag_j[j] == jcol) break;
+               if (j < RAP_diag_i[ic+1])
+                  RAP_diag_data[j] += RAP_ext_data[k];
+               else
+                  num_missing_local++;
+            }
+            else
+            {
+               jcol = hypre_BinarySearch(col_map_offd_RAP, jcol, num_cols_offd_RAP);
+               for (j = RAP_offd_i[ic]; j < RAP_offd_i[ic+1]; j++)
+                  if (RAP_offd_j[j] == jcol) break;
+               if (jcol > -1 && j < RAP_offd_i[ic+1])
+                  RAP_offd_data[j] += RAP_ext_data[k];
+               else
+                  num_missing_local++;
+            }
          }
- 
-      for (i=0; i < RAP_offd_size; i++)
-      {
-	 i3 = RAP_offd_j[i];
-	 RAP_offd_j[i] = P_marker[i3];
       }
-      
-      num_cols_offd_RAP = jj_count_offd;
-      hypre_TFree(col_map_offd_RAP);
-      col_map_offd_RAP = new_col_map_offd_RAP;
-   }
-   hypre_TFree(P_marker);
-
-   RAP = hypre_ParCSRMatrixCreate(comm, n_coarse_RT, n_coarse,
-                                  RT_partitioning, coarse_partitioning,
-                                  num_cols_offd_RAP, RAP_diag_size,
-                                  RAP_offd_size);
-
-/* Have RAP own coarse_partitioning instead of P */
-   hypre_ParCSRMatrixSetColStartsOwner(P,0);
-   hypre_ParCSRMatrixSetColStartsOwner(RT,0);
-
-   RAP_diag = hypre_ParCSRMatrixDiag(RAP);
-   hypre_CSRMatrixI(RAP_diag) = RAP_diag_i; 
-   if (RAP_diag_size)
-   {
-      hypre_CSRMatrixData(RAP_diag) = RAP_diag_data; 
-      hypre_CSRMatrixJ(RAP_diag) = RAP_diag_j; 
-   }
-
-   RAP_offd = hypre_ParCSRMatrixOffd(RAP);
-   hypre_CSRMatrixI(RAP_offd) = RAP_offd_i; 
-   if (num_cols_offd_RAP)
-   {
-        hypre_CSRMatrixData(RAP_offd) = RAP_offd_data; 
-        hypre_CSRMatrixJ(RAP_offd) = RAP_offd_j; 
-        hypre_ParCSRMatrixColMapOffd(RAP) = col_map_offd_RAP;
-   }
-   if (num_procs > 1)
-   {
-        /* hypre_GenerateRAPCommPkg(RAP, A); */
-        hypre_MatvecCommPkgCreate(RAP); 
    }
 
-   *RAP_ptr = RAP;
+   hypre_MPI_Allreduce(&num_missing_local, &num_missing, 1, HYPRE_MPI_INT,
+                       hypre_MPI_SUM, comm);
+   *num_missing_ptr = num_missing;
 
    /*-----------------------------------------------------------------------
-    *  Free R, P_ext and marker arrays.
+    *  Free R, P_ext, RAP_ext and maps.
     *-----------------------------------------------------------------------*/
 
    hypre_CSRMatrixDestroy(R_diag);
-   R_diag = NULL;
-
    if (num_cols_offd_RT) 
-   {
       hypre_CSRMatrixDestroy(R_offd);
-      R_offd = NULL;
-   }
-
    if (num_sends_RT || num_recvs_RT) 
-   {
       hypre_CSRMatrixDestroy(RAP_ext);
-      RAP_ext = NULL;
-   }
-   hypre_TFree(P_mark_array);   
-   hypre_TFree(A_mark_array);
-   hypre_TFree(P_ext_diag_i);
-   hypre_TFree(P_ext_offd_i);
-   hypre_TFree(jj_cnt_diag);   
-   hypre_TFree(jj_cnt_offd);   
-   if (num_cols_offd_P)
+   hypre_TFree(P_ext_i);
+   if (P_ext_size)
    {
-      hypre_TFree(map_P_to_Pext);
-      hypre_TFree(map_P_to_RAP);
+      hypre_TFree(P_ext_j);
+      hypre_TFree(P_ext_data);
    }
    if (num_cols_offd_Pext)
-   {
       hypre_TFree(col_map_offd_Pext);
-      hypre_TFree(map_Pext_to_RAP);
-   }
-   if (P_ext_diag_size)
-   {
-      hypre_TFree(P_ext_diag_data);
-      hypre_TFree(P_ext_diag_j);
-   }
-   if (P_ext_offd_size)
-   {
-      hypre_TFree(P_ext_offd_data);
-      hypre_TFree(P_ext_offd_j);
-   }
-   return(0);
-   
-}            
+   if (num_cols_offd_P)
+      hypre_TFree(map_P_to_Pext);
+   if (num_cols_offd_RAP)
+      hypre_TFree(map_RAP_to_Pext);
 
+   return hypre_error_flag;
+}
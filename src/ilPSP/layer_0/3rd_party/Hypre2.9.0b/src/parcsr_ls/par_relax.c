@@ -113,6 +113,12 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_size(comm,&num_procs);  
    hypre_MPI_Comm_rank(comm,&my_id);  
    num_threads = hypre_NumThreads();
+
+   /* levels stored in single precision, see par_amg_mixed.c */
+   if (hypre_CSRMatrixSPData(A_diag))
+      return hypre_BoomerAMGRelaxSP(A, f, cf_marker, relax_type, relax_points,
+                                    relax_weight, omega, u, Vtemp, Ztemp);
+
    /*-----------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type = 0 -> Jacobi or CF-Jacobi
@@ -138,10 +144,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	{
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
 	if (num_cols_offd)
 	{
@@ -251,8 +257,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
 	 if (num_procs > 1)
          {
-	 hypre_TFree(Vext_data);
-	 hypre_TFree(v_buf_data);
+	 hypre_WorkspaceTFree(Vext_data);
+	 hypre_WorkspaceTFree(v_buf_data);
          }
       }
       break;
@@ -264,10 +270,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	{
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
 	if (num_cols_offd)
 	{
@@ -365,8 +371,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-	   hypre_TFree(Vext_data);
-	   hypre_TFree(v_buf_data);
+	   hypre_WorkspaceTFree(Vext_data);
+	   hypre_WorkspaceTFree(v_buf_data);
          }
       }
       break;
@@ -387,10 +393,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
             
-            v_buf_data = hypre_CTAlloc(double, 
+            v_buf_data = hypre_WorkspaceCTAlloc(double, 
                                        hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
             
-            Vext_data = hypre_CTAlloc(double,num_cols_offd);
+            Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
             
             if (num_cols_offd)
             {
@@ -823,8 +829,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
         }
         if (num_procs > 1)
         {
-	   hypre_TFree(Vext_data);
-	   hypre_TFree(v_buf_data);
+	   hypre_WorkspaceTFree(Vext_data);
+	   hypre_WorkspaceTFree(v_buf_data);
         }
       }
       break;
@@ -836,13 +842,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    	num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
-	status  = hypre_CTAlloc(hypre_MPI_Status,num_recvs+num_sends);
-	requests= hypre_CTAlloc(hypre_MPI_Request, num_recvs+num_sends);
+	status  = hypre_WorkspaceCTAlloc(hypre_MPI_Status,num_recvs+num_sends);
+	requests= hypre_WorkspaceCTAlloc(hypre_MPI_Request, num_recvs+num_sends);
 
 	if (num_cols_offd)
 	{
@@ -963,10 +969,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	}
 	if (num_procs > 1)
 	{
-	hypre_TFree(Vext_data);
-	hypre_TFree(v_buf_data);
-	hypre_TFree(status);
-	hypre_TFree(requests);
+	hypre_WorkspaceTFree(Vext_data);
+	hypre_WorkspaceTFree(v_buf_data);
+	hypre_WorkspaceTFree(status);
+	hypre_WorkspaceTFree(requests);
 	}
       }
       break;
@@ -979,13 +985,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    	num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
-	status  = hypre_CTAlloc(hypre_MPI_Status,num_recvs+num_sends);
-	requests= hypre_CTAlloc(hypre_MPI_Request, num_recvs+num_sends);
+	status  = hypre_WorkspaceCTAlloc(hypre_MPI_Status,num_recvs+num_sends);
+	requests= hypre_WorkspaceCTAlloc(hypre_MPI_Request, num_recvs+num_sends);
 
 	if (num_cols_offd)
 	{
@@ -1154,10 +1160,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	}
 	if (num_procs > 1)
 	{
-	hypre_TFree(Vext_data);
-	hypre_TFree(v_buf_data);
-	hypre_TFree(status);
-	hypre_TFree(requests);
+	hypre_WorkspaceTFree(Vext_data);
+	hypre_WorkspaceTFree(v_buf_data);
+	hypre_WorkspaceTFree(status);
+	hypre_WorkspaceTFree(requests);
 	}
       }
       break;
@@ -1170,10 +1176,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	{
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
 	if (num_cols_offd)
 	{
@@ -1210,7 +1216,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
 	  if (num_threads > 1)
           {
-	   tmp_data = hypre_CTAlloc(double,n);
+	   tmp_data = hypre_WorkspaceCTAlloc(double,n);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
@@ -1260,7 +1266,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
            }
-           hypre_TFree(tmp_data);
+           hypre_WorkspaceTFree(tmp_data);
           }
 	  else
           {
@@ -1299,7 +1305,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
 	  if (num_threads > 1)
 	  {
-	   tmp_data = hypre_CTAlloc(double,n);
+	   tmp_data = hypre_WorkspaceCTAlloc(double,n);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
@@ -1351,7 +1357,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }     
            }     
-           hypre_TFree(tmp_data);
+           hypre_WorkspaceTFree(tmp_data);
            
 	  }
 	  else
@@ -1399,7 +1405,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
 	  if (num_threads > 1)
           {
-	   tmp_data = hypre_CTAlloc(double,n);
+	   tmp_data = hypre_WorkspaceCTAlloc(double,n);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
@@ -1458,7 +1464,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
            }
-           hypre_TFree(tmp_data);
+           hypre_WorkspaceTFree(tmp_data);
            
           }
 	  else
@@ -1504,7 +1510,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
 	  if (num_threads > 1)
 	  {
-	   tmp_data = hypre_CTAlloc(double,n);
+	   tmp_data = hypre_WorkspaceCTAlloc(double,n);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
@@ -1565,7 +1571,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }     
            }     
-           hypre_TFree(tmp_data);
+           hypre_WorkspaceTFree(tmp_data);
 	  }
 	  else
 	  {
@@ -1607,8 +1613,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
-	   hypre_TFree(Vext_data);
-	   hypre_TFree(v_buf_data);
+	   hypre_WorkspaceTFree(Vext_data);
+	   hypre_WorkspaceTFree(v_buf_data);
          }
       }
       break;
@@ -1631,10 +1637,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 	{
    	num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-   	v_buf_data = hypre_CTAlloc(double, 
+   	v_buf_data = hypre_WorkspaceCTAlloc(double, 
 			hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-	Vext_data = hypre_CTAlloc(double,num_cols_offd);
+	Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
         
 	if (num_cols_offd)
 	{
@@ -2311,8 +2317,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
         }
         if (num_procs > 1)
         {
-	   hypre_TFree(Vext_data);
-	   hypre_TFree(v_buf_data);
+	   hypre_WorkspaceTFree(Vext_data);
+	   hypre_WorkspaceTFree(v_buf_data);
         }
       }
       break;
@@ -2363,10 +2369,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
         {
         num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-        v_buf_data = hypre_CTAlloc(double,
+        v_buf_data = hypre_WorkspaceCTAlloc(double,
                         hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
-        Vext_data = hypre_CTAlloc(double,num_cols_offd);
+        Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
 
         if (num_cols_offd)
         {
@@ -3043,8 +3049,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
         }
         if (num_procs > 1)
         {
-           hypre_TFree(Vext_data);
-           hypre_TFree(v_buf_data);
+           hypre_WorkspaceTFree(Vext_data);
+           hypre_WorkspaceTFree(v_buf_data);
         }
       }
       break;
@@ -3346,7 +3352,7 @@ HYPRE_Int hypre_GaussElimSolve (void *amg_vdata, HYPRE_Int level, HYPRE_Int rela
                           b_vec, info, displs,
                           hypre_MPI_DOUBLE, new_comm );
 
-      A_tmp = hypre_CTAlloc (double, n_global*n_global);
+      A_tmp = hypre_WorkspaceTAlloc(double, n_global*n_global);
       for (i=0; i < n_global*n_global; i++)
          A_tmp[i] = A_mat[i];
 
@@ -3357,7 +3363,7 @@ HYPRE_Int hypre_GaussElimSolve (void *amg_vdata, HYPRE_Int level, HYPRE_Int rela
       else if (relax_type == 99) /* use pivoting */
       {
          HYPRE_Int *piv;
-         piv = hypre_CTAlloc(HYPRE_Int, n_global);
+         piv = hypre_WorkspaceCTAlloc(HYPRE_Int, n_global);
 
          /* write over A with LU */
 #ifdef HYPRE_USING_ESSL
@@ -3379,13 +3385,13 @@ HYPRE_Int hypre_GaussElimSolve (void *amg_vdata, HYPRE_Int level, HYPRE_Int rela
                                              &n_global, piv, b_vec, 
                                              &n_global, &my_info);
 #endif
-         hypre_TFree(piv);
+         hypre_WorkspaceTFree(piv);
       }
       for (i = 0; i < n; i++)
       {
          u_data[i] = b_vec[first_index+i];
       }
-      hypre_TFree(A_tmp);
+      hypre_WorkspaceTFree(A_tmp);
    }
    if (error_flag) hypre_error(HYPRE_ERROR_GENERIC);
 
@@ -382,12 +382,9 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
 
    HYPRE_Int cheby_order;
 
-   double *ds_data, *tmp_data;
+   double *ds_data;
    double  diag;
 
-   hypre_ParVector    *ds;
-   hypre_ParVector    *tmp_vec;
-
    /* u = u + p(A)r */
 
    if (order > 4)
@@ -486,7 +483,7 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
       }
    }
 
-   orig_u = hypre_CTAlloc(double, num_rows);
+   orig_u = hypre_WorkspaceCTAlloc(double, num_rows);
 
    if (!scale)
    {
@@ -531,19 +528,7 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
       
       /*grab 1/sqrt(diagonal) */
       
-      ds = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
-                                 hypre_ParCSRMatrixGlobalNumRows(A),
-                                 hypre_ParCSRMatrixRowStarts(A));
-      hypre_ParVectorInitialize(ds);
-      hypre_ParVectorSetPartitioningOwner(ds,0);
-      ds_data = hypre_VectorData(hypre_ParVectorLocalVector(ds));
-      
-      tmp_vec = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
-                                      hypre_ParCSRMatrixGlobalNumRows(A),
-                                      hypre_ParCSRMatrixRowStarts(A));
-      hypre_ParVectorInitialize(tmp_vec);
-      hypre_ParVectorSetPartitioningOwner(tmp_vec,0);
-      tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(tmp_vec));
+      ds_data = hypre_WorkspaceCTAlloc(double, num_rows);
 
     /* get ds_data and get scaled residual: r = D^(-1/2)f -
        * D^(-1/2)A*u */
@@ -560,13 +545,14 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
          r_data[j] = ds_data[j] * f_data[j];
       }
 
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, tmp_vec);
+      /* v is free until the iteration starts, use it for A*u */
+      hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, v);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
 #endif
       for ( j = 0; j < num_rows; j++ ) 
       {
-         r_data[j] += ds_data[j] * tmp_data[j];
+         r_data[j] += ds_data[j] * v_data[j];
       }
 
       /* save original u, then start 
@@ -585,15 +571,16 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
       /* now do the other coefficients */   
       for (i = cheby_order - 1; i >= 0; i-- ) 
       {
-         /* v = D^(-1/2)AD^(-1/2)u */
+         /* v = D^(-1/2)AD^(-1/2)u, u is overwritten below, so
+            D^(-1/2)u is formed in place */
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
 #endif
          for ( j = 0; j < num_rows; j++ )
          {
-            tmp_data[j]  =  ds_data[j] * u_data[j];
+            u_data[j]  =  ds_data[j] * u_data[j];
          }
-         hypre_ParCSRMatrixMatvec(1.0, A, tmp_vec, 0.0, v);
+         hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, v);
 
          /* u_new = coef*r + v*/
          mult = coefs[i];
@@ -619,15 +606,14 @@ HYPRE_Int hypre_ParCSRRelax_Cheby(hypre_ParCSRMatrix *A, /* matrix to relax with
          u_data[j] = orig_u[j] + ds_data[j]*u_data[j];
       }
    
-      hypre_ParVectorDestroy(ds);
-      hypre_ParVectorDestroy(tmp_vec);  
+      hypre_WorkspaceTFree(ds_data);
 
 
    }/* end of scaling code */
 
 
 
-   hypre_TFree(orig_u);
+   hypre_WorkspaceTFree(orig_u);
   
 
    
@@ -1040,10 +1026,10 @@ HYPRE_Int  hypre_ParCSRRelax_L1_Jacobi( hypre_ParCSRMatrix *A,
     {
        num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
        
-       v_buf_data = hypre_CTAlloc(double, 
+       v_buf_data = hypre_WorkspaceCTAlloc(double, 
                                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
        
-       Vext_data = hypre_CTAlloc(double,num_cols_offd);
+       Vext_data = hypre_WorkspaceCTAlloc(double,num_cols_offd);
        
        if (num_cols_offd)
        {
@@ -1151,8 +1137,8 @@ HYPRE_Int  hypre_ParCSRRelax_L1_Jacobi( hypre_ParCSRMatrix *A,
     }
     if (num_procs > 1)
     {
-       hypre_TFree(Vext_data);
-       hypre_TFree(v_buf_data);
+       hypre_WorkspaceTFree(Vext_data);
+       hypre_WorkspaceTFree(v_buf_data);
     }
 
     return 0;
@@ -964,6 +964,121 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
 
 
 
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionStats
+ *
+ * prints the precision and the number of nonzeros of A and P on
+ * each level and the matrix storage (values and column indices)
+ * of the hierarchy compared to a double precision hierarchy
+ *---------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionStats( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data = amg_vdata;
+
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            mp_num_levels = hypre_ParAMGDataMPNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array = hypre_ParAMGDataPArray(amg_data);
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A_array[0]);
+
+   double  *send_buff;
+   double  *gather_buff;
+   double   double_bytes, mixed_bytes, value_bytes;
+   HYPRE_Int  level, A_single, P_single, my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   send_buff   = hypre_CTAlloc(double, 2*num_levels);
+   gather_buff = hypre_CTAlloc(double, 2*num_levels);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      send_buff[2*level] = (double)
+         (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A_array[level])) +
+          hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A_array[level])));
+      if (level < num_levels-1)
+         send_buff[2*level+1] = (double)
+            (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(P_array[level])) +
+             hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(P_array[level])));
+   }
+
+   hypre_MPI_Allreduce(send_buff, gather_buff, 2*num_levels, hypre_MPI_DOUBLE,
+                       hypre_MPI_SUM, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n\nBoomerAMG MIXED PRECISION HIERARCHY:\n\n");
+      hypre_printf("lev    A nonzeros  precision     P nonzeros  precision\n");
+
+      double_bytes = 0.0;
+      mixed_bytes  = 0.0;
+      for (level = 0; level < num_levels; level++)
+      {
+         A_single = (mp_num_levels > 0 && level > 0 && level < num_levels-1);
+         P_single = (mp_num_levels > 0 && level < num_levels-1);
+
+         hypre_printf("%2d %13.0f  %s", level, gather_buff[2*level],
+                      A_single ? "single" : "double");
+         if (level < num_levels-1)
+            hypre_printf(" %14.0f  %s", gather_buff[2*level+1],
+                         P_single ? "single" : "double");
+         hypre_printf("\n");
+
+         value_bytes = sizeof(double) + sizeof(HYPRE_Int);
+         double_bytes += value_bytes*(gather_buff[2*level] + gather_buff[2*level+1]);
+         mixed_bytes  += (A_single ? sizeof(float) + sizeof(HYPRE_Int) : value_bytes)
+                         * gather_buff[2*level];
+         mixed_bytes  += (P_single ? sizeof(float) + sizeof(HYPRE_Int) : value_bytes)
+                         * gather_buff[2*level+1];
+      }
+
+      hypre_printf("\nmatrix storage (values and column indices):\n");
+      hypre_printf("   double precision hierarchy = %e bytes\n", double_bytes);
+      hypre_printf("   mixed precision hierarchy  = %e bytes\n", mixed_bytes);
+      if (double_bytes > 0.0)
+         hypre_printf("   saved                      = %e bytes (%.1f %%)\n\n",
+                      double_bytes - mixed_bytes,
+                      100.0*(double_bytes - mixed_bytes)/double_bytes);
+   }
+
+   hypre_TFree(send_buff);
+   hypre_TFree(gather_buff);
+
+   return(0);
+}
+
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGMixedPrecisionSolveStats
+ *
+ * prints the iterations of the last solve with the mixed precision
+ * hierarchy and, if known, the change against the last solve with
+ * the double precision hierarchy; called on processor 0 only
+ *---------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMixedPrecisionSolveStats( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data = amg_vdata;
+
+   HYPRE_Int  num_iterations = hypre_ParAMGDataNumIterations(amg_data);
+   HYPRE_Int  ref_iterations = hypre_ParAMGDataMPRefIterations(amg_data);
+
+   if (hypre_ParAMGDataMPNumLevels(amg_data) == 0)
+      return(0);
+
+   hypre_printf(" Mixed precision hierarchy: %d iterations", num_iterations);
+   if (ref_iterations >= 0)
+      hypre_printf(" (double precision: %d, change: %+d)",
+                   ref_iterations, num_iterations - ref_iterations);
+   hypre_printf("\n\n");
+
+   return(0);
+}
+
+
+
 /*---------------------------------------------------------------
  * hypre_BoomerAMGWriteSolverParams
  *---------------------------------------------------------------*/
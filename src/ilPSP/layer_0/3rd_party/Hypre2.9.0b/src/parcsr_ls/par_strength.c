@@ -22,6 +22,120 @@
 
 #include "_hypre_parcsr_ls.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCompressS
+ *
+ * Removes the entries marked weak (-1) from the rows of S, which still has
+ * the nonzero structure A_i.  With more than one thread the strong entries
+ * are counted per thread (contiguous blocks of rows) and copied into a new
+ * array; otherwise S_j is compressed in place.
+ * Returns the number of strong entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGCompressS( HYPRE_Int   num_variables,
+                          HYPRE_Int  *A_i,
+                          HYPRE_Int  *S_i,
+                          HYPRE_Int **S_j_ptr )
+{
+   HYPRE_Int  *S_j = *S_j_ptr;
+   HYPRE_Int   i, jA, jS;
+#ifdef HYPRE_USING_OPENMP
+   HYPRE_Int   num_threads = hypre_NumThreads();
+   HYPRE_Int  *S_j_new, *thread_start;
+   HYPRE_Int   ii, ns, ne, size, rest;
+
+   if (num_threads > 1 && S_j)
+   {
+      thread_start = hypre_CTAlloc(HYPRE_Int, num_threads+1);
+
+#pragma omp parallel for private(ii,i,jA,jS,ns,ne,size,rest) HYPRE_SMP_SCHEDULE
+      for (ii = 0; ii < num_threads; ii++)
+      {
+         size = num_variables/num_threads;
+         rest = num_variables - size*num_threads;
+         if (ii < rest)
+         {
+            ns = ii*size+ii;
+            ne = (ii+1)*size+ii+1;
+         }
+         else
+         {
+            ns = ii*size+rest;
+            ne = (ii+1)*size+rest;
+         }
+         jS = 0;
+         for (jA = A_i[ns]; jA < A_i[ne]; jA++)
+         {
+            if (S_j[jA] > -1) jS++;
+         }
+         thread_start[ii+1] = jS;
+      }
+
+      for (ii = 0; ii < num_threads; ii++)
+      {
+         thread_start[ii+1] += thread_start[ii];
+      }
+      S_j_new = hypre_CTAlloc(HYPRE_Int, thread_start[num_threads]);
+
+#pragma omp parallel for private(ii,i,jA,jS,ns,ne,size,rest) HYPRE_SMP_SCHEDULE
+      for (ii = 0; ii < num_threads; ii++)
+      {
+         size = num_variables/num_threads;
+         rest = num_variables - size*num_threads;
+         if (ii < rest)
+         {
+            ns = ii*size+ii;
+            ne = (ii+1)*size+ii+1;
+         }
+         else
+         {
+            ns = ii*size+rest;
+            ne = (ii+1)*size+rest;
+         }
+         jS = thread_start[ii];
+         for (i = ns; i < ne; i++)
+         {
+            S_i[i] = jS;
+            for (jA = A_i[i]; jA < A_i[i+1]; jA++)
+            {
+               if (S_j[jA] > -1)
+               {
+                  S_j_new[jS++] = S_j[jA];
+               }
+            }
+         }
+      }
+
+      jS = thread_start[num_threads];
+      S_i[num_variables] = jS;
+
+      hypre_TFree(S_j);
+      *S_j_ptr = S_j_new;
+      hypre_TFree(thread_start);
+
+      return jS;
+   }
+#endif
+
+   jS = 0;
+   for (i = 0; i < num_variables; i++)
+   {
+      S_i[i] = jS;
+      for (jA = A_i[i]; jA < A_i[i+1]; jA++)
+      {
+         if (S_j[jA] > -1)
+         {
+            S_j[jS]    = S_j[jA];
+            jS++;
+         }
+      }
+   }
+   S_i[num_variables] = jS;
+
+   return jS;
+}
+
 
 
 /*==========================================================================*/
@@ -405,38 +519,12 @@ hypre_BoomerAMGCreateS(hypre_ParCSRMatrix    *A,
     * that builds interpolation would have to be modified first.
     *----------------------------------------------------------------*/
 
-/* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_diag_i[i] = jS;
-      for (jA = A_diag_i[i]; jA < A_diag_i[i+1]; jA++)
-      {
-         if (S_diag_j[jA] > -1)
-         {
-            S_diag_j[jS]    = S_diag_j[jA];
-            jS++;
-         }
-      }
-   }
-   S_diag_i[num_variables] = jS;
+   jS = hypre_BoomerAMGCompressS(num_variables, A_diag_i, S_diag_i, &S_diag_j);
+   hypre_CSRMatrixJ(S_diag) = S_diag_j;
    hypre_CSRMatrixNumNonzeros(S_diag) = jS;
 
-/* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_offd_i[i] = jS;
-      for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-      {
-         if (S_offd_j[jA] > -1)
-         {
-            S_offd_j[jS]    = S_offd_j[jA];
-            jS++;
-         }
-      }
-   }
-   S_offd_i[num_variables] = jS;
+   jS = hypre_BoomerAMGCompressS(num_variables, A_offd_i, S_offd_i, &S_offd_j);
+   hypre_CSRMatrixJ(S_offd) = S_offd_j;
    hypre_CSRMatrixNumNonzeros(S_offd) = jS;
    hypre_ParCSRMatrixCommPkg(S) = NULL;
 
@@ -749,38 +837,12 @@ hypre_BoomerAMGCreateSabs(hypre_ParCSRMatrix    *A,
     * that builds interpolation would have to be modified first.
     *----------------------------------------------------------------*/
 
-/* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_diag_i[i] = jS;
-      for (jA = A_diag_i[i]; jA < A_diag_i[i+1]; jA++)
-      {
-         if (S_diag_j[jA] > -1)
-         {
-            S_diag_j[jS]    = S_diag_j[jA];
-            jS++;
-         }
-      }
-   }
-   S_diag_i[num_variables] = jS;
+   jS = hypre_BoomerAMGCompressS(num_variables, A_diag_i, S_diag_i, &S_diag_j);
+   hypre_CSRMatrixJ(S_diag) = S_diag_j;
    hypre_CSRMatrixNumNonzeros(S_diag) = jS;
 
-/* RDF: not sure if able to thread this loop */
-   jS = 0;
-   for (i = 0; i < num_variables; i++)
-   {
-      S_offd_i[i] = jS;
-      for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-      {
-         if (S_offd_j[jA] > -1)
-         {
-            S_offd_j[jS]    = S_offd_j[jA];
-            jS++;
-         }
-      }
-   }
-   S_offd_i[num_variables] = jS;
+   jS = hypre_BoomerAMGCompressS(num_variables, A_offd_i, S_offd_i, &S_offd_j);
+   hypre_CSRMatrixJ(S_offd) = S_offd_j;
    hypre_CSRMatrixNumNonzeros(S_offd) = jS;
    hypre_ParCSRMatrixCommPkg(S) = NULL;
 
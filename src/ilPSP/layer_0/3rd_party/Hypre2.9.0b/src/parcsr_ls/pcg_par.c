@@ -168,6 +168,69 @@ hypre_ParKrylovInnerProd( void *x,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProdStart, hypre_ParKrylovMultiInnerProdWait
+ *
+ * n inner products with a single, nonblocking MPI_Iallreduce
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProdStart( HYPRE_Int           n,
+                                    void              **x,
+                                    void              **y,
+                                    double             *local_prod,
+                                    double             *prod,
+                                    hypre_MPI_Request  *request )
+{
+   MPI_Comm  comm = hypre_ParVectorComm((hypre_ParVector *) x[0]);
+   HYPRE_Int k;
+
+   for (k = 0; k < n; k++)
+   {
+      local_prod[k] = hypre_SeqVectorInnerProd(
+         hypre_ParVectorLocalVector((hypre_ParVector *) x[k]),
+         hypre_ParVectorLocalVector((hypre_ParVector *) y[k]) );
+   }
+
+   return ( hypre_MPI_Iallreduce(local_prod, prod, n, hypre_MPI_DOUBLE,
+                                 hypre_MPI_SUM, comm, request) );
+}
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   return ( hypre_MPI_Wait(request, &status) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMultiInnerProd
+ *
+ * prod[k] = <x[k],y>, k < n, with a single MPI_Allreduce
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMultiInnerProd( HYPRE_Int   n,
+                               void      **x,
+                               void       *y,
+                               double     *local_prod,
+                               double     *prod )
+{
+   MPI_Comm         comm    = hypre_ParVectorComm((hypre_ParVector *) y);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector((hypre_ParVector *) y);
+   HYPRE_Int        k;
+
+   for (k = 0; k < n; k++)
+   {
+      local_prod[k] = hypre_SeqVectorInnerProd(
+         hypre_ParVectorLocalVector((hypre_ParVector *) x[k]), y_local );
+   }
+
+   return ( hypre_MPI_Allreduce(local_prod, prod, n, hypre_MPI_DOUBLE,
+                                hypre_MPI_SUM, comm) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovCopyVector
  *--------------------------------------------------------------------------*/
@@ -360,3 +360,50 @@ HYPRE_ParCSRMatrixMatvecT( double alpha,
    return ( hypre_ParCSRMatrixMatvecT( alpha, (hypre_ParCSRMatrix *) A,
 		(hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRSetPersistentComm
+ *   switches the persistent halo buffers/requests of the matvecs on (1,
+ *   default) or off (0)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRSetPersistentComm( HYPRE_Int persistent )
+{
+   return ( hypre_ParCSRSetPersistentComm( persistent ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRSetOverlapComm
+ *   chunk_size > 0 switches the matvec into overlap mode: the local part
+ *   is computed in chunks of chunk_size rows while the halo exchange
+ *   progresses; 0 (default) switches it off
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRSetOverlapComm( HYPRE_Int chunk_size )
+{
+   return ( hypre_ParCSRSetOverlapComm( chunk_size ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGetOverlapStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGetOverlapStats( double *halo_time,
+                             double *wait_time,
+                             double *overlap )
+{
+   return ( hypre_ParCSRGetOverlapStats( halo_time, wait_time, overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRResetOverlapStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRResetOverlapStats( )
+{
+   return ( hypre_ParCSRResetOverlapStats( ) );
+}
@@ -50,13 +50,20 @@ typedef struct
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
+   /* persistent buffers and communication handles for Matvec (job 1)
+      and MatvecT (job 2); created on first use and freed with the
+      comm_pkg, see hypre_ParCSRCommPkgGetPersistentCommHandle */
+   hypre_Vector                *tmp_vector;
+   double                      *buf_data;
+   struct hypre_ParCSRCommHandle_struct *persistent_comm_handles[2];
+
 } hypre_ParCSRCommPkg;
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle:
  *--------------------------------------------------------------------------*/
 
-typedef struct
+typedef struct hypre_ParCSRCommHandle_struct
 {
    hypre_ParCSRCommPkg  *comm_pkg;
    void 	  *send_data;
@@ -65,6 +72,9 @@ typedef struct
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
 
+   /* only used by persistent handles */
+   hypre_MPI_Status     *status;
+
 } hypre_ParCSRCommHandle;
 
 /*--------------------------------------------------------------------------
@@ -93,6 +103,11 @@ typedef struct
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)  (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i) (comm_pkg -> recv_mpi_types[i])
 
+#define hypre_ParCSRCommPkgTmpVector(comm_pkg)     (comm_pkg -> tmp_vector)
+#define hypre_ParCSRCommPkgBufData(comm_pkg)       (comm_pkg -> buf_data)
+#define hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg,job) \
+                                  (comm_pkg -> persistent_comm_handles[(job)-1])
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ParCSRCommHandle
  *--------------------------------------------------------------------------*/
@@ -103,6 +118,7 @@ typedef struct
 #define hypre_ParCSRCommHandleNumRequests(comm_handle) (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)    (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)  (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleStatus(comm_handle)      (comm_handle -> status)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -228,6 +244,27 @@ typedef struct
 #ifndef hypre_PAR_CSR_MATRIX_HEADER
 #define hypre_PAR_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * Off-processor part of a Parallel CSR Matrix, split by halo messages:
+ * block b contains all entries of offd whose columns are received from
+ * recv_procs[b], stored row-wise, so that it can be applied as soon as
+ * message b arrives (see hypre_ParCSRMatrixMatvec in overlap mode).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_CSRMatrix      *offd;      /* offd and comm_pkg this split was */
+   hypre_ParCSRCommPkg  *comm_pkg;  /* created for, to detect changes   */
+   HYPRE_Int             num_nonzeros;
+
+   HYPRE_Int             num_blocks;
+   HYPRE_Int            *block_starts; /* size num_blocks+1, into rows       */
+   HYPRE_Int            *rows;         /* local row index of each block row  */
+   HYPRE_Int            *row_starts;   /* into pos                           */
+   HYPRE_Int            *pos;          /* index into the j/data array of offd */
+
+} hypre_ParCSROffdSplit;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -280,6 +317,7 @@ typedef struct
    hypre_IJAssumedPart *assumed_partition; /* only populated if no_global_partition option
                                               is used (compile-time option)*/
 
+   hypre_ParCSROffdSplit *offd_split; /* created on first use by the overlapping matvec */
 
 } hypre_ParCSRMatrix;
 
@@ -314,6 +352,7 @@ hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(matrix))
 #define hypre_ParCSRMatrixRowvalues(matrix)       ((matrix) -> rowvalues)
 #define hypre_ParCSRMatrixGetrowactive(matrix)    ((matrix) -> getrowactive)
 #define hypre_ParCSRMatrixAssumedPartition(matrix) ((matrix) -> assumed_partition)
+#define hypre_ParCSRMatrixOffdSplit(matrix)       ((matrix) -> offd_split)
 
 
 
@@ -664,7 +703,15 @@ HYPRE_Int BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_ParCSRB
 
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMulti ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int num_vectors , void *send_data , void *recv_data );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
+HYPRE_Int hypre_ParCSRSetPersistentComm ( HYPRE_Int persistent );
+HYPRE_Int hypre_ParCSRGetPersistentComm ( HYPRE_Int *persistent );
+hypre_ParCSRCommHandle *hypre_ParCSRPersistentCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
+HYPRE_Int hypre_ParCSRPersistentCommHandleStart ( hypre_ParCSRCommHandle *comm_handle );
+HYPRE_Int hypre_ParCSRPersistentCommHandleWait ( hypre_ParCSRCommHandle *comm_handle );
+HYPRE_Int hypre_ParCSRPersistentCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
+hypre_ParCSRCommHandle *hypre_ParCSRCommPkgGetPersistentCommHandle ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg );
 void hypre_MatvecCommPkgCreate_core ( MPI_Comm comm , HYPRE_Int *col_map_offd , HYPRE_Int first_col_diag , HYPRE_Int *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int firstColDiag , HYPRE_Int *colMapOffd , HYPRE_Int data , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
@@ -717,6 +764,12 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixCompleteClone ( hypre_ParCSRMatrix *A );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixUnion ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B );
 
 /* par_csr_matvec.c */
+HYPRE_Int hypre_ParCSRSetOverlapComm ( HYPRE_Int chunk_size );
+HYPRE_Int hypre_ParCSRGetOverlapStats ( double *halo_time , double *wait_time , double *overlap );
+HYPRE_Int hypre_ParCSRResetOverlapStats ( void );
+HYPRE_Int hypre_ParCSRPrintOverlapStats ( const char *heading , MPI_Comm comm );
+hypre_ParCSROffdSplit *hypre_ParCSRMatrixGetOffdSplit ( hypre_ParCSRMatrix *A , hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSROffdSplitDestroy ( hypre_ParCSROffdSplit *split );
 HYPRE_Int hypre_ParCSRMatrixMatvec ( double alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , double beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( double alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , double beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( double alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , double beta , hypre_ParVector *y , HYPRE_Int *CF_marker , HYPRE_Int fpt );
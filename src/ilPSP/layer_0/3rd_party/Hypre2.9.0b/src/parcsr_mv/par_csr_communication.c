@@ -61,7 +61,7 @@ hypre_ParCSRCommHandleCreate ( HYPRE_Int 	      job,
     *--------------------------------------------------------------------*/
 
    num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests);
+   requests = hypre_WorkspaceCTAlloc(hypre_MPI_Request, num_requests);
  
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
@@ -180,7 +180,95 @@ hypre_ParCSRCommHandleCreate ( HYPRE_Int 	      job,
     * set up comm_handle and return
     *--------------------------------------------------------------------*/
 
-   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle, 1);
+   comm_handle = hypre_WorkspaceCTAlloc(hypre_ParCSRCommHandle, 1);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_ParCSRCommHandleSendData(comm_handle)    = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)    = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle) = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
+
+   return ( comm_handle );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMulti:
+ * like hypre_ParCSRCommHandleCreate with job = 1 or job = 2, but for
+ * num_vectors vectors in row storage, i.e. the data of each element are
+ * num_vectors consecutive doubles. The vectors are exchanged together,
+ * with one message per neighbor.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle *
+hypre_ParCSRCommHandleCreateMulti ( HYPRE_Int 	      job,
+			            hypre_ParCSRCommPkg *comm_pkg,
+                                    HYPRE_Int            num_vectors,
+                                    void          *send_data, 
+                                    void          *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   double              *d_send_data = (double *) send_data;
+   double              *d_recv_data = (double *) recv_data;
+
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                  num_requests;
+   hypre_MPI_Request         *requests;
+
+   HYPRE_Int                  i, j;
+   HYPRE_Int			ip, vec_start, vec_len;
+
+   hypre_assert( job==1 || job==2 );
+
+   num_requests = num_sends + num_recvs;
+   requests = hypre_WorkspaceCTAlloc(hypre_MPI_Request, num_requests);
+
+   j = 0;
+   if (job == 1)
+   {
+   	for (i = 0; i < num_recvs; i++)
+   	{
+      		ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i); 
+      		vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+      		vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+      		hypre_MPI_Irecv(&d_recv_data[vec_start*num_vectors],
+                        vec_len*num_vectors, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   	for (i = 0; i < num_sends; i++)
+   	{
+	    vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+	    vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+      	    ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i); 
+   	    hypre_MPI_Isend(&d_send_data[vec_start*num_vectors],
+                        vec_len*num_vectors, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   }
+   else
+   {
+   	for (i = 0; i < num_sends; i++)
+   	{
+	    vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+	    vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+      	    ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i); 
+   	    hypre_MPI_Irecv(&d_recv_data[vec_start*num_vectors],
+                        vec_len*num_vectors, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   	for (i = 0; i < num_recvs; i++)
+   	{
+      		ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i); 
+      		vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+      		vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+      		hypre_MPI_Isend(&d_send_data[vec_start*num_vectors],
+                        vec_len*num_vectors, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   }
+
+   comm_handle = hypre_WorkspaceCTAlloc(hypre_ParCSRCommHandle, 1);
 
    hypre_ParCSRCommHandleCommPkg(comm_handle)     = comm_pkg;
    hypre_ParCSRCommHandleSendData(comm_handle)    = send_data;
@@ -200,19 +288,218 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
    if ( comm_handle==NULL ) return hypre_error_flag;
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
-      status0 = hypre_CTAlloc(hypre_MPI_Status,
-                       hypre_ParCSRCommHandleNumRequests(comm_handle));
+      status0 = hypre_WorkspaceTAlloc(hypre_MPI_Status,
+                              hypre_ParCSRCommHandleNumRequests(comm_handle));
+      hypre_ProfileBegin(HYPRE_PROFILE_COMM_WAIT);
       hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                   hypre_ParCSRCommHandleRequests(comm_handle), status0);
-      hypre_TFree(status0);
+      hypre_ProfileEnd(HYPRE_PROFILE_COMM_WAIT);
+      hypre_WorkspaceTFree(status0);
    }
 
+   hypre_WorkspaceTFree(hypre_ParCSRCommHandleRequests(comm_handle));
+   hypre_WorkspaceTFree(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Persistent communication for hypre_ParCSRMatrixMatvec and
+ * hypre_ParCSRMatrixMatvecT: if switched on (default), the halo buffers
+ * and the (persistent) MPI requests are attached to the comm_pkg on first
+ * use and reused by all subsequent matvecs, instead of being allocated,
+ * posted and freed in every call.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_persistent_comm = 1;
+
+HYPRE_Int
+hypre_ParCSRSetPersistentComm( HYPRE_Int persistent )
+{
+   hypre_persistent_comm = persistent;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRGetPersistentComm( HYPRE_Int *persistent )
+{
+   *persistent = hypre_persistent_comm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPersistentCommHandleCreate:
+ * like hypre_ParCSRCommHandleCreate, but the requests are only initialized
+ * (MPI_Send_init/MPI_Recv_init) and not started, i.e. send_data and
+ * recv_data must stay valid until the handle is destroyed.
+ * Only job = 1 and job = 2 are supported.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle *
+hypre_ParCSRPersistentCommHandleCreate ( HYPRE_Int 	      job,
+			                 hypre_ParCSRCommPkg *comm_pkg,
+                                         void          *send_data, 
+                                         void          *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   double              *d_send_data = (double *) send_data;
+   double              *d_recv_data = (double *) recv_data;
+
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                  num_requests;
+   hypre_MPI_Request         *requests;
+
+   HYPRE_Int                  i, j;
+   HYPRE_Int			ip, vec_start, vec_len;
+
+   hypre_assert( job==1 || job==2 );
+
+   num_requests = num_sends + num_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests);
+
+   /* receives are always first, so that the requests can also be
+      completed one by one */
+   j = 0;
+   if (job == 1)
+   {
+   	for (i = 0; i < num_recvs; i++)
+   	{
+      		ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i); 
+      		vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+      		vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+      		hypre_MPI_Recv_init(&d_recv_data[vec_start], vec_len, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   	for (i = 0; i < num_sends; i++)
+   	{
+	    vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+	    vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1)-vec_start;
+      	    ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i); 
+   	    hypre_MPI_Send_init(&d_send_data[vec_start], vec_len, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   }
+   else
+   {
+   	for (i = 0; i < num_sends; i++)
+   	{
+	    vec_start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+	    vec_len = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) - vec_start;
+      	    ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i); 
+   	    hypre_MPI_Recv_init(&d_recv_data[vec_start], vec_len, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   	for (i = 0; i < num_recvs; i++)
+   	{
+      		ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i); 
+      		vec_start = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i);
+      		vec_len = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,i+1)-vec_start;
+      		hypre_MPI_Send_init(&d_send_data[vec_start], vec_len, hypre_MPI_DOUBLE,
+			ip, 0, comm, &requests[j++]);
+   	}
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle, 1);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_ParCSRCommHandleSendData(comm_handle)    = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)    = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle) = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
+   hypre_ParCSRCommHandleStatus(comm_handle)      =
+      hypre_CTAlloc(hypre_MPI_Status, num_requests);
+
+   return ( comm_handle );
+}
+
+HYPRE_Int
+hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRCommHandle *comm_handle )
+{
+   if (hypre_ParCSRCommHandleNumRequests(comm_handle))
+      hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                         hypre_ParCSRCommHandleRequests(comm_handle));
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRCommHandle *comm_handle )
+{
+   if (hypre_ParCSRCommHandleNumRequests(comm_handle))
+   {
+      hypre_ProfileBegin(HYPRE_PROFILE_COMM_WAIT);
+      hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                        hypre_ParCSRCommHandleRequests(comm_handle),
+                        hypre_ParCSRCommHandleStatus(comm_handle));
+      hypre_ProfileEnd(HYPRE_PROFILE_COMM_WAIT);
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
+{
+   HYPRE_Int i;
+
+   if ( comm_handle==NULL ) return hypre_error_flag;
+
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+
+   hypre_TFree(hypre_ParCSRCommHandleStatus(comm_handle));
    hypre_TFree(hypre_ParCSRCommHandleRequests(comm_handle));
    hypre_TFree(comm_handle);
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgGetPersistentCommHandle:
+ * returns the persistent handle of comm_pkg for job 1 (Matvec) or
+ * job 2 (MatvecT) and creates it (and the buffers) on first use.
+ * For job 1, the send buffer is BufData and the receive buffer is the data
+ * of TmpVector (i.e. the off-processor part of x); for job 2 it is vice
+ * versa. Both handles share the same buffers.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle *
+hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job,
+                                            hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   double   *tmp_data;
+
+   if (!hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, job))
+   {
+      if (!hypre_ParCSRCommPkgTmpVector(comm_pkg))
+      {
+         hypre_ParCSRCommPkgTmpVector(comm_pkg) = hypre_SeqVectorCreate(
+            hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs));
+         hypre_SeqVectorInitialize(hypre_ParCSRCommPkgTmpVector(comm_pkg));
+         hypre_ParCSRCommPkgBufData(comm_pkg) = hypre_CTAlloc(double,
+            hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+      }
+      tmp_data = hypre_VectorData(hypre_ParCSRCommPkgTmpVector(comm_pkg));
+
+      if (job == 1)
+         hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, job) =
+            hypre_ParCSRPersistentCommHandleCreate(job, comm_pkg,
+               hypre_ParCSRCommPkgBufData(comm_pkg), tmp_data);
+      else
+         hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, job) =
+            hypre_ParCSRPersistentCommHandleCreate(job, comm_pkg,
+               tmp_data, hypre_ParCSRCommPkgBufData(comm_pkg));
+   }
+
+   return hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, job);
+}
+
 
 /* hypre_MatCommPkgCreate_core does all the communications and computations for
        hypre_MatCommPkgCreate ( hypre_ParCSRMatrix *A)
@@ -567,6 +854,13 @@ hypre_MatvecCommPkgDestroy(hypre_ParCSRCommPkg *comm_pkg)
    hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg));
    /* if (hypre_ParCSRCommPkgRecvMPITypes(comm_pkg))
       hypre_TFree(hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)); */
+   hypre_ParCSRPersistentCommHandleDestroy(
+      hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, 1));
+   hypre_ParCSRPersistentCommHandleDestroy(
+      hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg, 2));
+   if (hypre_ParCSRCommPkgTmpVector(comm_pkg))
+      hypre_SeqVectorDestroy(hypre_ParCSRCommPkgTmpVector(comm_pkg));
+   hypre_TFree(hypre_ParCSRCommPkgBufData(comm_pkg));
    hypre_TFree(comm_pkg);
 
    return hypre_error_flag;
@@ -38,13 +38,20 @@ typedef struct
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
+   /* persistent buffers and communication handles for Matvec (job 1)
+      and MatvecT (job 2); created on first use and freed with the
+      comm_pkg, see hypre_ParCSRCommPkgGetPersistentCommHandle */
+   hypre_Vector                *tmp_vector;
+   double                      *buf_data;
+   struct hypre_ParCSRCommHandle_struct *persistent_comm_handles[2];
+
 } hypre_ParCSRCommPkg;
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle:
  *--------------------------------------------------------------------------*/
 
-typedef struct
+typedef struct hypre_ParCSRCommHandle_struct
 {
    hypre_ParCSRCommPkg  *comm_pkg;
    void 	  *send_data;
@@ -53,6 +60,9 @@ typedef struct
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
 
+   /* only used by persistent handles */
+   hypre_MPI_Status     *status;
+
 } hypre_ParCSRCommHandle;
 
 /*--------------------------------------------------------------------------
@@ -81,6 +91,11 @@ typedef struct
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)  (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i) (comm_pkg -> recv_mpi_types[i])
 
+#define hypre_ParCSRCommPkgTmpVector(comm_pkg)     (comm_pkg -> tmp_vector)
+#define hypre_ParCSRCommPkgBufData(comm_pkg)       (comm_pkg -> buf_data)
+#define hypre_ParCSRCommPkgPersistentCommHandle(comm_pkg,job) \
+                                  (comm_pkg -> persistent_comm_handles[(job)-1])
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_ParCSRCommHandle
  *--------------------------------------------------------------------------*/
@@ -91,5 +106,6 @@ typedef struct
 #define hypre_ParCSRCommHandleNumRequests(comm_handle) (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)    (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)  (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleStatus(comm_handle)      (comm_handle -> status)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
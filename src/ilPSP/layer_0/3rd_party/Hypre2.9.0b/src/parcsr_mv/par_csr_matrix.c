@@ -174,6 +174,7 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
       if (hypre_ParCSRMatrixAssumedPartition(matrix))
          hypre_ParCSRMatrixDestroyAssumedPartition(matrix);
 
+      hypre_ParCSROffdSplitDestroy(hypre_ParCSRMatrixOffdSplit(matrix));
 
       hypre_TFree(matrix);
    }
@@ -25,6 +25,27 @@
 #ifndef hypre_PAR_CSR_MATRIX_HEADER
 #define hypre_PAR_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * Off-processor part of a Parallel CSR Matrix, split by halo messages:
+ * block b contains all entries of offd whose columns are received from
+ * recv_procs[b], stored row-wise, so that it can be applied as soon as
+ * message b arrives (see hypre_ParCSRMatrixMatvec in overlap mode).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_CSRMatrix      *offd;      /* offd and comm_pkg this split was */
+   hypre_ParCSRCommPkg  *comm_pkg;  /* created for, to detect changes   */
+   HYPRE_Int             num_nonzeros;
+
+   HYPRE_Int             num_blocks;
+   HYPRE_Int            *block_starts; /* size num_blocks+1, into rows       */
+   HYPRE_Int            *rows;         /* local row index of each block row  */
+   HYPRE_Int            *row_starts;   /* into pos                           */
+   HYPRE_Int            *pos;          /* index into the j/data array of offd */
+
+} hypre_ParCSROffdSplit;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -77,6 +98,7 @@ typedef struct
    hypre_IJAssumedPart *assumed_partition; /* only populated if no_global_partition option
                                               is used (compile-time option)*/
 
+   hypre_ParCSROffdSplit *offd_split; /* created on first use by the overlapping matvec */
 
 } hypre_ParCSRMatrix;
 
@@ -111,6 +133,7 @@ hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(matrix))
 #define hypre_ParCSRMatrixRowvalues(matrix)       ((matrix) -> rowvalues)
 #define hypre_ParCSRMatrixGetrowactive(matrix)    ((matrix) -> getrowactive)
 #define hypre_ParCSRMatrixAssumedPartition(matrix) ((matrix) -> assumed_partition)
+#define hypre_ParCSRMatrixOffdSplit(matrix)       ((matrix) -> offd_split)
 
 
 
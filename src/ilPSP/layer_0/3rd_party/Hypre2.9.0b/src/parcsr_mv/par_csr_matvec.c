@@ -22,6 +22,356 @@
 #include "_hypre_parcsr_mv.h"
 #include <assert.h>
 
+/*--------------------------------------------------------------------------
+ * Overlap mode of hypre_ParCSRMatrixMatvec: the diag product is computed
+ * in chunks of hypre_overlap_chunk_size rows and MPI_Testall is called
+ * between the chunks, so that MPI can progress the halo exchange; the
+ * offd part is then applied message by message as the halos arrive
+ * (MPI_Waitany). A chunk size of 0 (default) switches the mode off.
+ *
+ * The statistics measure the time from starting the exchange until the
+ * last halo message has arrived (halo time) and the part of it in which
+ * the matvec was blocked waiting (wait time); the overlap is the
+ * percentage of the halo time hidden behind the diag computation.
+ *
+ * Chunk size and statistics are process-global, i.e. shared by all
+ * matrices; the statistics are accumulated over all overlapping matvecs
+ * of the process since the last hypre_ParCSRResetOverlapStats (or
+ * hypre_ParCSRPrintOverlapStats, which resets them).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_overlap_chunk_size = 0;
+static double    hypre_overlap_halo_time = 0.0;
+static double    hypre_overlap_wait_time = 0.0;
+
+HYPRE_Int
+hypre_ParCSRSetOverlapComm( HYPRE_Int chunk_size )
+{
+   hypre_overlap_chunk_size = chunk_size;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRGetOverlapStats( double *halo_time,
+                             double *wait_time,
+                             double *overlap )
+{
+   *halo_time = hypre_overlap_halo_time;
+   *wait_time = hypre_overlap_wait_time;
+   if (hypre_overlap_halo_time > 0.0)
+      *overlap = 100.0*(1.0 - hypre_overlap_wait_time/hypre_overlap_halo_time);
+   else
+      *overlap = 0.0;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRResetOverlapStats( )
+{
+   hypre_overlap_halo_time = 0.0;
+   hypre_overlap_wait_time = 0.0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPrintOverlapStats
+ *   prints the overlap statistics in the format of hypre_PrintTiming
+ *   (maximum over all processes) and resets them
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRPrintOverlapStats( const char *heading,
+                               MPI_Comm    comm )
+{
+   double  local_time[2], time[2], local_overlap, overlap;
+   HYPRE_Int     myrank;
+
+   hypre_MPI_Comm_rank(comm, &myrank );
+
+   hypre_ParCSRGetOverlapStats(&local_time[0], &local_time[1], &local_overlap);
+   hypre_MPI_Allreduce(local_time, time, 2, hypre_MPI_DOUBLE, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(&local_overlap, &overlap, 1, hypre_MPI_DOUBLE, hypre_MPI_MIN, comm);
+
+   if (myrank == 0)
+   {
+      hypre_printf("=============================================\n");
+      hypre_printf("%s:\n", heading);
+      hypre_printf("=============================================\n");
+      hypre_printf("Matvec halo exchange:\n");
+      hypre_printf("  halo time       = %f seconds\n", time[0]);
+      hypre_printf("  wait time       = %f seconds\n", time[1]);
+      hypre_printf("  overlap         = %f %%\n\n", overlap);
+   }
+
+   hypre_ParCSRResetOverlapStats();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixGetOffdSplit
+ *   returns the offd part of A split by the receives of comm_pkg; it is
+ *   (re-)created if it does not exist or offd/comm_pkg have changed.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSROffdSplit *
+hypre_ParCSRMatrixGetOffdSplit( hypre_ParCSRMatrix  *A,
+                                hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_CSRMatrix       *offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int             *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int             *offd_j = hypre_CSRMatrixJ(offd);
+   HYPRE_Int              num_rows = hypre_CSRMatrixNumRows(offd);
+   HYPRE_Int              num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int              num_nonzeros = hypre_CSRMatrixNumNonzeros(offd);
+   HYPRE_Int              num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   hypre_ParCSROffdSplit *split = hypre_ParCSRMatrixOffdSplit(A);
+
+   HYPRE_Int   *col_block, *num_block_rows, *next_row, *next_pos, *last_row;
+   HYPRE_Int    i, j, b, k, num_split_rows;
+
+   if (split)
+   {
+      if (split -> offd == offd && split -> comm_pkg == comm_pkg &&
+          split -> num_nonzeros == num_nonzeros)
+         return split;
+
+      hypre_ParCSROffdSplitDestroy(split);
+   }
+
+   /* block of each offd column */
+   col_block = hypre_CTAlloc(HYPRE_Int, num_cols_offd);
+   for (b = 0; b < num_recvs; b++)
+      for (j = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, b);
+           j < hypre_ParCSRCommPkgRecvVecStart(comm_pkg, b+1); j++)
+         col_block[j] = b;
+
+   /* count rows and nonzeros per block */
+   num_block_rows = hypre_CTAlloc(HYPRE_Int, num_recvs+1);
+   next_pos = hypre_CTAlloc(HYPRE_Int, num_recvs+1);
+   last_row = hypre_CTAlloc(HYPRE_Int, num_recvs);
+   for (b = 0; b < num_recvs; b++)
+      last_row[b] = -1;
+   for (i = 0; i < num_rows; i++)
+      for (k = offd_i[i]; k < offd_i[i+1]; k++)
+      {
+         b = col_block[offd_j[k]];
+         if (last_row[b] != i)
+         {
+            last_row[b] = i;
+            num_block_rows[b+1]++;
+         }
+         next_pos[b+1]++;
+      }
+   for (b = 0; b < num_recvs; b++)
+   {
+      num_block_rows[b+1] += num_block_rows[b];
+      next_pos[b+1] += next_pos[b];
+   }
+   num_split_rows = num_block_rows[num_recvs];
+
+   split = hypre_CTAlloc(hypre_ParCSROffdSplit, 1);
+   split -> offd = offd;
+   split -> comm_pkg = comm_pkg;
+   split -> num_nonzeros = num_nonzeros;
+   split -> num_blocks = num_recvs;
+   split -> block_starts = hypre_CTAlloc(HYPRE_Int, num_recvs+1);
+   split -> rows = hypre_CTAlloc(HYPRE_Int, num_split_rows);
+   split -> row_starts = hypre_CTAlloc(HYPRE_Int, num_split_rows+1);
+   split -> pos = hypre_CTAlloc(HYPRE_Int, num_nonzeros);
+
+   /* fill: rows of a block in ascending order, blocks one after another */
+   next_row = hypre_CTAlloc(HYPRE_Int, num_recvs);
+   for (b = 0; b < num_recvs; b++)
+   {
+      split -> block_starts[b] = num_block_rows[b];
+      next_row[b] = num_block_rows[b];
+      last_row[b] = -1;
+   }
+   split -> block_starts[num_recvs] = num_split_rows;
+   for (i = 0; i < num_rows; i++)
+      for (k = offd_i[i]; k < offd_i[i+1]; k++)
+      {
+         b = col_block[offd_j[k]];
+         if (last_row[b] != i)
+         {
+            last_row[b] = i;
+            split -> rows[next_row[b]] = i;
+            split -> row_starts[next_row[b]] = next_pos[b];
+            next_row[b]++;
+         }
+         split -> pos[next_pos[b]++] = k;
+      }
+   split -> row_starts[num_split_rows] = num_nonzeros;
+
+   hypre_TFree(col_block);
+   hypre_TFree(num_block_rows);
+   hypre_TFree(next_pos);
+   hypre_TFree(next_row);
+   hypre_TFree(last_row);
+
+   hypre_ParCSRMatrixOffdSplit(A) = split;
+
+   return split;
+}
+
+HYPRE_Int
+hypre_ParCSROffdSplitDestroy( hypre_ParCSROffdSplit *split )
+{
+   if (split)
+   {
+      hypre_TFree(split -> block_starts);
+      hypre_TFree(split -> rows);
+      hypre_TFree(split -> row_starts);
+      hypre_TFree(split -> pos);
+      hypre_TFree(split);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * y[i] = alpha*(A*x)[i] + beta*y[i] for row_begin <= i < row_end
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixMatvecRows( double           alpha,
+                           hypre_CSRMatrix *A,
+                           double          *x_data,
+                           double           beta,
+                           double          *y_data,
+                           HYPRE_Int        row_begin,
+                           HYPRE_Int        row_end )
+{
+   double     *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int  *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int  *A_j      = hypre_CSRMatrixJ(A);
+   double      temp;
+   HYPRE_Int   i, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = row_begin; i < row_end; i++)
+   {
+      temp = 0.0;
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         temp += A_data[jj] * x_data[A_j[jj]];
+      if (beta == 0.0)
+         y_data[i] = alpha*temp;
+      else
+         y_data[i] = beta*y_data[i] + alpha*temp;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * y += alpha*offd*x_tmp, restricted to the columns of halo message b
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSROffdSplitMatvecBlock( double                 alpha,
+                                  hypre_ParCSROffdSplit *split,
+                                  HYPRE_Int              b,
+                                  double                *x_tmp_data,
+                                  double                *y_data )
+{
+   double     *offd_data = hypre_CSRMatrixData(split -> offd);
+   HYPRE_Int  *offd_j    = hypre_CSRMatrixJ(split -> offd);
+   HYPRE_Int  *rows      = split -> rows;
+   HYPRE_Int  *row_starts = split -> row_starts;
+   HYPRE_Int  *pos       = split -> pos;
+   double      temp;
+   HYPRE_Int   ir, jj, k;
+
+   for (ir = split -> block_starts[b]; ir < split -> block_starts[b+1]; ir++)
+   {
+      temp = 0.0;
+      for (jj = row_starts[ir]; jj < row_starts[ir+1]; jj++)
+      {
+         k = pos[jj];
+         temp += offd_data[k] * x_tmp_data[offd_j[k]];
+      }
+      y_data[rows[ir]] += alpha*temp;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * overlapping version of the persistent matvec, see above
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixMatvecOverlap( double                  alpha,
+                                 hypre_ParCSRMatrix     *A,
+                                 hypre_Vector           *x_local,
+                                 double                  beta,
+                                 hypre_Vector           *y_local,
+                                 hypre_ParCSRCommPkg    *comm_pkg,
+                                 hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_CSRMatrix   *diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          num_rows = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int          num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int          num_requests = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   hypre_MPI_Request *requests = hypre_ParCSRCommHandleRequests(comm_handle);
+   hypre_MPI_Status  *status = hypre_ParCSRCommHandleStatus(comm_handle);
+   double            *x_data = hypre_VectorData(x_local);
+   double            *y_data = hypre_VectorData(y_local);
+   double            *x_tmp_data = (double *) hypre_ParCSRCommHandleRecvData(comm_handle);
+   hypre_ParCSROffdSplit *split;
+
+   HYPRE_Int          chunk = hypre_overlap_chunk_size;
+   HYPRE_Int          done, i, b, n;
+   double             t, t_start, t_done, t_wait;
+
+   split = hypre_ParCSRMatrixGetOffdSplit(A, comm_pkg);
+
+   t_start = hypre_MPI_Wtime();
+   t_done = t_start;
+   hypre_ParCSRPersistentCommHandleStart(comm_handle);
+
+   /* diag in chunks, polling the exchange in between */
+   done = (num_requests == 0);
+   for (i = 0; i < num_rows; i += chunk)
+   {
+      hypre_CSRMatrixMatvecRows(alpha, diag, x_data, beta, y_data,
+                                i, hypre_min(i+chunk, num_rows));
+      if (!done)
+      {
+         hypre_MPI_Testall(num_requests, requests, &done, status);
+         if (done) t_done = hypre_MPI_Wtime();
+      }
+   }
+
+   /* offd, message by message */
+   t_wait = 0.0;
+   if (done)
+   {
+      for (b = 0; b < num_recvs; b++)
+         hypre_ParCSROffdSplitMatvecBlock(alpha, split, b, x_tmp_data, y_data);
+   }
+   else
+   {
+      for (n = 0; n < num_recvs; n++)
+      {
+         t = hypre_MPI_Wtime();
+         hypre_MPI_Waitany(num_recvs, requests, &b, status);
+         t_done = hypre_MPI_Wtime();
+         t_wait += t_done - t;
+         hypre_ParCSROffdSplitMatvecBlock(alpha, split, b, x_tmp_data, y_data);
+      }
+      t = hypre_MPI_Wtime();
+      hypre_MPI_Waitall(num_requests-num_recvs, &requests[num_recvs], status);
+      t_done = hypre_MPI_Wtime();
+      t_wait += t_done - t;
+   }
+
+   hypre_overlap_halo_time += t_done - t_start;
+   hypre_overlap_wait_time += t_wait;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -49,12 +399,16 @@ hypre_ParCSRMatrixMatvec( double           alpha,
    HYPRE_Int	      num_cols_offd = hypre_CSRMatrixNumCols(offd);
    HYPRE_Int        ierr = 0;
    HYPRE_Int	      num_sends, i, j, jv, index, start;
+   HYPRE_Int        persistent;
 
    HYPRE_Int        vecstride = hypre_VectorVectorStride( x_local );
    HYPRE_Int        idxstride = hypre_VectorIndexStride( x_local );
 
    double     *x_tmp_data, **x_buf_data;
    double     *x_local_data = hypre_VectorData(x_local);
+   hypre_ParCSRCommHandle  *persistent_handle;
+   hypre_ProfileBegin(HYPRE_PROFILE_MATVEC);
+
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  ParMatvec returns ierr = 11 if
     *  length of X doesn't equal the number of columns of A,
@@ -79,6 +433,108 @@ hypre_ParCSRMatrixMatvec( double           alpha,
 
     hypre_assert( hypre_VectorNumVectors(y_local)==num_vectors );
 
+   /*---------------------------------------------------------------------
+    * If there exists no CommPkg for A, a CommPkg is generated using
+    * equally load balanced partitionings
+    *--------------------------------------------------------------------*/
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A); 
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /*---------------------------------------------------------------------
+    * persistent communication: halo buffers and MPI requests are
+    * taken from the comm_pkg, nothing is allocated here.
+    *--------------------------------------------------------------------*/
+   hypre_ParCSRGetPersistentComm(&persistent);
+   if ( persistent && num_vectors==1 &&
+        hypre_ParCSRCommPkgRecvVecStart(comm_pkg,
+           hypre_ParCSRCommPkgNumRecvs(comm_pkg))==num_cols_offd )
+   {
+      persistent_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      x_tmp = hypre_ParCSRCommPkgTmpVector(comm_pkg);
+      x_buf_data = &(hypre_ParCSRCommPkgBufData(comm_pkg));
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+            x_buf_data[0][index++] 
+               = x_local_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
+      }
+
+      /* the chunked kernels only read double data, see
+         hypre_CSRMatrixSetSinglePrecision */
+      if (hypre_overlap_chunk_size > 0 && !hypre_CSRMatrixSPData(diag))
+      {
+         hypre_ParCSRMatrixMatvecOverlap(alpha, A, x_local, beta, y_local,
+                                         comm_pkg, persistent_handle);
+      }
+      else
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_handle);
+
+         hypre_CSRMatrixMatvec( alpha, diag, x_local, beta, y_local);
+
+         hypre_ParCSRPersistentCommHandleWait(persistent_handle);
+
+         if (num_cols_offd) hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local);    
+      }
+
+      hypre_ProfileEnd(HYPRE_PROFILE_MATVEC);
+      return ierr;
+   }
+
+   /*---------------------------------------------------------------------
+    * multivectors in row storage: all vectors are exchanged with one
+    * message per neighbor, diag and offd are applied with the SpMM kernel
+    * of hypre_CSRMatrixMatvec.
+    *--------------------------------------------------------------------*/
+   if ( num_vectors>1 && idxstride==num_vectors )
+   {
+      hypre_assert( vecstride==1 );
+      hypre_assert( hypre_VectorIndexStride(y_local)==num_vectors );
+
+      x_tmp = hypre_SeqMultiVectorCreate( num_cols_offd, num_vectors );
+      hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+      hypre_SeqVectorInitialize(x_tmp);
+      x_tmp_data = hypre_VectorData(x_tmp);
+
+      x_buf_data = hypre_CTAlloc( double*, 1 );
+      x_buf_data[0] = hypre_CTAlloc(double, num_vectors*
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+            for ( jv=0; jv<num_vectors; ++jv )
+               x_buf_data[0][index++] = x_local_data[
+                  jv + num_vectors*hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j) ];
+      }
+
+      comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle*, 1);
+      comm_handle[0] = hypre_ParCSRCommHandleCreateMulti
+         ( 1, comm_pkg, num_vectors, x_buf_data[0], x_tmp_data );
+
+      hypre_CSRMatrixMatvec( alpha, diag, x_local, beta, y_local);
+
+      hypre_ParCSRCommHandleDestroy(comm_handle[0]);
+      hypre_TFree(comm_handle);
+
+      if (num_cols_offd) hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local);    
+
+      hypre_SeqVectorDestroy(x_tmp);
+      hypre_TFree(x_buf_data[0]);
+      hypre_TFree(x_buf_data);
+
+      hypre_ProfileEnd(HYPRE_PROFILE_MATVEC);
+      return ierr;
+   }
+
     if ( num_vectors==1 )
        x_tmp = hypre_SeqVectorCreate( num_cols_offd );
     else
@@ -91,17 +547,6 @@ hypre_ParCSRMatrixMatvec( double           alpha,
    
    comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle*,num_vectors);
 
-   /*---------------------------------------------------------------------
-    * If there exists no CommPkg for A, a CommPkg is generated using
-    * equally load balanced partitionings
-    *--------------------------------------------------------------------*/
-   if (!comm_pkg)
-   {
-      hypre_MatvecCommPkgCreate(A);
-      comm_pkg = hypre_ParCSRMatrixCommPkg(A); 
-   }
-
-   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    x_buf_data = hypre_CTAlloc( double*, num_vectors );
    for ( jv=0; jv<num_vectors; ++jv )
       x_buf_data[jv] = hypre_CTAlloc(double, hypre_ParCSRCommPkgSendMapStart
@@ -134,13 +579,8 @@ hypre_ParCSRMatrixMatvec( double           alpha,
       }
 
    hypre_assert( idxstride==1 );
-   /* >>> ... The assert is because the following loop only works for 'column' storage of a multivector <<<
-      >>> This needs to be fixed to work more generally, at least for 'row' storage. <<<
-      >>> This in turn, means either change CommPkg so num_sends is no.zones*no.vectors (not no.zones)
-      >>> or, less dangerously, put a stride in the logic of CommHandleCreate (stride either from a
-      >>> new arg or a new variable inside CommPkg).  Or put the num_vector iteration inside
-      >>> CommHandleCreate (perhaps a new multivector variant of it).
-   */
+   /* the following loop only works for 'column' storage of a multivector;
+      'row' storage is handled above, with hypre_ParCSRCommHandleCreateMulti */
    for ( jv=0; jv<num_vectors; ++jv )
    {
       comm_handle[jv] = hypre_ParCSRCommHandleCreate
@@ -163,6 +603,7 @@ hypre_ParCSRMatrixMatvec( double           alpha,
    for ( jv=0; jv<num_vectors; ++jv ) hypre_TFree(x_buf_data[jv]);
    hypre_TFree(x_buf_data);
   
+   hypre_ProfileEnd(HYPRE_PROFILE_MATVEC);
    return ierr;
 }
 
@@ -200,9 +641,13 @@ hypre_ParCSRMatrixMatvecT( double           alpha,
    HYPRE_Int         num_vectors = hypre_VectorNumVectors(y_local);
 
    HYPRE_Int         i, j, jv, index, start, num_sends;
+   HYPRE_Int         persistent;
+   hypre_ParCSRCommHandle *persistent_handle;
 
    HYPRE_Int         ierr  = 0;
 
+   hypre_ProfileBegin(HYPRE_PROFILE_MATVECT);
+
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  MatvecT returns ierr = 1 if
     *  length of X doesn't equal the number of rows of A,
@@ -222,6 +667,98 @@ hypre_ParCSRMatrixMatvecT( double           alpha,
 
     if (num_rows != x_size && num_cols != y_size)
               ierr = 3;
+
+   /*---------------------------------------------------------------------
+    * If there exists no CommPkg for A, a CommPkg is generated using
+    * equally load balanced partitionings
+    *--------------------------------------------------------------------*/
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A); 
+   }
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /*---------------------------------------------------------------------
+    * persistent communication: halo buffers and MPI requests are
+    * taken from the comm_pkg, nothing is allocated here.
+    *--------------------------------------------------------------------*/
+   hypre_ParCSRGetPersistentComm(&persistent);
+   if ( persistent && num_vectors==1 &&
+        hypre_ParCSRCommPkgRecvVecStart(comm_pkg,
+           hypre_ParCSRCommPkgNumRecvs(comm_pkg))==num_cols_offd )
+   {
+      persistent_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
+      y_tmp = hypre_ParCSRCommPkgTmpVector(comm_pkg);
+      y_buf_data = &(hypre_ParCSRCommPkgBufData(comm_pkg));
+
+      if (num_cols_offd) hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+
+      hypre_ParCSRPersistentCommHandleStart(persistent_handle);
+
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+
+      hypre_ParCSRPersistentCommHandleWait(persistent_handle);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+            y_local_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)]
+               += y_buf_data[0][index++];
+      }
+
+      hypre_ProfileEnd(HYPRE_PROFILE_MATVECT);
+      return ierr;
+   }
+
+   /*---------------------------------------------------------------------
+    * multivectors in row storage: one message per neighbor
+    *--------------------------------------------------------------------*/
+   if ( num_vectors>1 && idxstride==num_vectors )
+   {
+      hypre_assert( vecstride==1 );
+      hypre_assert( hypre_VectorIndexStride(x_local)==num_vectors );
+
+      y_tmp = hypre_SeqMultiVectorCreate( num_cols_offd, num_vectors );
+      hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+      hypre_SeqVectorInitialize(y_tmp);
+      y_tmp_data = hypre_VectorData(y_tmp);
+
+      y_buf_data = hypre_CTAlloc( double*, 1 );
+      y_buf_data[0] = hypre_CTAlloc(double, num_vectors*
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+
+      if (num_cols_offd) hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+
+      comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle*, 1);
+      comm_handle[0] = hypre_ParCSRCommHandleCreateMulti
+         ( 2, comm_pkg, num_vectors, y_tmp_data, y_buf_data[0] );
+
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+
+      hypre_ParCSRCommHandleDestroy(comm_handle[0]);
+      hypre_TFree(comm_handle);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+            for ( jv=0; jv<num_vectors; ++jv )
+               y_local_data[ jv + num_vectors*hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j) ]
+                  += y_buf_data[0][index++];
+      }
+
+      hypre_SeqVectorDestroy(y_tmp);
+      hypre_TFree(y_buf_data[0]);
+      hypre_TFree(y_buf_data);
+
+      hypre_ProfileEnd(HYPRE_PROFILE_MATVECT);
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     *-----------------------------------------------------------------------*/
 
@@ -237,17 +774,6 @@ hypre_ParCSRMatrixMatvecT( double           alpha,
     }
     hypre_SeqVectorInitialize(y_tmp);
 
-   /*---------------------------------------------------------------------
-    * If there exists no CommPkg for A, a CommPkg is generated using
-    * equally load balanced partitionings
-    *--------------------------------------------------------------------*/
-   if (!comm_pkg)
-   {
-      hypre_MatvecCommPkgCreate(A);
-      comm_pkg = hypre_ParCSRMatrixCommPkg(A); 
-   }
-
-   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
    y_buf_data = hypre_CTAlloc( double*, num_vectors );
    for ( jv=0; jv<num_vectors; ++jv )
       y_buf_data[jv] = hypre_CTAlloc(double, hypre_ParCSRCommPkgSendMapStart
@@ -305,6 +831,7 @@ hypre_ParCSRMatrixMatvecT( double           alpha,
    for ( jv=0; jv<num_vectors; ++jv ) hypre_TFree(y_buf_data[jv]);
    hypre_TFree(y_buf_data);
 
+   hypre_ProfileEnd(HYPRE_PROFILE_MATVECT);
    return ierr;
 }
 /*--------------------------------------------------------------------------
@@ -294,6 +294,105 @@ hypre_CSRMatrixDeleteZeros( hypre_CSRMatrix *A, double tol)
  *
  *****************************************************************************/
 
+#ifdef HYPRE_USING_OPENMP
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTransposeThreaded
+ *
+ * Each thread counts the column entries of a contiguous block of rows;
+ * thread t then starts row c of AT behind the entries of threads 0,...,t-1,
+ * so the entries of each row of AT come out sorted by the row index of A,
+ * exactly as in the sequential version.  Needs num_threads*num_rowsAT
+ * integers of work space.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixTransposeThreaded( HYPRE_Int  *A_i,
+                                  HYPRE_Int  *A_j,
+                                  double     *A_data,
+                                  HYPRE_Int   num_rowsA,
+                                  HYPRE_Int   num_rowsAT,
+                                  HYPRE_Int  *AT_i,
+                                  HYPRE_Int  *AT_j,
+                                  double     *AT_data )
+{
+   HYPRE_Int   num_threads = hypre_NumThreads();
+   HYPRE_Int  *count = hypre_CTAlloc(HYPRE_Int, num_threads*num_rowsAT);
+   HYPRE_Int   i, j, c, t, ns, ne, size, rest, my_thread_num, pos;
+   HYPRE_Int  *my_count;
+
+#pragma omp parallel private(i,j,c,t,ns,ne,size,rest,my_thread_num,my_count,pos) num_threads(num_threads)
+   {
+      my_thread_num = hypre_GetThreadNum();
+      my_count = count + my_thread_num*num_rowsAT;
+
+      size = num_rowsA/num_threads;
+      rest = num_rowsA - size*num_threads;
+      if (my_thread_num < rest)
+      {
+         ns = my_thread_num*size+my_thread_num;
+         ne = (my_thread_num+1)*size+my_thread_num+1;
+      }
+      else
+      {
+         ns = my_thread_num*size+rest;
+         ne = (my_thread_num+1)*size+rest;
+      }
+
+      for (j = A_i[ns]; j < A_i[ne]; j++)
+      {
+         my_count[A_j[j]]++;
+      }
+
+#pragma omp barrier
+
+      /* row lengths of AT, and the start of each thread within a row */
+#pragma omp for HYPRE_SMP_SCHEDULE
+      for (c = 0; c < num_rowsAT; c++)
+      {
+         pos = 0;
+         for (t = 0; t < num_threads; t++)
+         {
+            i = count[t*num_rowsAT+c];
+            count[t*num_rowsAT+c] = pos;
+            pos += i;
+         }
+         AT_i[c+1] = pos;
+      }
+
+#pragma omp single
+      {
+         for (c = 1; c < num_rowsAT; c++)
+         {
+            AT_i[c+1] += AT_i[c];
+         }
+      }
+
+#pragma omp for HYPRE_SMP_SCHEDULE
+      for (c = 0; c < num_rowsAT; c++)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            count[t*num_rowsAT+c] += AT_i[c];
+         }
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         for (j = A_i[i]; j < A_i[i+1]; j++)
+         {
+            pos = my_count[A_j[j]]++;
+            AT_j[pos] = i;
+            if (AT_data) AT_data[pos] = A_data[j];
+         }
+      }
+   }
+
+   AT_i[0] = 0;
+
+   hypre_TFree(count);
+}
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixTranspose
  *--------------------------------------------------------------------------*/
@@ -360,6 +459,15 @@ HYPRE_Int hypre_CSRMatrixTranspose(hypre_CSRMatrix   *A, hypre_CSRMatrix   **AT,
       hypre_CSRMatrixData(*AT) = AT_data;
    }
 
+#ifdef HYPRE_USING_OPENMP
+   if (hypre_NumThreads() > 1 && num_rowsA > 1)
+   {
+      hypre_CSRMatrixTransposeThreaded(A_i, A_j, A_data, num_rowsA, num_rowsAT,
+                                       AT_i, AT_j, data ? AT_data : NULL);
+      return(0);
+   }
+#endif
+
    /*-----------------------------------------------------------------
     * Count the number of entries in each column of A (row of AT)
     * and fill the AT_i array.
@@ -17,6 +17,7 @@
  *****************************************************************************/
 
 #include "seq_mv.h"
+#include <float.h>
 
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixCreate
@@ -32,6 +33,7 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    matrix = hypre_CTAlloc(hypre_CSRMatrix, 1);
 
    hypre_CSRMatrixData(matrix) = NULL;
+   hypre_CSRMatrixSPData(matrix) = NULL;
    hypre_CSRMatrixI(matrix)    = NULL;
    hypre_CSRMatrixJ(matrix)    = NULL;
    hypre_CSRMatrixRownnz(matrix) = NULL;
@@ -65,6 +67,7 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixData(matrix));
          hypre_TFree(hypre_CSRMatrixJ(matrix));
       }
+      hypre_TFree(hypre_CSRMatrixSPData(matrix));
       hypre_TFree(matrix);
    }
 
@@ -157,6 +160,46 @@ hypre_CSRMatrixSetRownnz( hypre_CSRMatrix *matrix )
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSinglePrecision
+ *
+ * converts the values of the matrix to single precision: they are moved to
+ * sp_data and data is freed (if owned) and set to NULL.  Only
+ * hypre_CSRMatrixMatvec and hypre_CSRMatrixMatvecT (single vectors) know
+ * about sp_data, routines which read data directly must not be called any
+ * more.  Returns 1 if a value does not fit into a float, the matrix is then
+ * left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSinglePrecision( hypre_CSRMatrix *matrix )
+{
+   double    *data         = hypre_CSRMatrixData(matrix);
+   HYPRE_Int  num_nonzeros = hypre_CSRMatrixNumNonzeros(matrix);
+   float     *sp_data;
+   HYPRE_Int  i;
+
+   if (hypre_CSRMatrixSPData(matrix))
+      return 0;
+
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      if (fabs(data[i]) > FLT_MAX)
+         return 1;
+   }
+
+   sp_data = hypre_CTAlloc(float, num_nonzeros);
+   for (i = 0; i < num_nonzeros; i++)
+      sp_data[i] = (float) data[i];
+
+   if (hypre_CSRMatrixOwnsData(matrix))
+      hypre_TFree(data);
+   hypre_CSRMatrixData(matrix)   = NULL;
+   hypre_CSRMatrixSPData(matrix) = sp_data;
+
+   return 0;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixRead
  *--------------------------------------------------------------------------*/
@@ -42,6 +42,10 @@ typedef struct
 
    double  *data;
 
+   /* single precision copy of `data' (data is then NULL), see
+      hypre_CSRMatrixSetSinglePrecision */
+   float   *sp_data;
+
    /* for compressing rows in matrix multiplication  */
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
@@ -61,6 +65,7 @@ typedef struct
 #define hypre_CSRMatrixRownnz(matrix)       ((matrix) -> rownnz)
 #define hypre_CSRMatrixNumRownnz(matrix)    ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)     ((matrix) -> owns_data)
+#define hypre_CSRMatrixSPData(matrix)       ((matrix) -> sp_data)
 
 
 
@@ -22,6 +22,74 @@
 #include "seq_mv.h"
 #include <assert.h>
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecRowStorage
+ *
+ *   Performs y += A*x for multivectors x and y in row storage, i.e.
+ *   vj[i] = data[ j + num_vectors*i ] (SpMM kernel).
+ *
+ *   Every matrix entry is read once for all vectors; the vectors are
+ *   processed in blocks of HYPRE_SPMM_BLOCK with unit-stride inner loops
+ *   of constant length, which the compiler can vectorize.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SPMM_BLOCK 8
+
+static void
+hypre_CSRMatrixMatvecRowStorage( hypre_CSRMatrix *A,
+                                 HYPRE_Int        num_vectors,
+                                 double          *x_data,
+                                 double          *y_data )
+{
+   double     *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+
+   double      temp[HYPRE_SPMM_BLOCK];
+   double      a, *x_row, *y_row;
+
+   HYPRE_Int         i, j, jj, jv, nb;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,jj,jv,nb,a,x_row,y_row,temp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      y_row = &y_data[i*num_vectors];
+      for (jv = 0; jv < num_vectors; jv += HYPRE_SPMM_BLOCK)
+      {
+         nb = hypre_min(HYPRE_SPMM_BLOCK, num_vectors-jv);
+         for (j = 0; j < HYPRE_SPMM_BLOCK; j++)
+            temp[j] = 0.0;
+
+         if (nb == HYPRE_SPMM_BLOCK)
+         {
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               a = A_data[jj];
+               x_row = &x_data[A_j[jj]*num_vectors + jv];
+               for (j = 0; j < HYPRE_SPMM_BLOCK; j++)
+                  temp[j] += a * x_row[j];
+            }
+         }
+         else
+         {
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               a = A_data[jj];
+               x_row = &x_data[A_j[jj]*num_vectors + jv];
+               for (j = 0; j < nb; j++)
+                  temp[j] += a * x_row[j];
+            }
+         }
+
+         for (j = 0; j < nb; j++)
+            y_row[jv+j] += temp[j];
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -34,6 +102,7 @@ hypre_CSRMatrixMatvec( double           alpha,
               hypre_Vector    *y     )
 {
    double     *A_data   = hypre_CSRMatrixData(A);
+   float      *A_sp_data = hypre_CSRMatrixSPData(A);
    HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
    HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
    HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
@@ -130,9 +199,34 @@ hypre_CSRMatrixMatvec( double           alpha,
     * y += A*x
     *-----------------------------------------------------------------*/
 
+   if ( num_vectors > 1 &&
+        idxstride_x == num_vectors && vecstride_x == 1 &&
+        idxstride_y == num_vectors && vecstride_y == 1 )
+   {
+      /* multivectors in row storage */
+      hypre_CSRMatrixMatvecRowStorage( A, num_vectors, x_data, y_data );
+   }
+
+   /* single precision values, accumulated in double (single vectors only) */
+
+   else if (A_sp_data)
+   {
+      hypre_assert( num_vectors == 1 );
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            temp += (double) A_sp_data[jj] * x_data[A_j[jj]];
+         y_data[i] += temp;
+      }
+   }
+
 /* use rownnz pointer to do the A*x multiplication  when num_rownnz is smaller than num_rows */
 
-   if (num_rownnz < xpar*(num_rows))
+   else if (num_rownnz < xpar*(num_rows))
    {
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i,jj,m,tempx) HYPRE_SMP_SCHEDULE
@@ -428,6 +522,7 @@ hypre_CSRMatrixMatvecT( double           alpha,
                hypre_Vector    *y     )
 {
    double     *A_data    = hypre_CSRMatrixData(A);
+   float      *A_sp_data = hypre_CSRMatrixSPData(A);
    HYPRE_Int        *A_i       = hypre_CSRMatrixI(A);
    HYPRE_Int        *A_j       = hypre_CSRMatrixJ(A);
    HYPRE_Int         num_rows  = hypre_CSRMatrixNumRows(A);
@@ -521,7 +616,7 @@ hypre_CSRMatrixMatvecT( double           alpha,
    num_threads = hypre_NumThreads();
    if (num_threads > 1)
    {
-      y_data_expand = hypre_CTAlloc(double, num_threads*y_size);
+      y_data_expand = hypre_WorkspaceCTAlloc(double, num_threads*y_size);
 
       if ( num_vectors==1 )
       {
@@ -532,15 +627,32 @@ hypre_CSRMatrixMatvecT( double           alpha,
          {                                      
             my_thread_num = hypre_GetThreadNum();
             offset =  y_size*my_thread_num;
+            if (A_sp_data)
+            {
 #ifdef HYPRE_USING_OPENMP
 #pragma omp for HYPRE_SMP_SCHEDULE
 #endif
-            for (i = 0; i < num_rows; i++)
+               for (i = 0; i < num_rows; i++)
+               {
+                  for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+                  {
+                     j = A_j[jj];
+                     y_data_expand[offset + j] += (double) A_sp_data[jj] * x_data[i];
+                  }
+               }
+            }
+            else
             {
-               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+               for (i = 0; i < num_rows; i++)
                {
-                  j = A_j[jj];
-                  y_data_expand[offset + j] += A_data[jj] * x_data[i];
+                  for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+                  {
+                     j = A_j[jj];
+                     y_data_expand[offset + j] += A_data[jj] * x_data[i];
+                  }
                }
             }
 
@@ -561,6 +673,7 @@ hypre_CSRMatrixMatvecT( double           alpha,
       }
       else
       {
+         hypre_assert( !A_sp_data );
          /* multiple vector case is not threaded */
          for (i = 0; i < num_rows; i++)
          {
@@ -576,9 +689,22 @@ hypre_CSRMatrixMatvecT( double           alpha,
          }
       }
 
-      hypre_TFree(y_data_expand);
+      hypre_WorkspaceTFree(y_data_expand);
 
    }
+   else if (A_sp_data)
+   {
+      /* single precision values, single vectors only */
+      hypre_assert( num_vectors == 1 );
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            j = A_j[jj];
+            y_data[j] += (double) A_sp_data[jj] * x_data[i];
+         }
+      }
+   }
    else 
    {
       for (i = 0; i < num_rows; i++)
@@ -359,6 +359,13 @@ hypre_PointRelax( void               *relax_vdata,
                         
    HYPRE_Int              constant_coefficient;
 
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int              use_kernel, num_offd, si;
+   double                *Aps[hypre_StencilKernelMaxSize];
+   HYPRE_Int              xoffs[hypre_StencilKernelMaxSize];
+
    HYPRE_Int              iter, p, compute_i, i, j;
    HYPRE_Int              pointset;
 
@@ -395,6 +402,10 @@ hypre_PointRelax( void               *relax_vdata,
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(x, 0);
 
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
    rsumsq = 0.0;
    if ( tol>0.0 )
       bsumsq = hypre_StructInnerProd( b, b );
@@ -572,10 +583,40 @@ hypre_PointRelax( void               *relax_vdata,
             xp = hypre_StructVectorBoxData(x, i);
             tp = hypre_StructVectorBoxData(t, i);
 
+            /* unit stride, variable coefficients: t = (b - A_offd x) / A_diag
+               in one sweep of the vectorized stencil kernel */
+            use_kernel = ( constant_coefficient==0 &&
+                           hypre_StencilKernelUsable(stride, stencil_size-1) );
+            if (use_kernel)
+            {
+               for (si = 0, num_offd = 0; si < stencil_size; si++)
+               {
+                  if (si != diag_rank)
+                  {
+                     Aps[num_offd]   = hypre_StructMatrixBoxData(A, i, si);
+                     xoffs[num_offd] = hypre_BoxOffsetDistance(
+                        x_data_box, stencil_shape[si]);
+                     num_offd++;
+                  }
+               }
+            }
+
             hypre_ForBoxI(j, compute_box_a)
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
+               if (use_kernel)
+               {
+                  start  = hypre_BoxIMin(compute_box);
+                  hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+                  hypre_StencilKernelJacobi(
+                     loop_size, start, num_offd, Aps, xoffs,
+                     hypre_StructMatrixBoxData(A, i, diag_rank),
+                     A_data_box, x_data_box, xp, b_data_box, bp,
+                     t_data_box, tp);
+                  continue;
+               }
+
                if ( constant_coefficient==1 || constant_coefficient==2 )
                {
                   hypre_PointRelax_core12(
@@ -1819,6 +1819,9 @@ typedef struct hypre_StructStencil_struct
 #define hypre_StructStencilElement(stencil, i) \
 hypre_StructStencilShape(stencil)[i]
 
+/* largest stencil handled by the unit-stride kernels in struct_stencil_kernels.c */
+#define hypre_StencilKernelMaxSize 27
+
 #endif
 /*BHEADER**********************************************************************
  * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
@@ -2611,6 +2614,11 @@ HYPRE_Int hypre_StructStencilDestroy ( hypre_StructStencil *stencil );
 HYPRE_Int hypre_StructStencilElementRank ( hypre_StructStencil *stencil , hypre_Index stencil_element );
 HYPRE_Int hypre_StructStencilSymmetrize ( hypre_StructStencil *stencil , hypre_StructStencil **symm_stencil_ptr , HYPRE_Int **symm_elements_ptr );
 
+/* struct_stencil_kernels.c */
+HYPRE_Int hypre_StencilKernelUsable ( hypre_IndexRef stride , HYPRE_Int nentries );
+HYPRE_Int hypre_StencilKernelMatvec ( hypre_Index loop_size , hypre_IndexRef start , HYPRE_Int nentries , double **Aps , HYPRE_Int *xoffs , double alpha , hypre_Box *A_data_box , hypre_Box *x_data_box , double *xp , hypre_Box *y_data_box , double *yp );
+HYPRE_Int hypre_StencilKernelJacobi ( hypre_Index loop_size , hypre_IndexRef start , HYPRE_Int nentries , double **Aps , HYPRE_Int *xoffs , double *dp , hypre_Box *A_data_box , hypre_Box *x_data_box , double *xp , hypre_Box *b_data_box , double *bp , hypre_Box *t_data_box , double *tp );
+
 /* struct_vector.c */
 hypre_StructVector *hypre_StructVectorCreate ( MPI_Comm comm , hypre_StructGrid *grid );
 hypre_StructVector *hypre_StructVectorRef ( hypre_StructVector *vector );
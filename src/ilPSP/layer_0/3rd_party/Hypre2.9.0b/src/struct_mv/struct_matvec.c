@@ -327,6 +327,9 @@ HYPRE_Int hypre_StructMatvecCC0( double              alpha,
    hypre_IndexRef           start;
    HYPRE_Int                yi;
    HYPRE_Int                ndim;
+   HYPRE_Int                use_kernel;
+   double                  *Aps[hypre_StencilKernelMaxSize];
+   HYPRE_Int                xoffs[hypre_StencilKernelMaxSize];
 
    stencil       = hypre_StructMatrixStencil(A);
    stencil_shape = hypre_StructStencilShape(stencil);
@@ -344,6 +347,18 @@ HYPRE_Int hypre_StructMatvecCC0( double              alpha,
       xp = hypre_StructVectorBoxData(x, i);
       yp = hypre_StructVectorBoxData(y, i);
 
+      /* unit stride: use the vectorized stencil kernel, BoxLoops otherwise */
+      use_kernel = hypre_StencilKernelUsable(stride, stencil_size);
+      if (use_kernel)
+      {
+         for (si = 0; si < stencil_size; si++)
+         {
+            Aps[si]   = hypre_StructMatrixBoxData(A, i, si);
+            xoffs[si] = hypre_BoxOffsetDistance(x_data_box,
+                                                stencil_shape[si]);
+         }
+      }
+
       hypre_ForBoxI(j, compute_box_a)
       {
          compute_box = hypre_BoxArrayBox(compute_box_a, j);
@@ -351,6 +366,15 @@ HYPRE_Int hypre_StructMatvecCC0( double              alpha,
          hypre_BoxGetSize(compute_box, loop_size);
          start  = hypre_BoxIMin(compute_box);
 
+         if (use_kernel)
+         {
+            hypre_StencilKernelMatvec(loop_size, start, stencil_size,
+                                      Aps, xoffs, alpha,
+                                      A_data_box, x_data_box, xp,
+                                      y_data_box, yp);
+            continue;
+         }
+
          /* unroll up to depth MAX_DEPTH */
          for (si = 0; si < stencil_size; si+= MAX_DEPTH)
          {
@@ -48,4 +48,7 @@ typedef struct hypre_StructStencil_struct
 #define hypre_StructStencilElement(stencil, i) \
 hypre_StructStencilShape(stencil)[i]
 
+/* largest stencil handled by the unit-stride kernels in struct_stencil_kernels.c */
+#define hypre_StencilKernelMaxSize 27
+
 #endif
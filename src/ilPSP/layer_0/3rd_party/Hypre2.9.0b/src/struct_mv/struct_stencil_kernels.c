@@ -0,0 +1,422 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 2.0 $
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Unit-stride stencil kernels for variable coefficient struct matrices.
+ *
+ * These are the fast paths for the hot loops of StructMatvec and the
+ * PFMG Jacobi relaxation.  Instead of the generic BoxLoop macros (which
+ * step through the box with stride arithmetic and split the threads along
+ * one direction only) the box is traversed as a set of x-lines: the
+ * (j,k) lines are distributed over the OpenMP threads, and each line is
+ * processed in chunks by a stencil-specialized inner loop with unit
+ * stride, which the compiler can vectorize.  The stencil sums are unrolled
+ * for the 5, 7, 9 and 27 point stencils (see hypre_StencilKernelGroup).
+ *
+ * The callers keep the BoxLoop code as the fallback for non-unit strides
+ * and larger stencils, see hypre_StencilKernelUsable.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+
+/* length of the x-line chunks, short enough to stay in L1 between the passes */
+#define hypre_StencilKernelChunk 256
+
+/* mark an inner loop as free of loop-carried dependencies */
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#define hypre_StencilKernelSimd _Pragma("omp simd")
+#elif defined(__clang__)
+#define hypre_StencilKernelSimd _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define hypre_StencilKernelSimd _Pragma("GCC ivdep")
+#elif defined(__INTEL_COMPILER)
+#define hypre_StencilKernelSimd _Pragma("ivdep")
+#else
+#define hypre_StencilKernelSimd
+#endif
+
+/*--------------------------------------------------------------------------
+ * Chunk kernel: out[ii] = in[ii] + sign * sum_s Ar[s][ii] * xr[ii + xoff[s]]
+ *
+ * The coefficient pointers Ar[s] and the vector pointers are already
+ * shifted to the first point of the chunk.  Each case is a single loop with
+ * a fixed number of terms; larger stencils are summed in groups of up to
+ * hypre_StencilKernelDepth entries.  The BoxLoop code uses groups of
+ * MAX_DEPTH = 7, so the results agree with it only up to round-off.
+ * This gives one fused loop for the 5, 7 and 9 point stencils (and their
+ * off-diagonal parts) and three for the 27 point stencil.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StencilKernelDepth 9
+
+static void
+hypre_StencilKernelGroup( HYPRE_Int n, HYPRE_Int depth, double **Ar,
+                          double *xr, HYPRE_Int *xoff, double sign,
+                          double *in, double *out )
+{
+   double   *A0 = NULL, *A1 = NULL, *A2 = NULL, *A3 = NULL, *A4 = NULL,
+            *A5 = NULL, *A6 = NULL, *A7 = NULL, *A8 = NULL;
+   double   *x0 = NULL, *x1 = NULL, *x2 = NULL, *x3 = NULL, *x4 = NULL,
+            *x5 = NULL, *x6 = NULL, *x7 = NULL, *x8 = NULL;
+   HYPRE_Int ii;
+
+   switch (depth)
+   {
+      case 9: A8 = Ar[8]; x8 = xr + xoff[8];
+      case 8: A7 = Ar[7]; x7 = xr + xoff[7];
+      case 7: A6 = Ar[6]; x6 = xr + xoff[6];
+      case 6: A5 = Ar[5]; x5 = xr + xoff[5];
+      case 5: A4 = Ar[4]; x4 = xr + xoff[4];
+      case 4: A3 = Ar[3]; x3 = xr + xoff[3];
+      case 3: A2 = Ar[2]; x2 = xr + xoff[2];
+      case 2: A1 = Ar[1]; x1 = xr + xoff[1];
+      case 1: A0 = Ar[0]; x0 = xr + xoff[0];
+   }
+
+   switch (depth)
+   {
+      case 9:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] +
+                A4[ii] * x4[ii] +
+                A5[ii] * x5[ii] +
+                A6[ii] * x6[ii] +
+                A7[ii] * x7[ii] +
+                A8[ii] * x8[ii] );
+         }
+         break;
+
+      case 8:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] +
+                A4[ii] * x4[ii] +
+                A5[ii] * x5[ii] +
+                A6[ii] * x6[ii] +
+                A7[ii] * x7[ii] );
+         }
+         break;
+
+      case 7:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] +
+                A4[ii] * x4[ii] +
+                A5[ii] * x5[ii] +
+                A6[ii] * x6[ii] );
+         }
+         break;
+
+      case 6:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] +
+                A4[ii] * x4[ii] +
+                A5[ii] * x5[ii] );
+         }
+         break;
+
+      case 5:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] +
+                A4[ii] * x4[ii] );
+         }
+         break;
+
+      case 4:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] +
+                A3[ii] * x3[ii] );
+         }
+         break;
+
+      case 3:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] +
+                A2[ii] * x2[ii] );
+         }
+         break;
+
+      case 2:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] +
+                A1[ii] * x1[ii] );
+         }
+         break;
+
+      case 1:
+         hypre_StencilKernelSimd
+         for (ii = 0; ii < n; ii++)
+         {
+            out[ii] = in[ii] + sign * (
+                A0[ii] * x0[ii] );
+         }
+         break;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StencilKernelUsable
+ *
+ * Returns 1 if a box traversal with the given stride and number of stencil
+ * entries can be done by the kernels below.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StencilKernelUsable( hypre_IndexRef stride,
+                           HYPRE_Int      nentries )
+{
+   return ( hypre_IndexX(stride) == 1 &&
+            hypre_IndexY(stride) == 1 &&
+            hypre_IndexZ(stride) == 1 &&
+            nentries > 0 && nentries <= hypre_StencilKernelMaxSize );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StencilKernelMatvec
+ *
+ * y = alpha * ( y + sum_s A_s x(. + offset_s) ) on the box of size
+ * loop_size starting at start, with unit stride.  Aps[s] and xoffs[s] are
+ * the coefficient data and the x offset distance of stencil entry s.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StencilKernelMatvec( hypre_Index     loop_size,
+                           hypre_IndexRef  start,
+                           HYPRE_Int       nentries,
+                           double        **Aps,
+                           HYPRE_Int      *xoffs,
+                           double          alpha,
+                           hypre_Box      *A_data_box,
+                           hypre_Box      *x_data_box,
+                           double         *xp,
+                           hypre_Box      *y_data_box,
+                           double         *yp )
+{
+   HYPRE_Int  nx = hypre_IndexX(loop_size);
+   HYPRE_Int  ny = hypre_IndexY(loop_size);
+   HYPRE_Int  nz = hypre_IndexZ(loop_size);
+   HYPRE_Int  A_sy, A_sz, x_sy, x_sz, y_sy, y_sz;
+   HYPRE_Int  Ai0, xi0, yi0;
+   HYPRE_Int  nrows, r;
+
+   if (nx <= 0 || ny <= 0 || nz <= 0)
+   {
+      return hypre_error_flag;
+   }
+   if (nentries > hypre_StencilKernelMaxSize)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   A_sy = hypre_BoxSizeX(A_data_box);
+   A_sz = A_sy * hypre_BoxSizeY(A_data_box);
+   x_sy = hypre_BoxSizeX(x_data_box);
+   x_sz = x_sy * hypre_BoxSizeY(x_data_box);
+   y_sy = hypre_BoxSizeX(y_data_box);
+   y_sz = y_sy * hypre_BoxSizeY(y_data_box);
+
+   Ai0 = hypre_BoxIndexRank(A_data_box, start);
+   xi0 = hypre_BoxIndexRank(x_data_box, start);
+   yi0 = hypre_BoxIndexRank(y_data_box, start);
+
+   nrows = ny * nz;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nrows; r++)
+   {
+      double    *Ar[hypre_StencilKernelMaxSize];
+      double    *xr, *yr;
+      HYPRE_Int  j = r % ny;
+      HYPRE_Int  k = r / ny;
+      HYPRE_Int  Ai = Ai0 + j*A_sy + k*A_sz;
+      HYPRE_Int  xi = xi0 + j*x_sy + k*x_sz;
+      HYPRE_Int  yi = yi0 + j*y_sy + k*y_sz;
+      HYPRE_Int  c, n, s, ii;
+
+      for (c = 0; c < nx; c += hypre_StencilKernelChunk)
+      {
+         n  = hypre_min(hypre_StencilKernelChunk, nx - c);
+         xr = xp + xi + c;
+         yr = yp + yi + c;
+         for (s = 0; s < nentries; s++)
+         {
+            Ar[s] = Aps[s] + Ai + c;
+         }
+         for (s = 0; s < nentries; s += hypre_StencilKernelDepth)
+         {
+            hypre_StencilKernelGroup(
+               n, hypre_min(hypre_StencilKernelDepth, nentries - s),
+               Ar + s, xr, xoffs + s, 1.0, yr, yr);
+         }
+
+         if (alpha != 1.0)
+         {
+            hypre_StencilKernelSimd
+            for (ii = 0; ii < n; ii++)
+            {
+               yr[ii] *= alpha;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StencilKernelJacobi
+ *
+ * t = ( b - sum_s A_s x(. + offset_s) ) / D on the box of size loop_size
+ * starting at start, with unit stride.  The diagonal entry must not be part
+ * of Aps; if dp is NULL, the division by the diagonal D is skipped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StencilKernelJacobi( hypre_Index     loop_size,
+                           hypre_IndexRef  start,
+                           HYPRE_Int       nentries,
+                           double        **Aps,
+                           HYPRE_Int      *xoffs,
+                           double         *dp,
+                           hypre_Box      *A_data_box,
+                           hypre_Box      *x_data_box,
+                           double         *xp,
+                           hypre_Box      *b_data_box,
+                           double         *bp,
+                           hypre_Box      *t_data_box,
+                           double         *tp )
+{
+   HYPRE_Int  nx = hypre_IndexX(loop_size);
+   HYPRE_Int  ny = hypre_IndexY(loop_size);
+   HYPRE_Int  nz = hypre_IndexZ(loop_size);
+   HYPRE_Int  A_sy, A_sz, x_sy, x_sz, b_sy, b_sz, t_sy, t_sz;
+   HYPRE_Int  Ai0, xi0, bi0, ti0;
+   HYPRE_Int  nrows, r;
+
+   if (nx <= 0 || ny <= 0 || nz <= 0)
+   {
+      return hypre_error_flag;
+   }
+   if (nentries > hypre_StencilKernelMaxSize)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   A_sy = hypre_BoxSizeX(A_data_box);
+   A_sz = A_sy * hypre_BoxSizeY(A_data_box);
+   x_sy = hypre_BoxSizeX(x_data_box);
+   x_sz = x_sy * hypre_BoxSizeY(x_data_box);
+   b_sy = hypre_BoxSizeX(b_data_box);
+   b_sz = b_sy * hypre_BoxSizeY(b_data_box);
+   t_sy = hypre_BoxSizeX(t_data_box);
+   t_sz = t_sy * hypre_BoxSizeY(t_data_box);
+
+   Ai0 = hypre_BoxIndexRank(A_data_box, start);
+   xi0 = hypre_BoxIndexRank(x_data_box, start);
+   bi0 = hypre_BoxIndexRank(b_data_box, start);
+   ti0 = hypre_BoxIndexRank(t_data_box, start);
+
+   nrows = ny * nz;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nrows; r++)
+   {
+      double    *Ar[hypre_StencilKernelMaxSize];
+      double    *xr, *br, *tr, *dr;
+      HYPRE_Int  j = r % ny;
+      HYPRE_Int  k = r / ny;
+      HYPRE_Int  Ai = Ai0 + j*A_sy + k*A_sz;
+      HYPRE_Int  xi = xi0 + j*x_sy + k*x_sz;
+      HYPRE_Int  bi = bi0 + j*b_sy + k*b_sz;
+      HYPRE_Int  ti = ti0 + j*t_sy + k*t_sz;
+      HYPRE_Int  c, n, s, ii;
+
+      for (c = 0; c < nx; c += hypre_StencilKernelChunk)
+      {
+         n  = hypre_min(hypre_StencilKernelChunk, nx - c);
+         xr = xp + xi + c;
+         br = bp + bi + c;
+         tr = tp + ti + c;
+         for (s = 0; s < nentries; s++)
+         {
+            Ar[s] = Aps[s] + Ai + c;
+         }
+         /* the first group reads b, the following ones accumulate into t */
+         for (s = 0; s < nentries; s += hypre_StencilKernelDepth)
+         {
+            hypre_StencilKernelGroup(
+               n, hypre_min(hypre_StencilKernelDepth, nentries - s),
+               Ar + s, xr, xoffs + s, -1.0, (s == 0) ? br : tr, tr);
+         }
+
+         if (dp != NULL)
+         {
+            dr = dp + Ai + c;
+            hypre_StencilKernelSimd
+            for (ii = 0; ii < n; ii++)
+            {
+               tr[ii] /= dr[ii];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,66 @@
+#!/bin/sh
+#BHEADER**********************************************************************
+# Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+# Produced at the Lawrence Livermore National Laboratory.
+# This file is part of HYPRE.  See file COPYRIGHT for details.
+#
+# HYPRE is free software; you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License (as published by the Free
+# Software Foundation) version 2.1 dated February 1999.
+#
+# $Revision: 1.0 $
+#EHEADER**********************************************************************
+
+TNAME=`basename $0 .sh`
+
+#=============================================================================
+# ij: thread scaling of the BoomerAMG setup; the runs of one problem must
+# give the same hierarchy (operator complexity and iteration count) for all
+# thread counts
+#=============================================================================
+
+SetupTime()
+{
+   grep -A 2 "BoomerAMG Setup" $1 | grep "wall clock time" | awk '{print $5}'
+}
+
+rm -f ${TNAME}.log
+for first in 0 4 8
+do
+   case $first in
+      0) problem="7pt  PMIS" ;;
+      4) problem="27pt PMIS" ;;
+      8) problem="7pt  HMIS" ;;
+   esac
+   T1=`SetupTime ${TNAME}.out.$first`
+   for i in 0 1 2 3
+   do
+      out=${TNAME}.out.`expr $first + $i`
+      case $i in
+         0) nthreads=1 ;;
+         1) nthreads=2 ;;
+         2) nthreads=4 ;;
+         3) nthreads=8 ;;
+      esac
+      T=`SetupTime $out`
+      echo "$problem  8 x $nthreads: setup $T s  speedup" \
+         `echo "$T1 $T" | awk '{printf "%.2f", $1/$2}'` >> ${TNAME}.log
+   done
+
+   for i in 1 2 3
+   do
+      out=${TNAME}.out.`expr $first + $i`
+      for key in "Operator Complexity" "Iterations"
+      do
+         ref=`grep "$key" ${TNAME}.out.$first`
+         val=`grep "$key" $out`
+         if [ "$ref" != "$val" ]; then
+            echo "$out: $key differs from single-threaded run ($val / $ref)" >&2
+         fi
+      done
+   done
+done
+
+cat ${TNAME}.log
+
+rm -f ${TNAME}.out.*
@@ -0,0 +1,57 @@
+#!/bin/sh
+#BHEADER**********************************************************************
+# Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+# Produced at the Lawrence Livermore National Laboratory.
+# This file is part of HYPRE.  See file COPYRIGHT for details.
+#
+# HYPRE is free software; you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License (as published by the Free
+# Software Foundation) version 2.1 dated February 1999.
+#
+# $Revision: 1.0 $
+#EHEADER**********************************************************************
+
+TNAME=`basename $0 .sh`
+
+#=============================================================================
+# ij: time of the triangular solves (Euclid timing report) and total time
+# to solution per triangular solve variant; the level-scheduled runs must
+# give the same iteration count as the sequential ones
+#=============================================================================
+
+TriSolveTime()
+{
+   grep "tri solves: *[0-9]*\.[0-9]*$" $1 | head -1 | awk '{printf "%s", $NF}'
+}
+
+rm -f ${TNAME}.log
+T1=`TriSolveTime ${TNAME}.out.0`
+for i in 0 1 2 3 4 5 6 7 8 9 10 11
+do
+   out=${TNAME}.out.$i
+   case `expr $i % 4` in
+      0) nthreads=1 ;;
+      1) nthreads=2 ;;
+      2) nthreads=4 ;;
+      3) nthreads=8 ;;
+   esac
+   if [ $i -lt 4 ]; then trisolve="seq   ";
+   elif [ $i -lt 8 ]; then trisolve="level ";
+   else trisolve="jacobi"; fi
+   T=`TriSolveTime $out`
+   its=`grep "^Iterations" $out | awk '{print $NF}'`
+   echo "$trisolve 1 x $nthreads: tri solves $T s  its $its  speedup" \
+      `echo "$T1 $T" | awk '{printf "%.2f", $1/$2}'` >> ${TNAME}.log
+
+   if [ $i -ge 4 ] && [ $i -lt 8 ]; then
+      ref=`grep "^Iterations" ${TNAME}.out.0`
+      val=`grep "^Iterations" $out`
+      if [ "$ref" != "$val" ]; then
+         echo "$out: Iterations differ from reference run ($val / $ref)" >&2
+      fi
+   fi
+done
+
+cat ${TNAME}.log
+
+rm -f ${TNAME}.out.*
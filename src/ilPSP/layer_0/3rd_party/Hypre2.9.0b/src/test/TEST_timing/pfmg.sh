@@ -0,0 +1,61 @@
+#!/bin/sh
+#BHEADER**********************************************************************
+# Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+# Produced at the Lawrence Livermore National Laboratory.
+# This file is part of HYPRE.  See file COPYRIGHT for details.
+#
+# HYPRE is free software; you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License (as published by the Free
+# Software Foundation) version 2.1 dated February 1999.
+#
+# $Revision: 1.0 $
+#EHEADER**********************************************************************
+
+TNAME=`basename $0 .sh`
+
+#=============================================================================
+# struct: PFMG solve time (solve phase wall clock time) per thread count;
+# the iteration count must not depend on the number of threads
+#=============================================================================
+
+SolveTime()
+{
+   grep "wall clock time" $1 | tail -1 | awk '{printf "%s", $5}'
+}
+
+rm -f ${TNAME}.log
+for first in 0 4 8
+do
+   case $first in
+      0) problem="3D 7pt PFMG    " ;;
+      4) problem="3D 7pt PFMG-PCG" ;;
+      8) problem="2D 5pt PFMG    " ;;
+   esac
+   T1=`SolveTime ${TNAME}.out.$first`
+   for i in 0 1 2 3
+   do
+      out=${TNAME}.out.`expr $first + $i`
+      case $i in
+         0) nthreads=1 ;;
+         1) nthreads=2 ;;
+         2) nthreads=4 ;;
+         3) nthreads=8 ;;
+      esac
+      T=`SolveTime $out`
+      its=`grep "^Iterations" $out | awk '{print $NF}'`
+      echo "$problem 1 x $nthreads: solve $T s  its $its  speedup" \
+         `echo "$T1 $T" | awk '{printf "%.2f", $1/$2}'` >> ${TNAME}.log
+
+      if [ $i -gt 0 ]; then
+         ref=`grep "^Iterations" ${TNAME}.out.$first`
+         val=`grep "^Iterations" $out`
+         if [ "$ref" != "$val" ]; then
+            echo "$out: Iterations differ from reference run ($val / $ref)" >&2
+         fi
+      fi
+   done
+done
+
+cat ${TNAME}.log
+
+rm -f ${TNAME}.out.*
@@ -0,0 +1,65 @@
+#!/bin/sh
+#BHEADER**********************************************************************
+# Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+# Produced at the Lawrence Livermore National Laboratory.
+# This file is part of HYPRE.  See file COPYRIGHT for details.
+#
+# HYPRE is free software; you can redistribute it and/or modify it under the
+# terms of the GNU Lesser General Public License (as published by the Free
+# Software Foundation) version 2.1 dated February 1999.
+#
+# $Revision: 1.0 $
+#EHEADER**********************************************************************
+
+TNAME=`basename $0 .sh`
+
+#=============================================================================
+# ij: time of the Galerkin products (sum over the levels, process 0); all
+# runs of one problem must give the same hierarchy (operator complexity and
+# iteration count), independent of the accumulator and the thread count
+#=============================================================================
+
+RAPTime()
+{
+   grep "Proc = 0 .*Build Coarse Operator Time" $1 | \
+      awk '{t += $NF} END {printf "%.2f", t}'
+}
+
+rm -f ${TNAME}.log
+for first in 0 8
+do
+   case $first in
+      0) problem="7pt " ;;
+      8) problem="27pt" ;;
+   esac
+   T1=`RAPTime ${TNAME}.out.$first`
+   for i in 0 1 2 3 4 5 6 7
+   do
+      out=${TNAME}.out.`expr $first + $i`
+      case $i in
+         0|4) nthreads=1 ;;
+         1|5) nthreads=2 ;;
+         2|6) nthreads=4 ;;
+         3|7) nthreads=8 ;;
+      esac
+      if [ $i -lt 4 ]; then accum="marker"; else accum="hash  "; fi
+      T=`RAPTime $out`
+      echo "$problem $accum 8 x $nthreads: RAP $T s  speedup" \
+         `echo "$T1 $T" | awk '{printf "%.2f", $1/$2}'` >> ${TNAME}.log
+
+      if [ $i -gt 0 ]; then
+         for key in "Operator Complexity" "Iterations"
+         do
+            ref=`grep "$key" ${TNAME}.out.$first`
+            val=`grep "$key" $out`
+            if [ "$ref" != "$val" ]; then
+               echo "$out: $key differs from reference run ($val / $ref)" >&2
+            fi
+         done
+      fi
+   done
+done
+
+cat ${TNAME}.log
+
+rm -f ${TNAME}.out.*
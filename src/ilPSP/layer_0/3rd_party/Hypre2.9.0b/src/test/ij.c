@@ -157,6 +157,10 @@ main( hypre_int argc,
    HYPRE_Int      num_functions = 1;
    HYPRE_Int      num_paths = 1;
    HYPRE_Int      agg_num_levels = 0;
+   HYPRE_Int      rap_accum_type = 0;
+   HYPRE_Int      mixed_precision = 0;
+   hypre_ParVector *x0 = NULL;
+   HYPRE_Int      mp_num_iterations;
    /* for CGC BM Aug 25, 2006 */
    HYPRE_Int      cgcits = 1;
 
@@ -175,6 +179,9 @@ main( hypre_int argc,
    HYPRE_Int      gsmg_samples = 5;
 
    HYPRE_Int      print_system = 0;
+   HYPRE_Int      memory_mode = 0;
+   HYPRE_Int      overlap_chunk = 0;
+   HYPRE_Int      profile_format = -1;
 
    /* begin lobpcg */
 
@@ -531,6 +538,16 @@ main( hypre_int argc,
          arg_index++;
          debug_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rap_accum") == 0 )
+      {
+         arg_index++;
+         rap_accum_type = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mixed") == 0 )
+      {
+         arg_index++;
+         mixed_precision = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-nf") == 0 )
       {
          arg_index++;
@@ -553,6 +570,26 @@ main( hypre_int argc,
          build_rhs_type = -1;
          if ( build_src_type == -1 ) build_src_type = 2;
       }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+#ifdef HYPRE_USING_OPENMP
+         omp_set_num_threads(atoi(argv[arg_index]));
+#endif
+         arg_index++;
+      }
+      else if ( strcmp(argv[arg_index], "-memmode") == 0 )
+      {
+         arg_index++;
+         memory_mode = atoi(argv[arg_index++]);
+         HYPRE_SetMemoryMode(memory_mode);
+      }
+      else if ( strcmp(argv[arg_index], "-profile") == 0 )
+      {
+         arg_index++;
+         profile_format = atoi(argv[arg_index++]);
+         HYPRE_ProfileSetState(1);
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -946,6 +983,12 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-overlap") == 0 )
+      {
+         arg_index++;
+         overlap_chunk = atoi(argv[arg_index++]);
+         HYPRE_ParCSRSetOverlapComm(overlap_chunk);
+      }
       else
       {
          arg_index++;
@@ -1082,7 +1125,21 @@ main( hypre_int argc,
       hypre_printf("  -dbg <val>             : set debug flag\n");
       hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
       hypre_printf("\n");
+      hypre_printf("  -rap_accum <val>       : accumulator for the coarse operator RAP\n");
+      hypre_printf("       0=dense marker array (default)  1=hash table per row\n");
+      hypre_printf("\n");
+      hypre_printf("  -mixed <val>           : AMG hierarchy precision (solvers 0 and 1)\n");
+      hypre_printf("       0=double (default)  1=single on coarse levels\n");
+      hypre_printf("       2=solve in double, then again with single coarse levels\n");
+      hypre_printf("\n");
       hypre_printf("  -print                 : print out the system\n");
+      hypre_printf("  -overlap <val>         : overlap the matvec halo exchange with the\n");
+      hypre_printf("       local product in chunks of val rows (0=off, default)\n");
+      hypre_printf("  -nthreads <val>        : number of OpenMP threads per MPI task\n");
+      hypre_printf("  -memmode <val>         : allocator, sum of 1=size-class pool\n");
+      hypre_printf("       2=huge-page arena  4=statistics to ij.memstats.<rank>\n");
+      hypre_printf("  -profile <val>         : profile hypre regions, write ij.profile.<rank>\n");
+      hypre_printf("       0=JSON  1=binary\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
@@ -1831,6 +1888,8 @@ main( hypre_int argc,
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
@@ -1841,6 +1900,8 @@ main( hypre_int argc,
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
@@ -1906,6 +1967,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetNumPaths(amg_solver, num_paths);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
+      HYPRE_BoomerAMGSetRAPAccumType(amg_solver, rap_accum_type);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, (mixed_precision == 1));
       if (num_functions > 1)
 	 HYPRE_BoomerAMGSetDofFunc(amg_solver, dof_func);
 
@@ -1913,9 +1976,21 @@ main( hypre_int argc,
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
+      if (mixed_precision == 2)
+      {
+         x0 = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                                    hypre_ParVectorGlobalSize((hypre_ParVector *) x),
+                                    hypre_ParVectorPartitioning((hypre_ParVector *) x));
+         hypre_ParVectorInitialize(x0);
+         hypre_ParVectorSetPartitioningOwner(x0, 0);
+         hypre_ParVectorCopy((hypre_ParVector *) x, x0);
+      }
+
       time_index = hypre_InitializeTiming("BoomerAMG Solve");
       hypre_BeginTiming(time_index);
 
@@ -1923,6 +1998,8 @@ main( hypre_int argc,
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
@@ -1937,6 +2014,38 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (mixed_precision == 2)
+      {
+         /* same solve with the hierarchy converted to single precision */
+         hypre_ParVectorCopy(x0, (hypre_ParVector *) x);
+         hypre_ParVectorDestroy(x0);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_solver, 1);
+
+         time_index = hypre_InitializeTiming("BoomerAMG Solve (mixed precision)");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         if (overlap_chunk > 0)
+            hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &mp_num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Iterations (mixed precision) = %d (double: %d)\n",
+                         mp_num_iterations, num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -2026,6 +2135,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetNumPaths(amg_solver, num_paths);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
+      HYPRE_BoomerAMGSetRAPAccumType(amg_solver, rap_accum_type);
       if (num_functions > 1)
          HYPRE_BoomerAMGSetDofFunc(amg_solver, dof_func);
  
@@ -2033,6 +2143,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
@@ -2043,6 +2155,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
@@ -2135,6 +2249,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, (mixed_precision == 1));
          HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
          HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
          HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -2262,6 +2378,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
          if (num_functions > 1)
             HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
          HYPRE_PCGSetPrecond(pcg_solver,
@@ -2304,9 +2421,21 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
    
+      if (solver_id == 1 && mixed_precision == 2)
+      {
+         x0 = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                                    hypre_ParVectorGlobalSize((hypre_ParVector *) x),
+                                    hypre_ParVectorPartitioning((hypre_ParVector *) x));
+         hypre_ParVectorInitialize(x0);
+         hypre_ParVectorSetPartitioningOwner(x0, 0);
+         hypre_ParVectorCopy((hypre_ParVector *) x, x0);
+      }
+
       time_index = hypre_InitializeTiming("PCG Solve");
       hypre_BeginTiming(time_index);
  
@@ -2315,12 +2444,45 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
       HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
       HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
 
+      if (solver_id == 1 && mixed_precision == 2)
+      {
+         /* same solve with the AMG hierarchy converted to single precision */
+         hypre_ParVectorCopy(x0, (hypre_ParVector *) x);
+         hypre_ParVectorDestroy(x0);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, 1);
+
+         time_index = hypre_InitializeTiming("PCG Solve (mixed precision AMG)");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                        (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+         if (overlap_chunk > 0)
+            hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_PCGGetNumIterations(pcg_solver, &mp_num_iterations);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("Iterations with mixed precision AMG = %d (double: %d)\n",
+                         mp_num_iterations, num_iterations);
+         }
+         HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+         num_iterations = mp_num_iterations;
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -2531,6 +2693,7 @@ main( hypre_int argc,
 	   HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
            HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
            HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+           HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
 	   HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
 	   HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
 	   HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -2658,6 +2821,7 @@ main( hypre_int argc,
 	   HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
            HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
            HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+           HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
 	   if (num_functions > 1)
 	     HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
 	   HYPRE_PCGSetPrecond(pcg_solver,
@@ -2705,6 +2869,8 @@ main( hypre_int argc,
 	
        hypre_EndTiming(time_index);
        hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+       if (overlap_chunk > 0)
+          hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
        hypre_FinalizeTiming(time_index);
        hypre_ClearTiming();
 	
@@ -2765,6 +2931,8 @@ main( hypre_int argc,
 	
        hypre_EndTiming(time_index);
        hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+       if (overlap_chunk > 0)
+          hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
        hypre_FinalizeTiming(time_index);
        hypre_ClearTiming();
 
@@ -2922,6 +3090,7 @@ main( hypre_int argc,
 	   HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
            HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
            HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+           HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
 	   HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
 	   HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
 	   HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -3054,6 +3223,7 @@ main( hypre_int argc,
 	   HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
            HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
            HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+           HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
 	   if (num_functions > 1)
 	     HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
 	    
@@ -3107,6 +3277,8 @@ main( hypre_int argc,
 
        hypre_EndTiming(time_index);
        hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+       if (overlap_chunk > 0)
+          hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
        hypre_FinalizeTiming(time_index);
        hypre_ClearTiming();
 
@@ -3145,6 +3317,8 @@ main( hypre_int argc,
 	
        hypre_EndTiming(time_index);
        hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+       if (overlap_chunk > 0)
+          hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
        hypre_FinalizeTiming(time_index);
        hypre_ClearTiming(); 
 	
@@ -3320,6 +3494,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
          HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
          HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
          HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -3437,6 +3612,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
          if (num_functions > 1)
             HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
          HYPRE_GMRESSetPrecond(pcg_solver,
@@ -3494,6 +3670,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
    
@@ -3505,6 +3683,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
@@ -3596,6 +3776,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
          HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
          HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
          HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -3665,6 +3846,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
    
@@ -3676,6 +3859,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
@@ -3762,6 +3947,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetRAPAccumType(pcg_precond, rap_accum_type);
          HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
          HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
          HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -3800,6 +3986,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Setup phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
    
@@ -3811,6 +3999,8 @@ main( hypre_int argc,
  
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      if (overlap_chunk > 0)
+         hypre_ParCSRPrintOverlapStats("Solve phase matvec overlap", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
  
@@ -3857,6 +4047,23 @@ main( hypre_int argc,
    HYPRE_IJVectorDestroy(ij_b);
    HYPRE_IJVectorDestroy(ij_x);
 
+   if (memory_mode & HYPRE_MEMORY_MODE_STATS)
+   {
+      char memstats_name[64];
+
+      hypre_sprintf(memstats_name, "ij.memstats.%05d", myid);
+      HYPRE_PrintMemoryStats(memstats_name);
+   }
+
+   if (profile_format >= 0)
+   {
+      char profile_name[64];
+
+      hypre_sprintf(profile_name, "ij.profile.%05d.%s", myid,
+                    profile_format ? "bin" : "json");
+      HYPRE_ProfilePrint(profile_name, profile_format);
+   }
+
 /*
    hypre_FinalizeMemoryDebug();
 */
@@ -416,6 +416,14 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+#ifdef HYPRE_USING_OPENMP
+         omp_set_num_threads(atoi(argv[arg_index]));
+#endif
+         arg_index++;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -568,6 +576,7 @@ main( hypre_int argc,
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
+      hypre_printf("  -nthreads <val>     : number of OpenMP threads per MPI task\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
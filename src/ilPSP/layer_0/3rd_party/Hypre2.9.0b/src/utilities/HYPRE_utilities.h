@@ -100,6 +100,44 @@ HYPRE_Int HYPRE_ClearError(HYPRE_Int hypre_error_code);
 /*Checks whether the AP is on */
 HYPRE_Int HYPRE_AssumedPartitionCheck();
 
+/*--------------------------------------------------------------------------
+ * HYPRE memory user functions
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MEMORY_MODE_SYSTEM    0   /* malloc/free */
+#define HYPRE_MEMORY_MODE_POOL      1   /* size-class pool for small blocks */
+#define HYPRE_MEMORY_MODE_HUGE      2   /* huge-page arena for large blocks */
+#define HYPRE_MEMORY_MODE_STATS     4   /* record allocations per call site */
+
+/* Selects the allocator backend, a combination of the modes above */
+HYPRE_Int HYPRE_SetMemoryMode(HYPRE_Int mode);
+
+/* Writes the allocation statistics to the given file (stdout if NULL) */
+HYPRE_Int HYPRE_PrintMemoryStats(const char *filename);
+
+/*--------------------------------------------------------------------------
+ * HYPRE profiling user functions
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_PROFILE_FORMAT_JSON   0
+#define HYPRE_PROFILE_FORMAT_BINARY 1
+
+/* Switches the hierarchical profiling of hypre regions on (1) or off (0) */
+HYPRE_Int HYPRE_ProfileSetState(HYPRE_Int state);
+HYPRE_Int HYPRE_ProfileGetState(HYPRE_Int *state);
+
+/* Discards the recorded call tree */
+HYPRE_Int HYPRE_ProfileClear(void);
+
+/* Walks the call tree; parents are numbered before their children */
+HYPRE_Int HYPRE_ProfileGetNumNodes(HYPRE_Int *num_nodes);
+HYPRE_Int HYPRE_ProfileGetNode(HYPRE_Int node, HYPRE_Int *parent,
+                               const char **name, HYPRE_Int *tag,
+                               HYPRE_Int *count, double *seconds);
+
+/* Writes the call tree of this rank to the given file */
+HYPRE_Int HYPRE_ProfilePrint(const char *filename, HYPRE_Int format);
+
 
 #ifdef __cplusplus
 }
@@ -181,6 +181,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall          
 #define MPI_Waitany         hypre_MPI_Waitany          
 #define MPI_Allreduce       hypre_MPI_Allreduce        
+#define MPI_Iallreduce      hypre_MPI_Iallreduce        
 #define MPI_Reduce          hypre_MPI_Reduce        
 #define MPI_Scan            hypre_MPI_Scan        
 #define MPI_Request_free    hypre_MPI_Request_free        
@@ -326,6 +327,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -416,7 +418,8 @@ extern "C" {
 ( hypre_FreeDML((char *)ptr, __FILE__, __LINE__), ptr = NULL )
 
 /*--------------------------------------------------------------------------
- * Use standard memory routines
+ * Use standard memory routines.  The call site is passed on for the
+ * statistics mode, see memory_pool.c.
  *--------------------------------------------------------------------------*/
 
 #else
@@ -425,13 +428,17 @@ extern "C" {
 #define hypre_FinalizeMemoryDebug()  
 
 #define hypre_TAlloc(type, count) \
-( (type *)hypre_MAlloc((size_t)(sizeof(type) * (count))) )
+( (type *)hypre_MAllocSite((size_t)(sizeof(type) * (count)),\
+                           __FILE__, __LINE__) )
 
 #define hypre_CTAlloc(type, count) \
-( (type *)hypre_CAlloc((size_t)(count), (size_t)sizeof(type)) )
+( (type *)hypre_CAllocSite((size_t)(count), (size_t)sizeof(type),\
+                           __FILE__, __LINE__) )
 
 #define hypre_TReAlloc(ptr, type, count) \
-( (type *)hypre_ReAlloc((char *)ptr, (size_t)(sizeof(type) * (count))) )
+( (type *)hypre_ReAllocSite((char *)ptr,\
+                            (size_t)(sizeof(type) * (count)),\
+                            __FILE__, __LINE__) )
 
 #define hypre_TFree(ptr) \
 ( hypre_Free((char *)ptr), ptr = NULL )
@@ -465,16 +472,71 @@ extern "C" {
 
 #endif
 
+/* allocator backend, see hypre_MemorySetMode */
+extern HYPRE_Int hypre_memory_mode;
+
+/*--------------------------------------------------------------------------
+ * Workspace arena
+ *
+ * A preallocated block from which temporaries are handed out stack-wise.
+ * While an arena is active (hypre_WorkspaceSetActive), hypre_WorkspaceTAlloc
+ * and hypre_WorkspaceCTAlloc take their memory from it; without an active
+ * arena, or if a request does not fit, they fall back to the heap.  The
+ * space of a freed block is reused once all blocks allocated after it are
+ * freed as well.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   char      *data;
+   size_t     size;      /* capacity in bytes */
+   size_t     used;      /* bytes currently handed out */
+   size_t     top;       /* offset of the topmost block */
+   size_t     peak;      /* largest request level, including overflows */
+   HYPRE_Int  num_heap;  /* number of requests that went to the heap */
+
+} hypre_Workspace;
+
+#define hypre_WorkspaceData(workspace)     ((workspace) -> data)
+#define hypre_WorkspaceSize(workspace)     ((workspace) -> size)
+#define hypre_WorkspaceUsed(workspace)     ((workspace) -> used)
+#define hypre_WorkspacePeak(workspace)     ((workspace) -> peak)
+#define hypre_WorkspaceNumHeap(workspace)  ((workspace) -> num_heap)
+
+/* bytes taken by an arena block of 'size' bytes, including its header */
+#define hypre_WorkspaceBlockSize(size) \
+( (size_t) 64 + ((((size_t) (size)) + 63) & ~((size_t) 63)) )
+
+#define hypre_WorkspaceTAlloc(type, count) \
+( (type *)hypre_WorkspaceMAlloc((size_t)(sizeof(type) * (count))) )
+
+#define hypre_WorkspaceCTAlloc(type, count) \
+( (type *)hypre_WorkspaceCAlloc((size_t)(count), (size_t)sizeof(type)) )
+
+#define hypre_WorkspaceTFree(ptr) \
+( hypre_WorkspaceFree((char *)ptr), ptr = NULL )
+
 /*--------------------------------------------------------------------------
  * Prototypes
  *--------------------------------------------------------------------------*/
 
 /* hypre_memory.c */
+size_t hypre_MemoryGetAllocCount ( void );
 HYPRE_Int hypre_OutOfMemory ( size_t size );
+char *hypre_MAllocSite ( size_t size , const char *file , HYPRE_Int line );
 char *hypre_MAlloc ( size_t size );
+char *hypre_CAllocSite ( size_t count , size_t elt_size , const char *file , HYPRE_Int line );
 char *hypre_CAlloc ( size_t count , size_t elt_size );
+char *hypre_ReAllocSite ( char *ptr , size_t size , const char *file , HYPRE_Int line );
 char *hypre_ReAlloc ( char *ptr , size_t size );
 void hypre_Free ( char *ptr );
+hypre_Workspace *hypre_WorkspaceCreate ( size_t size );
+HYPRE_Int hypre_WorkspaceDestroy ( hypre_Workspace *workspace );
+HYPRE_Int hypre_WorkspaceReserve ( hypre_Workspace *workspace , size_t size );
+hypre_Workspace *hypre_WorkspaceSetActive ( hypre_Workspace *workspace );
+char *hypre_WorkspaceMAlloc ( size_t size );
+char *hypre_WorkspaceCAlloc ( size_t count , size_t elt_size );
+void hypre_WorkspaceFree ( char *ptr );
 char *hypre_SharedMAlloc ( size_t size );
 char *hypre_SharedCAlloc ( size_t count , size_t elt_size );
 char *hypre_SharedReAlloc ( char *ptr , size_t size );
@@ -489,6 +551,18 @@ char *hypre_CAllocDML( HYPRE_Int count , HYPRE_Int elt_size , char *file , HYPRE
 char *hypre_ReAllocDML( char *ptr , HYPRE_Int size , char *file , HYPRE_Int line );
 void hypre_FreeDML( char *ptr , char *file , HYPRE_Int line );
 
+/* memory_pool.c */
+void hypre_MemoryRecordSite ( const char *file , HYPRE_Int line , size_t size );
+char *hypre_MemoryPoolAlloc ( size_t size , HYPRE_Int zero , const char *file , HYPRE_Int line );
+size_t hypre_MemoryPoolSize ( char *ptr );
+HYPRE_Int hypre_MemoryPoolFree ( char *ptr );
+HYPRE_Int hypre_MemorySetMode ( HYPRE_Int mode );
+HYPRE_Int hypre_MemoryGetMode ( HYPRE_Int *mode );
+HYPRE_Int hypre_MemorySetHugeThreshold ( size_t size );
+HYPRE_Int hypre_MemoryPoolRelease ( HYPRE_Int release_chunks );
+HYPRE_Int hypre_MemoryClearStats ( void );
+HYPRE_Int hypre_MemoryPrintStats ( const char *filename );
+
 #ifdef __cplusplus
 }
 #endif
@@ -825,6 +899,39 @@ HYPRE_Int hypre_PrintTiming( const char *heading , MPI_Comm comm );
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Hierarchical profiling (always compiled, switched on at runtime)
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_PROFILE_AMG_SETUP      0
+#define HYPRE_PROFILE_COARSEN        1   /* strength and C/F splitting */
+#define HYPRE_PROFILE_INTERP         2
+#define HYPRE_PROFILE_RAP            3
+#define HYPRE_PROFILE_AMG_SOLVE      4
+#define HYPRE_PROFILE_CYCLE          5
+#define HYPRE_PROFILE_RELAX          6
+#define HYPRE_PROFILE_RESTRICT       7   /* residual and restriction */
+#define HYPRE_PROFILE_PROLONG        8   /* interpolation of the correction */
+#define HYPRE_PROFILE_MATVEC         9
+#define HYPRE_PROFILE_MATVECT       10
+#define HYPRE_PROFILE_COMM_WAIT     11
+#define HYPRE_PROFILE_PCG_SOLVE     12
+#define HYPRE_PROFILE_GMRES_SOLVE   13
+#define HYPRE_PROFILE_NUM_REGIONS   14
+
+extern HYPRE_Int hypre_profile_on;
+
+#define hypre_ProfileBegin(region) \
+(hypre_profile_on ? hypre_ProfileRegionBegin((region), -1) : 0)
+#define hypre_ProfileBeginTag(region, tag) \
+(hypre_profile_on ? hypre_ProfileRegionBegin((region), (tag)) : 0)
+#define hypre_ProfileEnd(region) \
+(hypre_profile_on ? hypre_ProfileRegionEnd(region) : 0)
+
+/* profiling.c */
+HYPRE_Int hypre_ProfileRegionBegin( HYPRE_Int region , HYPRE_Int tag );
+HYPRE_Int hypre_ProfileRegionEnd( HYPRE_Int region );
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,7 @@
  *
  *****************************************************************************/
 
+#include <string.h>
 #include "_hypre_utilities.h"
 
 #ifdef HYPRE_USE_PTHREADS
@@ -51,6 +52,23 @@
  *
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * Heap allocation counter
+ *
+ * With HYPRE_MEMORY_COUNT, counts the calls of hypre_MAlloc, hypre_CAlloc
+ * and hypre_ReAlloc that go to the heap.  Code that is meant to run without
+ * allocations (e.g. the BoomerAMG solve cycle) compares the count before
+ * and after.  Without it the count stays zero.
+ *--------------------------------------------------------------------------*/
+
+static size_t hypre_memory_alloc_count = 0;
+
+size_t
+hypre_MemoryGetAllocCount( void )
+{
+   return hypre_memory_alloc_count;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_OutOfMemory
  *--------------------------------------------------------------------------*/
@@ -67,22 +85,40 @@ hypre_OutOfMemory( size_t size )
 }
 
 /*--------------------------------------------------------------------------
- * hypre_MAlloc
+ * hypre_MAllocSite
+ *
+ * 'file' and 'line' identify the caller for the statistics mode; requests
+ * go to the backend selected with hypre_MemorySetMode (memory_pool.c).
  *--------------------------------------------------------------------------*/
 
 char *
-hypre_MAlloc( size_t size )
+hypre_MAllocSite( size_t      size,
+                  const char *file,
+                  HYPRE_Int   line )
 {
    char *ptr;
 
    if (size > 0)
    {
+      if (hypre_memory_mode)
+      {
+         ptr = hypre_MemoryPoolAlloc(size, 0, file, line);
+      }
+      else
+      {
 #ifdef HYPRE_USE_UMALLOC
-      HYPRE_Int threadid = hypre_GetThreadID();
+         HYPRE_Int threadid = hypre_GetThreadID();
 
-      ptr = _umalloc_(size);
+         ptr = _umalloc_(size);
 #else
-      ptr = malloc(size);
+         ptr = malloc(size);
+#endif
+      }
+#ifdef HYPRE_MEMORY_COUNT
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
+      hypre_memory_alloc_count++;
 #endif
 
 #if 1
@@ -101,24 +137,49 @@ hypre_MAlloc( size_t size )
 }
 
 /*--------------------------------------------------------------------------
- * hypre_CAlloc
+ * hypre_MAlloc
  *--------------------------------------------------------------------------*/
 
 char *
-hypre_CAlloc( size_t count,
-              size_t elt_size )
+hypre_MAlloc( size_t size )
+{
+   return hypre_MAllocSite(size, NULL, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAllocSite
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_CAllocSite( size_t      count,
+                  size_t      elt_size,
+                  const char *file,
+                  HYPRE_Int   line )
 {
    char   *ptr;
    size_t  size = count*elt_size;
 
    if (size > 0)
    {
+      if (hypre_memory_mode)
+      {
+         ptr = hypre_MemoryPoolAlloc(size, 1, file, line);
+      }
+      else
+      {
 #ifdef HYPRE_USE_UMALLOC
-      HYPRE_Int threadid = hypre_GetThreadID();
+         HYPRE_Int threadid = hypre_GetThreadID();
 
-      ptr = _ucalloc_(count, elt_size);
+         ptr = _ucalloc_(count, elt_size);
 #else
-      ptr = calloc(count, elt_size);
+         ptr = calloc(count, elt_size);
+#endif
+      }
+#ifdef HYPRE_MEMORY_COUNT
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
+      hypre_memory_alloc_count++;
 #endif
 
 #if 1
@@ -137,13 +198,54 @@ hypre_CAlloc( size_t count,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_ReAlloc
+ * hypre_CAlloc
  *--------------------------------------------------------------------------*/
 
 char *
-hypre_ReAlloc( char   *ptr,
-               size_t  size )
+hypre_CAlloc( size_t count,
+              size_t elt_size )
 {
+   return hypre_CAllocSite(count, elt_size, NULL, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReAllocSite
+ *
+ * Blocks from the pool or the huge arena are moved to a new block of the
+ * current backend; other blocks stay with realloc.
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_ReAllocSite( char       *ptr,
+                   size_t      size,
+                   const char *file,
+                   HYPRE_Int   line )
+{
+   char   *new_ptr;
+   size_t  old_size;
+
+   if (ptr && (old_size = hypre_MemoryPoolSize(ptr)) > 0)
+   {
+      new_ptr = hypre_MAllocSite(size, file, line);
+      if (new_ptr)
+      {
+         memcpy(new_ptr, ptr, hypre_min(old_size, size));
+      }
+      if (new_ptr || size == 0)
+      {
+         hypre_Free(ptr);
+      }
+      return new_ptr;
+   }
+   if (ptr == NULL && hypre_memory_mode)
+   {
+      return hypre_MAllocSite(size, file, line);
+   }
+   if (size > 0 && (hypre_memory_mode & HYPRE_MEMORY_MODE_STATS))
+   {
+      hypre_MemoryRecordSite(file, line, size);
+   }
+
 #ifdef HYPRE_USE_UMALLOC
    if (ptr == NULL)
    {
@@ -169,6 +271,16 @@ hypre_ReAlloc( char   *ptr,
    }
 #endif
 
+   if (size > 0)
+   {
+#ifdef HYPRE_MEMORY_COUNT
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
+      hypre_memory_alloc_count++;
+#endif
+   }
+
 #if 1
    if ((ptr == NULL) && (size > 0))
    {
@@ -179,6 +291,17 @@ hypre_ReAlloc( char   *ptr,
    return ptr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ReAlloc
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_ReAlloc( char   *ptr,
+               size_t  size )
+{
+   return hypre_ReAllocSite(ptr, size, NULL, 0);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_Free
  *--------------------------------------------------------------------------*/
@@ -186,7 +309,8 @@ hypre_ReAlloc( char   *ptr,
 void
 hypre_Free( char *ptr )
 {
-   if (ptr)
+   /* blocks of the pool or the huge arena are released there */
+   if (ptr && !hypre_MemoryPoolFree(ptr))
    {
 #ifdef HYPRE_USE_UMALLOC
       HYPRE_Int threadid = hypre_GetThreadID();
@@ -199,6 +323,217 @@ hypre_Free( char *ptr )
 }
 
 
+/*--------------------------------------------------------------------------
+ * Workspace arena, see hypre_memory.h.  Only one arena is active at a
+ * time; requests from inside an OpenMP parallel region always go to the
+ * heap.  Every block starts with a header which links it to the block
+ * below, so that blocks may be freed in any order: the space of a block
+ * is reused once it and all blocks above it are freed.
+ *--------------------------------------------------------------------------*/
+
+/* alignment of the arena blocks (a cache line) */
+#define hypre_WorkspaceAlign(size) ( ((size) + 63) & ~((size_t) 63) )
+
+typedef struct
+{
+   size_t  prev_top;   /* offset of the block below */
+   size_t  freed;
+
+} hypre_WorkspaceBlock;
+
+/* offset of the data behind the header, see hypre_WorkspaceBlockSize */
+#define hypre_WorkspaceHeader ((size_t) 64)
+
+#define hypre_WorkspaceBlockAt(workspace, offset) \
+( (hypre_WorkspaceBlock *) ((workspace) -> data + (offset)) )
+
+static hypre_Workspace *hypre_active_workspace = NULL;
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_Workspace *
+hypre_WorkspaceCreate( size_t size )
+{
+   hypre_Workspace *workspace;
+
+   workspace = hypre_CTAlloc(hypre_Workspace, 1);
+   hypre_WorkspaceReserve(workspace, size);
+
+   return workspace;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WorkspaceDestroy( hypre_Workspace *workspace )
+{
+   if (workspace)
+   {
+      if (hypre_active_workspace == workspace)
+      {
+         hypre_active_workspace = NULL;
+      }
+      hypre_TFree(workspace -> data);
+      hypre_TFree(workspace);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceReserve
+ *
+ * Grows the arena to at least 'size' bytes and to its recorded peak, so
+ * that requests which went to the heap before fit the next time.  The
+ * arena must not be in use.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WorkspaceReserve( hypre_Workspace *workspace,
+                        size_t           size )
+{
+   if (!workspace)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (workspace -> used)
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
+   }
+
+   size = hypre_WorkspaceAlign(hypre_max(size, workspace -> peak));
+   if (size > workspace -> size)
+   {
+      hypre_TFree(workspace -> data);
+      workspace -> data = hypre_TAlloc(char, size);
+      workspace -> size = size;
+   }
+   workspace -> peak = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceSetActive
+ *
+ * Makes 'workspace' (may be NULL) the active arena and returns the
+ * previously active one, to be restored by the caller.
+ *--------------------------------------------------------------------------*/
+
+hypre_Workspace *
+hypre_WorkspaceSetActive( hypre_Workspace *workspace )
+{
+   hypre_Workspace *previous = hypre_active_workspace;
+
+   hypre_active_workspace = workspace;
+
+   return previous;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceMAlloc
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_WorkspaceMAlloc( size_t size )
+{
+   hypre_Workspace      *workspace = hypre_active_workspace;
+   hypre_WorkspaceBlock *block;
+   size_t                offset;
+
+   if (size == 0)
+   {
+      return NULL;
+   }
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      workspace = NULL;
+   }
+#endif
+   if (!workspace)
+   {
+      return hypre_MAlloc(size);
+   }
+
+   offset = workspace -> used;
+   if (offset + hypre_WorkspaceBlockSize(size) > workspace -> size)
+   {
+      /* does not fit: serve from the heap, remember the size needed */
+      workspace -> peak = hypre_max(workspace -> peak,
+                                    offset + hypre_WorkspaceBlockSize(size));
+      (workspace -> num_heap)++;
+      return hypre_MAlloc(size);
+   }
+
+   block = hypre_WorkspaceBlockAt(workspace, offset);
+   block -> prev_top = workspace -> top;
+   block -> freed    = 0;
+   workspace -> top  = offset;
+   workspace -> used = offset + hypre_WorkspaceBlockSize(size);
+   workspace -> peak = hypre_max(workspace -> peak, workspace -> used);
+
+   return (char *) block + hypre_WorkspaceHeader;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceCAlloc
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_WorkspaceCAlloc( size_t count,
+                       size_t elt_size )
+{
+   char *ptr = hypre_WorkspaceMAlloc(count*elt_size);
+
+   if (ptr)
+   {
+      memset(ptr, 0, count*elt_size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_WorkspaceFree
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_WorkspaceFree( char *ptr )
+{
+   hypre_Workspace      *workspace = hypre_active_workspace;
+   hypre_WorkspaceBlock *block;
+
+   if (workspace && ptr >= workspace -> data &&
+       ptr < workspace -> data + workspace -> size)
+   {
+      block = (hypre_WorkspaceBlock *) (ptr - hypre_WorkspaceHeader);
+      block -> freed = 1;
+
+      /* pop all freed blocks from the top */
+      while (workspace -> used > 0)
+      {
+         block = hypre_WorkspaceBlockAt(workspace, workspace -> top);
+         if (!(block -> freed))
+         {
+            break;
+         }
+         workspace -> used = workspace -> top;
+         workspace -> top  = block -> prev_top;
+      }
+   }
+   else
+   {
+      hypre_Free(ptr);
+   }
+}
+
 /*--------------------------------------------------------------------------
  * These Shared routines are for one thread to allocate memory for data
  * will be visible to all threads.  The file-scope pointer
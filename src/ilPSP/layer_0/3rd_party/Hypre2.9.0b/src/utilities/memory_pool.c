@@ -0,0 +1,834 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 2.0 $
+ ***********************************************************************EHEADER*/
+
+
+
+/******************************************************************************
+ *
+ * Memory management utilities
+ *
+ * Allocator backends selected at runtime with hypre_MemorySetMode:
+ *
+ *  - HYPRE_MEMORY_MODE_POOL:  requests up to hypre_PoolMaxBlock bytes are
+ *    served from power-of-two size classes.  Each class carves its blocks
+ *    from 2MB chunks and keeps freed blocks on a free list; chunks are kept
+ *    until hypre_MemoryPoolRelease.
+ *  - HYPRE_MEMORY_MODE_HUGE:  requests of at least the huge threshold (large
+ *    CSR arrays) get their own 2MB aligned region, advised for transparent
+ *    huge pages where the system supports it.  A few freed regions are kept
+ *    for reuse.
+ *  - HYPRE_MEMORY_MODE_STATS: counts and bytes of all requests are recorded
+ *    per call site (__FILE__/__LINE__ of hypre_TAlloc and friends), see
+ *    hypre_MemoryPrintStats.
+ *
+ * Pool chunks and huge regions are entered in a table keyed by their 2MB
+ * frame, so hypre_Free recognizes them regardless of the current mode.
+ * Everything else goes to malloc/free as before.  The bookkeeping itself
+ * uses malloc directly.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+#include <string.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+HYPRE_Int hypre_memory_mode = HYPRE_MEMORY_MODE_SYSTEM;
+
+#define hypre_PoolFrameBits    21
+#define hypre_PoolFrameSize    ((size_t) 1 << hypre_PoolFrameBits)
+#define hypre_PoolFrame(ptr)   ((size_t) (ptr) >> hypre_PoolFrameBits)
+#define hypre_PoolMinBits      4      /* smallest class: 16 bytes */
+#define hypre_PoolNumClasses   14     /* largest class: 128 KB */
+#define hypre_PoolMaxBlock     ((size_t) 1 << (hypre_PoolMinBits+hypre_PoolNumClasses-1))
+#define hypre_PoolNumCached    8
+
+/* frame table entries: a pool chunk (size class) or a huge region (bytes) */
+#define hypre_PoolEmpty        0
+#define hypre_PoolDeleted      1
+#define hypre_PoolKindChunk    1
+#define hypre_PoolKindHuge     2
+
+typedef struct
+{
+   size_t     frame;
+   HYPRE_Int  kind;
+   size_t     size;      /* block size of the chunk, or size of the region */
+
+} hypre_PoolEntry;
+
+typedef struct
+{
+   const char *file;
+   HYPRE_Int   line;
+   size_t      count;
+   size_t      bytes;
+
+} hypre_MemorySite;
+
+static hypre_PoolEntry  *hypre_pool_table = NULL;
+static size_t            hypre_pool_table_size = 0;   /* power of two */
+static size_t            hypre_pool_table_used = 0;   /* incl. deleted */
+static size_t            hypre_pool_table_live = 0;
+
+/* set (inside the critical section) before the first block of the pool or
+   the huge arena is handed out, and never reset; lets hypre_Free skip the
+   critical section as long as neither backend has been used */
+static HYPRE_Int         hypre_pool_in_use = 0;
+
+static char             *hypre_pool_free[hypre_PoolNumClasses];
+static char             *hypre_pool_next[hypre_PoolNumClasses];
+static char             *hypre_pool_end[hypre_PoolNumClasses];
+static char            **hypre_pool_chunks = NULL;
+static size_t            hypre_pool_num_chunks = 0;
+
+static char             *hypre_huge_cache[hypre_PoolNumCached];
+static size_t            hypre_huge_cache_size[hypre_PoolNumCached];
+static size_t            hypre_huge_threshold = hypre_PoolFrameSize;
+static size_t            hypre_huge_bytes = 0;
+static size_t            hypre_huge_peak = 0;
+
+static hypre_MemorySite *hypre_memory_sites = NULL;
+static size_t            hypre_memory_sites_size = 0;
+static size_t            hypre_memory_sites_used = 0;
+
+/*--------------------------------------------------------------------------
+ * Frame-aligned system memory
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_PoolFrameAlloc( size_t size )
+{
+   void *ptr = NULL;
+
+#if defined(_WIN32)
+   ptr = _aligned_malloc(size, hypre_PoolFrameSize);
+#else
+   if (posix_memalign(&ptr, hypre_PoolFrameSize, size))
+   {
+      ptr = NULL;
+   }
+#endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+   if (ptr)
+   {
+      madvise(ptr, size, MADV_HUGEPAGE);
+   }
+#endif
+
+   return (char *) ptr;
+}
+
+static void
+hypre_PoolFrameFree( char *ptr )
+{
+#if defined(_WIN32)
+   _aligned_free(ptr);
+#else
+   free(ptr);
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_pool_in_use is read outside of the critical section, so the read
+ * and the write must be atomic; without OpenMP 3.1 atomics the read is
+ * done in the critical section.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PoolInUse( )
+{
+   HYPRE_Int in_use;
+
+#if defined(HYPRE_USING_OPENMP) && defined(_OPENMP) && (_OPENMP >= 201107)
+#pragma omp atomic read
+   in_use = hypre_pool_in_use;
+#elif defined(HYPRE_USING_OPENMP)
+#pragma omp critical (hypre_memory_pool)
+   in_use = hypre_pool_in_use;
+#else
+   in_use = hypre_pool_in_use;
+#endif
+
+   return in_use;
+}
+
+/*--------------------------------------------------------------------------
+ * Frame table (open addressing)
+ *--------------------------------------------------------------------------*/
+
+static size_t
+hypre_PoolHash( size_t frame )
+{
+   return (frame * (size_t) 0x9E3779B97F4A7C15ULL) >> 7;
+}
+
+static hypre_PoolEntry *
+hypre_PoolLookup( char *ptr )
+{
+   size_t frame = hypre_PoolFrame(ptr);
+   size_t mask, i;
+
+   if (!hypre_pool_table_live)
+   {
+      return NULL;
+   }
+   mask = hypre_pool_table_size - 1;
+   for (i = hypre_PoolHash(frame) & mask; ; i = (i + 1) & mask)
+   {
+      if (hypre_pool_table[i].frame == frame)
+      {
+         return &hypre_pool_table[i];
+      }
+      if (hypre_pool_table[i].frame == hypre_PoolEmpty)
+      {
+         return NULL;
+      }
+   }
+}
+
+static HYPRE_Int
+hypre_PoolInsert( char *ptr, HYPRE_Int kind, size_t size )
+{
+   hypre_PoolEntry *old_table = hypre_pool_table;
+   size_t           old_size  = hypre_pool_table_size;
+   size_t           frame, mask, i;
+
+   if (2*(hypre_pool_table_used + 1) > hypre_pool_table_size)
+   {
+      /* grow (or just clean out deleted entries) and rehash */
+      for (hypre_pool_table_size = 64;
+           hypre_pool_table_size < 4*hypre_pool_table_live;
+           hypre_pool_table_size *= 2);
+      hypre_pool_table = (hypre_PoolEntry *)
+         calloc(hypre_pool_table_size, sizeof(hypre_PoolEntry));
+      if (!hypre_pool_table)
+      {
+         hypre_pool_table = old_table;
+         hypre_pool_table_size = old_size;
+         return 1;
+      }
+      hypre_pool_table_used = 0;
+      hypre_pool_table_live = 0;
+      for (i = 0; i < old_size; i++)
+      {
+         if (old_table[i].frame > hypre_PoolDeleted)
+         {
+            hypre_PoolInsert((char *) (old_table[i].frame << hypre_PoolFrameBits),
+                             old_table[i].kind, old_table[i].size);
+         }
+      }
+      free(old_table);
+   }
+
+   frame = hypre_PoolFrame(ptr);
+   mask  = hypre_pool_table_size - 1;
+   for (i = hypre_PoolHash(frame) & mask;
+        hypre_pool_table[i].frame > hypre_PoolDeleted; i = (i + 1) & mask);
+   if (hypre_pool_table[i].frame == hypre_PoolEmpty)
+   {
+      hypre_pool_table_used++;
+   }
+   hypre_pool_table[i].frame = frame;
+   hypre_pool_table[i].kind  = kind;
+   hypre_pool_table[i].size  = size;
+   hypre_pool_table_live++;
+
+   if (!hypre_pool_in_use)
+   {
+#if defined(HYPRE_USING_OPENMP) && defined(_OPENMP) && (_OPENMP >= 201107)
+#pragma omp atomic write
+#endif
+      hypre_pool_in_use = 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Size-class pool
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_PoolAllocBlock( size_t size )
+{
+   HYPRE_Int  c = 0;
+   size_t     block = (size_t) 1 << hypre_PoolMinBits;
+   char      *ptr, **chunks;
+
+   while (block < size)
+   {
+      block <<= 1;
+      c++;
+   }
+
+   ptr = hypre_pool_free[c];
+   if (ptr)
+   {
+      hypre_pool_free[c] = *((char **) ptr);
+      return ptr;
+   }
+
+   if (!hypre_pool_next[c] || hypre_pool_next[c] + block > hypre_pool_end[c])
+   {
+      /* carve a new chunk for this class */
+      chunks = (char **) realloc(hypre_pool_chunks,
+                                 (hypre_pool_num_chunks+1)*sizeof(char *));
+      if (!chunks)
+      {
+         return NULL;
+      }
+      hypre_pool_chunks = chunks;
+      ptr = hypre_PoolFrameAlloc(hypre_PoolFrameSize);
+      if (!ptr)
+      {
+         return NULL;
+      }
+      if (hypre_PoolInsert(ptr, hypre_PoolKindChunk, block))
+      {
+         hypre_PoolFrameFree(ptr);
+         return NULL;
+      }
+      hypre_pool_chunks[hypre_pool_num_chunks++] = ptr;
+      hypre_pool_next[c] = ptr;
+      hypre_pool_end[c]  = ptr + hypre_PoolFrameSize;
+   }
+
+   ptr = hypre_pool_next[c];
+   hypre_pool_next[c] += block;
+
+   return ptr;
+}
+
+static void
+hypre_PoolFreeBlock( char *ptr, size_t block )
+{
+   HYPRE_Int c = 0;
+
+   while (((size_t) 1 << (hypre_PoolMinBits + c)) < block)
+   {
+      c++;
+   }
+   *((char **) ptr) = hypre_pool_free[c];
+   hypre_pool_free[c] = ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * Huge-page arena
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_HugeAlloc( size_t size )
+{
+   HYPRE_Int  i, best = -1;
+   char      *ptr;
+
+   size = (size + hypre_PoolFrameSize - 1) & ~(hypre_PoolFrameSize - 1);
+
+   /* smallest cached region that fits without wasting more than half */
+   for (i = 0; i < hypre_PoolNumCached; i++)
+   {
+      if (hypre_huge_cache[i] && hypre_huge_cache_size[i] >= size &&
+          hypre_huge_cache_size[i] <= 2*size &&
+          (best < 0 || hypre_huge_cache_size[i] < hypre_huge_cache_size[best]))
+      {
+         best = i;
+      }
+   }
+   if (best >= 0)
+   {
+      ptr  = hypre_huge_cache[best];
+      size = hypre_huge_cache_size[best];
+      hypre_huge_cache[best] = NULL;
+   }
+   else
+   {
+      ptr = hypre_PoolFrameAlloc(size);
+      if (!ptr)
+      {
+         return NULL;
+      }
+   }
+   if (hypre_PoolInsert(ptr, hypre_PoolKindHuge, size))
+   {
+      hypre_PoolFrameFree(ptr);
+      return NULL;
+   }
+   hypre_huge_bytes += size;
+   if (hypre_huge_bytes > hypre_huge_peak)
+   {
+      hypre_huge_peak = hypre_huge_bytes;
+   }
+
+   return ptr;
+}
+
+static void
+hypre_HugeFree( char *ptr, size_t size )
+{
+   HYPRE_Int i, smallest = 0;
+
+   hypre_huge_bytes -= size;
+   for (i = 0; i < hypre_PoolNumCached; i++)
+   {
+      if (!hypre_huge_cache[i])
+      {
+         hypre_huge_cache[i] = ptr;
+         hypre_huge_cache_size[i] = size;
+         return;
+      }
+      if (hypre_huge_cache_size[i] < hypre_huge_cache_size[smallest])
+      {
+         smallest = i;
+      }
+   }
+   /* cache full: keep the larger region */
+   if (hypre_huge_cache_size[smallest] < size)
+   {
+      hypre_PoolFrameFree(hypre_huge_cache[smallest]);
+      hypre_huge_cache[smallest] = ptr;
+      hypre_huge_cache_size[smallest] = size;
+   }
+   else
+   {
+      hypre_PoolFrameFree(ptr);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Call-site statistics
+ *--------------------------------------------------------------------------*/
+
+static size_t
+hypre_MemorySiteHash( const char *file, HYPRE_Int line )
+{
+   return (((size_t) file) >> 3) * 31 + (size_t) line;
+}
+
+static void
+hypre_MemorySiteRecord( const char *file, HYPRE_Int line, size_t size )
+{
+   hypre_MemorySite *old_sites = hypre_memory_sites;
+   size_t            old_size  = hypre_memory_sites_size;
+   size_t            mask, i, j;
+
+   if (2*(hypre_memory_sites_used + 1) > hypre_memory_sites_size)
+   {
+      hypre_memory_sites_size = hypre_max(256, 2*old_size);
+      hypre_memory_sites = (hypre_MemorySite *)
+         calloc(hypre_memory_sites_size, sizeof(hypre_MemorySite));
+      if (!hypre_memory_sites)
+      {
+         hypre_memory_sites = old_sites;
+         hypre_memory_sites_size = old_size;
+         return;
+      }
+      mask = hypre_memory_sites_size - 1;
+      for (i = 0; i < old_size; i++)
+      {
+         if (old_sites[i].count)
+         {
+            for (j = hypre_MemorySiteHash(old_sites[i].file, old_sites[i].line) & mask;
+                 hypre_memory_sites[j].count; j = (j + 1) & mask);
+            hypre_memory_sites[j] = old_sites[i];
+         }
+      }
+      free(old_sites);
+   }
+
+   mask = hypre_memory_sites_size - 1;
+   for (i = hypre_MemorySiteHash(file, line) & mask; ; i = (i + 1) & mask)
+   {
+      if (!hypre_memory_sites[i].count)
+      {
+         hypre_memory_sites[i].file = file;
+         hypre_memory_sites[i].line = line;
+         hypre_memory_sites_used++;
+         break;
+      }
+      if (hypre_memory_sites[i].file == file && hypre_memory_sites[i].line == line)
+      {
+         break;
+      }
+   }
+   hypre_memory_sites[i].count++;
+   hypre_memory_sites[i].bytes += size;
+}
+
+static int
+hypre_MemorySiteCompare( const void *a, const void *b )
+{
+   const hypre_MemorySite *sa = (const hypre_MemorySite *) a;
+   const hypre_MemorySite *sb = (const hypre_MemorySite *) b;
+
+   if (sa -> bytes != sb -> bytes)
+   {
+      return (sa -> bytes < sb -> bytes) ? 1 : -1;
+   }
+   return (sa -> count < sb -> count) ? 1 : (sa -> count > sb -> count) ? -1 : 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryRecordSite
+ *
+ * Records a request that does not go through hypre_MemoryPoolAlloc (a
+ * realloc of a system block) for the statistics mode.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_MemoryRecordSite( const char *file,
+                        HYPRE_Int   line,
+                        size_t      size )
+{
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   hypre_MemorySiteRecord(file, line, size);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryPoolAlloc
+ *
+ * Called by hypre_MAllocSite and friends when hypre_memory_mode is not
+ * HYPRE_MEMORY_MODE_SYSTEM.  Returns NULL on failure.
+ *--------------------------------------------------------------------------*/
+
+char *
+hypre_MemoryPoolAlloc( size_t      size,
+                       HYPRE_Int   zero,
+                       const char *file,
+                       HYPRE_Int   line )
+{
+   char *ptr = NULL;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      if (hypre_memory_mode & HYPRE_MEMORY_MODE_STATS)
+      {
+         hypre_MemorySiteRecord(file, line, size);
+      }
+      if ((hypre_memory_mode & HYPRE_MEMORY_MODE_HUGE) &&
+          size >= hypre_huge_threshold)
+      {
+         ptr = hypre_HugeAlloc(size);
+      }
+      else if ((hypre_memory_mode & HYPRE_MEMORY_MODE_POOL) &&
+               size <= hypre_PoolMaxBlock)
+      {
+         ptr = hypre_PoolAllocBlock(size);
+      }
+   }
+
+   if (!ptr)
+   {
+      ptr = zero ? (char *) calloc(size, 1) : (char *) malloc(size);
+   }
+   else if (zero)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryPoolSize
+ *
+ * Returns the usable size of a block from the pool or the huge arena, and
+ * 0 for any other pointer.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_MemoryPoolSize( char *ptr )
+{
+   hypre_PoolEntry *entry;
+   size_t           size = 0;
+
+   if (!hypre_PoolInUse())
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      entry = hypre_PoolLookup(ptr);
+      if (entry)
+      {
+         size = entry -> size;
+      }
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryPoolFree
+ *
+ * Returns 1 if 'ptr' belonged to the pool or the huge arena and has been
+ * released, and 0 if it has to go to free().
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemoryPoolFree( char *ptr )
+{
+   hypre_PoolEntry *entry;
+   HYPRE_Int        found = 0;
+
+   if (!hypre_PoolInUse())
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      entry = hypre_PoolLookup(ptr);
+      if (entry && entry -> kind == hypre_PoolKindChunk)
+      {
+         hypre_PoolFreeBlock(ptr, entry -> size);
+         found = 1;
+      }
+      else if (entry)
+      {
+         entry -> frame = hypre_PoolDeleted;
+         hypre_pool_table_live--;
+         hypre_HugeFree(ptr, entry -> size);
+         found = 1;
+      }
+   }
+
+   return found;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemorySetMode
+ *
+ * 'mode' is HYPRE_MEMORY_MODE_SYSTEM or a combination of the POOL, HUGE
+ * and STATS bits.  May be changed at any time; blocks are always returned
+ * to the backend they came from.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemorySetMode( HYPRE_Int mode )
+{
+   if (mode & ~(HYPRE_MEMORY_MODE_POOL | HYPRE_MEMORY_MODE_HUGE |
+                HYPRE_MEMORY_MODE_STATS))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_memory_mode = mode;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_MemoryGetMode( HYPRE_Int *mode )
+{
+   *mode = hypre_memory_mode;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemorySetHugeThreshold
+ *
+ * Requests of at least 'size' bytes go to the huge arena (default 2MB).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemorySetHugeThreshold( size_t size )
+{
+   if (size == 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_huge_threshold = size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryPoolRelease
+ *
+ * Returns the cached huge regions to the system, and with 'release_chunks'
+ * also all pool chunks.  The latter is only allowed when no pool block is
+ * in use any more; this is not checked.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemoryPoolRelease( HYPRE_Int release_chunks )
+{
+   hypre_PoolEntry *entry;
+   HYPRE_Int        i;
+   size_t           k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      for (i = 0; i < hypre_PoolNumCached; i++)
+      {
+         if (hypre_huge_cache[i])
+         {
+            hypre_PoolFrameFree(hypre_huge_cache[i]);
+            hypre_huge_cache[i] = NULL;
+         }
+      }
+      if (release_chunks)
+      {
+         for (k = 0; k < hypre_pool_num_chunks; k++)
+         {
+            entry = hypre_PoolLookup(hypre_pool_chunks[k]);
+            entry -> frame = hypre_PoolDeleted;
+            hypre_pool_table_live--;
+            hypre_PoolFrameFree(hypre_pool_chunks[k]);
+         }
+         free(hypre_pool_chunks);
+         hypre_pool_chunks = NULL;
+         hypre_pool_num_chunks = 0;
+         for (i = 0; i < hypre_PoolNumClasses; i++)
+         {
+            hypre_pool_free[i] = NULL;
+            hypre_pool_next[i] = NULL;
+            hypre_pool_end[i]  = NULL;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryClearStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemoryClearStats( void )
+{
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      free(hypre_memory_sites);
+      hypre_memory_sites = NULL;
+      hypre_memory_sites_size = 0;
+      hypre_memory_sites_used = 0;
+      hypre_huge_peak = hypre_huge_bytes;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_MemoryPrintStats
+ *
+ * Writes the recorded call sites, largest number of bytes first, and the
+ * state of the pool to 'filename' (stdout if NULL).  Each rank should use
+ * its own file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_MemoryPrintStats( const char *filename )
+{
+   FILE             *file;
+   hypre_MemorySite *sites;
+   size_t            i, n = 0, count = 0, bytes = 0;
+
+   if (filename)
+   {
+      if ((file = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_in_arg(1);
+         return hypre_error_flag;
+      }
+   }
+   else
+   {
+      file = stdout;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_pool)
+#endif
+   {
+      sites = (hypre_MemorySite *)
+         malloc((hypre_memory_sites_used+1)*sizeof(hypre_MemorySite));
+      for (i = 0; sites && i < hypre_memory_sites_size; i++)
+      {
+         if (hypre_memory_sites[i].count)
+         {
+            sites[n++] = hypre_memory_sites[i];
+         }
+      }
+   }
+
+   if (sites)
+   {
+      qsort(sites, n, sizeof(hypre_MemorySite), hypre_MemorySiteCompare);
+      for (i = 0; i < n; i++)
+      {
+         count += sites[i].count;
+         bytes += sites[i].bytes;
+      }
+      hypre_fprintf(file, "# hypre allocations: %.0f calls, %.0f bytes, %d sites\n",
+                    (double) count, (double) bytes, (HYPRE_Int) n);
+      hypre_fprintf(file, "# pool: %d chunks of %d bytes, "
+                    "huge arena: %.0f bytes in use, %.0f bytes peak\n",
+                    (HYPRE_Int) hypre_pool_num_chunks,
+                    (HYPRE_Int) hypre_PoolFrameSize,
+                    (double) hypre_huge_bytes, (double) hypre_huge_peak);
+      hypre_fprintf(file, "#          bytes      calls  site\n");
+      for (i = 0; i < n; i++)
+      {
+         hypre_fprintf(file, "%16.0f %10.0f  %s:%d\n",
+                       (double) sites[i].bytes, (double) sites[i].count,
+                       sites[i].file ? sites[i].file : "(unknown)",
+                       sites[i].line);
+      }
+      free(sites);
+   }
+
+   if (filename)
+   {
+      fclose(file);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetMemoryMode, HYPRE_PrintMemoryStats
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetMemoryMode( HYPRE_Int mode )
+{
+   return( hypre_MemorySetMode(mode) );
+}
+
+HYPRE_Int
+HYPRE_PrintMemoryStats( const char *filename )
+{
+   return( hypre_MemoryPrintStats(filename) );
+}
@@ -484,6 +484,20 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{ 
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   *request = hypre_MPI_REQUEST_NULL;
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -766,8 +780,8 @@ hypre_MPI_Allgatherv( void               *sendbuf,
    HYPRE_Int  ierr;
 
    MPI_Comm_size(comm, &csize);
-   mpi_recvcounts = hypre_TAlloc(hypre_int, csize);
-   mpi_displs = hypre_TAlloc(hypre_int, csize);
+   mpi_recvcounts = hypre_WorkspaceTAlloc(hypre_int, csize);
+   mpi_displs = hypre_WorkspaceTAlloc(hypre_int, csize);
    for (i = 0; i < csize; i++)
    {
       mpi_recvcounts[i] = (hypre_int) recvcounts[i];
@@ -776,8 +790,8 @@ hypre_MPI_Allgatherv( void               *sendbuf,
    ierr = (HYPRE_Int) MPI_Allgatherv(sendbuf, (hypre_int)sendcount, sendtype,
                                      recvbuf, mpi_recvcounts, mpi_displs, 
                                      recvtype, comm);
-   hypre_TFree(mpi_recvcounts);
-   hypre_TFree(mpi_displs);
+   hypre_WorkspaceTFree(mpi_recvcounts);
+   hypre_WorkspaceTFree(mpi_displs);
 
    return ierr;
 }
@@ -1014,6 +1028,27 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+/* MPI_Iallreduce is only available from MPI-3 on; with older MPI libraries
+   the reduction is completed immediately and a null request is returned */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -0,0 +1,466 @@
+/*BHEADER**********************************************************************
+ * Copyright (c) 2008,  Lawrence Livermore National Security, LLC.
+ * Produced at the Lawrence Livermore National Laboratory.
+ * This file is part of HYPRE.  See file COPYRIGHT for details.
+ *
+ * HYPRE is free software; you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License (as published by the Free
+ * Software Foundation) version 2.1 dated February 1999.
+ *
+ * $Revision: 2.0 $
+ ***********************************************************************EHEADER*/
+
+/******************************************************************************
+ *
+ * Hierarchical profiling of hypre regions.
+ *
+ * Unlike the flat table of timing.c, this is always compiled in and is
+ * switched on at runtime with HYPRE_ProfileSetState.  Each begin/end pair
+ * of a region moves the current position in a call tree whose nodes are
+ * keyed by (parent, region, tag); the tag is used for the multigrid level.
+ * A node accumulates the number of calls and the inclusive wall time.
+ * With profiling off, a region costs one load and branch at the call site.
+ *
+ * Only the master thread outside of OpenMP parallel regions records, so the
+ * tree needs no locking.  Ending a region closes any regions that were left
+ * open inside it (e.g. by an early exit), charging them the elapsed time.
+ *
+ * The tree can be walked node by node (parents come before their children)
+ * to merge it into another profiler, or written per rank as JSON or in a
+ * compact binary form.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#include <time.h>
+#ifdef WIN32
+#include <windows.h>
+#endif
+#ifdef HYPRE_USING_OPENMP
+#include <omp.h>
+#endif
+
+HYPRE_Int hypre_profile_on = 0;
+
+static const char *hypre_profile_names[HYPRE_PROFILE_NUM_REGIONS] =
+{
+   "BoomerAMGSetup",
+   "Coarsen",
+   "Interp",
+   "RAP",
+   "BoomerAMGSolve",
+   "Cycle",
+   "Relax",
+   "Restrict",
+   "Prolong",
+   "Matvec",
+   "MatvecT",
+   "CommWait",
+   "PCGSolve",
+   "GMRESSolve"
+};
+
+typedef struct
+{
+   HYPRE_Int  region;
+   HYPRE_Int  tag;
+   HYPRE_Int  parent;
+   HYPRE_Int  child;     /* first child */
+   HYPRE_Int  sibling;   /* next child of the same parent */
+   HYPRE_Int  count;
+   double     seconds;
+   double     start;
+
+} hypre_ProfileNode;
+
+/* node 0 is the root; it is not reported */
+static hypre_ProfileNode *hypre_profile_nodes = NULL;
+static HYPRE_Int          hypre_profile_num_nodes = 0;
+static HYPRE_Int          hypre_profile_size = 0;
+static HYPRE_Int          hypre_profile_current = 0;
+
+/*--------------------------------------------------------------------------
+ * Monotonic wall clock; cheaper and finer than time_getWallclockSeconds.
+ *--------------------------------------------------------------------------*/
+
+static double
+hypre_ProfileClock( void )
+{
+#if defined(WIN32)
+   static double tick = 0.0;
+   LARGE_INTEGER count;
+
+   if (tick == 0.0)
+   {
+      LARGE_INTEGER freq;
+      QueryPerformanceFrequency(&freq);
+      tick = 1.0 / (double) freq.QuadPart;
+   }
+   QueryPerformanceCounter(&count);
+   return tick * (double) count.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+#else
+   return time_getWallclockSeconds();
+#endif
+}
+
+static HYPRE_Int
+hypre_ProfileRecording( void )
+{
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      return 0;
+   }
+#endif
+   return 1;
+}
+
+static HYPRE_Int
+hypre_ProfileNewNode( HYPRE_Int region, HYPRE_Int tag, HYPRE_Int parent )
+{
+   hypre_ProfileNode *node;
+   HYPRE_Int          n = hypre_profile_num_nodes;
+
+   if (n == hypre_profile_size)
+   {
+      HYPRE_Int          size = hypre_max(2*hypre_profile_size, 256);
+      hypre_ProfileNode *nodes;
+
+      /* system allocator: the tree must not show up in the allocation
+         counter or the statistics of the hypre allocator */
+      nodes = realloc(hypre_profile_nodes, size * sizeof(hypre_ProfileNode));
+      if (nodes == NULL)
+      {
+         return -1;
+      }
+      hypre_profile_nodes = nodes;
+      hypre_profile_size  = size;
+   }
+
+   node = &hypre_profile_nodes[n];
+   node -> region  = region;
+   node -> tag     = tag;
+   node -> parent  = parent;
+   node -> child   = -1;
+   node -> sibling = -1;
+   node -> count   = 0;
+   node -> seconds = 0.0;
+   node -> start   = 0.0;
+   if (parent >= 0)
+   {
+      /* append, so that children keep the order of their first call */
+      HYPRE_Int *link = &hypre_profile_nodes[parent].child;
+
+      while (*link >= 0)
+      {
+         link = &hypre_profile_nodes[*link].sibling;
+      }
+      *link = n;
+   }
+   hypre_profile_num_nodes++;
+
+   return n;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileRegionBegin
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileRegionBegin( HYPRE_Int region, HYPRE_Int tag )
+{
+   HYPRE_Int node;
+
+   if (!hypre_ProfileRecording())
+   {
+      return 0;
+   }
+   if (hypre_profile_num_nodes == 0)
+   {
+      if (hypre_ProfileNewNode(-1, -1, -1) < 0)
+      {
+         return 0;
+      }
+      hypre_profile_current = 0;
+   }
+
+   for (node = hypre_profile_nodes[hypre_profile_current].child; node >= 0;
+        node = hypre_profile_nodes[node].sibling)
+   {
+      if (hypre_profile_nodes[node].region == region &&
+          hypre_profile_nodes[node].tag == tag)
+      {
+         break;
+      }
+   }
+   if (node < 0)
+   {
+      node = hypre_ProfileNewNode(region, tag, hypre_profile_current);
+      if (node < 0)
+      {
+         return 0;
+      }
+   }
+
+   hypre_profile_current = node;
+   hypre_profile_nodes[node].start = hypre_ProfileClock();
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileRegionEnd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileRegionEnd( HYPRE_Int region )
+{
+   HYPRE_Int          node;
+   hypre_ProfileNode *closed;
+   double             now;
+
+   if (!hypre_ProfileRecording() || hypre_profile_num_nodes == 0)
+   {
+      return 0;
+   }
+
+   /* an end without a matching begin (e.g. profiling was switched on
+      inside the region) is ignored */
+   for (node = hypre_profile_current; node > 0;
+        node = hypre_profile_nodes[node].parent)
+   {
+      if (hypre_profile_nodes[node].region == region)
+      {
+         break;
+      }
+   }
+   if (node <= 0)
+   {
+      return 0;
+   }
+
+   now = hypre_ProfileClock();
+   while (hypre_profile_current != hypre_profile_nodes[node].parent)
+   {
+      closed = &hypre_profile_nodes[hypre_profile_current];
+      closed -> seconds += now - closed -> start;
+      closed -> count++;
+      hypre_profile_current = closed -> parent;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfileSetState
+ *
+ * Switches recording on (state != 0) or off.  Switching off abandons any
+ * open regions; the recorded tree is kept until HYPRE_ProfileClear.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfileSetState( HYPRE_Int state )
+{
+   hypre_profile_on = (state != 0);
+   hypre_profile_current = 0;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_ProfileGetState( HYPRE_Int *state )
+{
+   if (!state)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *state = hypre_profile_on;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfileClear
+ *
+ * Discards the recorded tree.  Must not be called from inside a profiled
+ * hypre region (e.g. from a user callback).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfileClear( void )
+{
+   free(hypre_profile_nodes);
+   hypre_profile_nodes = NULL;
+   hypre_profile_num_nodes = 0;
+   hypre_profile_size = 0;
+   hypre_profile_current = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfileGetNumNodes
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfileGetNumNodes( HYPRE_Int *num_nodes )
+{
+   if (!num_nodes)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *num_nodes = hypre_max(hypre_profile_num_nodes - 1, 0);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfileGetNode
+ *
+ * Returns node 'node' (0 <= node < num_nodes) of the call tree.  'parent'
+ * is -1 for top-level regions and is always smaller than 'node'.  'tag' is
+ * the multigrid level for per-level regions and -1 otherwise.  'name'
+ * points to a static string.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfileGetNode( HYPRE_Int    node,
+                      HYPRE_Int   *parent,
+                      const char **name,
+                      HYPRE_Int   *tag,
+                      HYPRE_Int   *count,
+                      double      *seconds )
+{
+   hypre_ProfileNode *pnode;
+
+   if (node < 0 || node >= hypre_profile_num_nodes - 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   pnode = &hypre_profile_nodes[node+1];
+   if (parent)  *parent  = pnode -> parent - 1;
+   if (name)    *name    = hypre_profile_names[pnode -> region];
+   if (tag)     *tag     = pnode -> tag;
+   if (count)   *count   = pnode -> count;
+   if (seconds) *seconds = pnode -> seconds;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilePrint
+ *
+ * Writes the tree of the calling rank to 'filename':
+ *
+ * HYPRE_PROFILE_FORMAT_JSON: nested objects
+ *    {"regions":[{"name":..,"level":..,"calls":..,"seconds":..,
+ *                 "children":[..]}, ..]}
+ *    where "level" is present for per-level regions only.
+ *
+ * HYPRE_PROFILE_FORMAT_BINARY: native byte order
+ *    char[8] "HYPRPROF", int32 version (1),
+ *    int32 num_names, num_names * { int32 length, char[length] },
+ *    int32 num_nodes, num_nodes * { int32 parent, int32 name, int32 tag,
+ *                                   int32 calls, float64 seconds }
+ *    with the node conventions of HYPRE_ProfileGetNode.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ProfilePrintJSON( FILE *file, HYPRE_Int node )
+{
+   hypre_ProfileNode *pnode;
+   HYPRE_Int          first = 1;
+
+   for (; node >= 0; node = pnode -> sibling)
+   {
+      pnode = &hypre_profile_nodes[node];
+      hypre_fprintf(file, "%s{\"name\":\"%s\"", first ? "" : ",",
+                    hypre_profile_names[pnode -> region]);
+      if (pnode -> tag >= 0)
+      {
+         hypre_fprintf(file, ",\"level\":%d", pnode -> tag);
+      }
+      hypre_fprintf(file, ",\"calls\":%d,\"seconds\":%.9e",
+                    pnode -> count, pnode -> seconds);
+      if (pnode -> child >= 0)
+      {
+         hypre_fprintf(file, ",\"children\":[");
+         hypre_ProfilePrintJSON(file, pnode -> child);
+         hypre_fprintf(file, "]");
+      }
+      hypre_fprintf(file, "}\n");
+      first = 0;
+   }
+}
+
+HYPRE_Int
+HYPRE_ProfilePrint( const char *filename,
+                    HYPRE_Int   format )
+{
+   FILE      *file;
+   HYPRE_Int  i;
+
+   if (format != HYPRE_PROFILE_FORMAT_JSON &&
+       format != HYPRE_PROFILE_FORMAT_BINARY)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if ((file = fopen(filename, format ? "wb" : "w")) == NULL)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (format == HYPRE_PROFILE_FORMAT_JSON)
+   {
+      hypre_fprintf(file, "{\"regions\":[\n");
+      if (hypre_profile_num_nodes > 0)
+      {
+         hypre_ProfilePrintJSON(file, hypre_profile_nodes[0].child);
+      }
+      hypre_fprintf(file, "]}\n");
+   }
+   else
+   {
+      int    ival[4];
+      double seconds;
+
+      fwrite("HYPRPROF", 1, 8, file);
+      ival[0] = 1;
+      ival[1] = HYPRE_PROFILE_NUM_REGIONS;
+      fwrite(ival, sizeof(int), 2, file);
+      for (i = 0; i < HYPRE_PROFILE_NUM_REGIONS; i++)
+      {
+         ival[0] = (int) strlen(hypre_profile_names[i]);
+         fwrite(ival, sizeof(int), 1, file);
+         fwrite(hypre_profile_names[i], 1, ival[0], file);
+      }
+      ival[0] = (int) hypre_max(hypre_profile_num_nodes - 1, 0);
+      fwrite(ival, sizeof(int), 1, file);
+      for (i = 1; i < hypre_profile_num_nodes; i++)
+      {
+         ival[0] = (int) hypre_profile_nodes[i].parent - 1;
+         ival[1] = (int) hypre_profile_nodes[i].region;
+         ival[2] = (int) hypre_profile_nodes[i].tag;
+         ival[3] = (int) hypre_profile_nodes[i].count;
+         seconds = hypre_profile_nodes[i].seconds;
+         fwrite(ival, sizeof(int), 4, file);
+         fwrite(&seconds, sizeof(double), 1, file);
+      }
+   }
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
@@ -128,6 +128,39 @@ HYPRE_Int hypre_PrintTiming( const char *heading , MPI_Comm comm );
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Hierarchical profiling (always compiled, switched on at runtime)
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_PROFILE_AMG_SETUP      0
+#define HYPRE_PROFILE_COARSEN        1   /* strength and C/F splitting */
+#define HYPRE_PROFILE_INTERP         2
+#define HYPRE_PROFILE_RAP            3
+#define HYPRE_PROFILE_AMG_SOLVE      4
+#define HYPRE_PROFILE_CYCLE          5
+#define HYPRE_PROFILE_RELAX          6
+#define HYPRE_PROFILE_RESTRICT       7   /* residual and restriction */
+#define HYPRE_PROFILE_PROLONG        8   /* interpolation of the correction */
+#define HYPRE_PROFILE_MATVEC         9
+#define HYPRE_PROFILE_MATVECT       10
+#define HYPRE_PROFILE_COMM_WAIT     11
+#define HYPRE_PROFILE_PCG_SOLVE     12
+#define HYPRE_PROFILE_GMRES_SOLVE   13
+#define HYPRE_PROFILE_NUM_REGIONS   14
+
+extern HYPRE_Int hypre_profile_on;
+
+#define hypre_ProfileBegin(region) \
+(hypre_profile_on ? hypre_ProfileRegionBegin((region), -1) : 0)
+#define hypre_ProfileBeginTag(region, tag) \
+(hypre_profile_on ? hypre_ProfileRegionBegin((region), (tag)) : 0)
+#define hypre_ProfileEnd(region) \
+(hypre_profile_on ? hypre_ProfileRegionEnd(region) : 0)
+
+/* profiling.c */
+HYPRE_Int hypre_ProfileRegionBegin( HYPRE_Int region , HYPRE_Int tag );
+HYPRE_Int hypre_ProfileRegionEnd( HYPRE_Int region );
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,8 @@ int DLL_EXPORT BoSSS_Get_MPI_CART() {  return MPI_CART; }
 int DLL_EXPORT BoSSS_Get_MPI_GRAPH() {  return MPI_GRAPH; } 
 int DLL_EXPORT BoSSS_Get_MPI_KEYVAL_INVALID() {  return MPI_KEYVAL_INVALID; }  
 int DLL_EXPORT BoSSS_Get_MPI_REQUEST_NULL() { return MPI_Request_c2f(MPI_REQUEST_NULL); }
+int DLL_EXPORT BoSSS_Get_MPI_INFO_NULL() { return MPI_Info_c2f(MPI_INFO_NULL); }
+int DLL_EXPORT BoSSS_Get_MPI_COMM_TYPE_SHARED() { return MPI_COMM_TYPE_SHARED; }
 
 int DLL_EXPORT BoSSS_Get_MPI_Status_Size() { return sizeof(MPI_Status); }
 
@@ -0,0 +1,562 @@
+#include <stdlib.h>
+#include <string.h>
+#include "DllExportPreProc.h"
+
+/*
+ * Native sparse matrix-vector kernels for the multi-threaded CPU backend of monkey
+ * (ilPSP.LinSolvers.monkey.mtCPU.MtMatrix);
+ * All kernels compute
+ *      y = beta*y + alpha*A*x
+ * for a sub-range of the matrix (rows, SELL-slices or cell-rows), so that the calling
+ * managed code can distribute work among threads.
+ *
+ * Three storage formats are supported, which correspond to the formats in
+ * ilPSP.LinSolvers.monkey.MatrixBase:
+ *  - CSR:    compressed sparse row (MatrixBase.CSR)
+ *  - SELLCS: sliced ELLPACK with row sorting (SELL-C-sigma, MatrixBase.SELLCS);
+ *            within a slice of C rows, the entries are stored column-major.
+ *  - CCBCSR: ELLPACK with dense cells (MatrixBase.CCBCSR);
+ *            within a cell, the entries are stored column-major.
+ *
+ * For each format, a scalar, an AVX2 and an AVX-512 variant exists;
+ * the variant is picked at runtime, depending on the capabilities of the CPU
+ * (see BoSSS_SpMV_GetISA and BoSSS_SpMV_SetISA).
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SPMV_X86
+#define SPMV_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define SPMV_TARGET_AVX512 __attribute__((target("avx512f")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define SPMV_X86
+#define SPMV_TARGET_AVX2
+#define SPMV_TARGET_AVX512
+#endif
+
+/* instruction set levels, as returned by BoSSS_SpMV_GetISA */
+#define SPMV_ISA_SCALAR 0
+#define SPMV_ISA_AVX2   1
+#define SPMV_ISA_AVX512 2
+
+static int s_MaxISA = -1;  /* highest level supported by the CPU, -1 if not yet determined */
+static int s_ISA = -1;     /* level currently in use */
+
+/* ======================================================================================== */
+/* runtime CPU detection                                                                    */
+/* ======================================================================================== */
+
+static int DetectISA() {
+#if defined(SPMV_X86) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return SPMV_ISA_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SPMV_ISA_AVX2;
+    return SPMV_ISA_SCALAR;
+#elif defined(SPMV_X86) && defined(_MSC_VER)
+    int info[4];
+    unsigned long long xcr0;
+    int osxsave, avx2, fma, avx512f;
+
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return SPMV_ISA_SCALAR;
+
+    __cpuid(info, 1);
+    fma = (info[2] >> 12) & 1;
+    osxsave = (info[2] >> 27) & 1;
+    if (!osxsave)
+        return SPMV_ISA_SCALAR;
+    xcr0 = _xgetbv(0);
+
+    __cpuidex(info, 7, 0);
+    avx2 = (info[1] >> 5) & 1;
+    avx512f = (info[1] >> 16) & 1;
+
+    if (avx512f && (xcr0 & 0xE6) == 0xE6)  /* OS saves ZMM, YMM and XMM state */
+        return SPMV_ISA_AVX512;
+    if (avx2 && fma && (xcr0 & 0x6) == 0x6) /* OS saves YMM and XMM state */
+        return SPMV_ISA_AVX2;
+    return SPMV_ISA_SCALAR;
+#else
+    return SPMV_ISA_SCALAR;
+#endif
+}
+
+static int CurrentISA() {
+    if (s_ISA < 0) {
+        /* detection is idempotent, so a race between threads calling this for the first time is harmless */
+        int maxIsa = DetectISA();
+        int isa = maxIsa;
+
+        /* manual override, e.g. for benchmarking: BOSSS_SPMV_ISA=0|1|2 */
+        const char* env = getenv("BOSSS_SPMV_ISA");
+        if (env != NULL && env[0] >= '0' && env[0] <= '2' && env[0] - '0' < isa)
+            isa = env[0] - '0';
+
+        s_MaxISA = maxIsa;
+        s_ISA = isa;
+    }
+    return s_ISA;
+}
+
+/*
+ * returns the instruction set level used by the kernels:
+ * 0 for scalar code, 1 for AVX2/FMA, 2 for AVX-512.
+ */
+int DLL_EXPORT BoSSS_SpMV_GetISA() {
+    return CurrentISA();
+}
+
+/*
+ * restricts the instruction set level used by the kernels to at most 'isa'
+ * (the level is never raised above what the CPU supports);
+ * returns the level which is in use afterwards.
+ */
+int DLL_EXPORT BoSSS_SpMV_SetISA(int isa) {
+    CurrentISA();
+    if (isa < SPMV_ISA_SCALAR)
+        isa = SPMV_ISA_SCALAR;
+    s_ISA = isa < s_MaxISA ? isa : s_MaxISA;
+    return s_ISA;
+}
+
+
+/* ======================================================================================== */
+/* CSR                                                                                      */
+/* ======================================================================================== */
+
+static void CSR_Scalar(int i0, int iE, const int* RowStart, const int* ColInd, const double* Val,
+                       const double* x, double* y, double alpha, double beta) {
+    int row, k;
+    for (row = i0; row < iE; row++) {
+        double acc = 0;
+        int kE = RowStart[row + 1];
+        for (k = RowStart[row]; k < kE; k++)
+            acc += Val[k] * x[ColInd[k]];
+        y[row] = y[row] * beta + acc * alpha;
+    }
+}
+
+#ifdef SPMV_X86
+
+SPMV_TARGET_AVX2
+static void CSR_AVX2(int i0, int iE, const int* RowStart, const int* ColInd, const double* Val,
+                     const double* x, double* y, double alpha, double beta) {
+    int row, k;
+    for (row = i0; row < iE; row++) {
+        int k0 = RowStart[row];
+        int kE = RowStart[row + 1];
+        __m256d acc0 = _mm256_setzero_pd();
+        __m256d acc1 = _mm256_setzero_pd();
+        __m128d lo, hi;
+        double acc;
+
+        for (k = k0; k + 8 <= kE; k += 8) {
+            __m128i c0 = _mm_loadu_si128((const __m128i*)(ColInd + k));
+            __m128i c1 = _mm_loadu_si128((const __m128i*)(ColInd + k + 4));
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(Val + k), _mm256_i32gather_pd(x, c0, 8), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(Val + k + 4), _mm256_i32gather_pd(x, c1, 8), acc1);
+        }
+        if (k + 4 <= kE) {
+            __m128i c0 = _mm_loadu_si128((const __m128i*)(ColInd + k));
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(Val + k), _mm256_i32gather_pd(x, c0, 8), acc0);
+            k += 4;
+        }
+        acc0 = _mm256_add_pd(acc0, acc1);
+        lo = _mm256_castpd256_pd128(acc0);
+        hi = _mm256_extractf128_pd(acc0, 1);
+        lo = _mm_add_pd(lo, hi);
+        lo = _mm_add_sd(lo, _mm_unpackhi_pd(lo, lo));
+        acc = _mm_cvtsd_f64(lo);
+
+        for (; k < kE; k++)
+            acc += Val[k] * x[ColInd[k]];
+
+        y[row] = y[row] * beta + acc * alpha;
+    }
+}
+
+SPMV_TARGET_AVX512
+static void CSR_AVX512(int i0, int iE, const int* RowStart, const int* ColInd, const double* Val,
+                       const double* x, double* y, double alpha, double beta) {
+    int row, k;
+    for (row = i0; row < iE; row++) {
+        int k0 = RowStart[row];
+        int kE = RowStart[row + 1];
+        __m512d acc0 = _mm512_setzero_pd();
+        __m512d acc1 = _mm512_setzero_pd();
+
+        for (k = k0; k + 16 <= kE; k += 16) {
+            __m256i c0 = _mm256_loadu_si256((const __m256i*)(ColInd + k));
+            __m256i c1 = _mm256_loadu_si256((const __m256i*)(ColInd + k + 8));
+            acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(Val + k), _mm512_i32gather_pd(c0, x, 8), acc0);
+            acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(Val + k + 8), _mm512_i32gather_pd(c1, x, 8), acc1);
+        }
+        if (k + 8 <= kE) {
+            __m256i c0 = _mm256_loadu_si256((const __m256i*)(ColInd + k));
+            acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(Val + k), _mm512_i32gather_pd(c0, x, 8), acc0);
+            k += 8;
+        }
+        if (k < kE) {
+            __mmask8 m = (__mmask8)((1u << (kE - k)) - 1u);
+            __m256i c0 = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32((__mmask16)m, ColInd + k));
+            acc1 = _mm512_mask3_fmadd_pd(_mm512_maskz_loadu_pd(m, Val + k),
+                                         _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, c0, x, 8),
+                                         acc1, m);
+        }
+
+        y[row] = y[row] * beta + _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1)) * alpha;
+    }
+}
+
+#endif
+
+/*
+ * CSR-SpMV for rows i0 (including) to iE (excluding):
+ * y[i] = beta*y[i] + alpha*sum_k Val[k]*x[ColInd[k]], with RowStart[i] <= k < RowStart[i+1]
+ */
+void DLL_EXPORT BoSSS_SpMV_CSR(int i0, int iE, const int* RowStart, const int* ColInd, const double* Val,
+                               const double* x, double* y, double alpha, double beta) {
+    switch (CurrentISA()) {
+#ifdef SPMV_X86
+    case SPMV_ISA_AVX512: CSR_AVX512(i0, iE, RowStart, ColInd, Val, x, y, alpha, beta); return;
+    case SPMV_ISA_AVX2:   CSR_AVX2(i0, iE, RowStart, ColInd, Val, x, y, alpha, beta); return;
+#endif
+    default:              CSR_Scalar(i0, iE, RowStart, ColInd, Val, x, y, alpha, beta); return;
+    }
+}
+
+
+/* ======================================================================================== */
+/* SELL-C-sigma                                                                             */
+/* ======================================================================================== */
+
+/* largest slice height C for which the stack-buffer in the scalar kernel suffices */
+#define SELL_MAX_C 64
+
+static void SELL_WriteBack(int s, int C, int NoOfRows, const int* Perm, const double* acc,
+                           double* y, double alpha, double beta) {
+    int r;
+    int k0 = s * C;
+    int n = NoOfRows - k0 < C ? NoOfRows - k0 : C;
+    for (r = 0; r < n; r++) {
+        int row = Perm[k0 + r];
+        y[row] = y[row] * beta + acc[r] * alpha;
+    }
+}
+
+static void SELL_Scalar(int s0, int sE, int C, int NoOfRows, const int* SliceStart, const int* Perm,
+                        const int* ColInd, const double* Val, const double* x, double* y, double alpha, double beta) {
+    double acc[SELL_MAX_C];
+    int s, j, r;
+    for (s = s0; s < sE; s++) {
+        int k0 = SliceStart[s];
+        int W = (SliceStart[s + 1] - k0) / C;
+        for (r = 0; r < C; r++)
+            acc[r] = 0;
+        for (j = 0; j < W; j++) {
+            const double* v = Val + k0 + j * C;
+            const int* c = ColInd + k0 + j * C;
+            for (r = 0; r < C; r++)
+                acc[r] += v[r] * x[c[r]];
+        }
+        SELL_WriteBack(s, C, NoOfRows, Perm, acc, y, alpha, beta);
+    }
+}
+
+#ifdef SPMV_X86
+
+/* AVX2-kernel; C must be a multiple of 4 */
+SPMV_TARGET_AVX2
+static void SELL_AVX2(int s0, int sE, int C, int NoOfRows, const int* SliceStart, const int* Perm,
+                      const int* ColInd, const double* Val, const double* x, double* y, double alpha, double beta) {
+    double acc[SELL_MAX_C];
+    int s, j, r;
+    for (s = s0; s < sE; s++) {
+        int k0 = SliceStart[s];
+        int W = (SliceStart[s + 1] - k0) / C;
+
+        if (C == 8) {
+            __m256d a0 = _mm256_setzero_pd();
+            __m256d a1 = _mm256_setzero_pd();
+            const double* v = Val + k0;
+            const int* c = ColInd + k0;
+            for (j = 0; j < W; j++) {
+                __m128i c0 = _mm_loadu_si128((const __m128i*)(c));
+                __m128i c1 = _mm_loadu_si128((const __m128i*)(c + 4));
+                a0 = _mm256_fmadd_pd(_mm256_loadu_pd(v), _mm256_i32gather_pd(x, c0, 8), a0);
+                a1 = _mm256_fmadd_pd(_mm256_loadu_pd(v + 4), _mm256_i32gather_pd(x, c1, 8), a1);
+                v += 8;
+                c += 8;
+            }
+            _mm256_storeu_pd(acc, a0);
+            _mm256_storeu_pd(acc + 4, a1);
+        } else {
+            for (r = 0; r < C; r += 4) {
+                __m256d a0 = _mm256_setzero_pd();
+                const double* v = Val + k0 + r;
+                const int* c = ColInd + k0 + r;
+                for (j = 0; j < W; j++) {
+                    __m128i c0 = _mm_loadu_si128((const __m128i*)(c));
+                    a0 = _mm256_fmadd_pd(_mm256_loadu_pd(v), _mm256_i32gather_pd(x, c0, 8), a0);
+                    v += C;
+                    c += C;
+                }
+                _mm256_storeu_pd(acc + r, a0);
+            }
+        }
+        SELL_WriteBack(s, C, NoOfRows, Perm, acc, y, alpha, beta);
+    }
+}
+
+/* AVX-512-kernel; C must be a multiple of 8 */
+SPMV_TARGET_AVX512
+static void SELL_AVX512(int s0, int sE, int C, int NoOfRows, const int* SliceStart, const int* Perm,
+                        const int* ColInd, const double* Val, const double* x, double* y, double alpha, double beta) {
+    double acc[SELL_MAX_C];
+    int s, j, r;
+    for (s = s0; s < sE; s++) {
+        int k0 = SliceStart[s];
+        int W = (SliceStart[s + 1] - k0) / C;
+
+        for (r = 0; r < C; r += 8) {
+            __m512d a0 = _mm512_setzero_pd();
+            __m512d a1 = _mm512_setzero_pd();
+            const double* v = Val + k0 + r;
+            const int* c = ColInd + k0 + r;
+            for (j = 0; j + 2 <= W; j += 2) {
+                __m256i c0 = _mm256_loadu_si256((const __m256i*)(c));
+                __m256i c1 = _mm256_loadu_si256((const __m256i*)(c + C));
+                a0 = _mm512_fmadd_pd(_mm512_loadu_pd(v), _mm512_i32gather_pd(c0, x, 8), a0);
+                a1 = _mm512_fmadd_pd(_mm512_loadu_pd(v + C), _mm512_i32gather_pd(c1, x, 8), a1);
+                v += 2 * C;
+                c += 2 * C;
+            }
+            if (j < W) {
+                __m256i c0 = _mm256_loadu_si256((const __m256i*)(c));
+                a0 = _mm512_fmadd_pd(_mm512_loadu_pd(v), _mm512_i32gather_pd(c0, x, 8), a0);
+            }
+            _mm512_storeu_pd(acc + r, _mm512_add_pd(a0, a1));
+        }
+        SELL_WriteBack(s, C, NoOfRows, Perm, acc, y, alpha, beta);
+    }
+}
+
+#endif
+
+/*
+ * SELL-C-sigma-SpMV for slices s0 (including) to sE (excluding);
+ *  - C: slice height, at most 64
+ *  - SliceStart[s]: index into Val and ColInd where slice s starts;
+ *    the entry (r,j) (r-th row in slice, j-th packed column) of slice s is located at SliceStart[s] + j*C + r;
+ *  - Perm[k]: original row index of the k-th packed row (k < NoOfRows).
+ * Returns 0 on success, a negative value if C is not supported.
+ */
+int DLL_EXPORT BoSSS_SpMV_SELLCS(int s0, int sE, int C, int NoOfRows, const int* SliceStart, const int* Perm,
+                                 const int* ColInd, const double* Val, const double* x, double* y, double alpha, double beta) {
+    if (C < 1 || C > SELL_MAX_C)
+        return -1;
+
+#ifdef SPMV_X86
+    if (CurrentISA() >= SPMV_ISA_AVX512 && C % 8 == 0) {
+        SELL_AVX512(s0, sE, C, NoOfRows, SliceStart, Perm, ColInd, Val, x, y, alpha, beta);
+        return 0;
+    }
+    if (CurrentISA() >= SPMV_ISA_AVX2 && C % 4 == 0) {
+        SELL_AVX2(s0, sE, C, NoOfRows, SliceStart, Perm, ColInd, Val, x, y, alpha, beta);
+        return 0;
+    }
+#endif
+    SELL_Scalar(s0, sE, C, NoOfRows, SliceStart, Perm, ColInd, Val, x, y, alpha, beta);
+    return 0;
+}
+
+
+/* ======================================================================================== */
+/* CCBCSR                                                                                   */
+/* ======================================================================================== */
+
+static void CCBCSR_Scalar(int cr0, int crE, int CellSize, int CellStride, int NoOfCellsPerRow,
+                          const int* CellColumn, const double* Val, const double* x, double* y, double alpha, double beta) {
+    int cr, c, ii, jj;
+    for (cr = cr0; cr < crE; cr++) {
+        double* yb = y + cr * CellSize;
+        int ii0;
+        /* process the rows of the cell row in chunks, to keep the accumulators on the stack */
+        for (ii0 = 0; ii0 < CellSize; ii0 += 32) {
+            double acc[32];
+            int n = CellSize - ii0 < 32 ? CellSize - ii0 : 32;
+            for (ii = 0; ii < n; ii++)
+                acc[ii] = 0;
+
+            for (c = cr * NoOfCellsPerRow; c < (cr + 1) * NoOfCellsPerRow; c++) {
+                const double* cell = Val + (size_t)c * CellStride + ii0;
+                const double* xb = x + CellColumn[c] * CellSize;
+                for (jj = 0; jj < CellSize; jj++) {
+                    double xj = xb[jj];
+                    const double* col = cell + jj * CellSize;
+                    for (ii = 0; ii < n; ii++)
+                        acc[ii] += col[ii] * xj;
+                }
+            }
+
+            for (ii = 0; ii < n; ii++)
+                yb[ii0 + ii] = yb[ii0 + ii] * beta + acc[ii] * alpha;
+        }
+    }
+}
+
+#ifdef SPMV_X86
+
+SPMV_TARGET_AVX2
+static __m256i CCBCSR_AVX2_Mask(int n) {
+    /* mask for the first n lanes; all lanes for n >= 4, none for n <= 0 */
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n), _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+SPMV_TARGET_AVX2
+static void CCBCSR_AVX2(int cr0, int crE, int CellSize, int CellStride, int NoOfCellsPerRow,
+                        const int* CellColumn, const double* Val, const double* x, double* y, double alpha, double beta) {
+    int cr, c, jj, ii0;
+    __m256d va = _mm256_set1_pd(alpha);
+    __m256d vb = _mm256_set1_pd(beta);
+    for (cr = cr0; cr < crE; cr++) {
+        double* yb = y + cr * CellSize;
+        int c0 = cr * NoOfCellsPerRow;
+        int cE = c0 + NoOfCellsPerRow;
+
+        /* full chunks of 16 rows */
+        for (ii0 = 0; ii0 + 16 <= CellSize; ii0 += 16) {
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            __m256d a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+            for (c = c0; c < cE; c++) {
+                const double* col = Val + (size_t)c * CellStride + ii0;
+                const double* xb = x + CellColumn[c] * CellSize;
+                for (jj = 0; jj < CellSize; jj++) {
+                    __m256d xj = _mm256_broadcast_sd(xb + jj);
+                    a0 = _mm256_fmadd_pd(_mm256_loadu_pd(col), xj, a0);
+                    a1 = _mm256_fmadd_pd(_mm256_loadu_pd(col + 4), xj, a1);
+                    a2 = _mm256_fmadd_pd(_mm256_loadu_pd(col + 8), xj, a2);
+                    a3 = _mm256_fmadd_pd(_mm256_loadu_pd(col + 12), xj, a3);
+                    col += CellSize;
+                }
+            }
+            _mm256_storeu_pd(yb + ii0, _mm256_fmadd_pd(_mm256_loadu_pd(yb + ii0), vb, _mm256_mul_pd(a0, va)));
+            _mm256_storeu_pd(yb + ii0 + 4, _mm256_fmadd_pd(_mm256_loadu_pd(yb + ii0 + 4), vb, _mm256_mul_pd(a1, va)));
+            _mm256_storeu_pd(yb + ii0 + 8, _mm256_fmadd_pd(_mm256_loadu_pd(yb + ii0 + 8), vb, _mm256_mul_pd(a2, va)));
+            _mm256_storeu_pd(yb + ii0 + 12, _mm256_fmadd_pd(_mm256_loadu_pd(yb + ii0 + 12), vb, _mm256_mul_pd(a3, va)));
+        }
+
+        /* remaining rows (less than 16), in one masked pass over the cells */
+        if (ii0 < CellSize) {
+            int n = CellSize - ii0;
+            __m256i m0 = CCBCSR_AVX2_Mask(n), m1 = CCBCSR_AVX2_Mask(n - 4);
+            __m256i m2 = CCBCSR_AVX2_Mask(n - 8), m3 = CCBCSR_AVX2_Mask(n - 12);
+            __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+            __m256d a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+            for (c = c0; c < cE; c++) {
+                const double* col = Val + (size_t)c * CellStride + ii0;
+                const double* xb = x + CellColumn[c] * CellSize;
+                for (jj = 0; jj < CellSize; jj++) {
+                    __m256d xj = _mm256_broadcast_sd(xb + jj);
+                    a0 = _mm256_fmadd_pd(_mm256_maskload_pd(col, m0), xj, a0);
+                    a1 = _mm256_fmadd_pd(_mm256_maskload_pd(col + 4, m1), xj, a1);
+                    a2 = _mm256_fmadd_pd(_mm256_maskload_pd(col + 8, m2), xj, a2);
+                    a3 = _mm256_fmadd_pd(_mm256_maskload_pd(col + 12, m3), xj, a3);
+                    col += CellSize;
+                }
+            }
+            _mm256_maskstore_pd(yb + ii0, m0, _mm256_fmadd_pd(_mm256_maskload_pd(yb + ii0, m0), vb, _mm256_mul_pd(a0, va)));
+            _mm256_maskstore_pd(yb + ii0 + 4, m1, _mm256_fmadd_pd(_mm256_maskload_pd(yb + ii0 + 4, m1), vb, _mm256_mul_pd(a1, va)));
+            _mm256_maskstore_pd(yb + ii0 + 8, m2, _mm256_fmadd_pd(_mm256_maskload_pd(yb + ii0 + 8, m2), vb, _mm256_mul_pd(a2, va)));
+            _mm256_maskstore_pd(yb + ii0 + 12, m3, _mm256_fmadd_pd(_mm256_maskload_pd(yb + ii0 + 12, m3), vb, _mm256_mul_pd(a3, va)));
+        }
+    }
+}
+
+static __mmask8 CCBCSR_AVX512_Mask(int n) {
+    /* mask for the first n lanes; all lanes for n >= 8, none for n <= 0 */
+    return n >= 8 ? (__mmask8)0xFF : n <= 0 ? (__mmask8)0 : (__mmask8)((1u << n) - 1u);
+}
+
+SPMV_TARGET_AVX512
+static void CCBCSR_AVX512(int cr0, int crE, int CellSize, int CellStride, int NoOfCellsPerRow,
+                          const int* CellColumn, const double* Val, const double* x, double* y, double alpha, double beta) {
+    int cr, c, jj, ii0;
+    __m512d va = _mm512_set1_pd(alpha);
+    __m512d vb = _mm512_set1_pd(beta);
+    for (cr = cr0; cr < crE; cr++) {
+        double* yb = y + cr * CellSize;
+        int c0 = cr * NoOfCellsPerRow;
+        int cE = c0 + NoOfCellsPerRow;
+
+        /* full chunks of 32 rows */
+        for (ii0 = 0; ii0 + 32 <= CellSize; ii0 += 32) {
+            __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+            __m512d a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+            for (c = c0; c < cE; c++) {
+                const double* col = Val + (size_t)c * CellStride + ii0;
+                const double* xb = x + CellColumn[c] * CellSize;
+                for (jj = 0; jj < CellSize; jj++) {
+                    __m512d xj = _mm512_set1_pd(xb[jj]);
+                    a0 = _mm512_fmadd_pd(_mm512_loadu_pd(col), xj, a0);
+                    a1 = _mm512_fmadd_pd(_mm512_loadu_pd(col + 8), xj, a1);
+                    a2 = _mm512_fmadd_pd(_mm512_loadu_pd(col + 16), xj, a2);
+                    a3 = _mm512_fmadd_pd(_mm512_loadu_pd(col + 24), xj, a3);
+                    col += CellSize;
+                }
+            }
+            _mm512_storeu_pd(yb + ii0, _mm512_fmadd_pd(_mm512_loadu_pd(yb + ii0), vb, _mm512_mul_pd(a0, va)));
+            _mm512_storeu_pd(yb + ii0 + 8, _mm512_fmadd_pd(_mm512_loadu_pd(yb + ii0 + 8), vb, _mm512_mul_pd(a1, va)));
+            _mm512_storeu_pd(yb + ii0 + 16, _mm512_fmadd_pd(_mm512_loadu_pd(yb + ii0 + 16), vb, _mm512_mul_pd(a2, va)));
+            _mm512_storeu_pd(yb + ii0 + 24, _mm512_fmadd_pd(_mm512_loadu_pd(yb + ii0 + 24), vb, _mm512_mul_pd(a3, va)));
+        }
+
+        /* remaining rows (less than 32), in one masked pass over the cells */
+        if (ii0 < CellSize) {
+            int n = CellSize - ii0;
+            __mmask8 m0 = CCBCSR_AVX512_Mask(n), m1 = CCBCSR_AVX512_Mask(n - 8);
+            __mmask8 m2 = CCBCSR_AVX512_Mask(n - 16), m3 = CCBCSR_AVX512_Mask(n - 24);
+            __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+            __m512d a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+            for (c = c0; c < cE; c++) {
+                const double* col = Val + (size_t)c * CellStride + ii0;
+                const double* xb = x + CellColumn[c] * CellSize;
+                for (jj = 0; jj < CellSize; jj++) {
+                    __m512d xj = _mm512_set1_pd(xb[jj]);
+                    a0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m0, col), xj, a0);
+                    a1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m1, col + 8), xj, a1);
+                    a2 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m2, col + 16), xj, a2);
+                    a3 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m3, col + 24), xj, a3);
+                    col += CellSize;
+                }
+            }
+            _mm512_mask_storeu_pd(yb + ii0, m0, _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m0, yb + ii0), vb, _mm512_mul_pd(a0, va)));
+            _mm512_mask_storeu_pd(yb + ii0 + 8, m1, _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m1, yb + ii0 + 8), vb, _mm512_mul_pd(a1, va)));
+            _mm512_mask_storeu_pd(yb + ii0 + 16, m2, _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m2, yb + ii0 + 16), vb, _mm512_mul_pd(a2, va)));
+            _mm512_mask_storeu_pd(yb + ii0 + 24, m3, _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m3, yb + ii0 + 24), vb, _mm512_mul_pd(a3, va)));
+        }
+    }
+}
+
+#endif
+
+/*
+ * CCBCSR-SpMV for cell rows cr0 (including) to crE (excluding);
+ * the (i,j)-th entry of the k-th cell is located at k*CellStride + j*CellSize + i,
+ * cell row cr consists of the cells cr*NoOfCellsPerRow to (cr+1)*NoOfCellsPerRow - 1.
+ */
+void DLL_EXPORT BoSSS_SpMV_CCBCSR(int cr0, int crE, int CellSize, int CellStride, int NoOfCellsPerRow,
+                                  const int* CellColumn, const double* Val, const double* x, double* y, double alpha, double beta) {
+    switch (CurrentISA()) {
+#ifdef SPMV_X86
+    case SPMV_ISA_AVX512: CCBCSR_AVX512(cr0, crE, CellSize, CellStride, NoOfCellsPerRow, CellColumn, Val, x, y, alpha, beta); return;
+    case SPMV_ISA_AVX2:   CCBCSR_AVX2(cr0, crE, CellSize, CellStride, NoOfCellsPerRow, CellColumn, Val, x, y, alpha, beta); return;
+#endif
+    default:              CCBCSR_Scalar(cr0, crE, CellSize, CellStride, NoOfCellsPerRow, CellColumn, Val, x, y, alpha, beta); return;
+    }
+}
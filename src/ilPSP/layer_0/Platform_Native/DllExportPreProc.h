@@ -14,6 +14,12 @@
 #define CALL7     _1, _2, _3, _4, _5, _6, _7
 #define PARAM8    void* _1, void* _2, void* _3, void* _4, void* _5, void* _6, void* _7, void* _8
 #define CALL8     _1, _2, _3, _4, _5, _6, _7, _8
+#define PARAM9    void* _1, void* _2, void* _3, void* _4, void* _5, void* _6, void* _7, void* _8, void* _9
+#define CALL9     _1, _2, _3, _4, _5, _6, _7, _8, _9
+#define PARAM10   void* _1, void* _2, void* _3, void* _4, void* _5, void* _6, void* _7, void* _8, void* _9, void* _10
+#define CALL10    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10
+#define PARAM11   void* _1, void* _2, void* _3, void* _4, void* _5, void* _6, void* _7, void* _8, void* _9, void* _10, void* _11
+#define CALL11    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11
 
 
 #define MAKE_MPIF(funcname,param,call)         \
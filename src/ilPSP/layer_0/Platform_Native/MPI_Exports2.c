@@ -18,3 +18,21 @@ MAKE_MPIF(MPI_SEND        ,PARAM7,CALL7)
 MAKE_MPIF(MPI_RECV        ,PARAM8,CALL8)
 MAKE_MPIF(MPI_INITIALIZED ,PARAM2,CALL2)
 MAKE_MPIF(MPI_INIT        ,PARAM1,CALL1)
+
+/* MPI-3: nonblocking and neighborhood collectives, persistent requests */
+MAKE_MPIF(MPI_IALLREDUCE                  ,PARAM8 ,CALL8 )
+MAKE_MPIF(MPI_IALLTOALLV                  ,PARAM11,CALL11)
+MAKE_MPIF(MPI_DIST_GRAPH_CREATE_ADJACENT  ,PARAM11,CALL11)
+MAKE_MPIF(MPI_NEIGHBOR_ALLTOALLV          ,PARAM10,CALL10)
+MAKE_MPIF(MPI_SEND_INIT                   ,PARAM8 ,CALL8 )
+MAKE_MPIF(MPI_RECV_INIT                   ,PARAM8 ,CALL8 )
+MAKE_MPIF(MPI_START                       ,PARAM2 ,CALL2 )
+MAKE_MPIF(MPI_STARTALL                    ,PARAM3 ,CALL3 )
+MAKE_MPIF(MPI_REQUEST_FREE                ,PARAM2 ,CALL2 )
+MAKE_MPIF(MPI_TESTANY                     ,PARAM6 ,CALL6 )
+MAKE_MPIF(MPI_COMM_FREE                   ,PARAM2 ,CALL2 )
+MAKE_MPIF(MPI_INEIGHBOR_ALLTOALLV         ,PARAM11,CALL11)
+MAKE_MPIF(MPI_COMM_SPLIT_TYPE             ,PARAM6 ,CALL6 )
+MAKE_MPIF(MPI_WIN_ALLOCATE_SHARED         ,PARAM7 ,CALL7 )
+MAKE_MPIF(MPI_WIN_SHARED_QUERY            ,PARAM6 ,CALL6 )
+MAKE_MPIF(MPI_WIN_FREE                    ,PARAM2 ,CALL2 )
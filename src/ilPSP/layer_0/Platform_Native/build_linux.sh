@@ -1,2 +1,2 @@
-mpicc -fPIC -c BoSSS_MPI.c MPI_Exports2.c
+mpicc -fPIC -O3 -c BoSSS_MPI.c MPI_Exports2.c BoSSS_SpMV.c
 mpif77 -shared  -o libPlatform_Native.so *.o
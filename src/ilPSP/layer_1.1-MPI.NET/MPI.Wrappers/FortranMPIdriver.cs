@@ -670,6 +670,363 @@ namespace MPI.Wrappers {
             MPIException.CheckReturnCode(ierr);
         }
 
+#pragma warning disable 649
+        delegate void _MPI_TESTANY(ref int count, [In, Out] MPI_Request[] array_of_requests, out int index, out int flag, out MPI_Status status, out int ierr);
+        _MPI_TESTANY MPI_TESTANY;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Testany(int count, MPI_Request[] array_of_requests, out int index, out bool flag, out MPI_Status status) {
+            int ierr, _flag;
+            MPI_TESTANY(ref count, array_of_requests, out index, out _flag, out status, out ierr);
+            if (index != MiscConstants.UNDEFINED)
+                index--; // convert fortran index into C-index
+            MPIException.CheckReturnCode(ierr);
+            flag = (_flag != 0);
+            FixMPIStatus(ref status);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_REQUEST_FREE(ref MPI_Request request, out int ierr);
+        _MPI_REQUEST_FREE MPI_REQUEST_FREE;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Request_free(ref MPI_Request request) {
+            int ierr;
+            MPI_REQUEST_FREE(ref request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_SEND_INIT(IntPtr buf, ref int count, ref MPI_Datatype datatype,
+                                     ref int dest, ref int tag,
+                                     ref MPI_Comm comm,
+                                     out MPI_Request request, out int ierr);
+        _MPI_SEND_INIT MPI_SEND_INIT;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Send_init(IntPtr buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, out MPI_Request request) {
+            int ierr;
+            MPI_SEND_INIT(buf, ref count, ref datatype, ref dest, ref tag, ref comm, out request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_RECV_INIT(IntPtr buf, ref int count, ref MPI_Datatype datatype,
+                                     ref int source, ref int tag,
+                                     ref MPI_Comm comm,
+                                     out MPI_Request request, out int ierr);
+        _MPI_RECV_INIT MPI_RECV_INIT;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Recv_init(IntPtr buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, out MPI_Request request) {
+            int ierr;
+            MPI_RECV_INIT(buf, ref count, ref datatype, ref source, ref tag, ref comm, out request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_START(ref MPI_Request request, out int ierr);
+        _MPI_START MPI_START;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Start(ref MPI_Request request) {
+            int ierr;
+            MPI_START(ref request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_STARTALL(ref int count, [In, Out] MPI_Request[] array_of_requests, out int ierr);
+        _MPI_STARTALL MPI_STARTALL;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Startall(int count, MPI_Request[] array_of_requests) {
+            int ierr;
+            MPI_STARTALL(ref count, array_of_requests, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+#pragma warning disable 649
+        delegate void _MPI_COMM_FREE(ref MPI_Comm comm, out int ierr);
+        _MPI_COMM_FREE MPI_COMM_FREE;
+#pragma warning restore 649
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Comm_free(ref MPI_Comm comm) {
+            int ierr;
+            MPI_COMM_FREE(ref comm, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        #region MPI-3
+
+        delegate void _MPI_IALLREDUCE(IntPtr sendbuf, IntPtr recvbuf, ref int count, ref MPI_Datatype datatype, ref MPI_Op op, ref MPI_Comm comm, out MPI_Request request, out int ierr);
+
+        delegate void _MPI_IALLTOALLV(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, ref MPI_Datatype sendtype,
+                                      IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, ref MPI_Datatype recvtype,
+                                      ref MPI_Comm comm, out MPI_Request request, out int ierr);
+
+        delegate void _MPI_DIST_GRAPH_CREATE_ADJACENT(ref MPI_Comm comm_old,
+                                                      ref int indegree, IntPtr sources, IntPtr sourceweights,
+                                                      ref int outdegree, IntPtr destinations, IntPtr destweights,
+                                                      ref int info, ref int reorder, out MPI_Comm comm_dist_graph, out int ierr);
+
+        delegate void _MPI_NEIGHBOR_ALLTOALLV(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, ref MPI_Datatype sendtype,
+                                              IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, ref MPI_Datatype recvtype,
+                                              ref MPI_Comm comm, out int ierr);
+
+        delegate void _MPI_INEIGHBOR_ALLTOALLV(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, ref MPI_Datatype sendtype,
+                                               IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, ref MPI_Datatype recvtype,
+                                               ref MPI_Comm comm, out MPI_Request request, out int ierr);
+
+        delegate void _MPI_COMM_SPLIT_TYPE(ref MPI_Comm comm, ref int split_type, ref int key, ref int info, out MPI_Comm newcomm, out int ierr);
+
+        delegate void _MPI_WIN_ALLOCATE_SHARED(ref long size, ref int disp_unit, ref int info, ref MPI_Comm comm, out IntPtr baseptr, out MPI_Win win, out int ierr);
+
+        delegate void _MPI_WIN_SHARED_QUERY(ref MPI_Win win, ref int rank, out long size, out int disp_unit, out IntPtr baseptr, out int ierr);
+
+        delegate void _MPI_WIN_FREE(ref MPI_Win win, out int ierr);
+
+        /// <summary>
+        /// MPI-3 functions, which are not provided by every MPI library on the market.
+        /// They are not members of the driver itself, since the <see cref="Utils.DynLibLoader"/>
+        /// rejects a library if any of the delegates cannot be loaded;
+        /// Instead, they are loaded on first use by <see cref="LoadOptionalFunctions"/>,
+        /// a function that is missing in the library remains null.
+        /// </summary>
+        class OptionalFunctions {
+#pragma warning disable 649
+            public _MPI_IALLREDUCE MPI_IALLREDUCE;
+            public _MPI_IALLTOALLV MPI_IALLTOALLV;
+            public _MPI_DIST_GRAPH_CREATE_ADJACENT MPI_DIST_GRAPH_CREATE_ADJACENT;
+            public _MPI_NEIGHBOR_ALLTOALLV MPI_NEIGHBOR_ALLTOALLV;
+            public _MPI_INEIGHBOR_ALLTOALLV MPI_INEIGHBOR_ALLTOALLV;
+            public _MPI_COMM_SPLIT_TYPE MPI_COMM_SPLIT_TYPE;
+            public _MPI_WIN_ALLOCATE_SHARED MPI_WIN_ALLOCATE_SHARED;
+            public _MPI_WIN_SHARED_QUERY MPI_WIN_SHARED_QUERY;
+            public _MPI_WIN_FREE MPI_WIN_FREE;
+#pragma warning restore 649
+        }
+
+        OptionalFunctions m_Optional;
+
+        /// <summary>
+        /// see <see cref="OptionalFunctions"/>
+        /// </summary>
+        OptionalFunctions LoadOptionalFunctions() {
+            if (m_Optional == null) {
+                var opt = new OptionalFunctions();
+                bool MacOs = base.CurrentLibraryName.EndsWith(".dylib");
+                foreach (var fld in typeof(OptionalFunctions).GetFields()) {
+                    string errstr;
+                    string UnmanagedName = MacOs ? MacOsMangling(fld.Name) : fld.Name;
+                    IntPtr FuncPtr = Utils.DynamicLibraries.LoadSymbol(base.LibHandle, UnmanagedName, out errstr);
+                    if (FuncPtr != IntPtr.Zero)
+                        fld.SetValue(opt, Marshal.GetDelegateForFunctionPointer(FuncPtr, fld.FieldType));
+                }
+                m_Optional = opt;
+            }
+            return m_Optional;
+        }
+
+        /// <summary>
+        /// exception for an MPI-3 function that is missing in the MPI library
+        /// </summary>
+        NotSupportedException MissingMPI3(string FuncName) {
+            return new NotSupportedException("MPI library '" + base.CurrentLibraryName + "' does not provide '" + FuncName + "' (MPI-3 required).");
+        }
+
+        /// <summary>
+        /// see <see cref="IMPIdriver.MPI3Available"/>
+        /// </summary>
+        public bool MPI3Available {
+            get {
+                var opt = LoadOptionalFunctions();
+                return opt.MPI_IALLREDUCE != null
+                    && opt.MPI_IALLTOALLV != null
+                    && opt.MPI_DIST_GRAPH_CREATE_ADJACENT != null
+                    && opt.MPI_NEIGHBOR_ALLTOALLV != null;
+            }
+        }
+
+        /// <summary>
+        /// see <see cref="IMPIdriver.MPI3NeighborhoodAvailable"/>
+        /// </summary>
+        public bool MPI3NeighborhoodAvailable {
+            get {
+                var opt = LoadOptionalFunctions();
+                return MPI3Available
+                    && opt.MPI_INEIGHBOR_ALLTOALLV != null
+                    && opt.MPI_COMM_SPLIT_TYPE != null
+                    && opt.MPI_WIN_ALLOCATE_SHARED != null
+                    && opt.MPI_WIN_SHARED_QUERY != null
+                    && opt.MPI_WIN_FREE != null;
+            }
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Iallreduce(IntPtr sndbuf, IntPtr rcvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, out MPI_Request request) {
+            var f = LoadOptionalFunctions().MPI_IALLREDUCE;
+            if (f == null)
+                throw MissingMPI3("MPI_IALLREDUCE");
+            int ierr;
+            f(sndbuf, rcvbuf, ref count, ref datatype, ref op, ref comm, out request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Ialltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                               IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                               MPI_Comm comm, out MPI_Request request) {
+            var f = LoadOptionalFunctions().MPI_IALLTOALLV;
+            if (f == null)
+                throw MissingMPI3("MPI_IALLTOALLV");
+            int ierr;
+            f(sendbuf, sendcounts, sdispls, ref sendtype, recvbuf, recvcounts, rdispls, ref recvtype, ref comm, out request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Dist_graph_create_adjacent(MPI_Comm comm_old,
+                                               int indegree, int[] sources, int[] sourceweights,
+                                               int outdegree, int[] destinations, int[] destweights,
+                                               bool reorder, out MPI_Comm comm_dist_graph) {
+            var f = LoadOptionalFunctions().MPI_DIST_GRAPH_CREATE_ADJACENT;
+            if (f == null)
+                throw MissingMPI3("MPI_DIST_GRAPH_CREATE_ADJACENT");
+
+            // arrays of length at least one, so that we never pass a null pointer to Fortran
+            int[] _sources = new int[Math.Max(indegree, 1)];
+            int[] _sourceweights = new int[Math.Max(indegree, 1)];
+            int[] _destinations = new int[Math.Max(outdegree, 1)];
+            int[] _destweights = new int[Math.Max(outdegree, 1)];
+            for (int i = 0; i < indegree; i++) {
+                _sources[i] = sources[i];
+                _sourceweights[i] = sourceweights != null ? sourceweights[i] : 1;
+            }
+            for (int i = 0; i < outdegree; i++) {
+                _destinations[i] = destinations[i];
+                _destweights[i] = destweights != null ? destweights[i] : 1;
+            }
+
+            int info = MiscConstants.INFO_NULL;
+            int _reorder = reorder ? 1 : 0;
+            int ierr;
+            unsafe {
+                fixed (int* pSrc = _sources, pSrcW = _sourceweights, pDst = _destinations, pDstW = _destweights) {
+                    f(ref comm_old, ref indegree, (IntPtr)pSrc, (IntPtr)pSrcW, ref outdegree, (IntPtr)pDst, (IntPtr)pDstW,
+                        ref info, ref _reorder, out comm_dist_graph, out ierr);
+                }
+            }
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Neighbor_alltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                                       IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                                       MPI_Comm comm) {
+            var f = LoadOptionalFunctions().MPI_NEIGHBOR_ALLTOALLV;
+            if (f == null)
+                throw MissingMPI3("MPI_NEIGHBOR_ALLTOALLV");
+            int ierr;
+            f(sendbuf, sendcounts, sdispls, ref sendtype, recvbuf, recvcounts, rdispls, ref recvtype, ref comm, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Ineighbor_alltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                                        IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                                        MPI_Comm comm, out MPI_Request request) {
+            var f = LoadOptionalFunctions().MPI_INEIGHBOR_ALLTOALLV;
+            if (f == null)
+                throw MissingMPI3("MPI_INEIGHBOR_ALLTOALLV");
+            int ierr;
+            f(sendbuf, sendcounts, sdispls, ref sendtype, recvbuf, recvcounts, rdispls, ref recvtype, ref comm, out request, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Comm_split_type(MPI_Comm comm, int split_type, int key, out MPI_Comm newcomm) {
+            var f = LoadOptionalFunctions().MPI_COMM_SPLIT_TYPE;
+            if (f == null)
+                throw MissingMPI3("MPI_COMM_SPLIT_TYPE");
+            int info = MiscConstants.INFO_NULL;
+            int ierr;
+            f(ref comm, ref split_type, ref key, ref info, out newcomm, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Win_allocate_shared(long size, int disp_unit, MPI_Comm comm, out IntPtr baseptr, out MPI_Win win) {
+            var f = LoadOptionalFunctions().MPI_WIN_ALLOCATE_SHARED;
+            if (f == null)
+                throw MissingMPI3("MPI_WIN_ALLOCATE_SHARED");
+            int info = MiscConstants.INFO_NULL;
+            int ierr;
+            f(ref size, ref disp_unit, ref info, ref comm, out baseptr, out win, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Win_shared_query(MPI_Win win, int rank, out long size, out int disp_unit, out IntPtr baseptr) {
+            var f = LoadOptionalFunctions().MPI_WIN_SHARED_QUERY;
+            if (f == null)
+                throw MissingMPI3("MPI_WIN_SHARED_QUERY");
+            int ierr;
+            f(ref win, ref rank, out size, out disp_unit, out baseptr, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public void Win_free(ref MPI_Win win) {
+            var f = LoadOptionalFunctions().MPI_WIN_FREE;
+            if (f == null)
+                throw MissingMPI3("MPI_WIN_FREE");
+            int ierr;
+            f(ref win, out ierr);
+            MPIException.CheckReturnCode(ierr);
+        }
+
+        #endregion
+
         int m_MPI_Status_Size = -1;
 
         /// <summary>
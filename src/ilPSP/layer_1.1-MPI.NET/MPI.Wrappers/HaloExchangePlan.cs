@@ -0,0 +1,460 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+
+namespace MPI.Wrappers {
+
+    /// <summary>
+    /// A persistent plan for the halo exchange of a distributed vector with a fixed
+    /// communication pattern (e.g. the values of external cells of a domain decomposition):
+    /// the packing index lists, buffers and the communicators are set up once and re-used for
+    /// each exchange;
+    /// - neighbours on other nodes are served by one (nonblocking) neighborhood collective
+    ///   (<see cref="NeighborhoodComm.IAlltoallv"/>) per exchange,
+    /// - neighbours on the same node, if the MPI library supports MPI-3, via a shared memory window
+    ///   (<see cref="IMPIdriver.Win_allocate_shared"/>): the sender packs directly into its shared segment,
+    ///   the receiver reads directly from there.
+    /// </summary>
+    /// <remarks>
+    /// The plan supports two directions:
+    /// - forward (<see cref="StartForward"/>, <see cref="FinishForward"/>): entries of the local vector at the send
+    ///   indices are sent, and received at the receive indices (e.g. values of locally updated cells are sent to the
+    ///   external cells on other processes);
+    /// - reverse (<see cref="StartReverse"/>, <see cref="FinishReverse"/>): the inverse, i.e. entries at the receive indices
+    ///   are sent back and accumulated at the send indices.
+    ///
+    /// For each direction, only one exchange may be in progress at a time; both directions may be in progress at the same time.
+    ///
+    /// Shared memory synchronization is point-to-point: for each pair of processes and direction, the sender increments a
+    /// 'ready' counter after packing, and the receiver increments a 'consumed' counter after reading the data;
+    /// the sender waits for the consumption of the previous exchange before packing again. This relies on the
+    /// unified memory model of MPI-3 shared windows, i.e. on the cache coherence of the node.
+    /// </remarks>
+    public sealed class HaloExchangePlan : IDisposable {
+
+        /// <summary>
+        /// Switch for the shared memory path; must be equal on all MPI processes when a plan is created;
+        /// if false, all neighbours are served by MPI messages.
+        /// </summary>
+        public static bool UseSharedMemory = true;
+
+        /// <summary>
+        /// Collective over <paramref name="comm"/>.
+        /// </summary>
+        /// <param name="comm">
+        /// communicator
+        /// </param>
+        /// <param name="SendRanks">
+        /// ranks (in <paramref name="comm"/>) to which data is sent in forward direction
+        /// </param>
+        /// <param name="SendIndices">
+        /// for each entry in <paramref name="SendRanks"/>, the indices (into the vector passed to <see cref="StartForward"/>)
+        /// of the entries to send, in the order in which they are received
+        /// </param>
+        /// <param name="RecvRanks">
+        /// ranks (in <paramref name="comm"/>) from which data is received in forward direction
+        /// </param>
+        /// <param name="RecvIndices">
+        /// for each entry in <paramref name="RecvRanks"/>, the indices (into the vector passed to <see cref="FinishForward"/>)
+        /// at which the received entries are stored
+        /// </param>
+        public HaloExchangePlan(MPI_Comm comm, int[] SendRanks, int[][] SendIndices, int[] RecvRanks, int[][] RecvIndices) {
+            if (SendRanks.Length != SendIndices.Length)
+                throw new ArgumentException("mismatch between number of send ranks and send index lists");
+            if (RecvRanks.Length != RecvIndices.Length)
+                throw new ArgumentException("mismatch between number of receive ranks and receive index lists");
+            m_Comm = comm;
+            csMPI.Raw.Comm_Rank(comm, out m_MyRank);
+
+            // neighbours: union of send and receive ranks, so that one graph communicator serves both directions
+            // ===================================================================================================
+            m_Neighbours = SendRanks.Union(RecvRanks).OrderBy(p => p).ToArray();
+            int K = m_Neighbours.Length;
+            int[][] SndIdx = new int[K][];
+            int[][] RcvIdx = new int[K][];
+            for (int k = 0; k < K; k++) {
+                int iSnd = Array.IndexOf(SendRanks, m_Neighbours[k]);
+                int iRcv = Array.IndexOf(RecvRanks, m_Neighbours[k]);
+                SndIdx[k] = iSnd >= 0 ? SendIndices[iSnd].ToArray() : new int[0];
+                RcvIdx[k] = iRcv >= 0 ? RecvIndices[iRcv].ToArray() : new int[0];
+            }
+            m_NbComm = new NeighborhoodComm(comm, m_Neighbours, m_Neighbours);
+
+            // shared memory
+            // =============
+            bool[] OnNode = new bool[K];
+            int[] NodeRank = new int[K];
+            if (UseSharedMemory && csMPI.Raw.MPI3NeighborhoodAvailable) {
+                csMPI.Raw.Comm_split_type(comm, csMPI.Raw.MiscConstants.COMM_TYPE_SHARED, m_MyRank, out m_NodeComm);
+                m_HasNodeComm = true;
+                csMPI.Raw.Comm_Rank(m_NodeComm, out m_MyNodeRank);
+                csMPI.Raw.Comm_Size(m_NodeComm, out m_NodeSize);
+                int[] NodeRanks2Rank = m_MyRank.MPIAllGather(m_NodeComm);
+                for (int k = 0; k < K; k++) {
+                    NodeRank[k] = Array.IndexOf(NodeRanks2Rank, m_Neighbours[k]);
+                    OnNode[k] = NodeRank[k] >= 0 && m_Neighbours[k] != m_MyRank;
+                }
+            }
+
+            m_Dir = new Direction[2];
+            m_Dir[0] = new Direction(SndIdx, RcvIdx, OnNode, NodeRank);
+            m_Dir[1] = new Direction(RcvIdx, SndIdx, OnNode, NodeRank);
+
+            if (m_HasNodeComm)
+                SetupSharedMemory();
+        }
+
+        MPI_Comm m_Comm;
+        int m_MyRank;
+        int[] m_Neighbours;
+        NeighborhoodComm m_NbComm;
+
+        MPI_Comm m_NodeComm;
+        bool m_HasNodeComm;
+        int m_MyNodeRank;
+        int m_NodeSize;
+        MPI_Win m_Win;
+        bool m_HasWin;
+
+        /// <summary>
+        /// distance between two counters in the shared segment, in units of long (one cache line each, to avoid false sharing)
+        /// </summary>
+        const int FlagStride = 8;
+
+        /// <summary>
+        /// local start address of the shared segment of this process
+        /// </summary>
+        IntPtr m_MySegment;
+
+        /// <summary>
+        /// communication data for one direction
+        /// </summary>
+        class Direction {
+
+            public Direction(int[][] PackIdx, int[][] UnpackIdx, bool[] OnNode, int[] NodeRank) {
+                int K = PackIdx.Length;
+                this.PackIdx = PackIdx;
+                this.UnpackIdx = UnpackIdx;
+                this.OnNode = OnNode;
+                this.NodeRank = NodeRank;
+
+                MpiSendCounts = new int[K];
+                MpiRecvCounts = new int[K];
+                MpiSendOffset = new int[K];
+                MpiRecvOffset = new int[K];
+                int SendLen = 0, RecvLen = 0;
+                for (int k = 0; k < K; k++) {
+                    if (OnNode[k])
+                        continue;
+                    MpiSendCounts[k] = PackIdx[k].Length;
+                    MpiRecvCounts[k] = UnpackIdx[k].Length;
+                    MpiSendOffset[k] = SendLen;
+                    MpiRecvOffset[k] = RecvLen;
+                    SendLen += MpiSendCounts[k];
+                    RecvLen += MpiRecvCounts[k];
+                }
+                MpiSendBuffer = new double[SendLen];
+                MpiRecvBuffer = new double[RecvLen];
+
+                ShmWriteOffset = new long[K];
+                PeerSegment = new IntPtr[K];
+                PeerDataOffset = new long[K];
+                NoOfWrites = new long[K];
+                NoOfReads = new long[K];
+            }
+
+            /// <summary> for each neighbour, indices of the entries to send </summary>
+            public int[][] PackIdx;
+            /// <summary> for each neighbour, indices at which received entries are stored </summary>
+            public int[][] UnpackIdx;
+            /// <summary> for each neighbour, whether it is served by shared memory </summary>
+            public bool[] OnNode;
+            /// <summary> for each neighbour, its rank in the node communicator, or negative </summary>
+            public int[] NodeRank;
+
+            public int[] MpiSendCounts, MpiRecvCounts, MpiSendOffset, MpiRecvOffset;
+            public double[] MpiSendBuffer, MpiRecvBuffer;
+
+            /// <summary> for each neighbour on the node, offset (in bytes) of the data for it in the own shared segment </summary>
+            public long[] ShmWriteOffset;
+            /// <summary> for each neighbour on the node, start of its shared segment </summary>
+            public IntPtr[] PeerSegment;
+            /// <summary> for each neighbour on the node, offset (in bytes) of the data for this process in its shared segment </summary>
+            public long[] PeerDataOffset;
+            /// <summary> number of exchanges in which data was written for, resp. read from, a neighbour </summary>
+            public long[] NoOfWrites, NoOfReads;
+
+            public MPIPendingRequest Pending;
+            public bool Started;
+        }
+
+        Direction[] m_Dir;
+
+        /// <summary>
+        /// number of neighbours which are served by shared memory instead of MPI messages
+        /// </summary>
+        public int NoOfSharedMemoryNeighbours {
+            get {
+                return m_Dir[0].OnNode.Count(b => b);
+            }
+        }
+
+        /// <summary>
+        /// number of neighbour processes
+        /// </summary>
+        public int NoOfNeighbours {
+            get {
+                return m_Neighbours.Length;
+            }
+        }
+
+        /// <summary>
+        /// Layout of the shared segment of each process:
+        /// - 4 arrays of counters, each of length 'node size', with one cache line per entry:
+        ///   'ready' forward, 'ready' reverse, 'consumed' forward, 'consumed' reverse;
+        ///   the counters are indexed by the node rank of the partner process;
+        /// - the data for the neighbours on the node, forward and reverse.
+        /// </summary>
+        void SetupSharedMemory() {
+            int K = m_Neighbours.Length;
+            long FlagBytes = 4L * m_NodeSize * FlagStride * sizeof(long);
+            long Size = FlagBytes;
+            for (int d = 0; d < 2; d++) {
+                var D = m_Dir[d];
+                for (int k = 0; k < K; k++) {
+                    if (!D.OnNode[k])
+                        continue;
+                    D.ShmWriteOffset[k] = Size;
+                    Size += D.PackIdx[k].Length * sizeof(double);
+                }
+            }
+
+            csMPI.Raw.Win_allocate_shared(Size, 1, m_NodeComm, out m_MySegment, out m_Win);
+            m_HasWin = true;
+            unsafe {
+                long* pFlags = (long*)m_MySegment;
+                for (long i = 0; i < FlagBytes / sizeof(long); i++)
+                    pFlags[i] = 0;
+            }
+
+            // tell each neighbour where its data is located in the own segment
+            // ===================================================================
+            // (sent to all neighbours in the graph, -1 for those which are not on the node;
+            // the offsets are small integers, so they are represented exactly as double)
+            double[] Offsets = new double[2 * K];
+            double[] PeerOffsets = new double[2 * K];
+            int[] Counts = new int[K];
+            for (int k = 0; k < K; k++) {
+                Offsets[2 * k + 0] = m_Dir[0].OnNode[k] ? m_Dir[0].ShmWriteOffset[k] : -1;
+                Offsets[2 * k + 1] = m_Dir[1].OnNode[k] ? m_Dir[1].ShmWriteOffset[k] : -1;
+                Counts[k] = 2;
+            }
+            m_NbComm.Alltoallv(Offsets, Counts, PeerOffsets, Counts);
+
+            for (int k = 0; k < K; k++) {
+                if (!m_Dir[0].OnNode[k])
+                    continue;
+                long size;
+                int disp_unit;
+                IntPtr PeerSeg;
+                csMPI.Raw.Win_shared_query(m_Win, m_Dir[0].NodeRank[k], out size, out disp_unit, out PeerSeg);
+                for (int d = 0; d < 2; d++) {
+                    m_Dir[d].PeerSegment[k] = PeerSeg;
+                    m_Dir[d].PeerDataOffset[k] = (long)PeerOffsets[2 * k + d];
+                }
+            }
+
+            // all counters must be initialized before anyone reads them
+            csMPI.Raw.Barrier(m_NodeComm);
+        }
+
+        /// <summary>
+        /// address of a counter in a shared segment
+        /// </summary>
+        /// <param name="Segment">start of the shared segment</param>
+        /// <param name="Consumed">'ready' (false) or 'consumed' (true) counter</param>
+        /// <param name="d">direction</param>
+        /// <param name="PartnerNodeRank">node rank of the partner</param>
+        unsafe long* Counter(IntPtr Segment, bool Consumed, int d, int PartnerNodeRank) {
+            int iArr = (Consumed ? 2 : 0) + d;
+            return ((long*)Segment) + ((long)iArr * m_NodeSize + PartnerNodeRank) * FlagStride;
+        }
+
+        /// <summary>
+        /// starts the forward exchange: the entries of <paramref name="Src"/> at the send indices are sent;
+        /// Every call must be matched by a later call to <see cref="FinishForward"/>.
+        /// </summary>
+        public void StartForward<T>(T Src) where T : IList<double> {
+            Start(0, Src);
+        }
+
+        /// <summary>
+        /// completes the forward exchange: the received entries are **accumulated** at the receive indices, i.e.
+        /// <c><paramref name="Dst"/>[i] = <paramref name="Dst"/>[i]*<paramref name="beta"/> + received</c>.
+        /// </summary>
+        public void FinishForward<T>(T Dst, double beta) where T : IList<double> {
+            Finish(0, Dst, beta);
+        }
+
+        /// <summary>
+        /// starts the reverse exchange: the entries of <paramref name="Src"/> at the receive indices are sent back;
+        /// Every call must be matched by a later call to <see cref="FinishReverse"/>.
+        /// </summary>
+        public void StartReverse<T>(T Src) where T : IList<double> {
+            Start(1, Src);
+        }
+
+        /// <summary>
+        /// completes the reverse exchange: the received entries are **accumulated** at the send indices, i.e.
+        /// <c><paramref name="Dst"/>[i] = <paramref name="Dst"/>[i]*<paramref name="beta"/> + received</c>.
+        /// </summary>
+        public void FinishReverse<T>(T Dst, double beta) where T : IList<double> {
+            Finish(1, Dst, beta);
+        }
+
+        void Start<T>(int d, T Src) where T : IList<double> {
+            var D = m_Dir[d];
+            if (D.Started)
+                throw new ApplicationException("exchange must be finished first.");
+            D.Started = true;
+            int K = m_Neighbours.Length;
+
+            // MPI messages
+            // ============
+            double[] SendBuf = D.MpiSendBuffer;
+            for (int k = 0; k < K; k++) {
+                if (D.OnNode[k])
+                    continue;
+                int[] Idx = D.PackIdx[k];
+                int i0 = D.MpiSendOffset[k];
+                for (int i = 0; i < Idx.Length; i++)
+                    SendBuf[i0 + i] = Src[Idx[i]];
+            }
+            D.Pending = m_NbComm.IAlltoallv(SendBuf, D.MpiSendCounts, D.MpiRecvBuffer, D.MpiRecvCounts);
+
+            // shared memory
+            // =============
+            if (m_HasWin) {
+                unsafe {
+                    for (int k = 0; k < K; k++) {
+                        if (!D.OnNode[k])
+                            continue;
+                        int[] Idx = D.PackIdx[k];
+                        if (Idx.Length <= 0)
+                            continue;
+
+                        long Epoch = ++D.NoOfWrites[k];
+
+                        // wait until the previous data has been consumed by the receiver
+                        SpinUntil(Counter(D.PeerSegment[k], true, d, m_MyNodeRank), Epoch - 1);
+
+                        double* pData = (double*)((byte*)m_MySegment + D.ShmWriteOffset[k]);
+                        for (int i = 0; i < Idx.Length; i++)
+                            pData[i] = Src[Idx[i]];
+
+                        Volatile.Write(ref *Counter(m_MySegment, false, d, D.NodeRank[k]), Epoch);
+                    }
+                }
+            }
+        }
+
+        void Finish<T>(int d, T Dst, double beta) where T : IList<double> {
+            var D = m_Dir[d];
+            if (!D.Started)
+                throw new ApplicationException("exchange must be started first.");
+            D.Started = false;
+            int K = m_Neighbours.Length;
+
+            // shared memory (while the MPI messages are in flight)
+            // =============
+            if (m_HasWin) {
+                unsafe {
+                    for (int k = 0; k < K; k++) {
+                        if (!D.OnNode[k])
+                            continue;
+                        int[] Idx = D.UnpackIdx[k];
+                        if (Idx.Length <= 0)
+                            continue;
+
+                        long Epoch = ++D.NoOfReads[k];
+
+                        // wait until the data is ready
+                        SpinUntil(Counter(D.PeerSegment[k], false, d, m_MyNodeRank), Epoch);
+
+                        double* pData = (double*)((byte*)D.PeerSegment[k] + D.PeerDataOffset[k]);
+                        for (int i = 0; i < Idx.Length; i++) {
+                            int iDst = Idx[i];
+                            Dst[iDst] = Dst[iDst] * beta + pData[i];
+                        }
+
+                        Volatile.Write(ref *Counter(m_MySegment, true, d, D.NodeRank[k]), Epoch);
+                    }
+                }
+            }
+
+            // MPI messages
+            // ============
+            D.Pending.Wait();
+            D.Pending = null;
+            double[] RecvBuf = D.MpiRecvBuffer;
+            for (int k = 0; k < K; k++) {
+                if (D.OnNode[k])
+                    continue;
+                int[] Idx = D.UnpackIdx[k];
+                int i0 = D.MpiRecvOffset[k];
+                for (int i = 0; i < Idx.Length; i++) {
+                    int iDst = Idx[i];
+                    Dst[iDst] = Dst[iDst] * beta + RecvBuf[i0 + i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// waits until the counter <paramref name="pCounter"/> reaches at least <paramref name="Value"/>
+        /// (yields the processor after a few spins, see <see cref="SpinWait"/>).
+        /// </summary>
+        static unsafe void SpinUntil(long* pCounter, long Value) {
+            if (Volatile.Read(ref *pCounter) >= Value)
+                return;
+            var sw = new SpinWait();
+            while (Volatile.Read(ref *pCounter) < Value)
+                sw.SpinOnce();
+        }
+
+        /// <summary>
+        /// frees the communicators and the shared memory; collective over the communicator of the plan.
+        /// </summary>
+        public void Dispose() {
+            for (int d = 0; d < m_Dir.Length; d++) {
+                if (m_Dir[d].Started)
+                    throw new ApplicationException("exchange must be finished first.");
+            }
+            if (m_HasWin) {
+                csMPI.Raw.Win_free(ref m_Win);
+                m_HasWin = false;
+            }
+            if (m_HasNodeComm) {
+                csMPI.Raw.Comm_free(ref m_NodeComm);
+                m_HasNodeComm = false;
+            }
+            m_NbComm.Dispose();
+        }
+    }
+}
@@ -333,6 +333,215 @@ namespace MPI.Wrappers {
         /// <param name="status"></param>
         void Waitany(int count, MPI_Request[] array_of_requests, out int index, out MPI_Status status);
 
+        /// <summary>
+        /// Like <see cref="Waitany"/>, but returns immediately: if one of the
+        /// active requests in the array has completed, <paramref name="flag"/>
+        /// is set to true, <paramref name="index"/> is the index of that
+        /// request (indexed from zero) and the request is deallocated, i.e.
+        /// set to MPI_REQUEST_NULL. If no active request has completed,
+        /// <paramref name="flag"/> is false and <paramref name="index"/> is
+        /// <see cref="IMiscConstants.UNDEFINED"/>. If the array contains no
+        /// active handles, the call returns with <paramref name="flag"/> =
+        /// true and <paramref name="index"/> = <see cref="IMiscConstants.UNDEFINED"/>.
+        /// </summary>
+        void Testany(int count, MPI_Request[] array_of_requests, out int index, out bool flag, out MPI_Status status);
+
+        /// <summary>
+        /// Marks the request object for deallocation and sets
+        /// <paramref name="request"/> to MPI_REQUEST_NULL. Mainly used to
+        /// free persistent requests (see <see cref="Send_init"/>,
+        /// <see cref="Recv_init"/>); an ongoing communication that is
+        /// associated with the request will be allowed to complete.
+        /// </summary>
+        void Request_free(ref MPI_Request request);
+
+        /// <summary>
+        /// Creates a persistent communication request for a standard mode
+        /// send operation, and binds to it all the arguments of a send
+        /// operation. The communication is started by <see cref="Start"/> or
+        /// <see cref="Startall"/> and completed by the usual wait and test
+        /// functions, after which the request becomes inactive, but is not
+        /// deallocated (see <see cref="Request_free"/>).
+        /// </summary>
+        /// <remarks>
+        /// The buffer <paramref name="buf"/> must remain pinned for the whole
+        /// lifetime of the request.
+        /// </remarks>
+        void Send_init(IntPtr buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, out MPI_Request request);
+
+        /// <summary>
+        /// Creates a persistent communication request for a receive
+        /// operation, see <see cref="Send_init"/>.
+        /// </summary>
+        void Recv_init(IntPtr buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, out MPI_Request request);
+
+        /// <summary>
+        /// Starts the communication of a persistent request, i.e. one that
+        /// was created by <see cref="Send_init"/> or <see cref="Recv_init"/>.
+        /// </summary>
+        void Start(ref MPI_Request request);
+
+        /// <summary>
+        /// Starts all communications associated with the persistent requests
+        /// in <paramref name="array_of_requests"/>.
+        /// </summary>
+        void Startall(int count, MPI_Request[] array_of_requests);
+
+        /// <summary>
+        /// Nonblocking variant of <see cref="Allreduce"/> (MPI-3): starts the
+        /// reduction and returns a request which must be completed by one of
+        /// the wait or test functions; until then, neither
+        /// <paramref name="sndbuf"/> nor <paramref name="rcvbuf"/> may be
+        /// accessed (and both must remain pinned).
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Iallreduce(IntPtr sndbuf, IntPtr rcvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm, out MPI_Request request);
+
+        /// <summary>
+        /// Nonblocking variant of MPI_ALLTOALLV (MPI-3): each process sends
+        /// <paramref name="sendcounts"/>[j] elements, starting at offset
+        /// <paramref name="sdispls"/>[j] of <paramref name="sendbuf"/>, to
+        /// process j and receives <paramref name="recvcounts"/>[i] elements from
+        /// process i into <paramref name="recvbuf"/> at offset
+        /// <paramref name="rdispls"/>[i]. Counts and displacements are
+        /// integer arrays of length comm size, given in units of the
+        /// respective data type; all buffers, including the count- and
+        /// displacement-arrays, must remain pinned until the request
+        /// completes.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Ialltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                        IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                        MPI_Comm comm, out MPI_Request request);
+
+        /// <summary>
+        /// Creates a communicator with a distributed graph topology (MPI-3),
+        /// where each process specifies its incoming (<paramref name="sources"/>)
+        /// and outgoing (<paramref name="destinations"/>) neighbours. This
+        /// is a collective call over <paramref name="comm_old"/>.
+        /// </summary>
+        /// <param name="comm_old">input communicator</param>
+        /// <param name="indegree">number of incoming neighbours</param>
+        /// <param name="sources">ranks (in <paramref name="comm_old"/>) of the incoming neighbours</param>
+        /// <param name="sourceweights">weights of the incoming edges, or null (unit weights)</param>
+        /// <param name="outdegree">number of outgoing neighbours</param>
+        /// <param name="destinations">ranks of the outgoing neighbours</param>
+        /// <param name="destweights">weights of the outgoing edges, or null (unit weights)</param>
+        /// <param name="reorder">
+        /// if true, the ranks may be reordered by the MPI library
+        /// </param>
+        /// <param name="comm_dist_graph">
+        /// on exit, the new communicator; must be freed by <see cref="Comm_free"/>
+        /// </param>
+        /// <remarks>
+        /// Since the Fortran-constant MPI_UNWEIGHTED cannot be passed through
+        /// this interface, null weights are replaced by unit weights.
+        /// </remarks>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Dist_graph_create_adjacent(MPI_Comm comm_old,
+                                        int indegree, int[] sources, int[] sourceweights,
+                                        int outdegree, int[] destinations, int[] destweights,
+                                        bool reorder, out MPI_Comm comm_dist_graph);
+
+        /// <summary>
+        /// Neighborhood all-to-all exchange (MPI-3) on a communicator with a
+        /// distributed graph topology (see <see cref="Dist_graph_create_adjacent"/>):
+        /// block k of the send buffer (<paramref name="sendcounts"/>[k]
+        /// elements at offset <paramref name="sdispls"/>[k]) is sent to the
+        /// k-th outgoing neighbour, block k of the receive buffer is received
+        /// from the k-th incoming neighbour. The count- and displacement-arrays
+        /// have length outdegree or indegree, respectively.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Neighbor_alltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                                IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                                MPI_Comm comm);
+
+        /// <summary>
+        /// Nonblocking variant of <see cref="Neighbor_alltoallv"/> (MPI-3);
+        /// all buffers, including the count- and displacement-arrays, must
+        /// remain pinned until the request completes.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Ineighbor_alltoallv(IntPtr sendbuf, IntPtr sendcounts, IntPtr sdispls, MPI_Datatype sendtype,
+                                 IntPtr recvbuf, IntPtr recvcounts, IntPtr rdispls, MPI_Datatype recvtype,
+                                 MPI_Comm comm, out MPI_Request request);
+
+        /// <summary>
+        /// Partitions the group of <paramref name="comm"/> into disjoint
+        /// subgroups, according to <paramref name="split_type"/>; e.g., for
+        /// <see cref="IMiscConstants.COMM_TYPE_SHARED"/>, each subgroup contains
+        /// all processes which can create a shared memory region (usually, all
+        /// processes on the same compute node). Collective over <paramref name="comm"/>.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Comm_split_type(MPI_Comm comm, int split_type, int key, out MPI_Comm newcomm);
+
+        /// <summary>
+        /// Collective over <paramref name="comm"/>, which must be a
+        /// communicator of processes on the same node (see
+        /// <see cref="Comm_split_type"/>): each process allocates
+        /// <paramref name="size"/> bytes of memory, which can be accessed by
+        /// all processes in <paramref name="comm"/> by load/store instructions
+        /// (see <see cref="Win_shared_query"/>); the process-local part is
+        /// returned in <paramref name="baseptr"/>.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Win_allocate_shared(long size, int disp_unit, MPI_Comm comm, out IntPtr baseptr, out MPI_Win win);
+
+        /// <summary>
+        /// Queries the size and the local address of the shared memory
+        /// segment of process <paramref name="rank"/> in a window created by
+        /// <see cref="Win_allocate_shared"/>.
+        /// </summary>
+        /// <exception cref="NotSupportedException">
+        /// if the MPI library does not implement MPI-3.
+        /// </exception>
+        void Win_shared_query(MPI_Win win, int rank, out long size, out int disp_unit, out IntPtr baseptr);
+
+        /// <summary>
+        /// Frees the window object (and the shared memory); collective.
+        /// </summary>
+        void Win_free(ref MPI_Win win);
+
+        /// <summary>
+        /// Marks the communicator object for deallocation and sets
+        /// <paramref name="comm"/> to MPI_COMM_NULL.
+        /// </summary>
+        void Comm_free(ref MPI_Comm comm);
+
+        /// <summary>
+        /// True, if the loaded MPI library provides the MPI-3 functions
+        /// (<see cref="Iallreduce"/>, <see cref="Ialltoallv"/>,
+        /// <see cref="Dist_graph_create_adjacent"/>, <see cref="Neighbor_alltoallv"/>).
+        /// </summary>
+        bool MPI3Available {
+            get;
+        }
+
+        /// <summary>
+        /// True, if additionally to <see cref="MPI3Available"/>, the MPI-3 functions for the neighbourhood halo exchange are provided
+        /// (<see cref="Ineighbor_alltoallv"/>, <see cref="Comm_split_type"/> and the shared memory windows,
+        /// <see cref="Win_allocate_shared"/>, <see cref="Win_shared_query"/>, <see cref="Win_free"/>).
+        /// </summary>
+        bool MPI3NeighborhoodAvailable {
+            get;
+        }
+
         /// <summary>
         /// The size of an <see cref="MPI_Status"/>.
         /// </summary>
@@ -860,5 +860,200 @@ namespace MPI.Wrappers {
 
             return result;
         }
+
+        /// <summary>
+        /// equal to <see cref="MPISumNonblocking(double[], double[], MPI_Comm)"/>, acting on the
+        /// WORLD-communicator
+        /// </summary>
+        static public MPIPendingRequest MPISumNonblocking(this double[] A, double[] Result) {
+            return MPISumNonblocking(A, Result, csMPI.Raw._COMM.WORLD);
+        }
+
+        /// <summary>
+        /// Starts the summation of <paramref name="A"/> over all MPI-processes in the
+        /// <paramref name="comm"/>--communicator (see <see cref="IMPIdriver.Iallreduce"/>), e.g.
+        /// to overlap the global reduction of inner products with local work in Krylov solvers.
+        /// </summary>
+        /// <param name="A">local values; must not be modified until the operation is complete</param>
+        /// <param name="Result">
+        /// output, valid after <see cref="MPIPendingRequest.Wait"/>; must have the same length as <paramref name="A"/>;
+        /// </param>
+        /// <param name="comm"></param>
+        /// <returns>
+        /// the pending operation; If the MPI library does not provide MPI-3,
+        /// a blocking reduction is performed and the returned request is already completed.
+        /// </returns>
+        static public MPIPendingRequest MPISumNonblocking(this double[] A, double[] Result, MPI_Comm comm) {
+            if (Result.Length != A.Length)
+                throw new ArgumentException("length mismatch between input and result array");
+            if (A.Length == 0)
+                return new MPIPendingRequest();
+
+            if (!csMPI.Raw.MPI3Available) {
+                unsafe {
+                    fixed (double* pA = A, pS = Result) {
+                        csMPI.Raw.Allreduce(((IntPtr)(pA)), ((IntPtr)(pS)), A.Length, csMPI.Raw._DATATYPE.DOUBLE, csMPI.Raw._OP.SUM, comm);
+                    }
+                }
+                return new MPIPendingRequest();
+            }
+
+            var pinned = MPIPendingRequest.Pin(A, Result);
+            MPI_Request req;
+            csMPI.Raw.Iallreduce(pinned[0].AddrOfPinnedObject(), pinned[1].AddrOfPinnedObject(), A.Length,
+                csMPI.Raw._DATATYPE.DOUBLE, csMPI.Raw._OP.SUM, comm, out req);
+            return new MPIPendingRequest(req, pinned);
+        }
+
+        /// <summary>
+        /// Starts an all-to-all exchange of variable size (see <see cref="IMPIdriver.Ialltoallv"/>):
+        /// the first <paramref name="SendCounts"/>[0] entries of <paramref name="SendBuf"/> are sent
+        /// to process 0, the next <paramref name="SendCounts"/>[1] entries to process 1, etc.;
+        /// <paramref name="RecvBuf"/> is filled in the same way.
+        /// </summary>
+        /// <param name="SendBuf"></param>
+        /// <param name="SendCounts">number of entries sent to each process; length equal to the size of <paramref name="comm"/></param>
+        /// <param name="RecvBuf">output, valid after <see cref="MPIPendingRequest.Wait"/></param>
+        /// <param name="RecvCounts">number of entries received from each process; length equal to the size of <paramref name="comm"/></param>
+        /// <param name="comm"></param>
+        /// <returns>
+        /// the pending operation; If the MPI library does not provide MPI-3,
+        /// the exchange is performed by point-to-point messages and the returned request is already completed.
+        /// </returns>
+        static public MPIPendingRequest MPIAlltoallvNonblocking(this double[] SendBuf, int[] SendCounts, double[] RecvBuf, int[] RecvCounts, MPI_Comm comm) {
+            int size;
+            csMPI.Raw.Comm_Size(comm, out size);
+            if (SendCounts.Length != size || RecvCounts.Length != size)
+                throw new ArgumentException("length of count arrays must be equal to communicator size");
+            int[] SendDispl = new int[size];
+            int[] RecvDispl = new int[size];
+            for (int p = 1; p < size; p++) {
+                SendDispl[p] = SendDispl[p - 1] + SendCounts[p - 1];
+                RecvDispl[p] = RecvDispl[p - 1] + RecvCounts[p - 1];
+            }
+            if (SendDispl[size - 1] + SendCounts[size - 1] > SendBuf.Length)
+                throw new ArgumentException("send buffer too short");
+            if (RecvDispl[size - 1] + RecvCounts[size - 1] > RecvBuf.Length)
+                throw new ArgumentException("receive buffer too short");
+
+            // dummies, to avoid null pointers
+            if (SendBuf.Length == 0)
+                SendBuf = new double[1];
+            if (RecvBuf.Length == 0)
+                RecvBuf = new double[1];
+
+            MPI_Datatype dbl = csMPI.Raw._DATATYPE.DOUBLE;
+            if (!csMPI.Raw.MPI3Available) {
+                MPI_Request[] reqs = new MPI_Request[2 * size];
+                MPI_Status[] st = new MPI_Status[2 * size];
+                int cnt = 0;
+                unsafe {
+                    fixed (double* pSend = SendBuf, pRecv = RecvBuf) {
+                        for (int p = 0; p < size; p++) {
+                            if (RecvCounts[p] > 0)
+                                csMPI.Raw.Irecv((IntPtr)(pRecv + RecvDispl[p]), RecvCounts[p], dbl, p, 4712, comm, out reqs[cnt++]);
+                        }
+                        for (int p = 0; p < size; p++) {
+                            if (SendCounts[p] > 0)
+                                csMPI.Raw.Issend((IntPtr)(pSend + SendDispl[p]), SendCounts[p], dbl, p, 4712, comm, out reqs[cnt++]);
+                        }
+                        csMPI.Raw.Waitall(cnt, reqs, st);
+                    }
+                }
+                return new MPIPendingRequest();
+            }
+
+            int[] _SendCounts = SendCounts.ToArray(), _RecvCounts = RecvCounts.ToArray();
+            var pinned = MPIPendingRequest.Pin(SendBuf, _SendCounts, SendDispl, RecvBuf, _RecvCounts, RecvDispl);
+            MPI_Request req;
+            csMPI.Raw.Ialltoallv(
+                pinned[0].AddrOfPinnedObject(), pinned[1].AddrOfPinnedObject(), pinned[2].AddrOfPinnedObject(), dbl,
+                pinned[3].AddrOfPinnedObject(), pinned[4].AddrOfPinnedObject(), pinned[5].AddrOfPinnedObject(), dbl,
+                comm, out req);
+            return new MPIPendingRequest(req, pinned);
+        }
+
+        /// <summary>
+        /// Creates persistent point-to-point messages (see <see cref="IMPIdriver.Send_init"/>, <see cref="IMPIdriver.Recv_init"/>)
+        /// for an exchange which is repeated with the same buffers, e.g. a halo exchange in every iteration of a solver:
+        /// the first <paramref name="SendCounts"/>[0] entries of <paramref name="SendBuf"/> are sent
+        /// to <paramref name="Destinations"/>[0], the next <paramref name="SendCounts"/>[1] entries to
+        /// <paramref name="Destinations"/>[1], etc.; <paramref name="RecvBuf"/> is filled the same way, from
+        /// <paramref name="Sources"/>.
+        /// </summary>
+        /// <param name="SendBuf">must not be modified while the exchange is running</param>
+        /// <param name="Destinations">ranks (in <paramref name="comm"/>) to send to</param>
+        /// <param name="SendCounts">number of entries sent to each destination</param>
+        /// <param name="RecvBuf">output, valid after each <see cref="MPIPendingRequest.Wait"/></param>
+        /// <param name="Sources">ranks (in <paramref name="comm"/>) to receive from</param>
+        /// <param name="RecvCounts">number of entries received from each source</param>
+        /// <param name="tag">MPI tag of all messages</param>
+        /// <param name="comm"></param>
+        /// <returns>
+        /// an inactive, persistent request: each exchange is started by <see cref="MPIPendingRequest.Start"/>
+        /// and completed by <see cref="MPIPendingRequest.Wait"/>; the buffers stay pinned until
+        /// <see cref="MPIPendingRequest.Dispose"/>, which frees the MPI requests.
+        /// </returns>
+        static public MPIPendingRequest MPIPersistentSendRecv(this double[] SendBuf, int[] Destinations, int[] SendCounts,
+            double[] RecvBuf, int[] Sources, int[] RecvCounts, int tag, MPI_Comm comm) {
+            if (SendCounts.Length != Destinations.Length)
+                throw new ArgumentException("length mismatch with number of destinations", "SendCounts");
+            if (RecvCounts.Length != Sources.Length)
+                throw new ArgumentException("length mismatch with number of sources", "RecvCounts");
+            if (SendCounts.Sum() > SendBuf.Length)
+                throw new ArgumentException("send buffer too short");
+            if (RecvCounts.Sum() > RecvBuf.Length)
+                throw new ArgumentException("receive buffer too short");
+
+            // dummies, to avoid null pointers
+            if (SendBuf.Length == 0)
+                SendBuf = new double[1];
+            if (RecvBuf.Length == 0)
+                RecvBuf = new double[1];
+
+            MPI_Datatype dbl = csMPI.Raw._DATATYPE.DOUBLE;
+            var pinned = MPIPendingRequest.Pin(SendBuf, RecvBuf);
+            MPI_Request[] reqs = new MPI_Request[Sources.Length + Destinations.Length];
+            unsafe {
+                double* pSend = (double*)pinned[0].AddrOfPinnedObject();
+                double* pRecv = (double*)pinned[1].AddrOfPinnedObject();
+                int i0 = 0;
+                for (int i = 0; i < Sources.Length; i++) {
+                    csMPI.Raw.Recv_init((IntPtr)(pRecv + i0), RecvCounts[i], dbl, Sources[i], tag, comm, out reqs[i]);
+                    i0 += RecvCounts[i];
+                }
+                i0 = 0;
+                for (int i = 0; i < Destinations.Length; i++) {
+                    csMPI.Raw.Send_init((IntPtr)(pSend + i0), SendCounts[i], dbl, Destinations[i], tag, comm, out reqs[Sources.Length + i]);
+                    i0 += SendCounts[i];
+                }
+            }
+            return new MPIPendingRequest(reqs, pinned, true);
+        }
+
+        /// <summary>
+        /// Creates a communicator for the exchange with a fixed set of neighbour processes (see <see cref="NeighborhoodComm"/>);
+        /// this is a collective call on <paramref name="comm"/>.
+        /// </summary>
+        /// <param name="comm">the parent communicator</param>
+        /// <param name="Sources">ranks (in <paramref name="comm"/>) from which this process receives data</param>
+        /// <param name="Destinations">ranks (in <paramref name="comm"/>) to which this process sends data</param>
+        static public NeighborhoodComm MPICreateNeighborhood(this MPI_Comm comm, int[] Sources, int[] Destinations) {
+            return new NeighborhoodComm(comm, Sources, Destinations);
+        }
+
+        /// <summary>
+        /// Neighborhood all-to-all exchange, see <see cref="NeighborhoodComm.Alltoallv"/>.
+        /// </summary>
+        static public void MPINeighborAlltoallv(this double[] SendBuf, int[] SendCounts, double[] RecvBuf, int[] RecvCounts, NeighborhoodComm comm) {
+            comm.Alltoallv(SendBuf, SendCounts, RecvBuf, RecvCounts);
+        }
+
+        /// <summary>
+        /// Nonblocking neighborhood all-to-all exchange, see <see cref="NeighborhoodComm.IAlltoallv"/>.
+        /// </summary>
+        static public MPIPendingRequest MPINeighborAlltoallvNonblocking(this double[] SendBuf, int[] SendCounts, double[] RecvBuf, int[] RecvCounts, NeighborhoodComm comm) {
+            return comm.IAlltoallv(SendBuf, SendCounts, RecvBuf, RecvCounts);
+        }
     }
 }
@@ -0,0 +1,218 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace MPI.Wrappers {
+
+    /// <summary>
+    /// A nonblocking MPI operation (e.g. <see cref="IMPIdriver.Iallreduce"/>,
+    /// <see cref="IMPIdriver.Ialltoallv"/>), or a set of point-to-point messages,
+    /// together with its buffers, which
+    /// remain pinned until the operation is completed by <see cref="Wait"/>
+    /// or <see cref="Test"/>.
+    /// </summary>
+    /// <remarks>
+    /// If the MPI library does not support MPI-3, the creators of this object
+    /// (see <see cref="MPIExtensions.MPISumNonblocking(double[], double[], MPI_Comm)"/>)
+    /// perform the blocking operation instead and return an already completed request;
+    /// so, code which overlaps communication and computation does not need a separate code
+    /// path for old MPI libraries.
+    /// Persistent requests (see <see cref="MPIExtensions.MPIPersistentSendRecv"/>) are created inactive,
+    /// can be started again by <see cref="Start"/> after each completion and keep their buffers pinned until <see cref="Dispose"/>.
+    /// </remarks>
+    public sealed class MPIPendingRequest : IDisposable {
+
+        MPI_Request[] m_Requests;
+        GCHandle[] m_PinnedBuffers;
+        bool m_Completed;
+        bool m_Persistent;
+
+        /// <summary>
+        /// ctor, for an already started operation
+        /// </summary>
+        /// <param name="Request">
+        /// the MPI request of the started operation
+        /// </param>
+        /// <param name="PinnedBuffers">
+        /// handles of all buffers used by the operation; they are freed upon completion.
+        /// </param>
+        internal MPIPendingRequest(MPI_Request Request, GCHandle[] PinnedBuffers)
+            : this(new MPI_Request[] { Request }, PinnedBuffers) {
+        }
+
+        /// <summary>
+        /// ctor, for a set of started operations, which are completed together
+        /// </summary>
+        internal MPIPendingRequest(MPI_Request[] Requests, GCHandle[] PinnedBuffers) {
+            m_Requests = Requests;
+            m_PinnedBuffers = PinnedBuffers;
+            m_Completed = false;
+        }
+
+        /// <summary>
+        /// ctor, for a set of persistent requests (see <see cref="IMPIdriver.Send_init"/>, <see cref="IMPIdriver.Recv_init"/>),
+        /// which are not started yet
+        /// </summary>
+        internal MPIPendingRequest(MPI_Request[] PersistentRequests, GCHandle[] PinnedBuffers, bool Persistent)
+            : this(PersistentRequests, PinnedBuffers) {
+            m_Persistent = Persistent;
+            m_Completed = true;
+        }
+
+        /// <summary>
+        /// ctor for an operation which is already complete (blocking fallback)
+        /// </summary>
+        internal MPIPendingRequest() {
+            m_Requests = new MPI_Request[0];
+            m_PinnedBuffers = new GCHandle[0];
+            m_Completed = true;
+        }
+
+        /// <summary>
+        /// pins <paramref name="buffers"/>
+        /// </summary>
+        internal static GCHandle[] Pin(params Array[] buffers) {
+            GCHandle[] ret = new GCHandle[buffers.Length];
+            for (int i = 0; i < buffers.Length; i++)
+                ret[i] = GCHandle.Alloc(buffers[i], GCHandleType.Pinned);
+            return ret;
+        }
+
+        /// <summary>
+        /// true, if the operation has completed.
+        /// </summary>
+        public bool IsCompleted {
+            get {
+                return m_Completed;
+            }
+        }
+
+        /// <summary>
+        /// true for persistent requests, which can be restarted by <see cref="Start"/>.
+        /// </summary>
+        public bool IsPersistent {
+            get {
+                return m_Persistent;
+            }
+        }
+
+        /// <summary>
+        /// (re-)starts a persistent operation (see <see cref="IMPIdriver.Startall"/>);
+        /// the previous run must be completed.
+        /// </summary>
+        public void Start() {
+            if (!m_Persistent)
+                throw new NotSupportedException("only persistent requests can be restarted.");
+            if (!m_Completed)
+                throw new InvalidOperationException("previous operation is not completed yet.");
+            if (m_PinnedBuffers == null)
+                throw new ObjectDisposedException("MPIPendingRequest");
+            m_Completed = false;
+            if (m_Requests.Length > 0)
+                csMPI.Raw.Startall(m_Requests.Length, m_Requests);
+        }
+
+        /// <summary>
+        /// blocks until the operation is complete;
+        /// afterwards, all buffers passed to the operation can be accessed.
+        /// </summary>
+        public void Wait() {
+            if (m_Completed)
+                return;
+            if (m_Requests.Length > 0) {
+                MPI_Status[] st = new MPI_Status[m_Requests.Length];
+                csMPI.Raw.Waitall(m_Requests.Length, m_Requests, st);
+            }
+            Complete();
+        }
+
+        /// <summary>
+        /// Tests, without blocking, whether the operation is complete;
+        /// calling this from time to time also drives the progress of the
+        /// operation in MPI libraries without an asynchronous progress thread.
+        /// </summary>
+        /// <returns>
+        /// true, if the operation has completed
+        /// </returns>
+        public bool Test() {
+            if (m_Completed)
+                return true;
+            while (true) {
+                int index;
+                bool flag;
+                MPI_Status st;
+                csMPI.Raw.Testany(m_Requests.Length, m_Requests, out index, out flag, out st);
+                if (!flag)
+                    return false;
+                if (index < 0 || index >= m_Requests.Length) {
+                    // no active request left
+                    Complete();
+                    return true;
+                }
+                // else: one request completed (and set to MPI_REQUEST_NULL), test the others
+            }
+        }
+
+        /// <summary>
+        /// Tests, without blocking, whether any of the operations in
+        /// <paramref name="Requests"/> has completed.
+        /// </summary>
+        /// <returns>
+        /// the index of some completed operation, or a negative value if none of
+        /// the still pending operations has completed yet;
+        /// Operations which are already marked as completed are ignored.
+        /// </returns>
+        public static int TestAny(IList<MPIPendingRequest> Requests) {
+            for (int i = 0; i < Requests.Count; i++) {
+                if (Requests[i].m_Completed)
+                    continue;
+                if (Requests[i].Test())
+                    return i;
+            }
+            return -1;
+        }
+
+        void Complete() {
+            m_Completed = true;
+            if (m_Persistent)
+                // buffers remain pinned for the next 'Start'
+                return;
+            foreach (var h in m_PinnedBuffers)
+                h.Free();
+            m_PinnedBuffers = new GCHandle[0];
+        }
+
+        /// <summary>
+        /// waits for completion (see <see cref="Wait"/>);
+        /// persistent requests are freed (see <see cref="IMPIdriver.Request_free"/>).
+        /// </summary>
+        public void Dispose() {
+            if (m_PinnedBuffers == null)
+                return;
+            Wait();
+            if (m_Persistent) {
+                for (int i = 0; i < m_Requests.Length; i++)
+                    csMPI.Raw.Request_free(ref m_Requests[i]);
+                foreach (var h in m_PinnedBuffers)
+                    h.Free();
+                m_PinnedBuffers = null;
+            }
+        }
+    }
+}
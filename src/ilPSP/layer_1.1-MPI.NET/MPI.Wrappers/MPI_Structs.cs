@@ -284,6 +284,18 @@ namespace MPI.Wrappers {
         }
     }
 
+    /// <summary>
+    /// MPI window (one-sided communication/shared memory), Fortran handle
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct MPI_Win {
+
+        /// <summary>
+        /// The actual window handle
+        /// </summary>
+        public int m1;
+    }
+
     /// <summary>
     /// MPI Datatype - type
     /// </summary>
@@ -70,6 +70,16 @@ namespace MPI.Wrappers {
         MPI_Request MPI_REQUEST_NULL {
             get;
         }
+
+        /// <summary> NULL info object (Fortran handle)</summary>
+        int INFO_NULL {
+            get;
+        }
+
+        /// <summary> split type for <see cref="IMPIdriver.Comm_split_type"/>: processes which can create a shared memory region</summary>
+        int COMM_TYPE_SHARED {
+            get;
+        }
     }
 
     class OPENMPI_MiscConstants : IMiscConstants {
@@ -170,6 +180,20 @@ namespace MPI.Wrappers {
                 return m_MPI_REQUEST_NULL;
             }
         }
+
+        /// <summary> NULL info object (Fortran handle)</summary>
+        public int INFO_NULL {
+            get {
+                return 0;
+            }
+        }
+
+        /// <summary> shared memory split type </summary>
+        public int COMM_TYPE_SHARED {
+            get {
+                return 0;
+            }
+        }
     }
 
     class MPICH_MiscConstants : IMiscConstants {
@@ -248,6 +272,20 @@ namespace MPI.Wrappers {
                 return r;
             }
         }
+
+        /// <summary> NULL info object (Fortran handle)</summary>
+        public int INFO_NULL {
+            get {
+                return 0x1c000000;
+            }
+        }
+
+        /// <summary> shared memory split type </summary>
+        public int COMM_TYPE_SHARED {
+            get {
+                return 1;
+            }
+        }
     }
 
 
@@ -277,6 +315,10 @@ namespace MPI.Wrappers {
         extern static int BoSSS_Get_MPI_KEYVAL_INVALID();
         [DllImport("Platform_Native")]
         extern static int BoSSS_Get_MPI_REQUEST_NULL();
+        [DllImport("Platform_Native")]
+        extern static int BoSSS_Get_MPI_INFO_NULL();
+        [DllImport("Platform_Native")]
+        extern static int BoSSS_Get_MPI_COMM_TYPE_SHARED();
 
 
         /// <summary> match any source rank </summary>
@@ -353,5 +395,19 @@ namespace MPI.Wrappers {
                 return ret;
             }
         }
+
+        /// <summary> NULL info object (Fortran handle)</summary>
+        public int INFO_NULL {
+            get {
+                return BoSSS_Get_MPI_INFO_NULL();
+            }
+        }
+
+        /// <summary> shared memory split type </summary>
+        public int COMM_TYPE_SHARED {
+            get {
+                return BoSSS_Get_MPI_COMM_TYPE_SHARED();
+            }
+        }
     }
 }
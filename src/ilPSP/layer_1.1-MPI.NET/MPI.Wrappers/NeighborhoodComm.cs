@@ -0,0 +1,219 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Linq;
+
+namespace MPI.Wrappers {
+
+    /// <summary>
+    /// A communicator with a distributed graph topology
+    /// (see <see cref="IMPIdriver.Dist_graph_create_adjacent"/>), for
+    /// sparse data exchange with a fixed set of neighbour processes, e.g. the
+    /// halo exchange of a domain decomposition.
+    /// </summary>
+    /// <remarks>
+    /// If the MPI library does not support MPI-3 (see <see cref="IMPIdriver.MPI3NeighborhoodAvailable"/>), no graph communicator is created
+    /// and <see cref="Alltoallv(double[], int[], double[], int[])"/> is implemented by point-to-point
+    /// messages on the original communicator.
+    /// </remarks>
+    public sealed class NeighborhoodComm : IDisposable {
+
+        /// <summary>
+        /// Collective over <paramref name="comm"/>.
+        /// </summary>
+        /// <param name="comm">
+        /// the parent communicator
+        /// </param>
+        /// <param name="Sources">
+        /// ranks (in <paramref name="comm"/>) from which this process receives data
+        /// </param>
+        /// <param name="Destinations">
+        /// ranks (in <paramref name="comm"/>) to which this process sends data
+        /// </param>
+        public NeighborhoodComm(MPI_Comm comm, int[] Sources, int[] Destinations) {
+            m_ParentComm = comm;
+            m_Sources = Sources.ToArray();
+            m_Destinations = Destinations.ToArray();
+
+            if (csMPI.Raw.MPI3NeighborhoodAvailable) {
+                csMPI.Raw.Dist_graph_create_adjacent(comm,
+                    m_Sources.Length, m_Sources, null,
+                    m_Destinations.Length, m_Destinations, null,
+                    false, out m_GraphComm);
+                m_HasGraphComm = true;
+            }
+        }
+
+        MPI_Comm m_ParentComm;
+        MPI_Comm m_GraphComm;
+        bool m_HasGraphComm;
+        int[] m_Sources;
+        int[] m_Destinations;
+
+        /// <summary>
+        /// ranks (in the parent communicator) from which this process receives data
+        /// </summary>
+        public int[] Sources {
+            get {
+                return m_Sources.ToArray();
+            }
+        }
+
+        /// <summary>
+        /// ranks (in the parent communicator) to which this process sends data
+        /// </summary>
+        public int[] Destinations {
+            get {
+                return m_Destinations.ToArray();
+            }
+        }
+
+        /// <summary>
+        /// Neighborhood all-to-all exchange (see <see cref="IMPIdriver.Neighbor_alltoallv"/>):
+        /// the first <paramref name="SendCounts"/>[0] entries of <paramref name="SendBuf"/> are sent
+        /// to <see cref="Destinations"/>[0], the next <paramref name="SendCounts"/>[1] entries to
+        /// <see cref="Destinations"/>[1], etc.; <paramref name="RecvBuf"/> is filled the same way, from
+        /// <see cref="Sources"/>.
+        /// </summary>
+        public void Alltoallv(double[] SendBuf, int[] SendCounts, double[] RecvBuf, int[] RecvCounts) {
+            if (SendCounts.Length != m_Destinations.Length)
+                throw new ArgumentException("length mismatch with number of destinations", "SendCounts");
+            if (RecvCounts.Length != m_Sources.Length)
+                throw new ArgumentException("length mismatch with number of sources", "RecvCounts");
+            int[] SendDispl = Displacements(SendCounts);
+            int[] RecvDispl = Displacements(RecvCounts);
+            if (SendDispl[SendCounts.Length] > SendBuf.Length)
+                throw new ArgumentException("send buffer too short", "SendBuf");
+            if (RecvDispl[RecvCounts.Length] > RecvBuf.Length)
+                throw new ArgumentException("receive buffer too short", "RecvBuf");
+
+            // dummies, to avoid null pointers
+            if (SendBuf.Length == 0)
+                SendBuf = new double[1];
+            if (RecvBuf.Length == 0)
+                RecvBuf = new double[1];
+
+            MPI_Datatype dbl = csMPI.Raw._DATATYPE.DOUBLE;
+            unsafe {
+                fixed (double* pSend = SendBuf, pRecv = RecvBuf) {
+                    if (m_HasGraphComm) {
+                        fixed (int* pSendCnt = Padded(SendCounts), pSendDispl = SendDispl, pRecvCnt = Padded(RecvCounts), pRecvDispl = RecvDispl) {
+                            csMPI.Raw.Neighbor_alltoallv(
+                                (IntPtr)pSend, (IntPtr)pSendCnt, (IntPtr)pSendDispl, dbl,
+                                (IntPtr)pRecv, (IntPtr)pRecvCnt, (IntPtr)pRecvDispl, dbl,
+                                m_GraphComm);
+                        }
+                    } else {
+                        // fallback: point-to-point
+                        int NoOfReq = m_Sources.Length + m_Destinations.Length;
+                        MPI_Request[] req = new MPI_Request[NoOfReq];
+                        MPI_Status[] st = new MPI_Status[NoOfReq];
+                        for (int i = 0; i < m_Sources.Length; i++)
+                            csMPI.Raw.Irecv((IntPtr)(pRecv + RecvDispl[i]), RecvCounts[i], dbl, m_Sources[i], FallbackTag, m_ParentComm, out req[i]);
+                        for (int i = 0; i < m_Destinations.Length; i++)
+                            csMPI.Raw.Issend((IntPtr)(pSend + SendDispl[i]), SendCounts[i], dbl, m_Destinations[i], FallbackTag, m_ParentComm, out req[m_Sources.Length + i]);
+                        csMPI.Raw.Waitall(NoOfReq, req, st);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Nonblocking variant of <see cref="Alltoallv(double[], int[], double[], int[])"/> (see <see cref="IMPIdriver.Ineighbor_alltoallv"/>):
+        /// the exchange is started and the buffers remain pinned until it is completed by <see cref="MPIPendingRequest.Wait"/>;
+        /// until then, <paramref name="SendBuf"/> must not be modified and <paramref name="RecvBuf"/> must not be accessed.
+        /// </summary>
+        /// <returns>
+        /// the pending exchange; without MPI-3, it consists of point-to-point messages.
+        /// </returns>
+        public MPIPendingRequest IAlltoallv(double[] SendBuf, int[] SendCounts, double[] RecvBuf, int[] RecvCounts) {
+            if (SendCounts.Length != m_Destinations.Length)
+                throw new ArgumentException("length mismatch with number of destinations", "SendCounts");
+            if (RecvCounts.Length != m_Sources.Length)
+                throw new ArgumentException("length mismatch with number of sources", "RecvCounts");
+            int[] SendDispl = Displacements(SendCounts);
+            int[] RecvDispl = Displacements(RecvCounts);
+            if (SendDispl[SendCounts.Length] > SendBuf.Length)
+                throw new ArgumentException("send buffer too short", "SendBuf");
+            if (RecvDispl[RecvCounts.Length] > RecvBuf.Length)
+                throw new ArgumentException("receive buffer too short", "RecvBuf");
+
+            // dummies, to avoid null pointers
+            if (SendBuf.Length == 0)
+                SendBuf = new double[1];
+            if (RecvBuf.Length == 0)
+                RecvBuf = new double[1];
+
+            MPI_Datatype dbl = csMPI.Raw._DATATYPE.DOUBLE;
+            if (m_HasGraphComm) {
+                var pinned = MPIPendingRequest.Pin(SendBuf, Padded(SendCounts).ToArray(), SendDispl, RecvBuf, Padded(RecvCounts).ToArray(), RecvDispl);
+                MPI_Request req;
+                csMPI.Raw.Ineighbor_alltoallv(
+                    pinned[0].AddrOfPinnedObject(), pinned[1].AddrOfPinnedObject(), pinned[2].AddrOfPinnedObject(), dbl,
+                    pinned[3].AddrOfPinnedObject(), pinned[4].AddrOfPinnedObject(), pinned[5].AddrOfPinnedObject(), dbl,
+                    m_GraphComm, out req);
+                return new MPIPendingRequest(req, pinned);
+            } else {
+                // fallback: point-to-point
+                var pinned = MPIPendingRequest.Pin(SendBuf, RecvBuf);
+                int NoOfReq = m_Sources.Length + m_Destinations.Length;
+                MPI_Request[] req = new MPI_Request[NoOfReq];
+                unsafe {
+                    double* pSend = (double*)pinned[0].AddrOfPinnedObject();
+                    double* pRecv = (double*)pinned[1].AddrOfPinnedObject();
+                    for (int i = 0; i < m_Sources.Length; i++)
+                        csMPI.Raw.Irecv((IntPtr)(pRecv + RecvDispl[i]), RecvCounts[i], dbl, m_Sources[i], FallbackTag, m_ParentComm, out req[i]);
+                    for (int i = 0; i < m_Destinations.Length; i++)
+                        csMPI.Raw.Issend((IntPtr)(pSend + SendDispl[i]), SendCounts[i], dbl, m_Destinations[i], FallbackTag, m_ParentComm, out req[m_Sources.Length + i]);
+                }
+                return new MPIPendingRequest(req, pinned);
+            }
+        }
+
+        /// <summary>
+        /// MPI tag for the point-to-point fallback
+        /// </summary>
+        const int FallbackTag = 4711;
+
+        /// <summary>
+        /// exclusive prefix sum of <paramref name="Counts"/>, with one additional entry for the total
+        /// </summary>
+        static int[] Displacements(int[] Counts) {
+            int[] ret = new int[Counts.Length + 1];
+            for (int i = 0; i < Counts.Length; i++)
+                ret[i + 1] = ret[i] + Counts[i];
+            return ret;
+        }
+
+        /// <summary>
+        /// copy of <paramref name="a"/> with length at least one, to avoid null pointers
+        /// </summary>
+        static int[] Padded(int[] a) {
+            return a.Length > 0 ? a : new int[1];
+        }
+
+        /// <summary>
+        /// frees the graph communicator
+        /// </summary>
+        public void Dispose() {
+            if (m_HasGraphComm) {
+                csMPI.Raw.Comm_free(ref m_GraphComm);
+                m_HasGraphComm = false;
+            }
+        }
+    }
+}
@@ -108,5 +108,11 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         
         [DllImport("HYPRE")]
         static public extern int HYPRE_EuclidSetLevel(T_Solver HYPRE_Solver, int level);
+
+        [DllImport("HYPRE")]
+        static public extern int HYPRE_EuclidSetTriSolve(T_Solver HYPRE_Solver, int tri_solve);
+
+        [DllImport("HYPRE")]
+        static public extern int HYPRE_EuclidSetTriSolveSweeps(T_Solver HYPRE_Solver, int sweeps);
     }
 }
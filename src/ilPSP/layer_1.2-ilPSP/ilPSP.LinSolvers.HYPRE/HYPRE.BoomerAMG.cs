@@ -162,6 +162,34 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE")]
         public static extern int HYPRE_BoomerAMGGetMeasureType(T_Solver solver, out int measure_type);
 
+        /// <summary>
+        /// (Optional) Defines how much of an existing hierarchy is kept when the
+        /// setup is called again with a matrix of the same sparsity pattern.
+        /// </summary>
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_BoomerAMGSetResetupType(T_Solver solver, int resetup_type);
+
+        /// <summary>
+        /// (Optional) Defines how much of an existing hierarchy is kept when the
+        /// setup is called again with a matrix of the same sparsity pattern.
+        /// </summary>
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_BoomerAMGGetResetupType(T_Solver solver, out int resetup_type);
+
+        /// <summary>
+        /// (Optional) Stores the matrix values of the intermediate levels in
+        /// single precision.
+        /// </summary>
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_BoomerAMGSetMixedPrecision(T_Solver solver, int mixed_precision);
+
+        /// <summary>
+        /// (Optional) Stores the matrix values of the intermediate levels in
+        /// single precision.
+        /// </summary>
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_BoomerAMGGetMixedPrecision(T_Solver solver, out int mixed_precision);
+
         /// <summary>
         /// (Optional) Defines the type of cycle
         /// </summary>
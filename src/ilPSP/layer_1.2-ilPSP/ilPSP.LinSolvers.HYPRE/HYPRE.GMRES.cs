@@ -97,6 +97,25 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers
         [DllImport("HYPRE", EntryPoint = "HYPRE_GMRESSetMaxIter")]
         public static extern int SetMaxIterations(T_Solver solver, int num_iterations);
 
+        /// <summary>
+        /// (Optional) Set the orthogonalization of the Krylov basis
+        /// (0: modified Gram-Schmidt, 1: CGS2, 2: classical Gram-Schmidt)
+        /// </summary>
+        /// <param name="solver">Pointer to GMRES solver</param>
+        /// <param name="orth_method">orthogonalization to set</param>
+        /// <returns></returns>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_GMRESSetOrthMethod")]
+        public static extern int SetOrthMethod(T_Solver solver, int orth_method);
+
+        /// <summary>
+        /// Get the orthogonalization of the Krylov basis
+        /// </summary>
+        /// <param name="solver">Pointer to GMRES solver</param>
+        /// <param name="orth_method">placeholder for return value</param>
+        /// <returns></returns>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_GMRESGetOrthMethod")]
+        public static extern int GetOrthMethod(T_Solver solver, out int orth_method);
+
         /// <summary>
         ///  Get minimal number of iteration 
         /// </summary>
@@ -72,6 +72,12 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE", EntryPoint = "HYPRE_PCGSetRelChange")]
         public static extern int SetRelChange(T_Solver solver, int rel_change);
 
+        /// <summary>
+        /// (Optional) Select the CG variant: 0 = standard, 1 = single reduction (Chronopoulos/Gear), 2 = pipelined (Ghysels/Vanroose)
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_PCGSetVariant")]
+        public static extern int SetVariant(T_Solver solver, int variant);
+
         /// <summary>
         /// (Optional) Set the preconditioner to use
         /// </summary>
@@ -132,6 +138,10 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE", EntryPoint = "HYPRE_PCGGetRelChange")]
         public static extern int GetRelChange(T_Solver solver, out int rel_change);
 
+        /// <summary> </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_PCGGetVariant")]
+        public static extern int GetVariant(T_Solver solver, out int variant);
+
         /// <summary> </summary>
         [DllImport("HYPRE", EntryPoint = "HYPRE_PCGGetPrecond")]
         public static extern int GetPrecond(T_Solver solver, out IntPtr precond_data_ptr);
@@ -80,6 +80,20 @@ namespace ilPSP.LinSolvers.HYPRE {
             //    DumpMatrix(M);
         }
 
+        /// <summary>
+        /// Replaces the matrix by <paramref name="M"/>, e.g. for a new Jacobian within a nonlinear iteration;
+        /// if the sparsity pattern is unchanged, only the values of the existing HYPRE matrix are overwritten
+        /// (see <see cref="IJMatrix.UpdateValues"/>), otherwise the matrix is re-created.
+        /// </summary>
+        public void UpdateMatrix(IMutableMatrixEx M) {
+            if (m_Matrix != null && m_Matrix.UpdateValues(M))
+                return;
+
+            if (m_Matrix != null)
+                m_Matrix.Dispose();
+            m_Matrix = new IJMatrix(M);
+        }
+
         /// <summary>
         /// <see cref="ISparseSolverExt.GetMatrix"/>
         /// </summary>
@@ -282,6 +296,8 @@ namespace ilPSP.LinSolvers.HYPRE {
                     Rhs.SetValues<Trhs>(rhs);
 
                     CallSolver(out res.NoOfIterations, out res.Converged, Unknowns, Rhs);
+                    if (Profiling.Enabled)
+                        Profiling.MergeIntoTracer();
 
 
                     // return
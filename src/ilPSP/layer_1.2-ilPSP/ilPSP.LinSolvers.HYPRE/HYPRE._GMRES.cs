@@ -22,6 +22,30 @@ using System.Collections.Generic;
 
 namespace ilPSP.LinSolvers.HYPRE
 {
+    /// <summary>
+    /// orthogonalization of the Krylov basis in the <see cref="GMRES"/> solver
+    /// </summary>
+    public enum GMRESOrthogonalization {
+
+        /// <summary>
+        /// modified Gram-Schmidt; one global reduction per basis vector, i.e. the
+        /// number of reductions per iteration grows with the Krylov dimension
+        /// </summary>
+        ModifiedGramSchmidt = 0,
+
+        /// <summary>
+        /// classical Gram-Schmidt with one reorthogonalization (CGS2); as stable as
+        /// modified Gram-Schmidt, but only two global reductions per iteration
+        /// </summary>
+        CGS2 = 1,
+
+        /// <summary>
+        /// classical Gram-Schmidt; a single global reduction per iteration, may lose
+        /// orthogonality for ill-conditioned problems
+        /// </summary>
+        ClassicalGramSchmidt = 2
+    }
+
     /// <summary>
     ///  GMRES Solver
     /// </summary>
@@ -139,6 +163,22 @@ namespace ilPSP.LinSolvers.HYPRE
             }
         }
 
+        /// <summary>
+        /// (Optional) orthogonalization of the Krylov basis, see <see cref="GMRESOrthogonalization"/>;
+        /// can be set in the XML solver configuration, e.g. <c>&lt;Orthogonalization&gt;CGS2&lt;/Orthogonalization&gt;</c>;
+        /// </summary>
+        public GMRESOrthogonalization Orthogonalization
+        {
+            get {
+                int _OrthMethod;
+                HypreException.Check(Wrappers.GMRES.GetOrthMethod(m_Solver, out _OrthMethod));
+                return (GMRESOrthogonalization)_OrthMethod;
+            }
+            set {
+                HypreException.Check(Wrappers.GMRES.SetOrthMethod(m_Solver, (int)value));
+            }
+        }
+
         /// <summary>
         ///  (Optional) Additionally require that the relative difference in successive iterates be small
         /// </summary>
@@ -22,6 +22,30 @@ using MPI.Wrappers;
 
 
 namespace ilPSP.LinSolvers.HYPRE {
+
+    /// <summary>
+    /// recurrence used by the <see cref="PCG"/> solver
+    /// </summary>
+    public enum PCGVariant {
+
+        /// <summary>
+        /// standard preconditioned CG; two or three separate global reductions per iteration
+        /// </summary>
+        Standard = 0,
+
+        /// <summary>
+        /// Chronopoulos/Gear - CG: all inner products of one iteration are combined in a single global reduction
+        /// </summary>
+        SingleReduction = 1,
+
+        /// <summary>
+        /// pipelined CG (Ghysels/Vanroose): the single reduction is overlapped with the preconditioner and the
+        /// matrix-vector product (non-blocking <c>MPI_Iallreduce</c>); needs more vector updates per
+        /// iteration, but hides the reduction latency on large core counts.
+        /// </summary>
+        Pipelined = 2
+    }
+
     /// <summary>
     /// PCG Solver
     /// </summary>
@@ -74,6 +98,23 @@ namespace ilPSP.LinSolvers.HYPRE {
             }
         }  
 
+        /// <summary>
+        /// selects the CG recurrence, see <see cref="PCGVariant"/>;
+        /// the non-standard variants only support the default convergence test,
+        /// i.e. <see cref="Tolerance"/> and <see cref="TwoNorm"/>;
+        /// can be set in the XML solver configuration, e.g. <c>&lt;Variant&gt;Pipelined&lt;/Variant&gt;</c>;
+        /// </summary>
+        public PCGVariant Variant {
+            set {
+                HypreException.Check(Wrappers.PCG.SetVariant(m_Solver, (int)value));
+            }
+            get {
+                int v;
+                HypreException.Check(Wrappers.PCG.GetVariant(m_Solver, out v));
+                return (PCGVariant)v;
+            }
+        }
+
         ///// <summary>
         ///// sets a <see cref="BoomerAMG"/> solver as preconditioner for this method
         ///// </summary>
@@ -78,6 +78,27 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE", EntryPoint = "HYPRE_IJMatrixAssemble")]
         extern public static int Assemble(T_IJMatrix matrix);
 
+        /// <summary>
+        /// Sets all local rows at once from a CSR structure (row pointers, global column indices, values)
+        /// and assembles the matrix; replaces <see cref="Initialize"/>, <see cref="SetValues"/> and <see cref="Assemble"/>
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_IJMatrixSetLocalCSR")]
+        extern public static int SetLocalCSR(T_IJMatrix matrix, int nrows, int[] row_ptr, int[] cols, double[] values);
+
+        /// <summary>
+        /// checks whether local rows in CSR format have the same sparsity pattern as the assembled matrix
+        /// (<paramref name="match"/> = 1) or not (<paramref name="match"/> = 0)
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_IJMatrixCheckLocalCSRPattern")]
+        extern public static int CheckLocalCSRPattern(T_IJMatrix matrix, int nrows, int[] row_ptr, int[] cols, out int match);
+
+        /// <summary>
+        /// overwrites the values of the assembled matrix from local rows in CSR format with the same sparsity pattern;
+        /// the matrix structure and communication package are kept
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_IJMatrixUpdateLocalCSRValues")]
+        extern public static int UpdateLocalCSRValues(T_IJMatrix matrix, int nrows, int[] row_ptr, int[] cols, double[] values);
+
         /// <summary>
         /// Gets number of nonzeros elements for nrows rows specified in rows and
         /// returns them in ncols, which needs to be allocated by the user
@@ -74,6 +74,13 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE", EntryPoint = "HYPRE_IJVectorSetValues")]
         public static extern int SetValues(T_IJVector vector, int nvalues, int[] indices, double[] values);
 
+        /// <summary>
+        /// Sets values in vector; 
+        /// if <paramref name="indices"/> is null, the first <paramref name="nvalues"/> local entries are set.
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_IJVectorSetValues")]
+        public static extern unsafe int SetValues(T_IJVector vector, int nvalues, int* indices, double* values);
+
         /// <summary>
         /// Adds to values in vector
         /// </summary>
@@ -92,6 +99,13 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         [DllImport("HYPRE", EntryPoint = "HYPRE_IJVectorGetValues")]
         public static extern int GetValues(T_IJVector vector, int nvalues, int[] indices, double[] values);
 
+        /// <summary>
+        /// Gets values in vector;
+        /// if <paramref name="indices"/> is null, the first <paramref name="nvalues"/> local entries are returned.
+        /// </summary>
+        [DllImport("HYPRE", EntryPoint = "HYPRE_IJVectorGetValues")]
+        public static extern unsafe int GetValues(T_IJVector vector, int nvalues, int* indices, double* values);
+
         /// <summary>
         /// Set the storage type of the vector object to be constructed
         /// </summary>
@@ -0,0 +1,94 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Runtime.InteropServices;
+using MPI.Wrappers;
+using ilPSP.Tracing;
+
+namespace ilPSP.LinSolvers.HYPRE {
+
+    /// <summary>
+    /// Hierarchical profiling of the HYPRE library: setup phases, cycle levels, relaxation,
+    /// matrix-vector products and communication wait times are recorded natively as a call tree
+    /// (a few clock reads per region; one branch per region if switched off).
+    /// </summary>
+    public static class Profiling {
+
+        /// <summary>
+        /// switches the recording in the native library on/off;
+        /// if on, each <see cref="Solver"/> merges the recorded regions into the <see cref="Tracer"/> call tree.
+        /// </summary>
+        public static bool Enabled {
+            get {
+                int state;
+                HypreException.Check(Wrappers.Utilities.HYPRE_ProfileGetState(out state));
+                return state != 0;
+            }
+            set {
+                HypreException.Check(Wrappers.Utilities.HYPRE_ProfileSetState(value ? 1 : 0));
+            }
+        }
+
+        /// <summary>
+        /// discards all regions recorded so far
+        /// </summary>
+        public static void Clear() {
+            HypreException.Check(Wrappers.Utilities.HYPRE_ProfileClear());
+        }
+
+        /// <summary>
+        /// Attaches the regions recorded so far below the innermost active <see cref="FuncTrace"/>/<see cref="BlockTrace"/>
+        /// (regions on a multigrid level are named e.g. 'hypre.Relax[2]') and clears the native record.
+        /// </summary>
+        public static void MergeIntoTracer() {
+            if (Tracer.InstrumentationSwitch) {
+                int NoOfNodes;
+                HypreException.Check(Wrappers.Utilities.HYPRE_ProfileGetNumNodes(out NoOfNodes));
+
+                // parents are numbered before their children
+                var Records = new MethodCallRecord[NoOfNodes];
+                for (int i = 0; i < NoOfNodes; i++) {
+                    int parent, tag, count;
+                    IntPtr name;
+                    double seconds;
+                    HypreException.Check(Wrappers.Utilities.HYPRE_ProfileGetNode(i, out parent, out name, out tag, out count, out seconds));
+
+                    string _name = "hypre." + Marshal.PtrToStringAnsi(name);
+                    if (tag >= 0)
+                        _name = _name + "[" + tag + "]";
+
+                    MethodCallRecord owner = parent >= 0 ? Records[parent] : Tracer.CurrentRecord;
+                    Records[i] = owner.AddSubCall(_name, (long)(seconds * TimeSpan.TicksPerSecond), count);
+                }
+            }
+
+            Clear();
+        }
+
+        /// <summary>
+        /// writes the regions recorded on this MPI process to '<paramref name="BaseName"/>.<i>rank</i>.json'
+        /// (or '.bin' in the compact binary format, see HYPRE_ProfilePrint), e.g. for aggregation over all processes.
+        /// </summary>
+        public static void WriteRankFile(string BaseName, bool Binary) {
+            int rank;
+            csMPI.Raw.Comm_Rank(csMPI.Raw._COMM.WORLD, out rank);
+
+            string FileName = BaseName + "." + rank + (Binary ? ".bin" : ".json");
+            HypreException.Check(Wrappers.Utilities.HYPRE_ProfilePrint(FileName, Binary ? 1 : 0));
+        }
+    }
+}
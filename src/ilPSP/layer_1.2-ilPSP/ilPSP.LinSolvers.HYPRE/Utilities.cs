@@ -47,5 +47,27 @@ namespace ilPSP.LinSolvers.HYPRE.Wrappers {
         /* Clears the given error code from the hypre error flag */
         [DllImport("HYPRE")]
         public static extern int HYPRE_ClearError(int hypre_error_code);
+
+        /* Switches the hierarchical profiling of hypre regions on (1) or off (0) */
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfileSetState(int state);
+
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfileGetState(out int state);
+
+        /* Discards the recorded call tree */
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfileClear();
+
+        /* Walks the call tree; parents are numbered before their children */
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfileGetNumNodes(out int num_nodes);
+
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfileGetNode(int node, out int parent, out IntPtr name, out int tag, out int count, out double seconds);
+
+        /* Writes the call tree of this rank to the given file; format 0: JSON, 1: binary */
+        [DllImport("HYPRE")]
+        public static extern int HYPRE_ProfilePrint(string filename, int format);
     }
 }
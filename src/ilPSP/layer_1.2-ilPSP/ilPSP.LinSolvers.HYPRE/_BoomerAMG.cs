@@ -194,6 +194,32 @@ namespace ilPSP.LinSolvers.HYPRE {
         global = 1
     }
     
+    /// <summary>
+    /// Defines what a repeated setup (i.e. solving with a matrix whose values, but not
+    /// its sparsity pattern, have changed since the last call) re-uses from the existing
+    /// AMG hierarchy. If the new matrix does not fit the hierarchy (different size, or
+    /// Galerkin products which leave the stored coarse grid patterns), HYPRE falls back
+    /// to a full setup for the affected part.
+    /// </summary>
+    public enum ResetupTypes
+    {
+        /// <summary>
+        /// full setup on every call (default)
+        /// </summary>
+        Full = 0,
+
+        /// <summary>
+        /// C/F-splitting is kept; interpolation and coarse grid operators are recomputed
+        /// </summary>
+        KeepCoarsening = 1,
+
+        /// <summary>
+        /// C/F-splitting and interpolation are kept; only the coarse grid operators
+        /// (in-place, numeric RAP) and the smoother data are recomputed
+        /// </summary>
+        KeepInterpolation = 2
+    }
+    
     /// <summary>
     /// (Optional) Defines in which order the points are relaxed
     /// 0 - the points are relaxed in natural or lexicographic order on each processor
@@ -357,6 +383,25 @@ namespace ilPSP.LinSolvers.HYPRE {
             }
         } // ok
 
+        /// <summary>
+        /// (Optional) Number of unknowns per node, e.g. the DG modes of one cell.
+        /// For values greater than 1, BoomerAMG runs in nodal block mode, i.e.
+        /// coarsening on the nodes, block interpolation (type 20) and block smoothers,
+        /// which use the block size specialized kernels of the HYPRE library.
+        /// The unknowns of one node must be numbered consecutively.
+        /// </summary>
+        public int NodalBlockSize {
+            set {
+                if (value < 1)
+                    throw new ArgumentOutOfRangeException("block size must be at least 1.");
+                HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGSetNumFunctions(m_Solver, value));
+                if (value > 1) {
+                    HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGSetNodal(m_Solver, 1));
+                    HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGSetInterpType(m_Solver, 20));
+                }
+            }
+        }
+
 
         /// <summary>
         /// (Optional) Defines the smoother at a given cycle.
@@ -582,6 +627,49 @@ namespace ilPSP.LinSolvers.HYPRE {
             }
         } // ok
 
+        /// <summary>
+        /// (Optional) Defines what is re-used from the previous AMG hierarchy, 
+        /// when the solver is called again for a matrix with changed values;
+        /// see <see cref="ResetupTypes"/>.
+        /// </summary>
+        public ResetupTypes ResetupType
+        {
+            set
+            {
+                HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGSetResetupType(m_Solver, (int)value));
+            }
+            get
+            {
+                int resetupType;
+                HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGGetResetupType(m_Solver, out resetupType));
+                return (ResetupTypes)resetupType;
+            }
+        }
+
+        /// <summary>
+        /// (Optional) If true, the coarse grid operators and the interpolation
+        /// (all levels except the finest and the coarsest one) are stored in single
+        /// precision, while vectors and arithmetic stay in double precision;
+        /// this saves memory and bandwidth of the AMG cycle, so it is intended for
+        /// BoomerAMG as preconditioner of a Krylov solver.
+        /// Only supported for the relaxation types 0, 3, 4 and 6; otherwise
+        /// the hierarchy stays in double precision.
+        /// If set after the setup, the existing hierarchy is converted.
+        /// </summary>
+        public bool MixedPrecision
+        {
+            set
+            {
+                HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGSetMixedPrecision(m_Solver, value ? 1 : 0));
+            }
+            get
+            {
+                int mixedPrecision;
+                HypreException.Check(Wrappers.BoomerAMG.HYPRE_BoomerAMGGetMixedPrecision(m_Solver, out mixedPrecision));
+                return (mixedPrecision != 0);
+            }
+        }
+
 
 
         /// <summary>
@@ -21,6 +21,29 @@ using System.Text;
 using MPI.Wrappers;
 
 namespace ilPSP.LinSolvers.HYPRE {
+
+    /// <summary>
+    /// triangular solves used by the <see cref="Euclid"/> preconditioner (sequential and block Jacobi cases)
+    /// </summary>
+    public enum EuclidTriSolve {
+
+        /// <summary>
+        /// sequential forward/backward substitution
+        /// </summary>
+        Sequential = 0,
+
+        /// <summary>
+        /// level-scheduled substitution; the rows of each level are processed in parallel by the OpenMP threads,
+        /// the result is the same as for <see cref="Sequential"/>
+        /// </summary>
+        LevelScheduled = 1,
+
+        /// <summary>
+        /// approximate triangular solves by a fixed number of Jacobi sweeps (see <see cref="Euclid.TriSolveSweeps"/>);
+        /// fully parallel, but the preconditioner is weaker
+        /// </summary>
+        Jacobi = 2
+    }
     
     /// <summary>
     /// Euclid preconditioner;
@@ -188,6 +211,38 @@ namespace ilPSP.LinSolvers.HYPRE {
         }
 
 
+        EuclidTriSolve m_TriSolve = EuclidTriSolve.Sequential;
+
+        /// <summary>
+        /// triangular solves used to apply the factors, see <see cref="EuclidTriSolve"/>; Default: <see cref="EuclidTriSolve.Sequential"/>
+        /// </summary>
+        public EuclidTriSolve TriSolve {
+            get {
+                return m_TriSolve;
+            }
+            set {
+                m_TriSolve = value;
+                HypreException.Check(Wrappers.Euclid.HYPRE_EuclidSetTriSolve(m_Solver, (int)value));
+            }
+        }
+
+        int m_TriSolveSweeps = 3;
+
+        /// <summary>
+        /// number of Jacobi sweeps per triangular solve for <see cref="EuclidTriSolve.Jacobi"/>; Default: 3
+        /// </summary>
+        public int TriSolveSweeps {
+            get {
+                return m_TriSolveSweeps;
+            }
+            set {
+                if (value < 0)
+                    throw new ArgumentOutOfRangeException("must be greater or equal to 0.");
+                m_TriSolveSweeps = value;
+                HypreException.Check(Wrappers.Euclid.HYPRE_EuclidSetTriSolveSweeps(m_Solver, value));
+            }
+        }
+
         /// <summary>
         /// disposal
         /// </summary>
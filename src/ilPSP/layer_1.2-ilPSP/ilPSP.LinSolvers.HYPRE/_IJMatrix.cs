@@ -100,24 +100,41 @@ namespace ilPSP.LinSolvers.HYPRE {
 
             HypreException.Check(Wrappers.IJMatrix.Create(comm, ilower, iupper, jlower, jupper, out m_IJMatrix));
             HypreException.Check(Wrappers.IJMatrix.SetObjectType(m_IJMatrix, Wrappers.Constants.HYPRE_PARCSR));
-            HypreException.Check(Wrappers.IJMatrix.Initialize(m_IJMatrix));
 
-            // matrix: set values, row by row ...
-            int nrows, lmax = mtx.GetMaxNoOfNonZerosPerRow();
-            int[] rows = new int[1], cols = new int[lmax], ncols = new int[1];
-            double[] values = new double[lmax];
+            // matrix: hand the local rows over to HYPRE in one call, which also assembles the matrix
+            int[] rowPtr, cols;
+            double[] values;
+            GetLocalCSR(mtx, out rowPtr, out cols, out values);
+            HypreException.Check(Wrappers.IJMatrix.SetLocalCSR(m_IJMatrix, mtx.RowPartitioning.LocalLength, rowPtr, cols, values));
+            HypreException.Check(Wrappers.IJMatrix.GetObject(m_IJMatrix, out m_ParCSR_matrix));
+        }
+
+        /// <summary>
+        /// collects the local rows of <paramref name="mtx"/> in CSR format (global column indices),
+        /// omitting zero entries; 
+        /// for a BlockMsrMatrix, 'GetRow' is served directly from the block rows.
+        /// </summary>
+        static void GetLocalCSR(IMutableMatrixEx mtx, out int[] rowPtr, out int[] cols, out double[] values) {
+            int L = mtx.RowPartitioning.LocalLength;
+            rowPtr = new int[L + 1];
+            cols = new int[Math.Max(L * Math.Min(mtx.GetMaxNoOfNonZerosPerRow(), 8), 16)];
+            values = new double[cols.Length];
             int LR;
             int[] col = null;
             double[] val = null;
-            for (int i = 0; i < mtx.RowPartitioning.LocalLength; i++) {
+            int cnt = 0;
+            for (int i = 0; i < L; i++) {
 
                 int iRowGlob = i + mtx.RowPartitioning.i0;
                 LR = mtx.GetRow(iRowGlob, ref col, ref val);
-                
-                nrows = 1;
-                rows[0] = iRowGlob;
-                ncols[0] = LR;
-                int cnt = 0;
+
+                if (cnt + LR > cols.Length) {
+                    int newLength = Math.Max(cols.Length * 2, cnt + LR);
+                    Array.Resize(ref cols, newLength);
+                    Array.Resize(ref values, newLength);
+                }
+
+                int cnt0 = cnt;
                 for (int j = 0; j < LR; j++) {
                     if (val[j] != 0.0) {
                         cols[cnt] = col[j];
@@ -125,15 +142,39 @@ namespace ilPSP.LinSolvers.HYPRE {
                         cnt++;
                     }
                 }
-                if (cnt <= 0)
+                if (cnt <= cnt0)
                     throw new ArgumentException(string.Format("Zero matrix row detected (local row index: {0}, global row index: {1}).",i,iRowGlob));
 
-                HypreException.Check(Wrappers.IJMatrix.SetValues(m_IJMatrix, nrows, ncols, rows, cols, values));
+                rowPtr[i + 1] = cnt;
             }
+        }
 
-            // matrix: assembly
-            HypreException.Check(Wrappers.IJMatrix.Assemble(m_IJMatrix));
-            HypreException.Check(Wrappers.IJMatrix.GetObject(m_IJMatrix, out m_ParCSR_matrix));
+        /// <summary>
+        /// Overwrites the values of this matrix with those of <paramref name="mtx"/>, if both have the same 
+        /// partitioning and sparsity pattern (of non-zero entries), on all MPI processes;
+        /// the HYPRE matrix structure and its communication pattern are kept.
+        /// Otherwise, nothing is changed.
+        /// </summary>
+        /// <returns>
+        /// true, if the values have been updated; false, if the sparsity pattern does not match
+        /// and the matrix has to be re-created.
+        /// </returns>
+        public bool UpdateValues(IMutableMatrixEx mtx) {
+            int L = m_RowPartition.LocalLength;
+            int[] rowPtr = null, cols = null;
+            double[] values = null;
+
+            int match = 0;
+            if (mtx.RowPartitioning.EqualsPartition(m_RowPartition) && mtx.ColPartition.EqualsPartition(m_ColPartition)) {
+                GetLocalCSR(mtx, out rowPtr, out cols, out values);
+                HypreException.Check(Wrappers.IJMatrix.CheckLocalCSRPattern(m_IJMatrix, L, rowPtr, cols, out match));
+            }
+            match = match.MPIMin(m_RowPartition.MPI_Comm);
+            if (match == 0)
+                return false;
+
+            HypreException.Check(Wrappers.IJMatrix.UpdateLocalCSRValues(m_IJMatrix, L, rowPtr, cols, values));
+            return true;
         }
 
         /// <summary>
@@ -112,6 +112,24 @@ namespace ilPSP.LinSolvers.HYPRE {
             int Nupdate = m_VectorPartition.LocalLength;
             int i0 = (int)m_VectorPartition.i0;
 
+            if (vec.Count < Nupdate)
+                throw new ArgumentException("vector is too short.");
+
+            unsafe {
+                // contiguous storage: hand the whole local part to HYPRE in one call,
+                // without intermediate buffers
+                if (vec is UnmanagedVector) {
+                    HypreException.Check(Wrappers.IJVector.SetValues(m_IJVector, Nupdate, null, (vec as UnmanagedVector).Pointer));
+                    return;
+                }
+                if (vec is double[]) {
+                    fixed (double* pVec = (vec as double[])) {
+                        HypreException.Check(Wrappers.IJVector.SetValues(m_IJVector, Nupdate, null, pVec));
+                    }
+                    return;
+                }
+            }
+
             int nvalues = Math.Min(1024, Nupdate);
             int[] indices = new int[nvalues];
             double[] values = new double[nvalues];
@@ -139,6 +157,24 @@ namespace ilPSP.LinSolvers.HYPRE {
             where vectype : IList<double> {
             int Nupdate = m_VectorPartition.LocalLength;
             int i0 = (int)m_VectorPartition.i0;
+
+            if (vec.Count < Nupdate)
+                throw new ArgumentException("vector is too short.");
+
+            unsafe {
+                // contiguous storage: read the whole local part in one call,
+                // without intermediate buffers
+                if (vec is UnmanagedVector) {
+                    HypreException.Check(Wrappers.IJVector.GetValues(m_IJVector, Nupdate, null, (vec as UnmanagedVector).Pointer));
+                    return;
+                }
+                if (vec is double[]) {
+                    fixed (double* pVec = (vec as double[])) {
+                        HypreException.Check(Wrappers.IJVector.GetValues(m_IJVector, Nupdate, null, pVec));
+                    }
+                    return;
+                }
+            }
             
             int nvalues = Math.Min(1024, Nupdate);
             int[] indices = new int[nvalues];
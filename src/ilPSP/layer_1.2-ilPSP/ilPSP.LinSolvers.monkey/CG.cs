@@ -304,12 +304,7 @@ namespace ilPSP.LinSolvers.monkey {
                 m_Matrix.SpMV_Expert(1.0, commP, 0, V);
                 double lambda = alpha / V.InnerProd(P);
 
-
-                x.Acc(lambda, P);
-                
-                R.Acc(-lambda, V);
-                
-                double alpha_neu = R.TwoNormSquare();
+                double alpha_neu = R.AccAndNorm(-lambda, V);        // R = R - lambda*V, alpha_neu = |R|^2
 
                 // compute residual norm
                 if (m_ConvergenceType == ConvergenceTypes.Absolute)
@@ -317,9 +312,7 @@ namespace ilPSP.LinSolvers.monkey {
                 else
                     ResNorm = Math.Sqrt(alpha/alpha_0);
 
-                
-                P.Scale(alpha_neu / alpha);
-                P.Acc(1.0, R);
+                P.XpayAxpy(alpha_neu / alpha, R, lambda, x);        // x = x + lambda*P, P = R + (alpha_neu/alpha)*P
                                 
                 alpha = alpha_neu;
                 stats.NoOfIterations++;
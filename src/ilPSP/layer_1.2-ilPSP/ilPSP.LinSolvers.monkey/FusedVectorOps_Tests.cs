@@ -0,0 +1,138 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using NUnit.Framework;
+using ilPSP.LinSolvers.monkey.CPU;
+using ilPSP.LinSolvers.monkey.mtCPU;
+
+namespace ilPSP.LinSolvers.monkey {
+
+    /// <summary>
+    /// The fused vector operations (<see cref="VectorBase.AccAndNorm"/>, <see cref="VectorBase.XpayAxpy"/>)
+    /// of the CPU devices must give bitwise the same results as the sequence of primitive operations they replace,
+    /// so that the CG/PCG iterates do not change.
+    /// </summary>
+    [TestFixture]
+    public class FusedVectorOps_Tests {
+
+        /// <summary>
+        /// for direct execution...
+        /// </summary>
+        public static void Main() {
+            var t = new FusedVectorOps_Tests();
+            t.Init();
+            t.AccAndNormTest();
+            t.XpayAxpyTest();
+            t.Cleanup();
+        }
+
+        /// <summary>
+        /// MPI init
+        /// </summary>
+        [TestFixtureSetUp]
+        public void Init() {
+            bool dummy;
+            ilPSP.Environment.Bootstrap(new string[0], null, out dummy);
+        }
+
+        /// <summary>
+        /// MPI teardown
+        /// </summary>
+        [TestFixtureTearDown]
+        public void Cleanup() {
+            MPI.Wrappers.csMPI.Raw.mpiFinalize();
+        }
+
+        /// <summary>
+        /// length of the test vectors; not a multiple of the thread count or any chunk size
+        /// </summary>
+        const int L = 10007;
+
+        static double[] Values(int seed) {
+            double[] v = new double[L];
+            for (int i = 0; i < L; i++)
+                v[i] = Math.Sin(seed * 7.1 + i * 0.37) * (1.0 + (i % 13));
+            return v;
+        }
+
+        static Device[] Devices {
+            get {
+                return new Device[] { new ReferenceDevice(), new MtDevice() };
+            }
+        }
+
+        static VectorBase Create(Device dev, Partitioning part, double[] vals) {
+            bool shallow;
+            VectorBase v = dev.CreateVector(part, (double[])vals.Clone(), out shallow);
+            v.Lock();
+            return v;
+        }
+
+        static double[] Values(VectorBase v) {
+            v.Unlock();
+            double[] r = new double[v.Part.LocalLength];
+            v.CopyTo(r, 0);
+            return r;
+        }
+
+        /// <summary>
+        /// <see cref="VectorBase.AccAndNorm"/> vs. <see cref="VectorBase.Acc"/> and <see cref="VectorBase.TwoNormSquare"/>
+        /// </summary>
+        [Test]
+        public void AccAndNormTest() {
+            Partitioning part = new Partitioning(L);
+            foreach (Device dev in Devices) {
+                VectorBase R1 = Create(dev, part, Values(1)), R2 = Create(dev, part, Values(1));
+                VectorBase V = Create(dev, part, Values(2));
+                double lambda = -0.8372;
+
+                double RRfused = R1.AccAndNorm(lambda, V);
+
+                R2.Acc(lambda, V);
+                double RR = R2.TwoNormSquare();
+
+                Assert.AreEqual(RR, RRfused, 0.0, dev.GetType().Name + ": norm");
+                Assert.AreEqual(Values(R2), Values(R1), dev.GetType().Name + ": vector");
+                V.Unlock();
+            }
+        }
+
+        /// <summary>
+        /// <see cref="VectorBase.XpayAxpy"/> vs. <see cref="VectorBase.Acc"/> and <see cref="VectorBase.Scale"/>
+        /// </summary>
+        [Test]
+        public void XpayAxpyTest() {
+            Partitioning part = new Partitioning(L);
+            foreach (Device dev in Devices) {
+                VectorBase P1 = Create(dev, part, Values(3)), P2 = Create(dev, part, Values(3));
+                VectorBase x1 = Create(dev, part, Values(4)), x2 = Create(dev, part, Values(4));
+                VectorBase Z = Create(dev, part, Values(5));
+                double beta = 0.61803, lambda = 1.2345;
+
+                P1.XpayAxpy(beta, Z, lambda, x1);
+
+                x2.Acc(lambda, P2);
+                P2.Scale(beta);
+                P2.Acc(1.0, Z);
+
+                Assert.AreEqual(Values(x2), Values(x1), dev.GetType().Name + ": x");
+                Assert.AreEqual(Values(P2), Values(P1), dev.GetType().Name + ": P");
+                Z.Unlock();
+            }
+        }
+    }
+}
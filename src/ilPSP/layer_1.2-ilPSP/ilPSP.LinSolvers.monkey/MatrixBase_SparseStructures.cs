@@ -1325,5 +1325,218 @@ namespace ilPSP.LinSolvers.monkey {
                 UsedLen = i;
             }
         }
+
+
+        /// <summary>
+        /// Sliced ELLPACK with local row sorting (aka. SELL-C-sigma):
+        /// the rows are grouped into slices of <see cref="SliceHeight"/> rows, each slice is stored
+        /// in ELLPACK (i.e. column-major) fashion, padded to the length of its longest row;
+        /// to reduce padding, the rows are sorted by descending length within windows of
+        /// <see cref="SortingScope"/> rows.
+        /// </summary>
+        /// <remarks>
+        /// Index computation: the <em>j</em>-th packed entry of the packed row <em>k</em>
+        /// is at <see cref="SliceStart"/>[k/C] + j*C + (k%C), with C=<see cref="SliceHeight"/>;
+        /// the packed row <em>k</em> corresponds with original row <see cref="Perm"/>[k].
+        /// </remarks>
+        public class SELLCS : FormatBase {
+
+            /// <summary>
+            /// ctor
+            /// </summary>
+            /// <param name="_csr">source data</param>
+            /// <param name="_SliceHeight">
+            /// number of rows per slice, (C); should be a multiple of the SIMD width
+            /// </param>
+            /// <param name="_SortingScope">
+            /// size of the sorting window (sigma), must be a multiple of <paramref name="_SliceHeight"/>
+            /// </param>
+            public SELLCS(TempCSR _csr, int _SliceHeight, int _SortingScope)
+                : base(_csr) {
+                if (_SliceHeight < 1)
+                    throw new ArgumentException("slice height must be at least 1.", "_SliceHeight");
+                if (_SortingScope < _SliceHeight || _SortingScope % _SliceHeight != 0)
+                    throw new ArgumentException("sorting scope must be a multiple of the slice height.", "_SortingScope");
+
+                SliceHeight = _SliceHeight;
+                SortingScope = _SortingScope;
+                NoOfRows = csr.NoOfRows;
+                NoOfSlices = (NoOfRows + SliceHeight - 1) / SliceHeight;
+                int C = SliceHeight;
+
+                // row lengths and sorting within the sigma-windows
+                // ================================================
+                RowLength = new int[NoOfRows];
+                for (int i = 0; i < NoOfRows; i++)
+                    RowLength[i] = csr.RowStart[i + 1] - csr.RowStart[i];
+
+                Perm = new int[NoOfRows];
+                for (int i = 0; i < NoOfRows; i++)
+                    Perm[i] = i;
+                int[] SortKeys = new int[NoOfRows];
+                for (int i = 0; i < NoOfRows; i++)
+                    SortKeys[i] = -RowLength[i]; // descending
+                for (int w0 = 0; w0 < NoOfRows; w0 += SortingScope)
+                    Array.Sort(SortKeys, Perm, w0, Math.Min(SortingScope, NoOfRows - w0));
+
+                InvPerm = new int[NoOfRows];
+                for (int k = 0; k < NoOfRows; k++)
+                    InvPerm[Perm[k]] = k;
+
+                // slice layout
+                // ============
+                SliceStart = new int[NoOfSlices + 1];
+                int Cnt = 0;
+                for (int s = 0; s < NoOfSlices; s++) {
+                    SliceStart[s] = Cnt;
+                    int Width = 0;
+                    for (int k = s * C; k < Math.Min((s + 1) * C, NoOfRows); k++)
+                        Width = Math.Max(Width, RowLength[Perm[k]]);
+                    Cnt += Width * C;
+                }
+                SliceStart[NoOfSlices] = Cnt;
+
+                // pack matrix
+                // ===========
+                Val = new double[Cnt];
+                ColInd = new int[Cnt];
+                for (int s = 0; s < NoOfSlices; s++) {
+                    int Width = (SliceStart[s + 1] - SliceStart[s]) / C;
+                    if (Width <= 0)
+                        continue;
+
+                    // column index for padding entries of empty rows: any column that is used in this slice
+                    // (the first row of a slice is the longest one, so it is non-empty)
+                    int FillCol = csr.ColInd[csr.RowStart[Perm[s * C]]];
+
+                    for (int r = 0; r < C; r++) {
+                        int k = s * C + r;
+                        int iRow = k < NoOfRows ? Perm[k] : -1;
+                        int c0 = iRow >= 0 ? csr.RowStart[iRow] : 0;
+                        int L = iRow >= 0 ? RowLength[iRow] : 0;
+                        int RowFillCol = L > 0 ? csr.ColInd[c0] : FillCol;
+
+                        for (int j = 0; j < Width; j++) {
+                            int iii = SliceStart[s] + j * C + r;
+                            if (j < L) {
+                                Val[iii] = csr.Vals[c0 + j];
+                                ColInd[iii] = csr.ColInd[c0 + j];
+                            } else {
+                                Val[iii] = 0.0;
+                                ColInd[iii] = RowFillCol;
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// <summary>
+            /// number of rows per slice (C)
+            /// </summary>
+            public int SliceHeight;
+
+            /// <summary>
+            /// size of the window within which rows are sorted by length (sigma)
+            /// </summary>
+            public int SortingScope;
+
+            /// <summary>
+            /// local number of rows in the matrix
+            /// </summary>
+            public int NoOfRows;
+
+            /// <summary>
+            /// number of slices
+            /// </summary>
+            public int NoOfSlices;
+
+            /// <summary>
+            /// index: slice index <em>s</em>; <br/>
+            /// content: index into <see cref="FormatBase.Val"/> and <see cref="ColInd"/> at which slice <em>s</em> starts.
+            /// </summary>
+            public int[] SliceStart;
+
+            /// <summary>
+            /// index: packed row index; <br/>
+            /// content: original (local) row index
+            /// </summary>
+            public int[] Perm;
+
+            /// <summary>
+            /// inverse of <see cref="Perm"/>
+            /// </summary>
+            public int[] InvPerm;
+
+            /// <summary>
+            /// number of (non-padding) entries in each (original) row
+            /// </summary>
+            public int[] RowLength;
+
+            /// <summary>
+            /// local column indices
+            /// </summary>
+            public int[] ColInd;
+
+            /// <summary>
+            /// see <see cref="FormatBase.RefSpMv"/>
+            /// </summary>
+            public override void RefSpMv(double alpha, double[] x, double beta, double[] y) {
+                if (y.Length != NoOfRows)
+                    throw new ArgumentException("wrong length", "y");
+
+                int C = SliceHeight;
+                for (int k = 0; k < NoOfRows; k++) {
+                    int s = k / C;
+                    int Width = (SliceStart[s + 1] - SliceStart[s]) / C;
+                    int iii = SliceStart[s] + (k % C);
+
+                    double acc = 0;
+                    for (int j = 0; j < Width; j++) {
+                        acc += Val[iii] * x[ColInd[iii]];
+                        iii += C;
+                    }
+
+                    int iRow = Perm[k];
+                    y[iRow] = y[iRow] * beta + acc * alpha;
+                }
+            }
+
+            /// <summary>
+            /// see <see cref="FormatBase.GetEntryIndex"/>
+            /// </summary>
+            public override int GetEntryIndex(int row, int col) {
+                int k = InvPerm[row];
+                int C = SliceHeight;
+                int iii = SliceStart[k / C] + (k % C);
+                int L = RowLength[row];
+                for (int j = 0; j < L; j++) {
+                    if (ColInd[iii] == col)
+                        return iii;
+                    iii += C;
+                }
+                return int.MinValue;
+            }
+
+            /// <summary>
+            /// see <see cref="FormatBase.GetAllOccupiedColumns"/>; padding entries are not reported.
+            /// </summary>
+            public override void GetAllOccupiedColumns(int row, ref int[] Out_MtxColIndices, ref int[] Out_PointersIntoVal, ref double[] Out_Values, out int UsedLen) {
+                int L = RowLength[row];
+                UsedLen = L;
+                if (Out_MtxColIndices == null || Out_MtxColIndices.Length < L) { Out_MtxColIndices = new int[L]; }
+                if (Out_PointersIntoVal == null || Out_PointersIntoVal.Length < L) { Out_PointersIntoVal = new int[L]; }
+                if (Out_Values == null || Out_Values.Length < L) { Out_Values = new double[L]; };
+
+                int k = InvPerm[row];
+                int C = SliceHeight;
+                int iii = SliceStart[k / C] + (k % C);
+                for (int j = 0; j < L; j++) {
+                    Out_PointersIntoVal[j] = iii;
+                    Out_MtxColIndices[j] = ColInd[iii];
+                    Out_Values[j] = Val[iii];
+                    iii += C;
+                }
+            }
+        }
     }
 }
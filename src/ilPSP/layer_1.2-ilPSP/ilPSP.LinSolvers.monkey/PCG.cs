@@ -139,9 +139,11 @@ namespace ilPSP.LinSolvers.monkey {
                 m_Matrix.SpMV_Expert(1.0, commP, 0, V);
                 double lambda = alpha / V.InnerProd(P);
 
-                x.Acc(lambda, P);
+                // the update of x is fused with the update of P (see below), unless the callback needs it now
+                if (m_IterationCallback != null)
+                    x.Acc(lambda, P);
                 
-                R.Acc(-lambda, V);
+                double RR = R.AccAndNorm(-lambda, V);               // R = R - lambda*V, RR = |R|^2
 
                 if (m_IterationCallback != null) {
                     // pass approx. sol and residual to callback function
@@ -163,24 +165,29 @@ namespace ilPSP.LinSolvers.monkey {
 
                 }
 
+                // without preconditioner, Z = R
+                VectorBase Zn = R;
+                double alpha_neu = RR;
                 if (m_NestedPrecond != null) {
                     Z.Clear();
                     m_NestedPrecond.DoPrecond();
-                } else {
-                    Z.CopyFrom(R);
+                    Zn = Z;
+                    alpha_neu = R.InnerProd(Z);
                 }
-
-                double alpha_neu = R.InnerProd(Z);
                 
                 // compute residual norm
                 if (m_ConvergenceType == ConvergenceTypes.Absolute)
                     ResNorm = Math.Sqrt(alpha);
                 else
                     ResNorm = Math.Sqrt(alpha/alpha_0);
-                ResNorm = Math.Sqrt(R.TwoNormSquare());
+                ResNorm = Math.Sqrt(RR);
                 
-                P.Scale(alpha_neu / alpha);
-                P.Acc(1.0, Z);
+                if (m_IterationCallback != null) {
+                    P.Scale(alpha_neu / alpha);
+                    P.Acc(1.0, Zn);
+                } else {
+                    P.XpayAxpy(alpha_neu / alpha, Zn, lambda, x);   // x = x + lambda*P, P = Zn + (alpha_neu/alpha)*P
+                }
                                 
                 alpha = alpha_neu;
                 stats.NoOfIterations++;
@@ -277,6 +277,62 @@ namespace ilPSP.LinSolvers.monkey.CPU {
             return ddotGlob;
         }
 
+        /// <summary>
+        /// this = this + <paramref name="alpha"/>*<paramref name="other"/>, returns the square of the two-norm of the result;
+        /// see <see cref="VectorBase.AccAndNorm"/>.
+        /// </summary>
+        public override double AccAndNorm(double alpha, VectorBase other) {
+            if (!m_IsLocked)
+                throw new ApplicationException("works only in locked mode.");
+            if (!other.IsLocked)
+                throw new ArgumentException("other object must be locked.", "other");
+            int N = this.m_Part.LocalLength;
+            if (other.Part.LocalLength != N)
+                throw new ArgumentException("mismatch in vector size.");
+
+            double NormLocPow2;
+            unsafe {
+                double* p_tis = this.m_StorageAddr, p_oda = (other as RefVector).m_StorageAddr;
+                NormLocPow2 = 0;
+                for (int i = 0; i < N; i++) {
+                    double r = p_tis[i] + alpha * p_oda[i];
+                    p_tis[i] = r;
+                    NormLocPow2 += r * r;
+                }
+            }
+
+            unsafe {
+                double NormglobPow2 = double.NaN;
+                csMPI.Raw.Allreduce((IntPtr)(&NormLocPow2), (IntPtr)(&NormglobPow2), 1, csMPI.Raw._DATATYPE.DOUBLE, csMPI.Raw._OP.SUM, csMPI.Raw._COMM.WORLD);
+                return NormglobPow2;
+            }
+        }
+
+        /// <summary>
+        /// <paramref name="x"/> = <paramref name="x"/> + <paramref name="lambda"/>*this, this = <paramref name="other"/> + <paramref name="beta"/>*this;
+        /// see <see cref="VectorBase.XpayAxpy"/>.
+        /// </summary>
+        public override void XpayAxpy(double beta, VectorBase other, double lambda, VectorBase x) {
+            if (!m_IsLocked)
+                throw new ApplicationException("works only in locked mode.");
+            if (!other.IsLocked)
+                throw new ArgumentException("other object must be locked.", "other");
+            if (!x.IsLocked)
+                throw new ArgumentException("other object must be locked.", "x");
+            int N = this.m_Part.LocalLength;
+            if (other.Part.LocalLength != N || x.Part.LocalLength != N)
+                throw new ArgumentException("mismatch in vector size.");
+
+            unsafe {
+                double* p_tis = this.m_StorageAddr, p_oda = (other as RefVector).m_StorageAddr, p_x = (x as RefVector).m_StorageAddr;
+                for (int i = 0; i < N; i++) {
+                    double p = p_tis[i];
+                    p_x[i] += lambda * p;
+                    p_tis[i] = p_oda[i] + beta * p;
+                }
+            }
+        }
+
         /// <summary>
         /// copies the content of <paramref name="other"/> to this vector.
         /// </summary>
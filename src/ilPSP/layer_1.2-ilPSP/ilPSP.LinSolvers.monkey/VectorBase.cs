@@ -292,6 +292,43 @@ namespace ilPSP.LinSolvers.monkey {
         /// </remarks>
         abstract public double InnerProd(VectorBase other);
 
+        /// <summary>
+        /// this = this + <paramref name="alpha"/>*<paramref name="other"/>, and 
+        /// returns the square of the two-norm of the result;
+        /// i.e. <see cref="Acc"/> and <see cref="TwoNormSquare"/> fused into one sweep over the vectors.
+        /// </summary>
+        /// <returns>
+        /// the square of the two-norm of this vector, after the update
+        /// </returns>
+        /// <remarks>
+        /// this is a MPI-collective operation;
+        /// works only in locked mode;
+        /// the default implementation calls <see cref="Acc"/> and <see cref="TwoNormSquare"/>,
+        /// devices override it with a fused kernel.
+        /// </remarks>
+        virtual public double AccAndNorm(double alpha, VectorBase other) {
+            Acc(alpha, other);
+            return TwoNormSquare();
+        }
+
+        /// <summary>
+        /// For each <em>j</em>, <br/>
+        /// <paramref name="x"/>[j] = <paramref name="x"/>[j] + <paramref name="lambda"/>*this[j],<br/>
+        /// this[j] = <paramref name="other"/>[j] + <paramref name="beta"/>*this[j],<br/>
+        /// i.e. the update of solution and search direction at the end of a CG iteration, 
+        /// in one sweep over the vectors.
+        /// </summary>
+        /// <remarks>
+        /// works only in locked mode;
+        /// the default implementation calls <see cref="Acc"/> and <see cref="Scale"/>,
+        /// devices override it with a fused kernel.
+        /// </remarks>
+        virtual public void XpayAxpy(double beta, VectorBase other, double lambda, VectorBase x) {
+            x.Acc(lambda, this);
+            Scale(beta);
+            Acc(1.0, other);
+        }
+
         /// <summary>
         /// initilizes this vector to be a copy of <paramref name="other"/>
         /// </summary>
@@ -27,7 +27,7 @@ namespace ilPSP.LinSolvers.monkey.CL
     /// </summary>
     public class clVector : VectorBase
     {
-        private cl_kernel clscale, clacc, clmew, cldnrm2, clinnerprod;
+        private cl_kernel clscale, clacc, clmew, cldnrm2, clinnerprod, claccnrm2, clxpayaxpy;
         private clDevice device;
 
         private int size;
@@ -83,6 +83,8 @@ namespace ilPSP.LinSolvers.monkey.CL
             cl.ReleaseKernel(clmew);
             cl.ReleaseKernel(cldnrm2);
             cl.ReleaseKernel(clinnerprod);
+            cl.ReleaseKernel(claccnrm2);
+            cl.ReleaseKernel(clxpayaxpy);
         }
 
         private void init(IPartitioning p, cl_program program)
@@ -92,6 +94,8 @@ namespace ilPSP.LinSolvers.monkey.CL
             clmew = cl.CreateKernel(program, "mew");
             cldnrm2 = cl.CreateKernel(program, "dnrm2");
             clinnerprod = cl.CreateKernel(program, "innerprod");
+            claccnrm2 = cl.CreateKernel(program, "accnrm2");
+            clxpayaxpy = cl.CreateKernel(program, "xpayaxpy");
 
             size = p.LocalLength;
             globalsize = size;
@@ -380,6 +384,102 @@ namespace ilPSP.LinSolvers.monkey.CL
             return InnerProdGlobal;
         }
 
+        /// <summary>
+        /// Accumulate vector element-wise with other vector scaled by alpha and get the squared length of the result
+        /// </summary>
+        /// <param name="alpha">Scaling for other</param>
+        /// <param name="other">Other vector</param>
+        /// <returns>Returns the squared length</returns>
+        public override double AccAndNorm(double alpha, VectorBase other)
+        {
+            if (!this.IsLocked || !other.IsLocked)
+                throw new ApplicationException("works only in locked mode");
+
+            clVector _other = other as clVector;
+            if (_other == null)
+                throw new ArgumentException("other must be of type clVector.", "other");
+
+            if (_other.Part.LocalLength != this.Part.LocalLength)
+                throw new ArgumentException("mismatch in vector size.");
+
+            cl.SetKernelArg(claccnrm2, 0, d_data);
+            cl.SetKernelArg(claccnrm2, 1, _other.GetDevicePointer());
+            cl.SetKernelArg(claccnrm2, 2, alpha);
+            cl.SetKernelArg(claccnrm2, 3, d_result);
+            cl.SetKernelArgLocalSize(claccnrm2, 4, (uint)localsize * sizeof(double));
+            cl.SetKernelArg(claccnrm2, 5, size);
+
+            int[] global = { globalsizehalf };
+            int[] local = { localsize };
+            cl.EnqueueNDRangeKernel(device.cq, claccnrm2, 1, global, local);
+
+            return SumOfGroupResults();
+        }
+
+        /// <summary>
+        /// x = x + lambda*this, this = other + beta*this
+        /// </summary>
+        /// <param name="beta">Scaling for this</param>
+        /// <param name="other">Other vector</param>
+        /// <param name="lambda">Scaling for this, when accumulated to x</param>
+        /// <param name="x">Vector to accumulate to</param>
+        public override void XpayAxpy(double beta, VectorBase other, double lambda, VectorBase x)
+        {
+            if (!this.IsLocked || !other.IsLocked || !x.IsLocked)
+                throw new ApplicationException("works only in locked mode");
+
+            clVector _other = other as clVector;
+            if (_other == null)
+                throw new ArgumentException("other must be of type clVector.", "other");
+            clVector _x = x as clVector;
+            if (_x == null)
+                throw new ArgumentException("x must be of type clVector.", "x");
+
+            if (_other.Part.LocalLength != this.Part.LocalLength || _x.Part.LocalLength != this.Part.LocalLength)
+                throw new ArgumentException("mismatch in vector size.");
+
+            cl.SetKernelArg(clxpayaxpy, 0, d_data);
+            cl.SetKernelArg(clxpayaxpy, 1, _other.GetDevicePointer());
+            cl.SetKernelArg(clxpayaxpy, 2, beta);
+            cl.SetKernelArg(clxpayaxpy, 3, _x.GetDevicePointer());
+            cl.SetKernelArg(clxpayaxpy, 4, lambda);
+            cl.SetKernelArg(clxpayaxpy, 5, size);
+
+            int[] global = { globalsize };
+            int[] local = { localsize };
+            cl.EnqueueNDRangeKernel(device.cq, clxpayaxpy, 1, global, local);
+        }
+
+        /// <summary>
+        /// Sums up the per-group results of a reduction kernel, over all groups and all MPI processes
+        /// </summary>
+        private double SumOfGroupResults()
+        {
+            double SumLocal = 0.0;
+
+            IntPtr h_result;
+            cl.EnqueueMapBuffer(device.cq, d_result, out h_result, true, cl_map_flags.CL_MAP_READ, 0, (uint)groups * sizeof(double));
+
+            unsafe
+            {
+                double* ptr = (double*)h_result;
+                for (int i = 0; i < groups; i++)
+                {
+                    SumLocal += ptr[i];
+                }
+            }
+
+            cl.EnqueueUnmapMemObject(device.cq, d_result, h_result);
+
+            double SumGlobal = double.NaN;
+            unsafe
+            {
+                csMPI.Raw.Allreduce((IntPtr)(&SumLocal), (IntPtr)(&SumGlobal), 1, csMPI.Raw._DATATYPE.DOUBLE, csMPI.Raw._OP.SUM, csMPI.Raw._COMM.WORLD);
+            }
+
+            return SumGlobal;
+        }
+
         /// <summary>
         /// Copy content from other vector
         /// </summary>
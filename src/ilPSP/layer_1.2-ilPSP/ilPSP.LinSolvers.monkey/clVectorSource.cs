@@ -93,6 +93,46 @@ namespace ilPSP.LinSolvers.monkey.CL
             "   }\n",
             "}\n",
 
+            "__kernel void accnrm2(__global double* x, __global double* y, double alpha, __global double* result, __local double* sdata, int size) {\n",
+            "   int idx = get_global_id(0);\n",
+            "   int tid = get_local_id(0);\n",
+
+            "   double value;\n",
+            "   sdata[tid] = 0.0;\n",
+            "   if(idx < size) {\n",
+            "       value = x[idx] + y[idx] * alpha;\n",
+            "       x[idx] = value;\n",
+            "       sdata[tid] = value * value;\n",
+            "   }\n",
+            "   idx += get_global_size(0);\n",
+            "   if(idx < size) {\n",
+            "       value = x[idx] + y[idx] * alpha;\n",
+            "       x[idx] = value;\n",
+            "       sdata[tid] += value * value;\n",
+            "   }\n",
+            "   barrier(CLK_LOCAL_MEM_FENCE);\n",
+
+            "   for(int s = get_local_size(0) / 2; s > 0; s >>= 1) {\n",
+            "       if(tid < s) {\n",
+            "           sdata[tid] += sdata[tid + s];\n",
+            "       }\n",
+            "       barrier(CLK_LOCAL_MEM_FENCE);\n",
+            "   }\n",
+
+            "   if(tid == 0) {\n",
+            "       result[get_group_id(0)] = sdata[0];\n",
+            "   }\n",
+            "}\n",
+
+            "__kernel void xpayaxpy(__global double* p, __global double* r, double beta, __global double* x, double lambda, int size) {\n",
+            "   int idx = get_global_id(0);\n",
+            "   if(idx < size) {\n",
+            "       double value = p[idx];\n",
+            "       x[idx] += value * lambda;\n",
+            "       p[idx] = r[idx] + value * beta;\n",
+            "   }\n",
+            "}\n",
+
             "__kernel void fillSendBuffer(__global double* sendBuffer, __global int* indices, __global double* data, int size) {\n",
             "   int idx = get_global_id(0);\n",
             "   if(idx < size) {\n",
@@ -52,7 +52,7 @@ namespace ilPSP.LinSolvers.monkey {
     }
 
     /// <summary>
-    /// Data structure of matrix, only used with CUDA
+    /// Data structure of matrix, used with CUDA, OpenCL and the multi-threaded CPU device
     /// </summary>
     public enum MatrixType {
         /// <summary>
@@ -82,7 +82,13 @@ namespace ilPSP.LinSolvers.monkey {
         /// <summary>
         /// ELLPACK with manual caching - ususally best (see <see cref="MatrixBase.ManualCacheELLPACK"/>)
         /// </summary>
-        ELLPACKcache
+        ELLPACKcache,
+
+        /// <summary>
+        /// sliced ELLPACK with row sorting (see <see cref="MatrixBase.SELLCS"/>), 
+        /// currently only supported by <see cref="mtCPU.MtDevice"/>
+        /// </summary>
+        SELLCS
     }
 
     
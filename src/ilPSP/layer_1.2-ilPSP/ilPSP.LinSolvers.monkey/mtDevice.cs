@@ -40,13 +40,22 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// see <see cref="Device.CreateMatrix(MsrMatrix,MatrixType)"/>;
         /// </summary>
         public override MatrixBase CreateMatrix(MsrMatrix M, MatrixType matType) {
-            return new MtMatrix(M);
+            return new MtMatrix(M, matType);
         }
 
         /// <summary>
         /// see <see cref="Device.CreateVector{T}(IPartitioning,T,out bool)"/>;
         /// </summary>
         public override VectorBase CreateVector<T>(IPartitioning p, T content, out bool shallowInit) {
+            if (content is UnmanagedVector) {
+                // caller-owned memory: operate on it directly
+                if (content.Count < p.LocalLength)
+                    throw new ArgumentException("vector content must match local length of partition", "content");
+                shallowInit = true;
+                unsafe {
+                    return new MtVector(p, (content as UnmanagedVector).Pointer);
+                }
+            }
             double[] vals = null;
             if (typeof(T).Equals(typeof(double[]))) {
                 shallowInit = true;
@@ -30,13 +30,166 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
     public class MtMatrix : MatrixBase {
 
         /// <summary>
-        /// constructor
+        /// constructor, with automatic selection of the storage format
         /// </summary>
         /// <param name="M"></param>
         public MtMatrix(MsrMatrix M)
+            : this(M, MatrixType.Auto) {
+        }
+
+        /// <summary>
+        /// constructor
+        /// </summary>
+        /// <param name="M"></param>
+        /// <param name="matType">
+        /// storage format of the local part of the matrix; 
+        /// formats other than <see cref="MatrixType.CSR"/> are only used with the native kernels (see <see cref="NativeKernels"/>),
+        /// otherwise, CSR is used.
+        /// <see cref="MatrixType.ELLPACK"/> and <see cref="MatrixType.ELLPACKcache"/> are mapped to <see cref="MatrixType.SELLCS"/>.
+        /// </param>
+        public MtMatrix(MsrMatrix M, MatrixType matType)
             : base(M) {
+            m_UseNative = NativeKernels;
+            m_RequestedFormat = matType;
             base.PackMatrix(M);
         }
+
+        #region native kernels
+
+        [DllImport("Platform_Native")]
+        static extern int BoSSS_SpMV_GetISA();
+
+        [DllImport("Platform_Native")]
+        static extern int BoSSS_SpMV_SetISA(int isa);
+
+        [DllImport("Platform_Native")]
+        unsafe static extern void BoSSS_SpMV_CSR(int i0, int iE, int* RowStart, int* ColInd, double* Val,
+                                                 double* x, double* y, double alpha, double beta);
+
+        [DllImport("Platform_Native")]
+        unsafe static extern int BoSSS_SpMV_SELLCS(int s0, int sE, int C, int NoOfRows, int* SliceStart, int* Perm,
+                                                   int* ColInd, double* Val, double* x, double* y, double alpha, double beta);
+
+        [DllImport("Platform_Native")]
+        unsafe static extern void BoSSS_SpMV_CCBCSR(int cr0, int crE, int CellSize, int CellStride, int NoOfCellsPerRow,
+                                                    int* CellColumn, double* Val, double* x, double* y, double alpha, double beta);
+
+        static bool? m_NativeAvailable = null;
+
+        static bool m_NativeKernels = true;
+
+        /// <summary>
+        /// true, if the native SpMV kernels in the Platform_Native - library could be loaded.
+        /// </summary>
+        public static bool NativeKernelsAvailable {
+            get {
+                if (m_NativeAvailable == null) {
+                    try {
+                        BoSSS_SpMV_GetISA();
+                        m_NativeAvailable = true;
+                    } catch (DllNotFoundException) {
+                        m_NativeAvailable = false;
+                    } catch (EntryPointNotFoundException) {
+                        // an old version of Platform_Native, without the SpMV kernels
+                        m_NativeAvailable = false;
+                    }
+                }
+                return m_NativeAvailable.Value;
+            }
+        }
+
+        /// <summary>
+        /// Whether matrices, which are created from now on, use the native (SIMD) kernels of the
+        /// Platform_Native - library (if true), or the managed CSR implementation (if false);
+        /// Defaults to true if the native library is available.
+        /// </summary>
+        public static bool NativeKernels {
+            get {
+                return m_NativeKernels && NativeKernelsAvailable;
+            }
+            set {
+                if (value && !NativeKernelsAvailable)
+                    throw new NotSupportedException("native SpMV kernels are not available (Platform_Native - library missing or outdated).");
+                m_NativeKernels = value;
+            }
+        }
+
+        /// <summary>
+        /// Instruction set used by the native kernels, picked at runtime according to the CPU capabilities:
+        /// 0 for scalar code, 1 for AVX2, 2 for AVX-512;
+        /// Setting can only lower the level, e.g. for benchmarking;
+        /// Negative if the native kernels are not available.
+        /// </summary>
+        public static int NativeInstructionSet {
+            get {
+                if (!NativeKernelsAvailable)
+                    return -1;
+                return BoSSS_SpMV_GetISA();
+            }
+            set {
+                if (!NativeKernelsAvailable)
+                    throw new NotSupportedException("native SpMV kernels are not available (Platform_Native - library missing or outdated).");
+                BoSSS_SpMV_SetISA(value);
+            }
+        }
+
+        /// <summary>
+        /// if true, the native kernels are used for the local part of the SpMV;
+        /// </summary>
+        bool m_UseNative;
+
+        /// <summary>
+        /// storage format requested in the constructor
+        /// </summary>
+        MatrixType m_RequestedFormat;
+
+        /// <summary>
+        /// the storage format that is actually used for the local part of the matrix
+        /// (<see cref="MatrixType.CSR"/>, <see cref="MatrixType.SELLCS"/> or <see cref="MatrixType.CCBCSR"/>).
+        /// </summary>
+        public MatrixType StorageFormat {
+            get {
+                if (m_LocalMtx is CCBCSR)
+                    return MatrixType.CCBCSR;
+                if (m_LocalMtx is SELLCS)
+                    return MatrixType.SELLCS;
+                return MatrixType.CSR;
+            }
+        }
+
+        /// <summary>
+        /// true, if the local part of the SpMV is performed by the native kernels
+        /// </summary>
+        public bool UsesNativeKernels {
+            get {
+                return m_UseNative;
+            }
+        }
+
+        /// <summary>
+        /// number of bytes that are loaded from/stored to main memory by one local SpMV,
+        /// assuming perfect caching of the input vector;
+        /// Used to compute the memory bandwidth in benchmarks.
+        /// </summary>
+        public long LocalSpMVTraffic {
+            get {
+                long NoOfRows = m_RowPart.LocalLength;
+                long NoOfCols = m_ColPart.LocalLength;
+                long vec = NoOfCols * sizeof(double) + 2 * NoOfRows * sizeof(double); // x; y read and written
+                if (m_LocalMtx is CCBCSR) {
+                    CCBCSR ccb = (CCBCSR)m_LocalMtx;
+                    return vec + (long)ccb.Val.Length * sizeof(double) + (long)ccb.CellColumn.Length * sizeof(int);
+                } else if (m_LocalMtx is SELLCS) {
+                    SELLCS sell = (SELLCS)m_LocalMtx;
+                    return vec + (long)sell.Val.Length * (sizeof(double) + sizeof(int)) + (long)(sell.SliceStart.Length + sell.Perm.Length) * sizeof(int);
+                } else {
+                    CSR csr = (CSR)m_LocalMtx;
+                    return vec + (long)csr.Val.Length * (sizeof(double) + sizeof(int)) + (long)csr.RowStart.Length * sizeof(int);
+                }
+            }
+        }
+
+        #endregion
         
         override internal void SpMV_Local_Start(double alpha, VectorBase a, double beta, VectorBase acc) {
             // return immediately;
@@ -97,29 +250,57 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
                 int* ColInd = this.LocalMatrixPin.pColInd;
                 double* _val = this.LocalMatrixPin.pVal;
 
+                if (m_UseNative) {
+                    // native SIMD kernels
+                    // ===================
+
+                    if (m_LocalMtx is CCBCSR) {
+                        CCBCSR ccb = (CCBCSR)m_LocalMtx;
+                        int CellSize = ccb.CellSize, CellStride = ccb.CellStride, NoOfCellsPerRow = ccb.NoOfCellsPerRow;
+                        ilPSP.Threading.Paralleism.For(0, ccb.NoOfCellRows, delegate(int i0, int iE) {
+                            BoSSS_SpMV_CCBCSR(i0, iE, CellSize, CellStride, NoOfCellsPerRow, ColInd, _val, _a_stor, _acc_stor, alpha, beta);
+                        });
+                    } else if (m_LocalMtx is SELLCS) {
+                        SELLCS sell = (SELLCS)m_LocalMtx;
+                        int C = sell.SliceHeight, NoOfRows = sell.NoOfRows;
+                        int* _perm = this.LocalMatrixPin.pPerm;
+                        ilPSP.Threading.Paralleism.For(0, sell.NoOfSlices, delegate(int i0, int iE) {
+                            if (BoSSS_SpMV_SELLCS(i0, iE, C, NoOfRows, _rowStart, _perm, ColInd, _val, _a_stor, _acc_stor, alpha, beta) != 0)
+                                throw new NotSupportedException("SELL-C-sigma: unsupported slice height " + C + ".");
+                        });
+                    } else {
+                        ilPSP.Threading.Paralleism.For(0, m_RowPart.LocalLength, delegate(int i0, int iE) {
+                            BoSSS_SpMV_CSR(i0, iE, _rowStart, ColInd, _val, _a_stor, _acc_stor, alpha, beta);
+                        });
+                    }
 
-                int NoOfRows = m_RowPart.LocalLength;
-                ilPSP.Threading.Paralleism.For(0, NoOfRows, delegate(int i0, int iE) {
+                } else {
+                    // managed CSR
+                    // ===========
 
-                    
-                    double* MtxEntry = _val + _rowStart[i0];
-                    int* __ColInd = ColInd + _rowStart[i0];
-                    for (int Row = i0; Row < iE; Row++) {
-                        int RowStart = _rowStart[Row];
-                        int RowEnd = _rowStart[Row + 1];
+                    int NoOfRows = m_RowPart.LocalLength;
+                    ilPSP.Threading.Paralleism.For(0, NoOfRows, delegate(int i0, int iE) {
 
-                        double rowacc = 0;
-                        for (int i = RowStart; i < RowEnd; i++) {
-                            rowacc += *MtxEntry * _a_stor[*__ColInd];
-                            __ColInd++;
-                            MtxEntry++;
-                        }
+                        
+                        double* MtxEntry = _val + _rowStart[i0];
+                        int* __ColInd = ColInd + _rowStart[i0];
+                        for (int Row = i0; Row < iE; Row++) {
+                            int RowStart = _rowStart[Row];
+                            int RowEnd = _rowStart[Row + 1];
 
-                        _acc_stor[Row] = _acc_stor[Row] * beta + rowacc * alpha;
-                    }
-                    
+                            double rowacc = 0;
+                            for (int i = RowStart; i < RowEnd; i++) {
+                                rowacc += *MtxEntry * _a_stor[*__ColInd];
+                                __ColInd++;
+                                MtxEntry++;
+                            }
 
-                });
+                            _acc_stor[Row] = _acc_stor[Row] * beta + rowacc * alpha;
+                        }
+                        
+
+                    });
+                }
             }
 
             //// Test code: test ok 05aug10, 16:36
@@ -135,7 +316,7 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
 
         
 
-        double[] m_acc_stor;
+        unsafe double* m_acc_stor;
         double m_alpha = double.NaN;
         //double m_beta = double.NaN;
 
@@ -166,8 +347,8 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             // optimized version
             unsafe {
                 double* _values = (double*)values;
-                fixed (double* _Val = &externalPart.Val[0],
-                               _acc_stor = &m_acc_stor[0]) {
+                double* _acc_stor = m_acc_stor;
+                fixed (double* _Val = &externalPart.Val[0]) {
                     fixed (int* _rowSt = &externalPart.RowStart[0],
                                 _colInd = &externalPart.ColInd[0],
                                 _rowInd = &externalPart.rowInd[0]) {
@@ -216,7 +397,10 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         internal override void SpMV_External_Begin(double alpha, double beta, VectorBase acc) {
             m_alpha = alpha;
             //m_beta = beta;
-            m_acc_stor = (acc as MtVector).Storage;
+            unsafe {
+                // 'acc' is locked during the SpMV, so its storage is pinned
+                m_acc_stor = (acc as MtVector).StorageAddr;
+            }
         }
 
         /// <summary>
@@ -225,7 +409,9 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         internal override void SpMV_External_Finalize() {
             m_alpha = double.NaN;
             //m_beta = double.NaN;
-            m_acc_stor = null;
+            unsafe {
+                m_acc_stor = null;
+            }
         }
 
         /// <summary>
@@ -239,6 +425,13 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
 
 
             IPartitioning part_a = len;
+            if (a is UnmanagedVector) {
+                // caller-owned memory: operate on it directly
+                CopyIsShallow = true;
+                unsafe {
+                    return new MtVector(part_a, (a as UnmanagedVector).Pointer);
+                }
+            }
             double[] _a_stor = a as double[]; // try to do a shallow copy and save mem. and time
             if (_a_stor == null) {
                 // shallow copy didn't worked
@@ -256,7 +449,7 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// </summary>
         public override void Lock() {
             base.Lock();
-            LocalMatrixPin.Lock((MatrixBase.CSR)m_LocalMtx);
+            LocalMatrixPin.Lock(m_LocalMtx);
         }
 
         /// <summary>
@@ -270,29 +463,55 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// </summary>
         struct LocalPin {
             // GC pinning for Local part of the matrix
-            GCHandle m_ValHandle;
-            GCHandle m_ColIndHandle;
-            GCHandle m_RowStartHandle;
+            GCHandle[] m_Handles;
 
             // pinned pointers to local part of the matrix, only valid in a look/unlock - section
             public unsafe double* pVal;
+            /// <summary>
+            /// CSR and SELL-C-sigma: column indices; CCBCSR: cell columns
+            /// </summary>
             public unsafe int* pColInd;
+            /// <summary>
+            /// CSR: row start; SELL-C-sigma: slice start; CCBCSR: unused
+            /// </summary>
             public unsafe int* pRowStart;
+            /// <summary>
+            /// SELL-C-sigma: row permutation; otherwise unused
+            /// </summary>
+            public unsafe int* pPerm;
+
+            IntPtr Pin(Array a, int i) {
+                m_Handles[i] = GCHandle.Alloc(a, GCHandleType.Pinned);
+                return Marshal.UnsafeAddrOfPinnedArrayElement(a, 0);
+            }
 
             /// <summary>
             /// performs pinning and initializes the pointers
             /// </summary>
             /// <param name="LocalMatrix"></param>
-            public void Lock(CSR LocalMatrix) {
+            public void Lock(FormatBase LocalMatrix) {
                 unsafe {
-                    m_ValHandle = GCHandle.Alloc(LocalMatrix.Val, GCHandleType.Pinned);
-                    pVal = (double*)Marshal.UnsafeAddrOfPinnedArrayElement(LocalMatrix.Val, 0);
-
-                    m_ColIndHandle = GCHandle.Alloc(LocalMatrix.ColInd, GCHandleType.Pinned);
-                    pColInd = (int*)Marshal.UnsafeAddrOfPinnedArrayElement(LocalMatrix.ColInd, 0);
-
-                    m_RowStartHandle = GCHandle.Alloc(LocalMatrix.RowStart, GCHandleType.Pinned);
-                    pRowStart = (int*)Marshal.UnsafeAddrOfPinnedArrayElement(LocalMatrix.RowStart, 0);
+                    if (LocalMatrix is CSR) {
+                        CSR csr = (CSR)LocalMatrix;
+                        m_Handles = new GCHandle[3];
+                        pVal = (double*)Pin(csr.Val, 0);
+                        pColInd = (int*)Pin(csr.ColInd, 1);
+                        pRowStart = (int*)Pin(csr.RowStart, 2);
+                    } else if (LocalMatrix is SELLCS) {
+                        SELLCS sell = (SELLCS)LocalMatrix;
+                        m_Handles = new GCHandle[4];
+                        pVal = (double*)Pin(sell.Val, 0);
+                        pColInd = (int*)Pin(sell.ColInd, 1);
+                        pRowStart = (int*)Pin(sell.SliceStart, 2);
+                        pPerm = (int*)Pin(sell.Perm, 3);
+                    } else if (LocalMatrix is CCBCSR) {
+                        CCBCSR ccb = (CCBCSR)LocalMatrix;
+                        m_Handles = new GCHandle[2];
+                        pVal = (double*)Pin(ccb.Val, 0);
+                        pColInd = (int*)Pin(ccb.CellColumn, 1);
+                    } else {
+                        throw new NotSupportedException("unsupported matrix format: " + LocalMatrix.GetType().Name);
+                    }
                 }
 
             }
@@ -301,13 +520,14 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             /// releases the pinning, unlocks the pointers.
             /// </summary>
             public void Unlock() {
-                m_ValHandle.Free();
-                m_ColIndHandle.Free();
-                m_RowStartHandle.Free();
+                foreach (GCHandle h in m_Handles)
+                    h.Free();
+                m_Handles = null;
                 unsafe {
                     pVal = (double*)IntPtr.Zero;
                     pColInd = (int*)IntPtr.Zero;
                     pRowStart = (int*)IntPtr.Zero;
+                    pPerm = (int*)IntPtr.Zero;
                 }
             }
         }
@@ -321,11 +541,123 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         }
 
         /// <summary>
-        /// returns a <see cref="MatrixBase.CSR"/>-object.
+        /// slice height for <see cref="MatrixBase.SELLCS"/>: one AVX-512 vector, or two AVX2 vectors
+        /// </summary>
+        const int SELL_C = 8;
+
+        /// <summary>
+        /// sorting scope for <see cref="MatrixBase.SELLCS"/>
+        /// </summary>
+        const int SELL_Sigma = 32 * SELL_C;
+
+        /// <summary>
+        /// formats are only picked by <see cref="MatrixType.Auto"/> if at least this fraction
+        /// of stored entries are nonzeros (and not padding)
+        /// </summary>
+        const double MinFillRatio = 0.8;
+
+        /// <summary>
+        /// returns a <see cref="MatrixBase.CSR"/>-, <see cref="MatrixBase.SELLCS"/>- or <see cref="MatrixBase.CCBCSR"/>-object,
+        /// depending on the requested format and the availability of the native kernels.
         /// </summary>
         protected override MatrixBase.FormatBase AssembleFinalFormat(MatrixBase.TempCSR tmp) {
             //TestFormats(tmp);
-            return new MatrixBase.CSR(tmp);
+            if (!m_UseNative)
+                return new MatrixBase.CSR(tmp);
+
+            int nnz = tmp.Vals.Count;
+            switch (m_RequestedFormat) {
+                case MatrixType.CSR:
+                    return new MatrixBase.CSR(tmp);
+
+                case MatrixType.CCBCSR: {
+                    double fill;
+                    int CellSize = FindCellSize(tmp, this.ColPartition.LocalLength, out fill);
+                    if (CellSize <= 1)
+                        // no dense cells in the matrix (at least locally): CCBCSR would degenerate to ELLPACK
+                        return new MatrixBase.SELLCS(tmp, SELL_C, SELL_Sigma);
+                    return new MatrixBase.CCBCSR(tmp, 1, CellSize);
+                }
+
+                case MatrixType.ELLPACK:
+                case MatrixType.ELLPACKcache:
+                case MatrixType.SELLCS:
+                    return new MatrixBase.SELLCS(tmp, SELL_C, SELL_Sigma);
+
+                case MatrixType.Auto: {
+                    // DG-matrices consist of dense cells: CCBCSR saves the column indices and allows contiguous SIMD loads
+                    double fill;
+                    int CellSize = FindCellSize(tmp, this.ColPartition.LocalLength, out fill);
+                    if (CellSize >= 4 && fill >= MinFillRatio)
+                        return new MatrixBase.CCBCSR(tmp, 1, CellSize);
+
+                    MatrixBase.SELLCS sell = new MatrixBase.SELLCS(tmp, SELL_C, SELL_Sigma);
+                    if (sell.Val.Length <= 0 || (double)nnz / (double)sell.Val.Length >= MinFillRatio)
+                        return sell;
+
+                    return new MatrixBase.CSR(tmp);
+                }
+
+                default:
+                    throw new NotImplementedException("unknown matrix type: " + m_RequestedFormat);
+            }
+        }
+
+        /// <summary>
+        /// Finds the size of the dense sub-matrices ('cells', e.g. the blocks of a DG matrix),
+        /// by testing all cell sizes up to 64 that divide the number of rows and columns;
+        /// </summary>
+        /// <param name="tmp">local part of the matrix</param>
+        /// <param name="NoOfCols">local number of columns</param>
+        /// <param name="FillRatio">
+        /// on exit, number of nonzeros divided by the number of entries which the <see cref="MatrixBase.CCBCSR"/>-format
+        /// would store for the returned cell size
+        /// </param>
+        /// <returns>
+        /// the largest cell size for which <paramref name="FillRatio"/> is at least <see cref="MinFillRatio"/>,
+        /// or 1 if there is no such cell size.
+        /// </returns>
+        static int FindCellSize(MatrixBase.TempCSR tmp, int NoOfCols, out double FillRatio) {
+            int NoOfRows = tmp.NoOfRows;
+            int nnz = tmp.Vals.Count;
+            FillRatio = 1.0;
+            if (NoOfRows <= 0 || nnz <= 0)
+                return 1;
+
+            // 'LastSeen' marks the cell columns already counted in the current cell-row;
+            // 'Stamp' is unique for each cell-row of each tested cell size, so the array never needs to be reset
+            int[] LastSeen = new int[NoOfCols];
+            ArrayTools.SetAll(LastSeen, -1);
+            int Stamp = 0;
+
+            for (int CellSize = Math.Min(64, NoOfRows); CellSize >= 2; CellSize--) {
+                if (NoOfRows % CellSize != 0 || NoOfCols % CellSize != 0)
+                    continue;
+
+                // count the occupied cells in each cell-row
+                int NoOfCellRows = NoOfRows / CellSize;
+                int MaxCellsPerRow = 0;
+                for (int cr = 0; cr < NoOfCellRows; cr++, Stamp++) {
+                    int NoOfCells = 0;
+                    int k0 = tmp.RowStart[cr * CellSize];
+                    int kE = tmp.RowStart[(cr + 1) * CellSize];
+                    for (int k = k0; k < kE; k++) {
+                        int CellCol = tmp.ColInd[k] / CellSize;
+                        if (LastSeen[CellCol] != Stamp) {
+                            LastSeen[CellCol] = Stamp;
+                            NoOfCells++;
+                        }
+                    }
+                    MaxCellsPerRow = Math.Max(MaxCellsPerRow, NoOfCells);
+                }
+
+                double fill = (double)nnz / ((double)NoOfCellRows * MaxCellsPerRow * CellSize * CellSize);
+                if (fill >= MinFillRatio) {
+                    FillRatio = fill;
+                    return CellSize;
+                }
+            }
+            return 1;
         }
 
         
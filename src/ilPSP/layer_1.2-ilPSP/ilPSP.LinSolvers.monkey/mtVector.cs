@@ -52,8 +52,31 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             m_Storage = content;
         }
 
+        /// <summary>
+        /// constructor which operates directly on unmanaged memory, e.g. memory that 
+        /// is owned by a C or FORTRAN caller; no copy is made;
+        /// </summary>
+        /// <param name="P"></param>
+        /// <param name="content">
+        /// start address of the vector entries; must remain valid as long as this object is in use;
+        /// </param>
+        unsafe public MtVector(IPartitioning P, double* content)
+            : base(P) {
+            if (content == null && P.LocalLength > 0)
+                throw new ArgumentNullException("content");
+            m_Storage = null;
+            m_StorageAddr = content;
+            m_IsExternal = true;
+        }
+
         double[] m_Storage;
 
+        /// <summary>
+        /// true, if this vector operates on unmanaged memory, see <see cref="MtVector(IPartitioning, double*)"/>;
+        /// then, <see cref="Storage"/> is null;
+        /// </summary>
+        bool m_IsExternal = false;
+
         /// <summary>
         /// internal storage of the vector;
         /// </summary>
@@ -61,6 +84,7 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// Attention: the length of this array may be grater than the local lenght of this vector;
         /// Only entries in the range 0 to local length - 1 are used. the local length
         /// can be determided by the partition <see cref="VectorBase.Part"/> of this vector.
+        /// For vectors on unmanaged memory (<see cref="MtVector(IPartitioning, double*)"/>), this is null.
         /// </remarks>
         public double[] Storage { 
             get { return m_Storage; } 
@@ -75,6 +99,17 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// <param name="insertAt"></param>
         /// <param name="Length"></param>
         public override void SetValues<T>(T vals, int arrayIndex, int insertAt, int Length) {
+            if (m_IsExternal) {
+                unsafe {
+                    if (typeof(T) == typeof(double[])) {
+                        Marshal.Copy(vals as double[], arrayIndex, (IntPtr)(m_StorageAddr + insertAt), Length);
+                    } else {
+                        for (int i = 0; i < Length; i++)
+                            m_StorageAddr[i + insertAt] = vals[i + arrayIndex];
+                    }
+                }
+                return;
+            }
             if (typeof(T) == typeof(double[])) {
                 // optimized version
                 Array.Copy(vals as double[], arrayIndex, m_Storage, insertAt, Length);
@@ -94,6 +129,17 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// <param name="readAt"></param>
         /// <param name="Length"></param>
         public override void GetValues<T>(T vals, int arrayIndex, int readAt, int Length) {
+            if (m_IsExternal) {
+                unsafe {
+                    if (typeof(T) == typeof(double[])) {
+                        Marshal.Copy((IntPtr)(m_StorageAddr + readAt), vals as double[], arrayIndex, Length);
+                    } else {
+                        for (int i = 0; i < Length; i++)
+                            vals[i + arrayIndex] = m_StorageAddr[i + readAt];
+                    }
+                }
+                return;
+            }
             if (typeof(T) == typeof(double[])) {
                 // optimized version
                 Array.Copy(m_Storage,readAt, vals as double[], arrayIndex, Length);
@@ -113,11 +159,26 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             get {
                 if (m_IsLocked)
                     throw new ApplicationException("object is locked.");
+                if (m_IsExternal) {
+                    if (index < 0 || index >= m_Part.LocalLength)
+                        throw new IndexOutOfRangeException();
+                    unsafe {
+                        return m_StorageAddr[index];
+                    }
+                }
                 return m_Storage[index];
             }
             set {
                 if (m_IsLocked)
                     throw new ApplicationException("object is locked.");
+                if (m_IsExternal) {
+                    if (index < 0 || index >= m_Part.LocalLength)
+                        throw new IndexOutOfRangeException();
+                    unsafe {
+                        m_StorageAddr[index] = value;
+                    }
+                    return;
+                }
                 m_Storage[index] = value;
             }
         }
@@ -126,6 +187,16 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// sets all entries to 0.0;
         /// </summary>
         public override void Clear() {
+            if (m_IsExternal) {
+                unsafe {
+                    double* pa = m_StorageAddr;
+                    ilPSP.Threading.Paralleism.For(0, m_Part.LocalLength, delegate(int i0, int iE) {
+                        for (int i = i0; i < iE; i++)
+                            pa[i] = 0.0;
+                    });
+                }
+                return;
+            }
             ilPSP.Threading.Paralleism.For(0, m_Storage.Length, delegate(int i0, int iE) {
                 Array.Clear(m_Storage, i0, iE-i0);
             });
@@ -150,8 +221,9 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             int L = ComList.Length;
             unsafe {
                 double* pBuffer = (double*)Buffer;
+                double* pStor = m_StorageAddr;
                 for (int i = 0; i < L; i++)
-                    pBuffer[i] = m_Storage[ComList[i]];
+                    pBuffer[i] = pStor[ComList[i]];
             }
         }
 
@@ -303,6 +375,69 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             return ddotGlob;
         }
 
+        /// <summary>
+        /// this = this + <paramref name="alpha"/>*<paramref name="other"/>, returns the square of the two-norm of the result;
+        /// see <see cref="VectorBase.AccAndNorm"/>.
+        /// </summary>
+        public override double AccAndNorm(double alpha, VectorBase other) {
+            if (!m_IsLocked)
+                throw new ApplicationException("works only in locked mode.");
+            if (!other.IsLocked)
+                throw new ArgumentException("other object must be locked.", "other");
+            int N = this.m_Part.LocalLength;
+            if (other.Part.LocalLength != N)
+                throw new ArgumentException("mismatch in vector size.");
+
+            double NormLocPow2;
+            unsafe {
+                double* p_tis = this.m_StorageAddr, p_oda = (other as MtVector).m_StorageAddr;
+                NormLocPow2 = ilPSP.Threading.Paralleism.ReduceFor<double>(0, N, delegate(int i0, int iE) {
+                    double myRes = 0;
+                    for (int i = i0; i < iE; i++) {
+                        double r = p_tis[i] + alpha * p_oda[i];
+                        p_tis[i] = r;
+                        myRes += r * r;
+                    }
+                    return myRes;
+                }, delegate(ref double tot_res, ref double thr_res) {
+                    tot_res += thr_res;
+                });
+            }
+
+            unsafe {
+                double NormglobPow2 = double.NaN;
+                csMPI.Raw.Allreduce((IntPtr)(&NormLocPow2), (IntPtr)(&NormglobPow2), 1, csMPI.Raw._DATATYPE.DOUBLE, csMPI.Raw._OP.SUM, csMPI.Raw._COMM.WORLD);
+                return NormglobPow2;
+            }
+        }
+
+        /// <summary>
+        /// <paramref name="x"/> = <paramref name="x"/> + <paramref name="lambda"/>*this, this = <paramref name="other"/> + <paramref name="beta"/>*this;
+        /// see <see cref="VectorBase.XpayAxpy"/>.
+        /// </summary>
+        public override void XpayAxpy(double beta, VectorBase other, double lambda, VectorBase x) {
+            if (!m_IsLocked)
+                throw new ApplicationException("works only in locked mode.");
+            if (!other.IsLocked)
+                throw new ArgumentException("other object must be locked.", "other");
+            if (!x.IsLocked)
+                throw new ArgumentException("other object must be locked.", "x");
+            int N = this.m_Part.LocalLength;
+            if (other.Part.LocalLength != N || x.Part.LocalLength != N)
+                throw new ArgumentException("mismatch in vector size.");
+
+            unsafe {
+                double* p_tis = this.m_StorageAddr, p_oda = (other as MtVector).m_StorageAddr, p_x = (x as MtVector).m_StorageAddr;
+                ilPSP.Threading.Paralleism.For(0, N, delegate(int i0, int iE) {
+                    for (int i = i0; i < iE; i++) {
+                        double p = p_tis[i];
+                        p_x[i] += lambda * p;
+                        p_tis[i] = p_oda[i] + beta * p;
+                    }
+                });
+            }
+        }
+
         /// <summary>
         /// copies the content of <paramref name="other"/> to this vector.
         /// </summary>
@@ -315,9 +450,13 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
             if (other.Part.LocalLength != N)
                 throw new ArgumentException("mismatch in vector size.");
 
-            ilPSP.Threading.Paralleism.For(0, N, delegate(int i0, int iE) {
-                Array.Copy((other as MtVector).m_Storage, i0, this.m_Storage, i0, iE-i0);
-            });
+            unsafe {
+                double* pSrc = (other as MtVector).m_StorageAddr, pDst = this.m_StorageAddr;
+                ilPSP.Threading.Paralleism.For(0, N, delegate(int i0, int iE) {
+                    for (int i = i0; i < iE; i++)
+                        pDst[i] = pSrc[i];
+                });
+            }
         }
 
         /// <summary>
@@ -360,6 +499,8 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// </summary>
         public override void Lock() {
             base.Lock();
+            if (m_IsExternal)
+                return; // unmanaged memory: nothing to pin
             m_StoragePin = GCHandle.Alloc(m_Storage, GCHandleType.Pinned);
             unsafe {
                 m_StorageAddr = (double*)Marshal.UnsafeAddrOfPinnedArrayElement(m_Storage, 0);
@@ -371,6 +512,8 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
         /// </summary>
         public override void Unlock() {
             base.Unlock();
+            if (m_IsExternal)
+                return;
             m_StoragePin.Free();
             unsafe {
                 m_StorageAddr = (double*)IntPtr.Zero;
@@ -392,10 +535,13 @@ namespace ilPSP.LinSolvers.monkey.mtCPU {
 
             MtVector o = (other as MtVector);
 
-            ilPSP.Threading.Paralleism.For(0, N, delegate(int i0, int iE) {
-                for (int i = i0; i < iE; i++)
-                    this.m_Storage[i] *= o.m_Storage[i];
-            });
+            unsafe {
+                double* pThis = this.m_StorageAddr, pO = o.m_StorageAddr;
+                ilPSP.Threading.Paralleism.For(0, N, delegate(int i0, int iE) {
+                    for (int i = i0; i < iE; i++)
+                        pThis[i] *= pO[i];
+                });
+            }
 
         }
 
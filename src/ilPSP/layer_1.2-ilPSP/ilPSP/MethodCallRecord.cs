@@ -126,13 +126,21 @@ namespace ilPSP.Tracing {
         /// the existing entry is modified.
         /// </summary>
         public MethodCallRecord AddSubCall(string _name, long ElapsedTicks) {
+            return AddSubCall(_name, ElapsedTicks, 1);
+        }
+
+        /// <summary>
+        /// Adds a new entry to <see cref="Calls"/> which accumulates <paramref name="NoOfCalls"/> calls,
+        /// e.g. measured by a profiler of some native library.
+        /// </summary>
+        public MethodCallRecord AddSubCall(string _name, long ElapsedTicks, int NoOfCalls) {
 
             MethodCallRecord mcr;
             if (!this.Calls.TryGetValue(_name, out mcr)) {
                 mcr = new MethodCallRecord(this, _name);
                 this.Calls.Add(_name, mcr);
             }
-            mcr.CallCount++;
+            mcr.CallCount += NoOfCalls;
             mcr.m_TicksSpentInMethod += ElapsedTicks;
 
             return mcr;
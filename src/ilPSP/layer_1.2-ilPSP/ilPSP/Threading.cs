@@ -16,6 +16,7 @@ limitations under the License.
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Threading;
 using System.Runtime.InteropServices;
 
@@ -62,7 +63,8 @@ namespace ilPSP.Threading {
         
     /// <summary>
     /// Helpers to realize quasi-OpenMP - parallelism;<br/>
-    /// This class should substitute the .NET 4 class 'System.Threading.Parallel' - class which currently (20sep10) isnt available in Mono.
+    /// This class should substitute the .NET 4 class 'System.Threading.Parallel' - class which currently (20sep10) isnt available in Mono.<br/>
+    /// The sections run on a pool of persistent worker threads (see <see cref="SpinTime"/> and <see cref="PinThreads"/>).
     /// </summary>
     public static class Paralleism {
         
@@ -70,12 +72,12 @@ namespace ilPSP.Threading {
 
         /// <summary>
         /// the currently predefined number of threads;
-        /// The default value is 'Number-of-Procesors' over 'Number-Of-MPI-Processes on current machine';
+        /// The default value is 'Number-of-Procesors' over 'Number-Of-MPI-Processes on current machine', but at least 1;
         /// </summary>
         static public int NumThreads {
             get {
                 if (m_NumThreads < 0) {
-                    m_NumThreads = System.Environment.ProcessorCount / ilPSP.Environment.MPIEnv.ProcessesOnMySMP;
+                    m_NumThreads = Math.Max(1, System.Environment.ProcessorCount / ilPSP.Environment.MPIEnv.ProcessesOnMySMP);
                 }
                 return m_NumThreads;
             }
@@ -88,11 +90,66 @@ namespace ilPSP.Threading {
         }
 
 
-        static RunParallel m_CurrentWorker = null;
+        /// <summary>
+        /// if true, the threads of the parallel regions are pinned to CPUs, in NUMA-domain order (compact placement);
+        /// If multiple MPI processes run on one compute node, each of them uses a different set of CPUs.
+        /// The default is taken from the environment variable <c>OMP_PROC_BIND</c>, i.e. pinning is turned on for
+        /// 'true', 'close', 'spread' or 'master'.
+        /// Since the calling thread executes rank 0 of each parallel region, it stays pinned, too, until pinning is turned off:
+        /// then, the original affinity of the calling thread and of all worker threads is restored.
+        /// </summary>
+        static public bool PinThreads {
+            get {
+                if (m_PinThreads == null) {
+                    string bind = System.Environment.GetEnvironmentVariable("OMP_PROC_BIND");
+                    m_PinThreads = bind != null && Array.IndexOf(new string[] { "true", "close", "spread", "master" }, bind.Trim().ToLowerInvariant()) >= 0;
+                }
+                return m_PinThreads.Value;
+            }
+            set {
+                bool wasOn = m_PinThreads ?? false;
+                m_PinThreads = value;
+                if (wasOn && !value)
+                    WorkerPool.Unpin();
+            }
+        }
 
-        static ManualResetEvent[] m_sync;
+        static bool? m_PinThreads = null;
 
-        static Exception[] m_exc;
+        /// <summary>
+        /// how long idle worker threads spin, waiting for the next parallel region, before they block (default: 1 millisecond);
+        /// Spinning keeps the fork/join latency low for regions in quick succession, blocking frees the CPU e.g. for MPI progress.
+        /// </summary>
+        static public TimeSpan SpinTime {
+            get {
+                return TimeSpan.FromSeconds((double)WorkerPool.SpinTicks / Stopwatch.Frequency);
+            }
+            set {
+                if (value < TimeSpan.Zero) {
+                    throw new ArgumentException("spin time must be greater or equal to zero.");
+                }
+                WorkerPool.SpinTicks = (long)(value.TotalSeconds * Stopwatch.Frequency);
+            }
+        }
+
+        /// <summary>
+        /// rank of the current thread within the current parallel section; 0 outside of parallel sections.
+        /// </summary>
+        static public int ThreadRank {
+            get {
+                return WorkerPool.ThreadRank;
+            }
+        }
+
+        /// <summary>
+        /// true, if the current thread executes a parallel section
+        /// (in this case, further sections are executed serially by the current thread)
+        /// </summary>
+        static public bool InParallelSection {
+            get {
+                return WorkerPool.InRegion;
+            }
+        }
 
         /// <summary>
         /// A parallel FOR-loop;
@@ -116,6 +173,101 @@ namespace ilPSP.Threading {
             });
         }
 
+        /// <summary>
+        /// size of one entry in the per-thread work queues of <see cref="ForDynamic"/>, 
+        /// so that the queue heads of different threads never share a cache line.
+        /// </summary>
+        const int QUEUE_STRIDE = 16;
+
+        [ThreadStatic]
+        static long[] t_Queues;
+
+        /// <summary>
+        /// A parallel FOR-loop with dynamic load balancing, for loops with uneven work per index
+        /// (e.g. cut cells, or cells with different polynomial degree);
+        /// each thread starts with the same index range as in <see cref="For"/>, which it processes in chunks of 
+        /// <paramref name="ChunkSize"/>; threads which are done steal chunks from the ranges of other threads.
+        /// </summary>
+        /// <param name="i0">
+        /// start index
+        /// </param>
+        /// <param name="Len">
+        /// loop lenght
+        /// </param>
+        /// <param name="ChunkSize">
+        /// number of indices passed to one call of <paramref name="operation"/>;
+        /// if less or equal to 0, a default is used, so that there are about 8 chunks per thread.
+        /// </param>
+        /// <param name="operation"></param>
+        /// <remarks>
+        /// if at least one thread throws an exception, an exception it hrown.
+        /// </remarks>
+        public static void ForDynamic(int i0, int Len, int ChunkSize, ForParallel operation) {
+            int N = NumThreads;
+            if (ChunkSize <= 0) {
+                ChunkSize = Math.Max(1, Len / (8 * N));
+            }
+
+            // the queues are cached in the calling thread; a nested call gets its own.
+            long[] Queues = t_Queues;
+            t_Queues = null;
+            if (Queues == null || Queues.Length < N * QUEUE_STRIDE) {
+                Queues = new long[N * QUEUE_STRIDE];
+            }
+            try {
+                for (int t = 0; t < N; t++) {
+                    Queues[t * QUEUE_STRIDE] = (Len * (long)t) / N + i0;
+                    Queues[t * QUEUE_STRIDE + 1] = (Len * (long)(t + 1)) / N + i0;
+                }
+
+                Run(delegate(int rnk, int Sz) {
+                    // first the own range, then steal from the others;
+                    // if the section runs with less than N threads, all ranges are processed anyway.
+                    for (int v = 0; v < N; v++) {
+                        int q = ((rnk + v) % N) * QUEUE_STRIDE;
+                        long qE = Queues[q + 1];
+                        while (true) {
+                            long c0 = Interlocked.Add(ref Queues[q], ChunkSize) - ChunkSize;
+                            if (c0 >= qE)
+                                break;
+                            operation((int)c0, (int)Math.Min(c0 + ChunkSize, qE));
+                        }
+                    }
+                });
+            } finally {
+                t_Queues = Queues;
+            }
+        }
+
+        /// <summary>
+        /// Multiple parallel FOR-loops within one parallel section, i.e. with only one fork/join for all 
+        /// <paramref name="kernels"/>; each thread processes the same index range (see <see cref="For"/>) in all kernels, 
+        /// the threads are synchronized (<see cref="Barrier"/>) between the kernels.
+        /// </summary>
+        /// <param name="i0">
+        /// start index
+        /// </param>
+        /// <param name="Len">
+        /// loop lenght
+        /// </param>
+        /// <param name="kernels">
+        /// the loop bodies, executed one after another
+        /// </param>
+        /// <remarks>
+        /// if at least one thread throws an exception, an exception it hrown.
+        /// </remarks>
+        public static void ForFused(int i0, int Len, params ForParallel[] kernels) {
+            Run(delegate(int i, int N) {
+                int thr_i0 = (Len * i) / N + i0;
+                int thr_iE = (Len * (i + 1)) / N + i0;
+                for (int k = 0; k < kernels.Length; k++) {
+                    if (k > 0)
+                        Barrier();
+                    kernels[k](thr_i0, thr_iE);
+                }
+            });
+        }
+
         /// <summary>
         /// A parallel FOR-loop;
         /// runs <paramref name="operation"/> in parallel, with <see cref="NumThreads"/> number of threads;
@@ -133,130 +285,47 @@ namespace ilPSP.Threading {
         /// </remarks>
         public static T ReduceFor<T>(int i0, int Len, ReduceForParallel<T> operation, ReduceOp<T> ReduceOp) 
             where T : struct {
-            if (m_CurrentWorker != null) {
-                throw new ApplicationException("allready in parallel section");
-            }
-
+            
             int N = NumThreads;
             T[] thr_res = new T[N];
 
-            Run(delegate(int rnk, int Sz) {
-                int thr_i0 = (Len * rnk) / Sz + i0;
-                int thr_iE = (Len * (rnk + 1)) / Sz + i0;
+            int Sz = WorkerPool.Run(delegate(int rnk, int _Sz) {
+                int thr_i0 = (Len * rnk) / _Sz + i0;
+                int thr_iE = (Len * (rnk + 1)) / _Sz + i0;
                 thr_res[rnk] = operation(thr_i0, thr_iE);
-            });
+            }, N);
 
 
             T retval = thr_res[0];// default(T);
-            for (int i = 1; i < N; i++) {
+            for (int i = 1; i < Sz; i++) {
                 ReduceOp(ref retval, ref thr_res[i]);
             }
             return retval;
         }
 
-        //[DllImport("Kernel32.dll")]
-        //static extern bool QueryPerformanceCounter(out long lpPerformanceCount);
-
-
         /// <summary>
         /// A general parallel section;
         /// runs <paramref name="operation"/> in parallel, with <see cref="NumThreads"/> number of threads;
         /// </summary>
         /// <param name="operation">operation to perform in parallel</param>
         /// <remarks>
+        /// The threads are persistent, i.e. they are created with the first parallel section and re-used afterwards.
+        /// A section which is started within another section 
+        /// (or while another thread runs a section) is executed serially,
+        /// i.e. <paramref name="operation"/> is called once, with thread rank 0 and number of threads 1.<br/>
         /// if at least one thread throws an exception, an exception it hrown.
         /// </remarks>
         public static void Run(RunParallel operation) {
-            //long start;
-            //QueryPerformanceCounter(out start);
-
-
-            if (m_CurrentWorker != null) {
-                throw new ApplicationException("already in parallel section");
-            }
-
-            m_CurrentWorker = operation;
-            int N = NumThreads;
-            if (m_sync == null || m_sync.Length != (N - 1)) {
-                m_sync = new ManualResetEvent[N - 1];
-                m_exc = new Exception[N];
-                //ThreadRuntime = new long[N];
-            }
-            for (int i = 0; i < N - 1; i++) {
-                m_sync[i] = new ManualResetEvent(false);
-                m_exc[i] = null;
-            }
-
-            //System.Threading.ThreadPool.SetMinThreads(N-1, 0);
-            //System.Threading.ThreadPool.SetMaxThreads(N-1, 0);
-            for (int i = 1; i < N; i++) {
-                System.Threading.ThreadPool.QueueUserWorkItem(Worker, new int[] { i, N });
-            }
-
-            try {
-                Worker(new int[] { 0, N }); // run the 0-th pice of work in the current thread !
-            } catch (Exception _e) {
-                m_exc[0] = _e;
-            }
-            //long sync_st;
-            //QueryPerformanceCounter(out sync_st);
-            if (N > 1)
-                WaitHandle.WaitAll(m_sync);
-            //long sync_end;
-            //QueryPerformanceCounter(out sync_end);
-
-            m_CurrentWorker = null;
-            for (int i = 0; i < N; i++) {
-                if (m_exc[i] != null)
-                    throw new ApplicationException("at least one thread (" + i + " of " + N + " throwed an exception;", m_exc[i]);
-            }
-
-            //long end;
-            //QueryPerformanceCounter(out end);
-            //{
-            //    long runtime = end - start;
-            //    long synctime = sync_end - sync_st;
-            //    double perc = (double)synctime / (double)runtime;
-            //    Console.WriteLine(N + " thr, total runtime: " + runtime + ", synctime: " + synctime + " = " + perc);
-
-            //    /*for (int i = 0; i < N; i++) {
-            //        Console.Write("thread #");
-            //        Console.Write(i);
-            //        Console.Write(": ");
-            //        Console.Write(ThreadRuntime[i]);
-            //        double perc = (double)ThreadRuntime[i] / (double)runtime;
-            //        Console.Write(", = ");
-            //        Console.Write(perc);
-            //        Console.Write(" of total.");
-            //        Console.WriteLine();
-            //    }*/
-            //}
+            WorkerPool.Run(operation, NumThreads);
         }
 
-        //static long[] ThreadRuntime;
-
-        static void Worker(object p) {
-            
-            //long st;
-            //QueryPerformanceCounter(out st);
-
-            int[] nums = (int[])p;
-            int rnk = nums[0];
-            int sz = nums[1];
-            
-            try {
-                m_CurrentWorker(rnk, sz);
-            } catch (Exception e) {
-                m_exc[rnk] = e;
-            }
-            if( rnk > 0)
-                m_sync[rnk-1].Set();
-
-            //long en;
-            //QueryPerformanceCounter(out en);
-
-            //ThreadRuntime[rnk] = en - st;
-
+        /// <summary>
+        /// synchronizes all threads of the current parallel section (see <see cref="Run"/>);
+        /// must be called by all threads of the section, the same number of times.
+        /// Outside of parallel sections, or in sections which are executed serially, this does nothing.
+        /// </summary>
+        public static void Barrier() {
+            WorkerPool.Barrier();
         }
     }
 }
@@ -98,6 +98,17 @@ namespace ilPSP.Tracing {
 
         private static MethodCallRecord Current;
 
+        /// <summary>
+        /// The record of the innermost active <see cref="FuncTrace"/> or <see cref="BlockTrace"/>;
+        /// call trees measured outside of the tracer (e.g. by the HYPRE profiler) are attached here
+        /// by <see cref="MethodCallRecord.AddSubCall(string, long, int)"/>.
+        /// </summary>
+        public static MethodCallRecord CurrentRecord {
+            get {
+                return Current;
+            }
+        }
+
         internal static void Push_MethodCallRecord(string _name) {
             Debug.Assert(InstrumentationSwitch == true);
             
@@ -0,0 +1,163 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Collections.Generic;
+
+namespace ilPSP.LinSolvers {
+
+    /// <summary>
+    /// A vector of doubles which lives in memory that is owned by someone else
+    /// (e.g. by a C or FORTRAN caller, or a pinned array), exposed as <see cref="IList{T}"/>.
+    /// Sparse solvers which recognize this type (see <see cref="ISparseSolver.Solve{Tunknowns, Trhs}(Tunknowns, Trhs)"/>)
+    /// operate directly on <see cref="Pointer"/>, i.e. without an intermediate managed copy.
+    /// </summary>
+    /// <remarks>
+    /// The caller is responsible for keeping the memory alive (and, if it is managed memory,
+    /// pinned) as long as this object is in use.
+    /// </remarks>
+    unsafe public class UnmanagedVector : IList<double> {
+
+        /// <summary>
+        /// ctor
+        /// </summary>
+        /// <param name="p">start address of the vector</param>
+        /// <param name="Length">number of entries</param>
+        public UnmanagedVector(double* p, int Length) {
+            if (Length < 0)
+                throw new ArgumentOutOfRangeException("Length");
+            if (p == null && Length > 0)
+                throw new ArgumentNullException("p");
+            m_Pointer = p;
+            m_Length = Length;
+        }
+
+        double* m_Pointer;
+        int m_Length;
+
+        /// <summary>
+        /// start address of the vector
+        /// </summary>
+        public double* Pointer {
+            get { return m_Pointer; }
+        }
+
+        /// <summary>
+        /// gets/sets an entry
+        /// </summary>
+        public double this[int index] {
+            get {
+                if (index < 0 || index >= m_Length)
+                    throw new IndexOutOfRangeException();
+                return m_Pointer[index];
+            }
+            set {
+                if (index < 0 || index >= m_Length)
+                    throw new IndexOutOfRangeException();
+                m_Pointer[index] = value;
+            }
+        }
+
+        /// <summary>
+        /// number of entries
+        /// </summary>
+        public int Count {
+            get { return m_Length; }
+        }
+
+        /// <summary>
+        /// always false
+        /// </summary>
+        public bool IsReadOnly {
+            get { return false; }
+        }
+
+        /// <summary>
+        /// index of the first occurrence of <paramref name="item"/>, or -1
+        /// </summary>
+        public int IndexOf(double item) {
+            for (int i = 0; i < m_Length; i++)
+                if (m_Pointer[i] == item)
+                    return i;
+            return -1;
+        }
+
+        /// <summary>
+        /// true, if <paramref name="item"/> is contained
+        /// </summary>
+        public bool Contains(double item) {
+            return IndexOf(item) >= 0;
+        }
+
+        /// <summary>
+        /// copies all entries to <paramref name="array"/>
+        /// </summary>
+        public void CopyTo(double[] array, int arrayIndex) {
+            if (array.Length - arrayIndex < m_Length)
+                throw new ArgumentException("target array too short.");
+            if (m_Length > 0)
+                System.Runtime.InteropServices.Marshal.Copy((IntPtr)m_Pointer, array, arrayIndex, m_Length);
+        }
+
+        /// <summary>
+        /// sets all entries to 0.0 (the length remains unchanged)
+        /// </summary>
+        public void Clear() {
+            for (int i = 0; i < m_Length; i++)
+                m_Pointer[i] = 0.0;
+        }
+
+        /// <summary>
+        /// not supported
+        /// </summary>
+        public void Insert(int index, double item) {
+            throw new NotSupportedException("resizeing is not supported.");
+        }
+
+        /// <summary>
+        /// not supported
+        /// </summary>
+        public void RemoveAt(int index) {
+            throw new NotSupportedException("resizeing is not supported.");
+        }
+
+        /// <summary>
+        /// not supported
+        /// </summary>
+        public void Add(double item) {
+            throw new NotSupportedException("resizeing is not supported.");
+        }
+
+        /// <summary>
+        /// not supported
+        /// </summary>
+        public bool Remove(double item) {
+            throw new NotSupportedException("resizeing is not supported.");
+        }
+
+        /// <summary>
+        /// enumerates all entries
+        /// </summary>
+        public IEnumerator<double> GetEnumerator() {
+            for (int i = 0; i < m_Length; i++)
+                yield return this[i];
+        }
+
+        System.Collections.IEnumerator System.Collections.IEnumerable.GetEnumerator() {
+            return GetEnumerator();
+        }
+    }
+}
@@ -0,0 +1,512 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace ilPSP.Threading {
+
+    /// <summary>
+    /// The persistent worker threads behind <see cref="Paralleism"/>:
+    /// the threads are created once and wait for the next parallel region by spinning for <see cref="Paralleism.SpinTime"/>
+    /// before they park (block on a monitor);
+    /// in this way, a fork/join costs roughly a cache line transfer per thread for regions in quick succession
+    /// (e.g. the vector operations of a Krylov solver), without burning the CPU between solver calls.
+    /// </summary>
+    internal static class WorkerPool {
+
+        /// <summary>
+        /// state of one worker thread;
+        /// the flags are in the middle of a private array, so that the flags of different threads never share a cache line.
+        /// </summary>
+        sealed class Slot {
+            public readonly int[] Flags = new int[48];
+            public readonly object SyncRoot = new object();
+            public int Rank;
+        }
+
+        /// <summary> index into <see cref="Slot.Flags"/>: generation of the last job posted to the worker </summary>
+        const int GEN = 16;
+        /// <summary> index into <see cref="Slot.Flags"/>: generation of the last job completed by the worker </summary>
+        const int DONE = 17;
+        /// <summary> index into <see cref="Slot.Flags"/>: 1, if the worker blocks on <see cref="Slot.SyncRoot"/> </summary>
+        const int PARKED = 18;
+
+        /// <summary>
+        /// workers, index: thread rank - 1 (rank 0 is the calling thread)
+        /// </summary>
+        static readonly List<Slot> m_Slots = new List<Slot>();
+
+        /// <summary>
+        /// only one thread can use the pool at a time; all others run their regions serially.
+        /// </summary>
+        static readonly object m_Busy = new object();
+
+        static RunParallel m_Job;
+        static int m_JobSize;
+        static int m_Generation;
+        static Exception[] m_exc = new Exception[0];
+        static int m_Aborted;
+        static bool m_Oversubscribed;
+
+        static int m_BarrierCount;
+        static int m_BarrierSense;
+
+        [ThreadStatic]
+        static int t_Rank;
+
+        [ThreadStatic]
+        static int t_Size;
+
+        [ThreadStatic]
+        static bool t_InRegion;
+
+        [ThreadStatic]
+        static int t_BarrierSense;
+
+        /// <summary>
+        /// true, if the current thread executes a parallel region (as master or as worker)
+        /// </summary>
+        public static bool InRegion {
+            get {
+                return t_InRegion;
+            }
+        }
+
+        /// <summary>
+        /// rank of the current thread within the current parallel region; 0 outside of parallel regions.
+        /// </summary>
+        public static int ThreadRank {
+            get {
+                return t_Rank;
+            }
+        }
+
+        /// <summary>
+        /// spin time of idle workers, in <see cref="Stopwatch"/>-ticks
+        /// </summary>
+        public static long SpinTicks = Stopwatch.Frequency / 1000;
+
+        /// <summary>
+        /// runs <paramref name="operation"/> with <paramref name="N"/> threads;
+        /// a region nested into another one, or started while the pool is used by some other thread,
+        /// runs serially in the calling thread.
+        /// </summary>
+        /// <returns>
+        /// the number of threads actually used, i.e. either <paramref name="N"/> or 1
+        /// </returns>
+        public static int Run(RunParallel operation, int N) {
+            if (N <= 1 || t_InRegion || !Monitor.TryEnter(m_Busy)) {
+                RunSerial(operation);
+                return 1;
+            }
+
+            try {
+                while (m_Slots.Count < N - 1)
+                    Spawn();
+                if (m_exc.Length < N)
+                    m_exc = new Exception[N];
+                Array.Clear(m_exc, 0, N);
+
+                m_Job = operation;
+                m_JobSize = N;
+                m_Aborted = 0;
+                m_Oversubscribed = N > System.Environment.ProcessorCount;
+                m_BarrierCount = N;
+                int gen = ++m_Generation;
+
+                // fork
+                for (int i = 0; i < N - 1; i++)
+                    Post(m_Slots[i], gen);
+
+                Execute(0); // run the 0-th pice of work in the current thread !
+
+                // join
+                for (int i = 0; i < N - 1; i++) {
+                    int[] Flags = m_Slots[i].Flags;
+                    if (Volatile.Read(ref Flags[DONE]) != gen) {
+                        SpinWait sw = new SpinWait();
+                        while (Volatile.Read(ref Flags[DONE]) != gen) {
+                            if (sw.NextSpinWillYield)
+                                Thread.Yield();
+                            else
+                                sw.SpinOnce();
+                        }
+                    }
+                }
+                m_Job = null;
+
+                // the exception of a thread that left the region because another one failed is only reported if there is no other
+                Exception first = null;
+                int iFirst = -1;
+                for (int i = 0; i < N; i++) {
+                    if (m_exc[i] != null && (first == null || (first is RegionAbortedException && !(m_exc[i] is RegionAbortedException)))) {
+                        first = m_exc[i];
+                        iFirst = i;
+                    }
+                }
+                if (first != null) {
+                    Array.Clear(m_exc, 0, N);
+                    throw new ApplicationException("at least one thread (" + iFirst + " of " + N + " throwed an exception;", first);
+                }
+
+            } finally {
+                Monitor.Exit(m_Busy);
+            }
+
+            return N;
+        }
+
+        static void RunSerial(RunParallel operation) {
+            int oldRank = t_Rank, oldSize = t_Size;
+            bool oldInRegion = t_InRegion;
+            t_Rank = 0;
+            t_Size = 1;
+            t_InRegion = true;
+            try {
+                operation(0, 1);
+            } catch (Exception e) {
+                throw new ApplicationException("at least one thread (0 of 1 throwed an exception;", e);
+            } finally {
+                t_Rank = oldRank;
+                t_Size = oldSize;
+                t_InRegion = oldInRegion;
+            }
+        }
+
+        static void Execute(int rank) {
+            if (Paralleism.PinThreads || t_PinnedCPU >= 0)
+                Pin(rank);
+
+            t_Rank = rank;
+            t_Size = m_JobSize;
+            t_InRegion = true;
+            t_BarrierSense = Volatile.Read(ref m_BarrierSense);
+            try {
+                m_Job(rank, m_JobSize);
+            } catch (Exception e) {
+                m_exc[rank] = e;
+                Volatile.Write(ref m_Aborted, 1);
+            } finally {
+                t_Rank = 0;
+                t_Size = 0;
+                t_InRegion = false;
+            }
+        }
+
+        static void Spawn() {
+            Slot s = new Slot();
+            s.Rank = m_Slots.Count + 1;
+            Thread t = new Thread(WorkerLoop);
+            t.IsBackground = true;
+            t.Name = "ilPSP worker " + s.Rank;
+            m_Slots.Add(s);
+            t.Start(s);
+        }
+
+        static void Post(Slot s, int gen) {
+            Volatile.Write(ref s.Flags[GEN], gen);
+            Thread.MemoryBarrier(); // the write above must not be reordered with the read below (see 'WaitForWork')
+            if (Volatile.Read(ref s.Flags[PARKED]) != 0) {
+                lock (s.SyncRoot) {
+                    Monitor.Pulse(s.SyncRoot);
+                }
+            }
+        }
+
+        static void WorkerLoop(object o) {
+            Slot s = (Slot)o;
+            int gen = 0;
+            while (true) {
+                gen = WaitForWork(s, gen);
+                Execute(s.Rank);
+                Volatile.Write(ref s.Flags[DONE], gen);
+            }
+        }
+
+        /// <summary>
+        /// spin-then-park; if there are more threads than CPUs, spinning would only steal time from the working threads.
+        /// </summary>
+        static int WaitForWork(Slot s, int lastGen) {
+            int gen;
+            long t0 = Stopwatch.GetTimestamp();
+            for (int i = 0; !m_Oversubscribed; i++) {
+                gen = Volatile.Read(ref s.Flags[GEN]);
+                if (gen != lastGen)
+                    return gen;
+
+                if ((i & 0x3f) == 0x3f) {
+                    if (Stopwatch.GetTimestamp() - t0 > SpinTicks)
+                        break;
+                    Thread.Yield();
+                } else {
+                    Thread.SpinWait(20);
+                }
+            }
+
+            lock (s.SyncRoot) {
+                Interlocked.Exchange(ref s.Flags[PARKED], 1);
+                while ((gen = Volatile.Read(ref s.Flags[GEN])) == lastGen)
+                    Monitor.Wait(s.SyncRoot);
+                Volatile.Write(ref s.Flags[PARKED], 0);
+            }
+            return gen;
+        }
+
+        /// <summary>
+        /// thrown by <see cref="Barrier"/> if another thread of the region failed
+        /// </summary>
+        sealed class RegionAbortedException : Exception {
+            public RegionAbortedException() : base("parallel region aborted, since another thread throwed an exception.") { }
+        }
+
+        /// <summary>
+        /// sense-reversing barrier over all threads of the current region
+        /// </summary>
+        public static void Barrier() {
+            if (t_Size <= 1)
+                return;
+
+            int sense = 1 - t_BarrierSense;
+            t_BarrierSense = sense;
+            if (Interlocked.Decrement(ref m_BarrierCount) == 0) {
+                m_BarrierCount = t_Size;
+                Volatile.Write(ref m_BarrierSense, sense);
+            } else {
+                SpinWait sw = new SpinWait();
+                while (Volatile.Read(ref m_BarrierSense) != sense) {
+                    if (Volatile.Read(ref m_Aborted) != 0)
+                        throw new RegionAbortedException();
+                    if (sw.NextSpinWillYield)
+                        Thread.Yield();
+                    else
+                        sw.SpinOnce();
+                }
+            }
+        }
+
+        #region thread pinning
+
+        [DllImport("libc", SetLastError = true)]
+        static extern int sched_setaffinity(int pid, IntPtr cpusetsize, ulong[] mask);
+
+        [DllImport("libc", SetLastError = true)]
+        static extern int sched_getaffinity(int pid, IntPtr cpusetsize, ulong[] mask);
+
+        [DllImport("kernel32.dll")]
+        static extern IntPtr GetCurrentThread();
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        static extern UIntPtr SetThreadAffinityMask(IntPtr hThread, UIntPtr dwThreadAffinityMask);
+
+        [DllImport("kernel32.dll")]
+        static extern IntPtr GetCurrentProcess();
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        static extern bool GetProcessAffinityMask(IntPtr hProcess, out UIntPtr lpProcessAffinityMask, out UIntPtr lpSystemAffinityMask);
+
+        /// <summary>
+        /// size of the Linux CPU set, in 64-bit words (i.e. up to 1024 CPUs)
+        /// </summary>
+        const int CPUSET_WORDS = 16;
+
+        static int[] m_CPUs;
+        static int m_CPUoffset;
+        static bool m_PinningFailed;
+
+        [ThreadStatic]
+        static int t_PinnedCPU_p1;
+
+        [ThreadStatic]
+        static ulong[] t_OrigMask;
+
+        /// <summary>
+        /// CPU the current thread is pinned to, or -1
+        /// </summary>
+        static int t_PinnedCPU {
+            get {
+                return t_PinnedCPU_p1 - 1;
+            }
+        }
+
+        static bool IsWindows {
+            get {
+                return System.Environment.OSVersion.Platform == PlatformID.Win32NT;
+            }
+        }
+
+        /// <summary>
+        /// pins the current thread to the <paramref name="rank"/>-th CPU of this process,
+        /// resp. restores the original affinity if <see cref="Paralleism.PinThreads"/> is turned off.
+        /// </summary>
+        static void Pin(int rank) {
+            if (m_PinningFailed)
+                return;
+
+            try {
+                if (!Paralleism.PinThreads) {
+                    if (t_OrigMask != null)
+                        SetAffinity(t_OrigMask);
+                    t_PinnedCPU_p1 = 0;
+                    return;
+                }
+
+                int[] CPUs = GetCPUs();
+                int cpu = CPUs[(m_CPUoffset + rank) % CPUs.Length];
+                if (cpu == t_PinnedCPU)
+                    return;
+
+                if (t_OrigMask == null)
+                    t_OrigMask = GetAffinity();
+                ulong[] mask = new ulong[CPUSET_WORDS];
+                mask[cpu / 64] = 1UL << (cpu % 64);
+                SetAffinity(mask);
+                t_PinnedCPU_p1 = cpu + 1;
+            } catch (Exception e) {
+                // e.g. an OS without any of the APIs above; run unpinned
+                if (!m_PinningFailed)
+                    Console.WriteLine("WARNING: thread pinning turned off: " + e.Message);
+                m_PinningFailed = true;
+            }
+        }
+
+        /// <summary>
+        /// restores the original affinity of the calling thread and of all worker threads,
+        /// after <see cref="Paralleism.PinThreads"/> has been turned off;
+        /// some other thread that was pinned as rank 0 of a region is restored at the beginning of its next region.
+        /// </summary>
+        public static void Unpin() {
+            if (m_PinningFailed || t_InRegion)
+                return;
+
+            Pin(0);
+
+            // an empty region: each worker restores its affinity in 'Execute'
+            Run(delegate (int rnk, int sz) { }, m_Slots.Count + 1);
+        }
+
+        /// <summary>
+        /// affinity mask of the current thread
+        /// </summary>
+        static ulong[] GetAffinity() {
+            ulong[] mask = new ulong[CPUSET_WORDS];
+            if (IsWindows) {
+                // there is no 'GetThreadAffinityMask': SetThreadAffinityMask returns the previous mask,
+                // so set the process mask (which is always allowed) and restore the previous one.
+                UIntPtr old = SetThreadAffinityMask(GetCurrentThread(), ProcessAffinityMask());
+                if (old == UIntPtr.Zero)
+                    throw new IOException("SetThreadAffinityMask failed: " + Marshal.GetLastWin32Error());
+                if (SetThreadAffinityMask(GetCurrentThread(), old) == UIntPtr.Zero)
+                    throw new IOException("SetThreadAffinityMask failed: " + Marshal.GetLastWin32Error());
+                mask[0] = old.ToUInt64();
+            } else {
+                if (sched_getaffinity(0, new IntPtr(CPUSET_WORDS * sizeof(ulong)), mask) != 0)
+                    throw new IOException("sched_getaffinity failed: " + Marshal.GetLastWin32Error());
+            }
+            return mask;
+        }
+
+        static UIntPtr ProcessAffinityMask() {
+            UIntPtr proc, sys;
+            if (!GetProcessAffinityMask(GetCurrentProcess(), out proc, out sys) || proc == UIntPtr.Zero)
+                throw new IOException("GetProcessAffinityMask failed: " + Marshal.GetLastWin32Error());
+            return proc;
+        }
+
+        static void SetAffinity(ulong[] mask) {
+            if (IsWindows) {
+                if (SetThreadAffinityMask(GetCurrentThread(), new UIntPtr(mask[0])) == UIntPtr.Zero)
+                    throw new IOException("SetThreadAffinityMask failed: " + Marshal.GetLastWin32Error());
+            } else {
+                if (sched_setaffinity(0, new IntPtr(CPUSET_WORDS * sizeof(ulong)), mask) != 0)
+                    throw new IOException("sched_setaffinity failed: " + Marshal.GetLastWin32Error());
+            }
+        }
+
+        /// <summary>
+        /// The CPUs this process may run on, ordered by NUMA domain (on Linux; on Windows, the processor numbering is NUMA-ordered anyway),
+        /// so that consecutive thread ranks end up on the same domain (compact placement).
+        /// If there are enough CPUs, the MPI processes on this node use disjoint parts of the list;
+        /// otherwise, the MPI launcher already did the binding.
+        /// </summary>
+        static int[] GetCPUs() {
+            if (m_CPUs != null)
+                return m_CPUs;
+
+            ulong[] allowed;
+            if (IsWindows) {
+                allowed = new ulong[CPUSET_WORDS];
+                allowed[0] = ProcessAffinityMask().ToUInt64();
+            } else {
+                allowed = GetAffinity();
+            }
+            List<int> NodeOrdered = new List<int>();
+            if (!IsWindows && Directory.Exists("/sys/devices/system/node")) {
+                List<int> nodes = new List<int>();
+                foreach (string d in Directory.GetDirectories("/sys/devices/system/node", "node*")) {
+                    int n;
+                    if (int.TryParse(Path.GetFileName(d).Substring(4), out n))
+                        nodes.Add(n);
+                }
+                nodes.Sort();
+                foreach (int n in nodes) {
+                    string f = "/sys/devices/system/node/node" + n + "/cpulist";
+                    if (File.Exists(f))
+                        NodeOrdered.AddRange(ParseCPUList(File.ReadAllText(f)));
+                }
+            }
+            if (NodeOrdered.Count <= 0) {
+                for (int cpu = 0; cpu < CPUSET_WORDS * 64; cpu++)
+                    NodeOrdered.Add(cpu);
+            }
+
+            List<int> CPUs = new List<int>();
+            foreach (int cpu in NodeOrdered) {
+                if (cpu < CPUSET_WORDS * 64 && (allowed[cpu / 64] & (1UL << (cpu % 64))) != 0)
+                    CPUs.Add(cpu);
+            }
+            if (CPUs.Count <= 0)
+                throw new NotSupportedException("unable to determine CPUs.");
+
+            MPIEnviroment env = ilPSP.Environment.MPIEnv;
+            m_CPUoffset = 0;
+            if (env != null && CPUs.Count >= (env.ProcessRankOnSMP + 1) * Paralleism.NumThreads)
+                m_CPUoffset = env.ProcessRankOnSMP * Paralleism.NumThreads;
+
+            m_CPUs = CPUs.ToArray();
+            return m_CPUs;
+        }
+
+        /// <summary>
+        /// parses a Linux CPU list, e.g. '0-3,8-11'
+        /// </summary>
+        static IEnumerable<int> ParseCPUList(string s) {
+            foreach (string part in s.Trim().Split(new char[] { ',' }, StringSplitOptions.RemoveEmptyEntries)) {
+                string[] ab = part.Split('-');
+                int a = int.Parse(ab[0]);
+                int b = ab.Length > 1 ? int.Parse(ab[1]) : a;
+                for (int cpu = a; cpu <= b; cpu++)
+                    yield return cpu;
+            }
+        }
+
+        #endregion
+    }
+}
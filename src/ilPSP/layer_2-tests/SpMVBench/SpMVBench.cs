@@ -0,0 +1,203 @@
+﻿/* =======================================================================
+Copyright 2017 Technische Universitaet Darmstadt, Fachgebiet fuer Stroemungsdynamik (chair of fluid dynamics)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+using System;
+using System.Diagnostics;
+using ilPSP;
+using ilPSP.LinSolvers;
+using ilPSP.LinSolvers.monkey;
+using ilPSP.LinSolvers.monkey.mtCPU;
+using ilPSP.Threading;
+using MPI.Wrappers;
+
+namespace SpMVBench {
+
+    /// <summary>
+    /// Benchmark for the local sparse matrix-vector product of <see cref="MtMatrix"/>:
+    /// compares the memory bandwidth (GB/s) of the managed CSR loop with the native (SIMD) kernels
+    /// of the Platform_Native - library for CSR, SELL-C-sigma and CCBCSR.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>SpMVBench.exe [file1 file2 ...]</c>, where the files are matrices stored by <see cref="MsrMatrix.SaveToFile"/>
+    /// (e.g. operator matrices of a BoSSS DG solver);
+    /// If no files are given, matrices with the structure of a 3D DG discretization on a Cartesian grid
+    /// (dense blocks of size 4, 10, 20, 35 and 56, i.e. polynomial degree 1 to 5, coupled with the 6 face neighbours) are generated.
+    /// The number of threads can be set by the environment variable <c>OMP_NUM_THREADS</c>,
+    /// the native instruction set can be limited by <c>BOSSS_SPMV_ISA</c> (0: scalar, 1: AVX2, 2: AVX-512).
+    /// </remarks>
+    static class SpMVBench {
+
+        static void Main(string[] args) {
+            bool dummy;
+            ilPSP.Environment.Bootstrap(new string[0], null, out dummy);
+
+            string nt = System.Environment.GetEnvironmentVariable("OMP_NUM_THREADS");
+            if (nt != null)
+                Paralleism.NumThreads = int.Parse(nt);
+
+            Console.WriteLine("threads:        " + Paralleism.NumThreads);
+            Console.WriteLine("native kernels: " + (MtMatrix.NativeKernelsAvailable ? ("yes, instruction set level " + MtMatrix.NativeInstructionSet) : "no"));
+            Console.WriteLine();
+
+            if (args.Length > 0) {
+                foreach (string file in args) {
+                    Run(file, MsrMatrix.LoadFromFile(file, csMPI.Raw._COMM.WORLD));
+                }
+            } else {
+                int[] BlockSizes = new int[] { 4, 10, 20, 35, 56 };
+                for (int p = 1; p <= BlockSizes.Length; p++) {
+                    int B = BlockSizes[p - 1];
+                    // about 1.5e7 nonzeros, i.e. 180 MB in CSR
+                    int n = (int)Math.Round(Math.Pow(1.5e7 / (7.0 * B * B), 1.0 / 3.0));
+                    Run(string.Format("DG, p = {0}, {1}^3 cells", p, n), CreateDGMatrix(n, B));
+                }
+            }
+
+            csMPI.Raw.mpiFinalize();
+        }
+
+        /// <summary>
+        /// benchmarks all formats for matrix <paramref name="M"/>
+        /// </summary>
+        static void Run(string Name, MsrMatrix M) {
+            Console.WriteLine("==========================================================================");
+            Console.WriteLine(Name + ": " + M.RowPartitioning.TotalLength + " rows, " + M.GetTotalNoOfNonZeros() + " nonzeros");
+            Console.WriteLine("==========================================================================");
+            Console.WriteLine(string.Format("{0,-22}{1,10}{2,12}{3,10}{4,12}", "kernel", "format", "time/SpMV", "GB/s", "error"));
+
+            double[] yRef = Measure("managed", M, false, MatrixType.CSR, null);
+            if (MtMatrix.NativeKernelsAvailable) {
+                Measure("native", M, true, MatrixType.CSR, yRef);
+                Measure("native", M, true, MatrixType.SELLCS, yRef);
+                Measure("native", M, true, MatrixType.CCBCSR, yRef);
+                Measure("native, auto", M, true, MatrixType.Auto, yRef);
+            }
+            Console.WriteLine();
+        }
+
+        /// <summary>
+        /// runs the SpMV repeatedly, for about one second, and prints the memory bandwidth.
+        /// </summary>
+        /// <returns>the result of the SpMV</returns>
+        static double[] Measure(string Name, MsrMatrix M, bool Native, MatrixType Format, double[] yRef) {
+            bool bkup = MtMatrix.NativeKernels;
+            MtMatrix.NativeKernels = Native;
+            MtMatrix A = new MtMatrix(M, Format);
+            MtMatrix.NativeKernels = bkup;
+
+            int L = A.ColPartition.LocalLength;
+            double[] xVals = new double[L];
+            for (int i = 0; i < L; i++)
+                xVals[i] = Math.Sin(i + A.ColPartition.i0);
+
+            MtDevice dev = new MtDevice();
+            bool shallow;
+            VectorBase x = dev.CreateVector(A.ColPartition, xVals, out shallow);
+            VectorBase y = dev.CreateVector(A.RowPartitioning);
+            VectorBase.CommVector x_comm = x.CreateCommVector(A);
+
+            x.Lock();
+            y.Lock();
+            A.Lock();
+
+            // warm-up, estimate number of runs
+            Stopwatch sw = new Stopwatch();
+            sw.Start();
+            for (int i = 0; i < 3; i++)
+                A.SpMV_Expert(1.0, x_comm, 0.0, y);
+            sw.Stop();
+            int NoOfRuns = Math.Max(5, (int)(3.0 / sw.Elapsed.TotalSeconds));
+
+            sw.Reset();
+            sw.Start();
+            for (int i = 0; i < NoOfRuns; i++)
+                A.SpMV_Expert(1.0, x_comm, 0.0, y);
+            sw.Stop();
+
+            A.Unlock();
+            y.Unlock();
+            x.Unlock();
+            x_comm.Dispose();
+
+            double[] yVals = new double[A.RowPartitioning.LocalLength];
+            y.GetValues(yVals, 0, 0, yVals.Length);
+
+            double err = 0;
+            if (yRef != null) {
+                for (int i = 0; i < yVals.Length; i++)
+                    err = Math.Max(err, Math.Abs(yVals[i] - yRef[i]));
+                err = err.MPIMax();
+            }
+
+            double tSpMV = sw.Elapsed.TotalSeconds / NoOfRuns;
+            double GBs = ((double)A.LocalSpMVTraffic) / tSpMV * 1.0e-9;
+            Console.WriteLine(string.Format("{0,-22}{1,10}{2,10:0.000}ms{3,10:0.00}{4,12:0.0e+00}",
+                Name, A.StorageFormat, tSpMV * 1000, GBs, err));
+
+            return yVals;
+        }
+
+        /// <summary>
+        /// creates a matrix with the structure of a DG discretization on an
+        /// <paramref name="n"/>x<paramref name="n"/>x<paramref name="n"/> - Cartesian grid,
+        /// i.e. dense diagonal blocks, coupled to the blocks of the face neighbours.
+        /// </summary>
+        /// <param name="n">number of cells in each direction</param>
+        /// <param name="B">number of DG modes per cell, i.e. block size</param>
+        static MsrMatrix CreateDGMatrix(int n, int B) {
+            int J = n * n * n;
+            int rank, size;
+            csMPI.Raw.Comm_Rank(csMPI.Raw._COMM.WORLD, out rank);
+            csMPI.Raw.Comm_Size(csMPI.Raw._COMM.WORLD, out size);
+            int j0 = (J * rank) / size;
+            int jE = (J * (rank + 1)) / size;
+
+            Partitioning part = new Partitioning((jE - j0) * B);
+            MsrMatrix M = new MsrMatrix(part, part, 7 * B);
+
+            Random rnd = new Random(j0);
+            int[] Neighbours = new int[7];
+            for (int j = j0; j < jE; j++) {
+                int ix = j % n, iy = (j / n) % n, iz = j / (n * n);
+
+                int NoOfNeigh = 0;
+                if (iz > 0) Neighbours[NoOfNeigh++] = j - n * n;
+                if (iy > 0) Neighbours[NoOfNeigh++] = j - n;
+                if (ix > 0) Neighbours[NoOfNeigh++] = j - 1;
+                Neighbours[NoOfNeigh++] = j;
+                if (ix < n - 1) Neighbours[NoOfNeigh++] = j + 1;
+                if (iy < n - 1) Neighbours[NoOfNeigh++] = j + n;
+                if (iz < n - 1) Neighbours[NoOfNeigh++] = j + n * n;
+
+                int[] ColIdx = new int[NoOfNeigh * B];
+                double[] Vals = new double[NoOfNeigh * B];
+                for (int ii = 0; ii < B; ii++) {
+                    int cnt = 0;
+                    for (int k = 0; k < NoOfNeigh; k++) {
+                        for (int jj = 0; jj < B; jj++) {
+                            ColIdx[cnt] = Neighbours[k] * B + jj;
+                            Vals[cnt] = (Neighbours[k] == j && ii == jj) ? 7.0 : rnd.NextDouble() - 0.5;
+                            cnt++;
+                        }
+                    }
+                    M.SetValues(j * B + ii, ColIdx, Vals);
+                }
+            }
+
+            return M;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+﻿using System;
+using System.Diagnostics;
+using System.Threading;
+using ilPSP.Threading;
+
+namespace ThreadTest {
+
+    /// <summary>
+    /// Microbenchmark for the fork/join overhead of <see cref="Paralleism"/>:
+    /// empty sections, short vector loops (as in the monkey vector operations), fused sections and
+    /// an unbalanced loop with static (<see cref="Paralleism.For"/>) vs. dynamic (<see cref="Paralleism.ForDynamic"/>) scheduling.
+    /// As a reference, the fork/join of the former implementation (a <see cref="ManualResetEvent"/> per thread and call,
+    /// work items queued on the .NET thread pool) is measured, too.
+    /// </summary>
+    static class ForkJoinBench {
+
+        public static void Run(int MaxThreads) {
+            Console.WriteLine("=================================================");
+            Console.WriteLine("Fork/join latency (microseconds per parallel section)");
+            Console.WriteLine("=================================================");
+            Console.WriteLine(string.Format("{0,8}{1,12}{2,12}{3,12}{4,12}{5,12}{6,12}{7,12}",
+                "threads", "legacy", "Run", "For 1e4", "3x For", "ForFused", "static", "dynamic"));
+
+            const int L = 10000;
+            double[] x = new double[L], y = new double[L], z = new double[L];
+            for (int i = 0; i < L; i++)
+                x[i] = i;
+
+            for (int NumThr = 1; NumThr <= MaxThreads; NumThr++) {
+                Paralleism.NumThreads = NumThr;
+
+                double tLegacy = Measure(delegate () {
+                    LegacyRun(NumThr, delegate (int rnk, int sz) { });
+                });
+                double tRun = Measure(delegate () {
+                    Paralleism.Run(delegate (int rnk, int sz) { });
+                });
+                double tFor = Measure(delegate () {
+                    Paralleism.For(0, L, delegate (int i0, int iE) {
+                        for (int i = i0; i < iE; i++)
+                            y[i] += 0.5 * x[i];
+                    });
+                });
+
+                ForParallel k1 = delegate (int i0, int iE) {
+                    for (int i = i0; i < iE; i++)
+                        y[i] += 0.5 * x[i];
+                };
+                ForParallel k2 = delegate (int i0, int iE) {
+                    for (int i = i0; i < iE; i++)
+                        z[i] = y[i] - x[i];
+                };
+                ForParallel k3 = delegate (int i0, int iE) {
+                    for (int i = i0; i < iE; i++)
+                        x[i] = 0.5 * z[i] + 0.5 * x[i];
+                };
+                double tUnfused = Measure(delegate () {
+                    Paralleism.For(0, L, k1);
+                    Paralleism.For(0, L, k2);
+                    Paralleism.For(0, L, k3);
+                });
+                double tFused = Measure(delegate () {
+                    Paralleism.ForFused(0, L, k1, k2, k3);
+                });
+
+                // unbalanced: the first eighth of the loop is 20 times more expensive, like cut cells clustered in one part of the grid
+                ForParallel Unbalanced = delegate (int i0, int iE) {
+                    for (int i = i0; i < iE; i++) {
+                        int NoOfOps = i < L / 8 ? 200 : 10;
+                        double acc = 0;
+                        for (int k = 0; k < NoOfOps; k++)
+                            acc += Math.Sqrt(k + x[i]);
+                        z[i] = acc;
+                    }
+                };
+                double tStatic = Measure(delegate () {
+                    Paralleism.For(0, L, Unbalanced);
+                });
+                double tDynamic = Measure(delegate () {
+                    Paralleism.ForDynamic(0, L, 64, Unbalanced);
+                });
+
+                Console.WriteLine(string.Format("{0,8}{1,12:0.00}{2,12:0.00}{3,12:0.00}{4,12:0.00}{5,12:0.00}{6,12:0.00}{7,12:0.00}",
+                    NumThr, tLegacy, tRun, tFor, tUnfused, tFused, tStatic, tDynamic));
+            }
+            Console.WriteLine();
+        }
+
+        /// <summary>
+        /// runs <paramref name="a"/> repeatedly, for about 0.2 seconds
+        /// </summary>
+        /// <returns>microseconds per call</returns>
+        static double Measure(Action a) {
+            for (int i = 0; i < 10; i++)
+                a();
+
+            int NoOfRuns = 16;
+            while (true) {
+                Stopwatch sw = new Stopwatch();
+                sw.Start();
+                for (int i = 0; i < NoOfRuns; i++)
+                    a();
+                sw.Stop();
+                if (sw.Elapsed.TotalSeconds > 0.2)
+                    return sw.Elapsed.TotalSeconds * 1.0e6 / NoOfRuns;
+                NoOfRuns *= 2;
+            }
+        }
+
+        /// <summary>
+        /// the fork/join of the former <see cref="Paralleism.Run"/>
+        /// </summary>
+        static void LegacyRun(int N, RunParallel operation) {
+            ManualResetEvent[] sync = new ManualResetEvent[N - 1];
+            for (int i = 0; i < N - 1; i++)
+                sync[i] = new ManualResetEvent(false);
+
+            for (int i = 1; i < N; i++) {
+                int rnk = i;
+                ThreadPool.QueueUserWorkItem(delegate (object o) {
+                    operation(rnk, N);
+                    sync[rnk - 1].Set();
+                });
+            }
+            operation(0, N);
+            if (N > 1)
+                WaitHandle.WaitAll(sync);
+        }
+    }
+}
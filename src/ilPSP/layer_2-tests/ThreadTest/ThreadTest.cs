@@ -69,6 +69,7 @@ namespace ThreadTest {
 
         static void Main(string[] args) {
             //ilPSP.Enviroment.Bootstrap(args, out dummy);
+            ForkJoinBench.Run(System.Environment.ProcessorCount);
             (new ThreadTest()).Run();
         }
 